@@ -3,53 +3,53 @@
 
 #include "math.glsl"
 
-// Lambert 漫反射
+// Lambert diffuse
 float lambert(vec3 N, vec3 L) {
     return max(dot(N, L), 0.0);
 }
 
-// Blinn-Phong 高光
+// Blinn-Phong specular
 float blinnPhong(vec3 N, vec3 L, vec3 V, float shininess) {
     vec3 H = normalize(L + V);
     float NdotH = max(dot(N, H), 0.0);
     return pow(NdotH, shininess);
 }
 
-// 衰减计算
+// attenuation
 float calcAttenuation(float distance, float constant, float linear, float quadratic) {
     return 1.0 / (constant + linear * distance + quadratic * distance * distance);
 }
 
-// 方向光
+// directional light
 vec3 calcDirectionalLight(vec3 direction, vec3 color, vec3 N, vec3 V, 
                           vec3 albedo, float shininess) {
     vec3 L = normalize(-direction);
     
-    // 漫反射
+    // diffuse
     float diff = lambert(N, L);
     vec3 diffuse = diff * color * albedo;
     
-    // 高光
+    // specular
     float spec = blinnPhong(N, L, V, shininess);
     vec3 specular = spec * color;
     
     return diffuse + specular;
 }
 
-// 点光源
+// point light
 vec3 calcPointLight(vec3 position, vec3 color, float constant, float linear, float quadratic,
                     vec3 fragPos, vec3 N, vec3 V, vec3 albedo, float shininess) {
     vec3 L = normalize(position - fragPos);
     float distance = length(position - fragPos);
     
-    // 衰减
+    // attenuation
     float attenuation = calcAttenuation(distance, constant, linear, quadratic);
     
-    // 漫反射
+    // diffuse
     float diff = lambert(N, L);
     vec3 diffuse = diff * color * albedo;
     
-    // 高光
+    // specular
     float spec = blinnPhong(N, L, V, shininess);
     vec3 specular = spec * color;
     
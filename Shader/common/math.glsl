@@ -5,7 +5,7 @@ const float PI = 3.14159265359;
 const float TWO_PI = 6.28318530718;
 const float HALF_PI = 1.57079632679;
 
-// 饱和函数
+// saturate
 float saturate(float x) 
 {
     return clamp(x, 0.0, 1.0);
@@ -16,26 +16,26 @@ vec3 saturate(vec3 v)
     return clamp(v, 0.0, 1.0);
 }
 
-// 平方
+// square
 float pow2(float x) 
 {
     return x * x;
 }
 
-// 五次方 (PBR 中常用)
+// fifth power (common in PBR)
 float pow5(float x)
  {
     float x2 = x * x;
     return x2 * x2 * x;
 }
 
-// 线性到 sRGB
+// linear to sRGB
 vec3 linearToSRGB(vec3 color)
  {
     return pow(color, vec3(1.0/2.2));
 }
 
-// sRGB 到线性
+// sRGB to linear
 vec3 sRGBToLinear(vec3 color)
  {
     return pow(color, vec3(2.2));
@@ -52,7 +52,7 @@ vec3 fresnelSchlickRoughness(float cosTheta, vec3 F0, float roughness) {
 vec3 cookTorranceBRDF(vec3 N, vec3 V, vec3 L, vec3 albedo, float metallic, float roughness) {
     vec3 H = normalize(V + L);
     
-    // 计算 F0
+    // compute F0
     vec3 F0 = vec3(0.04);
     F0 = mix(F0, albedo, metallic);
     
@@ -65,7 +65,7 @@ vec3 cookTorranceBRDF(vec3 N, vec3 V, vec3 L, vec3 albedo, float metallic, float
     float denominator = 4.0 * max(dot(N, V), 0.0) * max(dot(N, L), 0.0);
     vec3 specular = numerator / max(denominator, 0.001);
     
-    // 能量守恒
+    // energy conservation
     vec3 kS = F;
     vec3 kD = vec3(1.0) - kS;
     kD *= 1.0 - metallic;
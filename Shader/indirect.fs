@@ -0,0 +1,12 @@
+#version 430 core
+out vec4 FragColor;
+
+in vec3 Normal;
+in vec2 TexCoord;
+flat in vec4 DrawParams;
+
+void main()
+{
+	float diffuse = max(dot(normalize(Normal), normalize(vec3(0.3, 1.0, 0.5))), 0.0);
+	FragColor = vec4(DrawParams.rgb * (0.2 + 0.8 * diffuse), 1.0);
+}
@@ -0,0 +1,39 @@
+#version 430 core
+#extension GL_ARB_shader_draw_parameters : enable
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+layout (location = 2) in vec2 aTexCoord;
+// per-instance draw index appended by IndirectRenderer after the mesh layout
+layout (location = 3) in float aDrawIndex;
+
+// per-object data (IndirectRenderer::DrawData)
+struct DrawData {
+    mat4 model;
+    vec4 params;
+};
+
+layout (std430, binding = 0) readonly buffer DrawDataBuffer {
+    DrawData draws[];
+};
+
+uniform mat4 viewProjection;
+
+out vec3 Normal;
+out vec2 TexCoord;
+flat out vec4 DrawParams;
+
+void main()
+{
+#ifdef GL_ARB_shader_draw_parameters
+    // gl_BaseInstance is the index into the SSBO; gl_InstanceID does not include baseInstance
+    uint drawIndex = uint(gl_BaseInstanceARB + gl_InstanceID);
+#else
+    uint drawIndex = uint(aDrawIndex);
+#endif
+    DrawData draw = draws[drawIndex];
+
+    gl_Position = viewProjection * draw.model * vec4(aPos, 1.0);
+    Normal = mat3(draw.model) * aNormal;
+    TexCoord = aTexCoord;
+    DrawParams = draw.params;
+}
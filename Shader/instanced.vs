@@ -0,0 +1,15 @@
+#version 330 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aColor;
+// per-instance model matrix, occupies locations 2..5 (VertexBufferLayout::pushInstanceMatrix)
+layout (location = 2) in mat4 aInstanceModel;
+
+uniform mat4 viewProjection;
+
+out vec3 ourColor;
+
+void main()
+{
+	gl_Position = viewProjection * aInstanceModel * vec4(aPos, 1.0);
+	ourColor = aColor;
+}
@@ -8,7 +8,15 @@ in vec2 TexCoord;
 uniform sampler2D texture1;
 uniform sampler2D texture2;
 uniform vec4 timeColor;
+
+// material parameters, written by Material into the uniform buffer at binding 0.
+// mixValue is advanced by the main thread simulation (up/down arrow keys)
+layout(std140) uniform MaterialParams
+{
+	vec4 tint;
+	float mixValue;
+};
 void main()
 {
-	FragColor = mix(texture(texture1, TexCoord), texture(texture2, TexCoord), 0.2);
-}
\ No newline at end of file
+	FragColor = mix(texture(texture1, TexCoord), texture(texture2, TexCoord), mixValue) * tint;
+}
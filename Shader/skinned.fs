@@ -0,0 +1,20 @@
+#version 330 core
+out vec4 FragColor;
+
+in vec3 Normal;
+in vec2 TexCoord;
+
+uniform sampler2D diffuseTexture;
+
+// material parameters, written by Material into the uniform buffer at binding 0
+layout(std140) uniform MaterialParams
+{
+	vec4 tint;
+};
+
+void main()
+{
+	float diffuse = max(dot(normalize(Normal), normalize(vec3(0.3, 1.0, 0.5))), 0.0);
+	vec4 color = texture(diffuseTexture, TexCoord) * tint;
+	FragColor = vec4(color.rgb * (0.2 + 0.8 * diffuse), color.a);
+}
@@ -0,0 +1,46 @@
+#version 330 core
+#ifdef USE_STORAGE_BUFFER
+#extension GL_ARB_shader_storage_buffer_object : require
+#endif
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal;
+layout (location = 2) in vec2 aTexCoord;
+// joint indices are stored as floats (MeshImporter --skinned), at most 4 joints per vertex
+#ifdef HAS_TANGENT
+layout (location = 4) in vec4 aJoints;
+layout (location = 5) in vec4 aWeights;
+#else
+layout (location = 3) in vec4 aJoints;
+layout (location = 4) in vec4 aWeights;
+#endif
+
+// skinning palette, bound by SkinningBuffer
+#ifdef USE_STORAGE_BUFFER
+layout (std430) readonly buffer SkinningPalette {
+    mat4 palette[];
+};
+#else
+layout (std140) uniform SkinningPalette {
+    mat4 palette[256];
+};
+#endif
+
+uniform uint paletteOffset;  // return value of SkinningBuffer::bind
+uniform mat4 model;
+uniform mat4 viewProjection;
+
+out vec3 Normal;
+out vec2 TexCoord;
+
+void main()
+{
+    uvec4 joints = uvec4(aJoints) + paletteOffset;
+    mat4 skin = palette[joints.x] * aWeights.x
+              + palette[joints.y] * aWeights.y
+              + palette[joints.z] * aWeights.z
+              + palette[joints.w] * aWeights.w;
+
+    gl_Position = viewProjection * model * skin * vec4(aPos, 1.0);
+    Normal = mat3(model) * mat3(skin) * aNormal;
+    TexCoord = aTexCoord;
+}
@@ -0,0 +1,317 @@
+#include "AnimationBenchmark.h"
+#include "Benchmark.h"
+#include "AnimationCompressor.h"
+#include "AnimationFile.h"
+#include "Animator.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    const uint32_t kJointCount = 64;
+    const uint32_t kKeysPerTrack = 31;  // 1 , 30 ֡
+    const int kFrames = 10;
+
+    // ιǼ, Լ 6 
+    void buildSkeleton(Skeleton& skeleton) {
+        for (uint32_t i = 0; i < kJointCount; ++i) {
+            int32_t parent = i == 0 ? Skeleton::kNoParent : static_cast<int32_t>((i - 1) / 2);
+            float depth = std::floor(std::log2(static_cast<float>(i + 1)));
+            skeleton.addJoint("joint" + std::to_string(i), parent, glm::vec3(0.0f, 0.2f, 0.05f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f),
+                glm::vec3(1.0f), glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, -0.2f * depth, -0.05f * depth)));
+        }
+    }
+
+    AnimationClip makeClip(const std::string& name, float amplitude, uint32_t seed) {
+        AnimationClip clip(name, 1.0f);
+        for (uint32_t joint = 0; joint < kJointCount; ++joint) {
+            AnimationClip::Track& track = clip.addTrack(joint);
+            glm::vec3 axis = glm::normalize(Benchmark::randomVector(seed) - glm::vec3(0.5f));
+            float phase = Benchmark::random(seed) * 6.2831853f;
+            for (uint32_t k = 0; k < kKeysPerTrack; ++k) {
+                float time = static_cast<float>(k) / (kKeysPerTrack - 1);
+                float angle = amplitude * std::sin(phase + time * 6.2831853f);
+                track.rotationTimes.push_back(time);
+                track.rotations.push_back(glm::angleAxis(angle, axis));
+            }
+            if (joint == 0) {
+                for (uint32_t k = 0; k < kKeysPerTrack; ++k) {
+                    float time = static_cast<float>(k) / (kKeysPerTrack - 1);
+                    track.translationTimes.push_back(time);
+                    track.translations.push_back(glm::vec3(0.0f, 1.0f + 0.05f * amplitude * std::sin(time * 12.566371f), 0.0f));
+                }
+            }
+        }
+        return clip;
+    }
+
+    // ߷Ƭ: 2  60 ֡, ÿ֡ÿؽڵƽ / ת / Ŷйؼ֡.
+    // Լķ֮һĹؽڲ, ƽƺųؽⶼǳ
+    AnimationClip makeExportedClip(const Skeleton& skeleton, const std::string& name, float amplitude, uint32_t seed) {
+        const float duration = 2.0f;
+        const uint32_t keyCount = 121;
+        AnimationClip clip(name, duration);
+        const LocalPose& bindPose = skeleton.getBindPose();
+        for (uint32_t joint = 0; joint < skeleton.getJointCount(); ++joint) {
+            AnimationClip::Track& track = clip.addTrack(joint);
+            glm::vec3 axis = glm::normalize(Benchmark::randomVector(seed) - glm::vec3(0.5f));
+            float phase = Benchmark::random(seed) * 6.2831853f;
+            bool still = joint > 0 && Benchmark::random(seed) < 0.25f;
+            for (uint32_t k = 0; k < keyCount; ++k) {
+                float time = duration * k / (keyCount - 1);
+                float cycle = phase + time / duration * 6.2831853f;
+                glm::vec3 translation = bindPose.getTranslation(joint);
+                if (joint == 0) {
+                    translation.y += 0.05f * amplitude * std::sin(2.0f * cycle);
+                }
+                track.translationTimes.push_back(time);
+                track.translations.push_back(translation);
+                track.rotationTimes.push_back(time);
+                track.rotations.push_back(still ? bindPose.getRotation(joint) : glm::angleAxis(amplitude * std::sin(cycle), axis));
+                track.scaleTimes.push_back(time);
+                track.scales.push_back(bindPose.getScale(joint));
+            }
+        }
+        return clip;
+    }
+
+    // תļн. |q1 - q2| = 2 sin(theta / 4), СǶʱ acos(dot) ȷ
+    float rotationError(const glm::quat& a, const glm::quat& b) {
+        glm::quat d = glm::dot(a, b) < 0.0f ? a + b : a - b;
+        float distance = std::sqrt(glm::dot(d, d));
+        return 4.0f * std::asin(std::min(distance * 0.5f, 1.0f));
+    }
+
+    // : ؽ glm 
+    void computeScalarPalette(const Skeleton& skeleton, const LocalPose& pose, glm::mat4* modelMatrices, glm::mat4* palette) {
+        for (uint32_t i = 0; i < skeleton.getJointCount(); ++i) {
+            glm::mat4 local = glm::translate(glm::mat4(1.0f), pose.getTranslation(i)) * glm::mat4_cast(pose.getRotation(i))
+                * glm::scale(glm::mat4(1.0f), pose.getScale(i));
+            int32_t parent = skeleton.getParent(i);
+            modelMatrices[i] = parent == Skeleton::kNoParent ? local : modelMatrices[parent] * local;
+            palette[i] = modelMatrices[i] * skeleton.getInverseBindMatrix(i);
+        }
+    }
+}
+
+AnimationBenchmarkResult runAnimationBenchmark(JobSystem& jobs, uint32_t characterCount, bool print) {
+    AnimationBenchmarkResult result;
+    result.characterCount = characterCount;
+    result.jointCount = kJointCount;
+
+    Skeleton skeleton;
+    buildSkeleton(skeleton);
+    AnimationClip idle = makeClip("idle", 0.1f, 1);
+    AnimationClip walk = makeClip("walk", 0.5f, 2);
+    AnimationClip run = makeClip("run", 0.9f, 3);
+
+    BlendTree locomotion;
+    uint32_t speed = locomotion.addParameter("speed");
+    locomotion.setRoot(locomotion.addBlend1D({
+        { 0.0f, locomotion.addClip(&idle) },
+        { 1.5f, locomotion.addClip(&walk, 1.2f) },
+        { 5.0f, locomotion.addClip(&run, 1.6f) } }, speed));
+
+    std::vector<std::unique_ptr<Animator>> characters;
+    std::vector<Animator*> animators;
+    for (uint32_t i = 0; i < characterCount; ++i) {
+        characters.push_back(std::make_unique<Animator>(skeleton, locomotion));
+        characters.back()->getBlendTree().setParameter(speed, static_cast<float>(i % 60) * 0.1f);
+        characters.back()->update(static_cast<float>(i) * 0.013f);  // λ
+        animators.push_back(characters.back().get());
+    }
+
+    // ===== ɫ: glm vs SIMD =====
+    {
+        std::vector<glm::mat4> modelMatrices(kJointCount);
+        std::vector<glm::mat4> scalarPalette(kJointCount);
+        std::vector<glm::mat4> simdPalette(kJointCount);
+        for (Animator* animator : animators) {
+            computeScalarPalette(skeleton, animator->getPose(), modelMatrices.data(), scalarPalette.data());
+            skeleton.computeSkinningMatrices(animator->getPose(), modelMatrices.data(), simdPalette.data());
+            for (uint32_t j = 0; j < kJointCount; ++j) {
+                for (int c = 0; c < 4; ++c) {
+                    for (int r = 0; r < 4; ++r) {
+                        result.maxPaletteError = std::max(result.maxPaletteError, std::fabs(scalarPalette[j][c][r] - simdPalette[j][c][r]));
+                    }
+                }
+            }
+        }
+
+        Benchmark::TimePoint start = Benchmark::now();
+        for (int frame = 0; frame < kFrames; ++frame) {
+            for (Animator* animator : animators) {
+                computeScalarPalette(skeleton, animator->getPose(), modelMatrices.data(), scalarPalette.data());
+            }
+        }
+        result.scalarPaletteMs = Benchmark::millisecondsSince(start) / kFrames;
+
+        start = Benchmark::now();
+        for (int frame = 0; frame < kFrames; ++frame) {
+            for (Animator* animator : animators) {
+                skeleton.computeSkinningMatrices(animator->getPose(), modelMatrices.data(), simdPalette.data());
+            }
+        }
+        result.simdPaletteMs = Benchmark::millisecondsSince(start) / kFrames;
+    }
+
+    // ===== : ߳ vs  =====
+    {
+        const float deltaTime = 1.0f / 60.0f;
+        Benchmark::TimePoint start = Benchmark::now();
+        for (int frame = 0; frame < kFrames; ++frame) {
+            for (Animator* animator : animators) {
+                animator->update(deltaTime);
+            }
+        }
+        result.singleThreadUpdateMs = Benchmark::millisecondsSince(start) / kFrames;
+
+        start = Benchmark::now();
+        for (int frame = 0; frame < kFrames; ++frame) {
+            Animator::updateAll(jobs, animators.data(), animators.size(), deltaTime);
+        }
+        result.parallelUpdateMs = Benchmark::millisecondsSince(start) / kFrames;
+    }
+
+    if (print) {
+        std::cout << "===== Animation benchmark (" << characterCount << " characters, " << kJointCount << " joints, "
+            << jobs.getWorkerCount() << " workers) =====" << std::endl;
+        std::cout << "palette glm:      " << result.scalarPaletteMs << " ms/frame" << std::endl;
+        std::cout << "palette SIMD:     " << result.simdPaletteMs << " ms/frame ("
+            << result.scalarPaletteMs / std::max(result.simdPaletteMs, 1e-6) << "x), max error " << result.maxPaletteError << std::endl;
+        std::cout << "update 1 thread:  " << result.singleThreadUpdateMs << " ms/frame" << std::endl;
+        std::cout << "update parallel:  " << result.parallelUpdateMs << " ms/frame ("
+            << (result.parallelUpdateMs <= 1000.0 / 60.0 ? "within" : "over") << " the 60 Hz budget)" << std::endl;
+    }
+    return result;
+}
+
+// ===== ѹ =====
+AnimationCompressionBenchmarkResult runAnimationCompressionBenchmark(const std::string& animationPath, bool print) {
+    const int kInstances = 64;
+    const float kErrorRate = 240.0f;
+    const float kPlaybackRate = 60.0f;
+
+    std::unique_ptr<AnimationFile> file;
+    Skeleton syntheticSkeleton;
+    std::vector<AnimationClip> syntheticClips;
+    const Skeleton* skeleton = &syntheticSkeleton;
+    const std::vector<AnimationClip>* clips = &syntheticClips;
+    if (animationPath.empty()) {
+        buildSkeleton(syntheticSkeleton);
+        syntheticClips.push_back(makeExportedClip(syntheticSkeleton, "idle", 0.1f, 1));
+        syntheticClips.push_back(makeExportedClip(syntheticSkeleton, "walk", 0.5f, 2));
+        syntheticClips.push_back(makeExportedClip(syntheticSkeleton, "run", 0.9f, 3));
+    }
+    else {
+        file = std::make_unique<AnimationFile>(animationPath);
+        if (file->getClips().empty()) {
+            throw std::runtime_error("ERROR::ANIMATION_BENCHMARK: " + animationPath + " has no raw clips, import it with --raw-animations");
+        }
+        skeleton = &file->getSkeleton();
+        clips = &file->getClips();
+    }
+
+    AnimationCompressionBenchmarkResult result;
+    result.clipCount = static_cast<uint32_t>(clips->size());
+    result.jointCount = skeleton->getJointCount();
+
+    Benchmark::TimePoint start = Benchmark::now();
+    std::vector<CompressedClip> compressed;
+    for (const AnimationClip& clip : *clips) {
+        compressed.push_back(AnimationCompressor::compress(clip, *skeleton));
+    }
+    result.compressMs = Benchmark::millisecondsSince(start);
+
+    const LocalPose& bindPose = skeleton->getBindPose();
+    const uint32_t jointCount = skeleton->getJointCount();
+    std::vector<glm::mat4> sourceModel(jointCount);
+    std::vector<glm::mat4> compressedModel(jointCount);
+    std::vector<glm::mat4> palette(jointCount);
+    LocalPose sourcePose = bindPose;
+    LocalPose compressedPose = bindPose;
+
+    // С
+    for (size_t c = 0; c < clips->size(); ++c) {
+        const AnimationClip& clip = (*clips)[c];
+        const CompressedClip& packed = compressed[c];
+        result.sourceKeyCount += clip.getKeyCount();
+        result.keyCount += packed.getKeyCount();
+        result.sourceSize += AnimationCompressor::getSourceSize(clip);
+        result.compressedSize += packed.getDataSize();
+
+        CompressedClip::Cursor cursor;
+        uint32_t steps = static_cast<uint32_t>(std::ceil(clip.getDuration() * kErrorRate));
+        for (uint32_t step = 0; step <= steps; ++step) {
+            float time = std::min(step / kErrorRate, clip.getDuration());
+            sourcePose = bindPose;
+            compressedPose = bindPose;
+            clip.sample(time, sourcePose);
+            packed.sample(time, cursor, compressedPose);
+            for (uint32_t j = 0; j < jointCount; ++j) {
+                result.maxTranslationError = std::max(result.maxTranslationError,
+                    glm::length(sourcePose.getTranslation(j) - compressedPose.getTranslation(j)));
+                result.maxRotationError = std::max(result.maxRotationError,
+                    rotationError(sourcePose.getRotation(j), compressedPose.getRotation(j)));
+                result.maxScaleError = std::max(result.maxScaleError, glm::length(sourcePose.getScale(j) - compressedPose.getScale(j)));
+            }
+            skeleton->computeSkinningMatrices(sourcePose, sourceModel.data(), palette.data());
+            skeleton->computeSkinningMatrices(compressedPose, compressedModel.data(), palette.data());
+            for (uint32_t j = 0; j < jointCount; ++j) {
+                result.maxPositionError = std::max(result.maxPositionError,
+                    glm::length(glm::vec3(sourceModel[j][3]) - glm::vec3(compressedModel[j][3])));
+            }
+        }
+    }
+
+    // : ʵλѭ, ߶ΪƵĿ
+    uint64_t samples = 0;
+    start = Benchmark::now();
+    for (const AnimationClip& clip : *clips) {
+        uint32_t frames = static_cast<uint32_t>(std::ceil(clip.getDuration() * kPlaybackRate));
+        for (uint32_t frame = 0; frame < frames; ++frame) {
+            for (int instance = 0; instance < kInstances; ++instance) {
+                float time = std::fmod(frame / kPlaybackRate + instance * 0.37f, clip.getDuration());
+                sourcePose = bindPose;
+                clip.sample(time, sourcePose);
+                ++samples;
+            }
+        }
+    }
+    result.sourceSamplesPerSecond = samples / std::max(Benchmark::millisecondsSince(start) * 0.001, 1e-9);
+
+    samples = 0;
+    start = Benchmark::now();
+    for (const CompressedClip& clip : compressed) {
+        std::vector<CompressedClip::Cursor> cursors(kInstances);
+        uint32_t frames = static_cast<uint32_t>(std::ceil(clip.getDuration() * kPlaybackRate));
+        for (uint32_t frame = 0; frame < frames; ++frame) {
+            for (int instance = 0; instance < kInstances; ++instance) {
+                float time = std::fmod(frame / kPlaybackRate + instance * 0.37f, clip.getDuration());
+                compressedPose = bindPose;
+                clip.sample(time, cursors[instance], compressedPose);
+                ++samples;
+            }
+        }
+    }
+    result.compressedSamplesPerSecond = samples / std::max(Benchmark::millisecondsSince(start) * 0.001, 1e-9);
+
+    if (print) {
+        std::cout << "===== Animation compression benchmark (" << result.clipCount << " clips, " << result.jointCount
+            << " joints, " << (animationPath.empty() ? std::string("synthetic") : animationPath) << ") =====" << std::endl;
+        std::cout << "size:        " << result.sourceSize << " -> " << result.compressedSize << " bytes ("
+            << static_cast<double>(result.sourceSize) / std::max<size_t>(result.compressedSize, 1) << "x)" << std::endl;
+        std::cout << "keys:        " << result.sourceKeyCount << " -> " << result.keyCount << std::endl;
+        std::cout << "compress:    " << result.compressMs << " ms" << std::endl;
+        std::cout << "max error:   translation " << result.maxTranslationError << ", rotation " << result.maxRotationError
+            << " rad, scale " << result.maxScaleError << ", model-space position " << result.maxPositionError << std::endl;
+        std::cout << "sampling:    raw " << result.sourceSamplesPerSecond << " poses/s, compressed "
+            << result.compressedSamplesPerSecond << " poses/s ("
+            << result.compressedSamplesPerSecond / std::max(result.sourceSamplesPerSecond, 1e-9) << "x)" << std::endl;
+    }
+    return result;
+}
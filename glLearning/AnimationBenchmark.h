@@ -0,0 +1,49 @@
+#ifndef ANIMATION_BENCHMARK_H
+#define ANIMATION_BENCHMARK_H
+
+#include "JobSystem.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// ʱ׼: ϳɹǼ + Ƭεһά, Ա
+//   ؽ glm  SoA + SIMD ɫ (߳)
+//    Animator::update ߳ JobSystem 
+struct AnimationBenchmarkResult {
+    uint32_t characterCount = 0;
+    uint32_t jointCount = 0;
+    double scalarPaletteMs = 0.0;     // ÿ֡нɫ, glm ؽڼֲɫ
+    double simdPaletteMs = 0.0;       // ÿ֡нɫ, Skeleton::computeSkinningMatrices
+    double singleThreadUpdateMs = 0.0;
+    double parallelUpdateMs = 0.0;    // Animator::updateAll
+    float maxPaletteError = 0.0f;     // ֵɫ
+};
+
+// л׼ӡ (main  --bench-anim ). ڴ jobs ߳ϵ
+AnimationBenchmarkResult runAnimationBenchmark(JobSystem& jobs, uint32_t characterCount = 1000, bool print = true);
+
+// ѹ׼: ԭʼ AnimationClip  AnimationCompressor ѹ CompressedClip Ա
+//   Сؼ֡, ѹʱ
+//    240 Hz Ƭε (ֲƽ / ת / , ԼģͿռؽλ)
+//   64 ʵλѭʱĲ
+struct AnimationCompressionBenchmarkResult {
+    uint32_t clipCount = 0;
+    uint32_t jointCount = 0;
+    size_t sourceKeyCount = 0;
+    size_t keyCount = 0;
+    size_t sourceSize = 0;            // AnimationCompressor::getSourceSize
+    size_t compressedSize = 0;        // CompressedClip::getDataSize
+    double compressMs = 0.0;
+    float maxTranslationError = 0.0f;
+    float maxRotationError = 0.0f;    // 
+    float maxScaleError = 0.0f;
+    float maxPositionError = 0.0f;    // ģͿռؽλ
+    double sourceSamplesPerSecond = 0.0;      // ÿ
+    double compressedSamplesPerSecond = 0.0;
+};
+
+// animationPath ΪʱúϳɵƬ (뵼һÿ֡ÿؽڵƽ / ת / Ŷؼ֡).
+//  .anim  --raw-animations . @throws std::runtime_error ļȡʧܻûԭʼƬʱ׳
+AnimationCompressionBenchmarkResult runAnimationCompressionBenchmark(const std::string& animationPath = "", bool print = true);
+
+#endif // ANIMATION_BENCHMARK_H
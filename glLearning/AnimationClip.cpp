@@ -0,0 +1,87 @@
+#include "AnimationClip.h"
+#include <algorithm>
+
+namespace {
+    // ҵ time ڵĹؼ֡ [index, index + 1] ڵĲֵϵ
+    size_t findKey(const std::vector<float>& times, float time, float& factor) {
+        if (times.size() < 2 || time <= times.front()) {
+            factor = 0.0f;
+            return 0;
+        }
+        if (time >= times.back()) {
+            factor = 0.0f;
+            return times.size() - 1;
+        }
+        size_t next = std::upper_bound(times.begin(), times.end(), time) - times.begin();
+        size_t index = next - 1;
+        float span = times[next] - times[index];
+        factor = span > 0.0f ? (time - times[index]) / span : 0.0f;
+        return index;
+    }
+
+    glm::vec3 sampleVec3(const std::vector<float>& times, const std::vector<glm::vec3>& values, float time) {
+        float factor;
+        size_t index = findKey(times, time, factor);
+        if (factor == 0.0f) {
+            return values[index];
+        }
+        return glm::mix(values[index], values[index + 1], factor);
+    }
+
+    glm::quat sampleQuat(const std::vector<float>& times, const std::vector<glm::quat>& values, float time) {
+        float factor;
+        size_t index = findKey(times, time, factor);
+        if (factor == 0.0f) {
+            return values[index];
+        }
+        glm::quat a = values[index];
+        glm::quat b = values[index + 1];
+        if (glm::dot(a, b) < 0.0f) {
+            b = -b;
+        }
+        return glm::normalize(a * (1.0f - factor) + b * factor);
+    }
+}
+
+AnimationClip::AnimationClip(const std::string& name, float duration)
+    : m_name(name), m_duration(duration) {
+}
+
+AnimationClip::Track& AnimationClip::addTrack(uint32_t joint) {
+    m_tracks.emplace_back();
+    m_tracks.back().joint = joint;
+    return m_tracks.back();
+}
+
+size_t AnimationClip::getKeyCount() const {
+    size_t count = 0;
+    for (const Track& track : m_tracks) {
+        count += track.translations.size() + track.rotations.size() + track.scales.size();
+    }
+    return count;
+}
+
+void AnimationClip::sample(float time, LocalPose& pose) const {
+    time = std::min(std::max(time, 0.0f), m_duration);
+    for (const Track& track : m_tracks) {
+        if (track.joint >= pose.getJointCount()) {
+            continue;
+        }
+        glm::vec3 translation = track.translations.empty() ? pose.getTranslation(track.joint)
+            : sampleVec3(track.translationTimes, track.translations, time);
+        glm::quat rotation = track.rotations.empty() ? pose.getRotation(track.joint)
+            : sampleQuat(track.rotationTimes, track.rotations, time);
+        glm::vec3 scale = track.scales.empty() ? pose.getScale(track.joint)
+            : sampleVec3(track.scaleTimes, track.scales, time);
+        pose.setJoint(track.joint, translation, rotation, scale);
+    }
+}
+
+// ===== ʹdemo =====
+// AnimationClip wave("wave", 1.0f);
+// AnimationClip::Track& track = wave.addTrack(skeleton.findJoint("rightArm"));
+// track.rotationTimes = { 0.0f, 0.5f, 1.0f };
+// track.rotations = { restRotation, raisedRotation, restRotation };
+//
+// LocalPose pose = skeleton.getBindPose();
+// wave.sample(0.25f, pose);
@@ -0,0 +1,49 @@
+#ifndef ANIMATION_CLIP_H
+#define ANIMATION_CLIP_H
+
+#include "LocalPose.h"
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// AnimationClip: һιؼ֡, ÿؽһ, ƽ / ת / Ÿйؼ֡ʱ.
+// ʱ֮֡Բֵ (ת nlerp), ûйķ pose ԭֵ.
+class AnimationClip {
+public:
+    struct Track {
+        uint32_t joint = 0;
+        std::vector<float> translationTimes;
+        std::vector<glm::vec3> translations;
+        std::vector<float> rotationTimes;
+        std::vector<glm::quat> rotations;
+        std::vector<float> scaleTimes;
+        std::vector<glm::vec3> scales;
+    };
+
+    AnimationClip(const std::string& name, float duration);
+
+    // ؼ֡ʱ, λ
+    Track& addTrack(uint32_t joint);
+
+    const std::string& getName() const { return m_name; }
+    float getDuration() const { return m_duration; }
+    const std::vector<Track>& getTracks() const { return m_tracks; }
+
+    // ÿĹؼ֡
+    size_t getKeyCount() const;
+
+    /**
+     * @brief  time , д pose йĹؽ. time  [0, duration].
+     * ͨȰ pose ΪǼܵİٲ.
+     */
+    void sample(float time, LocalPose& pose) const;
+
+private:
+    std::string m_name;
+    float m_duration;
+    std::vector<Track> m_tracks;
+};
+
+#endif // ANIMATION_CLIP_H
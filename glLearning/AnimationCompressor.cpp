@@ -0,0 +1,271 @@
+#include "AnimationCompressor.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <tuple>
+
+namespace {
+    using ChannelType = CompressedClip::ChannelType;
+
+    // һؼ֡. תΪ xyzw, ƽ / ֻǰ
+    struct Key {
+        float time = 0.0f;
+        float value[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    };
+
+    // Ĺؼ֡, time / value Ϊ (ʱֵͬ)
+    struct QuantizedKey {
+        Key decoded;
+        uint16_t time = 0;
+        uint16_t rotation[3] = { 0, 0, 0 };
+    };
+
+    struct StreamEntry {
+        float order;  // ǰһؼ֡ʱ, һؼ֡Ϊ -1
+        uint16_t channel;
+        uint32_t key;
+    };
+
+    double computeError(ChannelType type, const float* a, const float* b) {
+        if (type == ChannelType::Rotation) {
+            // λԪľ d н theta: d = 2 sin(theta / 4). СǶʱ acos(dot) ȷö
+            double same = 0.0;
+            double flipped = 0.0;
+            for (int i = 0; i < 4; ++i) {
+                same += (double(a[i]) - b[i]) * (double(a[i]) - b[i]);
+                flipped += (double(a[i]) + b[i]) * (double(a[i]) + b[i]);
+            }
+            return 4.0 * std::asin(std::min(1.0, std::sqrt(std::min(same, flipped)) * 0.5));
+        }
+        double sum = 0.0;
+        for (int i = 0; i < 3; ++i) {
+            sum += (double(a[i]) - b[i]) * (double(a[i]) - b[i]);
+        }
+        return std::sqrt(sum);
+    }
+
+    //  CompressedClip::sample Ĳֵȫͬ
+    void interpolate(ChannelType type, const Key& a, const Key& b, float time, float (&out)[4]) {
+        float span = b.time - a.time;
+        float factor = span > 0.0f ? std::min(std::max((time - a.time) / span, 0.0f), 1.0f) : 1.0f;
+        if (type == ChannelType::Rotation) {
+            const float* p = a.value;
+            const float* q = b.value;
+            float sign = p[0] * q[0] + p[1] * q[1] + p[2] * q[2] + p[3] * q[3] < 0.0f ? -factor : factor;
+            float lengthSquared = 0.0f;
+            for (int i = 0; i < 4; ++i) {
+                out[i] = p[i] * (1.0f - factor) + q[i] * sign;
+                lengthSquared += out[i] * out[i];
+            }
+            float scale = 1.0f / std::sqrt(lengthSquared);
+            for (int i = 0; i < 4; ++i) {
+                out[i] *= scale;
+            }
+        }
+        else {
+            for (int i = 0; i < 3; ++i) {
+                out[i] = a.value[i] + (b.value[i] - a.value[i]) * factor;
+            }
+            out[3] = 0.0f;
+        }
+    }
+
+    Key makeKey(float time, const glm::vec3& value) {
+        Key key;
+        key.time = time;
+        key.value[0] = value.x;
+        key.value[1] = value.y;
+        key.value[2] = value.z;
+        return key;
+    }
+
+    Key makeKey(float time, const glm::quat& value) {
+        glm::quat rotation = glm::normalize(value);
+        Key key;
+        key.time = time;
+        key.value[0] = rotation.x;
+        key.value[1] = rotation.y;
+        key.value[2] = rotation.z;
+        key.value[3] = rotation.w;
+        return key;
+    }
+
+    template<typename T>
+    std::vector<Key> gatherKeys(const std::vector<float>& times, const std::vector<T>& values) {
+        std::vector<Key> keys;
+        keys.reserve(values.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            keys.push_back(makeKey(times[i], values[i]));
+        }
+        return keys;
+    }
+
+    QuantizedKey quantize(ChannelType type, const Key& key, float duration) {
+        QuantizedKey result;
+        result.time = CompressedClip::quantizeTime(key.time, duration);
+        result.decoded.time = CompressedClip::dequantizeTime(result.time, duration);
+        if (type == ChannelType::Rotation) {
+            CompressedClip::encodeRotation(glm::quat(key.value[3], key.value[0], key.value[1], key.value[2]), result.rotation);
+            glm::quat rotation = CompressedClip::decodeRotation(result.rotation);
+            result.decoded.value[0] = rotation.x;
+            result.decoded.value[1] = rotation.y;
+            result.decoded.value[2] = rotation.z;
+            result.decoded.value[3] = rotation.w;
+        }
+        else {
+            std::memcpy(result.decoded.value, key.value, sizeof(key.value));
+        }
+        return result;
+    }
+
+    // ȥؼ֡, رؼ֡ (һ)
+    std::vector<QuantizedKey> reduceKeys(ChannelType type, const std::vector<Key>& source, float tolerance, float duration) {
+        std::vector<QuantizedKey> quantized;
+        quantized.reserve(source.size());
+        for (const Key& key : source) {
+            quantized.push_back(quantize(type, key, duration));
+        }
+
+        // ֻͨһؼ֡
+        bool constant = true;
+        for (const Key& key : source) {
+            if (computeError(type, quantized.front().decoded.value, key.value) > tolerance) {
+                constant = false;
+                break;
+            }
+        }
+        if (constant) {
+            return { quantized.front() };
+        }
+
+        // ΪĹؼ֡, ÿԭʼؼ֡. ԭʼڹؼ֮֡ҲԲֵ,
+        // ֵԭʼؼ֡
+        auto fits = [&](size_t first, size_t last) {
+            float value[4];
+            for (size_t k = first + 1; k < last; ++k) {
+                interpolate(type, quantized[first].decoded, quantized[last].decoded, source[k].time, value);
+                if (computeError(type, value, source[k].value) > tolerance) {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        std::vector<QuantizedKey> kept = { quantized.front() };
+        size_t first = 0;
+        while (first + 1 < quantized.size()) {
+            size_t last = first + 1;
+            while (last + 1 < quantized.size() && fits(first, last + 1)) {
+                ++last;
+            }
+            kept.push_back(quantized[last]);
+            first = last;
+        }
+        return kept;
+    }
+
+    template<typename T>
+    void appendBytes(std::vector<uint8_t>& stream, const T* values, size_t count) {
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(values);
+        stream.insert(stream.end(), bytes, bytes + count * sizeof(T));
+    }
+}
+
+// ===== ѹ =====
+CompressedClip AnimationCompressor::compress(const AnimationClip& clip, const Skeleton& skeleton) {
+    return compress(clip, skeleton, Settings());
+}
+
+CompressedClip AnimationCompressor::compress(const AnimationClip& clip, const Skeleton& skeleton, const Settings& settings) {
+    const LocalPose& bindPose = skeleton.getBindPose();
+    const float duration = clip.getDuration();
+    std::vector<CompressedClip::Channel> channels;
+    std::vector<std::vector<QuantizedKey>> channelKeys;
+
+    auto addChannel = [&](uint32_t joint, ChannelType type, const std::vector<Key>& source, float tolerance, const Key& bind) {
+        if (source.empty()) {
+            return;
+        }
+        std::vector<QuantizedKey> keys = reduceKeys(type, source, tolerance, duration);
+        if (keys.size() == 1) {
+            // ͬ: ǰ pose Ѿǰ, Ҫͨ
+            bool isBind = true;
+            for (const Key& key : source) {
+                if (computeError(type, bind.value, key.value) > tolerance) {
+                    isBind = false;
+                    break;
+                }
+            }
+            if (isBind) {
+                return;
+            }
+        }
+        if (channels.size() > 0xFFFF) {
+            throw std::runtime_error("ERROR::ANIMATION_COMPRESSOR: Too many channels in clip " + clip.getName());
+        }
+        channels.push_back({ static_cast<uint16_t>(joint), type, 0 });
+        channelKeys.push_back(std::move(keys));
+    };
+
+    for (const AnimationClip::Track& track : clip.getTracks()) {
+        if (track.joint >= skeleton.getJointCount()) {
+            throw std::runtime_error("ERROR::ANIMATION_COMPRESSOR: Track joint " + std::to_string(track.joint)
+                + " out of range in clip " + clip.getName());
+        }
+        if (track.translationTimes.size() != track.translations.size() || track.rotationTimes.size() != track.rotations.size()
+            || track.scaleTimes.size() != track.scales.size()) {
+            throw std::runtime_error("ERROR::ANIMATION_COMPRESSOR: Key time and value counts differ in clip " + clip.getName());
+        }
+
+        addChannel(track.joint, ChannelType::Translation, gatherKeys(track.translationTimes, track.translations),
+            settings.translationTolerance, makeKey(0.0f, bindPose.getTranslation(track.joint)));
+        addChannel(track.joint, ChannelType::Rotation, gatherKeys(track.rotationTimes, track.rotations),
+            settings.rotationTolerance, makeKey(0.0f, bindPose.getRotation(track.joint)));
+        addChannel(track.joint, ChannelType::Scale, gatherKeys(track.scaleTimes, track.scales),
+            settings.scaleTolerance, makeKey(0.0f, bindPose.getScale(track.joint)));
+    }
+
+    // ÿؼ֡ǰһؼ֡ʱ䴦; ͬһʱ䰴ٰͨؼ֡˳, ֤ͬһͨĹؼ֡γ
+    std::vector<StreamEntry> entries;
+    for (size_t c = 0; c < channelKeys.size(); ++c) {
+        for (size_t k = 0; k < channelKeys[c].size(); ++k) {
+            float order = k == 0 ? -1.0f : channelKeys[c][k - 1].decoded.time;
+            entries.push_back({ order, static_cast<uint16_t>(c), static_cast<uint32_t>(k) });
+        }
+    }
+    std::sort(entries.begin(), entries.end(), [](const StreamEntry& a, const StreamEntry& b) {
+        return std::tie(a.order, a.channel, a.key) < std::tie(b.order, b.channel, b.key);
+    });
+
+    std::vector<uint8_t> stream;
+    for (const StreamEntry& entry : entries) {
+        const QuantizedKey& key = channelKeys[entry.channel][entry.key];
+        appendBytes(stream, &entry.channel, 1);
+        appendBytes(stream, &key.time, 1);
+        if (channels[entry.channel].type == ChannelType::Rotation) {
+            appendBytes(stream, key.rotation, 3);
+        }
+        else {
+            appendBytes(stream, key.decoded.value, 3);
+        }
+    }
+    return CompressedClip(clip.getName(), duration, std::move(channels), std::move(stream));
+}
+
+size_t AnimationCompressor::getSourceSize(const AnimationClip& clip) {
+    size_t size = 0;
+    for (const AnimationClip::Track& track : clip.getTracks()) {
+        size += track.translations.size() * (sizeof(float) + sizeof(glm::vec3));
+        size += track.rotations.size() * (sizeof(float) + 4 * sizeof(float));
+        size += track.scales.size() * (sizeof(float) + sizeof(glm::vec3));
+    }
+    return size;
+}
+
+// ===== ʹdemo =====
+// AnimationFile raw("../model/character.anim");  //  --import --skinned --raw-animations 
+// AnimationCompressor::Settings settings;
+// settings.rotationTolerance = 0.0005f;          // ָȺĹؽ
+// CompressedClip walk = AnimationCompressor::compress(*raw.findClip("walk"), raw.getSkeleton(), settings);
+// std::cout << AnimationCompressor::getSourceSize(*raw.findClip("walk")) << " -> " << walk.getDataSize() << " bytes" << std::endl;
@@ -0,0 +1,37 @@
+#ifndef ANIMATION_COMPRESSOR_H
+#define ANIMATION_COMPRESSOR_H
+
+#include "AnimationClip.h"
+#include "CompressedClip.h"
+#include "Skeleton.h"
+#include <cstddef>
+
+// AnimationCompressor: ߰ AnimationClip ѹ CompressedClip.
+//   1. : ת smallest-three 48 λ, ؼ֡ʱΪ 16 λ
+//   2. ȥؼ֡: ̰ĵӳԲֵ, ֱĳԭʼؼ֡ݲ.
+//      ֵ, ݲͬʱȥ֡
+//   3. ֻʣһؼ֡ҵڰƵͨȥ (߳ÿؽڵÿؼ֡)
+// ݲǵؽڵľֲ, ز㼶»ᱻŴ, ǼܺʱʵС.
+class AnimationCompressor {
+public:
+    struct Settings {
+        float translationTolerance = 0.0005f;  // λ
+        float rotationTolerance = 0.001f;      // 
+        float scaleTolerance = 0.0005f;
+    };
+
+    /**
+     * @brief ѹ clip. skeleton ṩ, ȥ֮ͬĳͨ.
+     * @throws std::runtime_error ˹ǼвڵĹؽ, ؼ֡ʱֵĸһʱ׳
+     */
+    static CompressedClip compress(const AnimationClip& clip, const Skeleton& skeleton);
+    static CompressedClip compress(const AnimationClip& clip, const Skeleton& skeleton, const Settings& settings);
+
+    // δѹʱ (AnimationFile ) ؼ֡ʱֵֽ, ѹ
+    static size_t getSourceSize(const AnimationClip& clip);
+
+private:
+    AnimationCompressor() = delete;
+};
+
+#endif // ANIMATION_COMPRESSOR_H
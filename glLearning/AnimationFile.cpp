@@ -0,0 +1,261 @@
+#include "AnimationFile.h"
+#include "AssetFileSystem.h"
+#include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+
+static_assert(std::is_trivially_copyable<AnimationFile::Joint>::value, "Animation joint must be POD");
+static_assert(sizeof(AnimationFile::Joint) == 172, "Unexpected animation joint size");
+static_assert(sizeof(AnimationFile::CompressedClipHeader) == 76, "Unexpected compressed clip header size");
+
+namespace {
+    // ߽˳ȡ
+    class Reader {
+    public:
+        Reader(const uint8_t* data, size_t size, const std::string& path)
+            : m_data(data), m_size(size), m_path(path) {
+        }
+
+        template<typename T>
+        T read() {
+            T value;
+            readArray(&value, 1);
+            return value;
+        }
+
+        template<typename T>
+        void readArray(T* values, size_t count) {
+            size_t bytes = count * sizeof(T);
+            if (count > m_size || bytes > m_size - m_offset) {
+                throw std::runtime_error("ERROR::ANIMATION_FILE: Truncated file: " + m_path);
+            }
+            if (bytes > 0) {
+                std::memcpy(values, m_data + m_offset, bytes);
+            }
+            m_offset += bytes;
+        }
+
+        bool atEnd() const { return m_offset == m_size; }
+
+    private:
+        const uint8_t* m_data;
+        size_t m_size;
+        size_t m_offset = 0;
+        const std::string& m_path;
+    };
+
+    std::string readName(const char (&name)[AnimationFile::kMaxNameLength]) {
+        return std::string(name, strnlen(name, AnimationFile::kMaxNameLength));
+    }
+
+    void writeName(char (&destination)[AnimationFile::kMaxNameLength], const std::string& name) {
+        std::memset(destination, 0, sizeof(destination));
+        std::memcpy(destination, name.data(), std::min<size_t>(name.size(), AnimationFile::kMaxNameLength - 1));
+    }
+
+    void readValue(Reader& reader, glm::vec3& value) {
+        float v[3];
+        reader.readArray(v, 3);
+        value = glm::vec3(v[0], v[1], v[2]);
+    }
+
+    void readValue(Reader& reader, glm::quat& value) {
+        float v[4];
+        reader.readArray(v, 4);
+        value = glm::quat(v[3], v[0], v[1], v[2]);
+    }
+
+    void writeValue(std::ofstream& file, const glm::vec3& value) {
+        const float v[3] = { value.x, value.y, value.z };
+        file.write(reinterpret_cast<const char*>(v), sizeof(v));
+    }
+
+    void writeValue(std::ofstream& file, const glm::quat& value) {
+        const float v[4] = { value.x, value.y, value.z, value.w };
+        file.write(reinterpret_cast<const char*>(v), sizeof(v));
+    }
+
+    template<typename T>
+    void readKeys(Reader& reader, uint32_t count, std::vector<float>& times, std::vector<T>& values) {
+        times.resize(count);
+        values.resize(count);
+        reader.readArray(times.data(), count);
+        for (T& value : values) {
+            readValue(reader, value);
+        }
+        for (uint32_t i = 1; i < count; ++i) {
+            if (!(times[i] >= times[i - 1])) {
+                throw std::runtime_error("ERROR::ANIMATION_FILE: Key times not sorted");
+            }
+        }
+    }
+
+    template<typename T>
+    void writeKeys(std::ofstream& file, const std::vector<float>& times, const std::vector<T>& values) {
+        file.write(reinterpret_cast<const char*>(times.data()), static_cast<std::streamsize>(times.size() * sizeof(float)));
+        for (const T& value : values) {
+            writeValue(file, value);
+        }
+    }
+}
+
+// ===== ȡ =====
+AnimationFile::AnimationFile(const std::string& path) {
+    AssetData data = AssetFileSystem::getInstance().read(path);
+    Reader reader(data.data(), data.size(), path);
+
+    Header header = reader.read<Header>();
+    if (header.magic != kMagic) {
+        throw std::runtime_error("ERROR::ANIMATION_FILE: Not an animation file: " + path);
+    }
+    if (header.version != kVersion) {
+        throw std::runtime_error("ERROR::ANIMATION_FILE: Unsupported version " + std::to_string(header.version)
+            + " (expected " + std::to_string(kVersion) + "), re-import " + path);
+    }
+
+    for (uint32_t i = 0; i < header.jointCount; ++i) {
+        Joint joint = reader.read<Joint>();
+        m_skeleton.addJoint(readName(joint.name), joint.parent, glm::make_vec3(joint.translation),
+            glm::quat(joint.rotation[3], joint.rotation[0], joint.rotation[1], joint.rotation[2]),
+            glm::make_vec3(joint.scale), glm::make_mat4(joint.inverseBind));
+    }
+
+    m_clips.reserve(header.clipCount);
+    for (uint32_t c = 0; c < header.clipCount; ++c) {
+        ClipHeader clipHeader = reader.read<ClipHeader>();
+        m_clips.emplace_back(readName(clipHeader.name), clipHeader.duration);
+        AnimationClip& clip = m_clips.back();
+        for (uint32_t t = 0; t < clipHeader.trackCount; ++t) {
+            TrackHeader trackHeader = reader.read<TrackHeader>();
+            if (trackHeader.joint >= header.jointCount) {
+                throw std::runtime_error("ERROR::ANIMATION_FILE: Track joint out of range in " + path);
+            }
+            AnimationClip::Track& track = clip.addTrack(trackHeader.joint);
+            readKeys(reader, trackHeader.translationCount, track.translationTimes, track.translations);
+            readKeys(reader, trackHeader.rotationCount, track.rotationTimes, track.rotations);
+            readKeys(reader, trackHeader.scaleCount, track.scaleTimes, track.scales);
+        }
+    }
+
+    m_compressedClips.reserve(header.compressedClipCount);
+    for (uint32_t c = 0; c < header.compressedClipCount; ++c) {
+        CompressedClipHeader clipHeader = reader.read<CompressedClipHeader>();
+        std::vector<CompressedClip::Channel> channels(clipHeader.channelCount);
+        std::vector<uint8_t> stream(clipHeader.streamSize);
+        reader.readArray(channels.data(), channels.size());
+        reader.readArray(stream.data(), stream.size());
+        for (const CompressedClip::Channel& channel : channels) {
+            if (channel.joint >= header.jointCount || channel.type > CompressedClip::ChannelType::Scale) {
+                throw std::runtime_error("ERROR::ANIMATION_FILE: Invalid compressed channel in " + path);
+            }
+        }
+        m_compressedClips.emplace_back(readName(clipHeader.name), clipHeader.duration, std::move(channels), std::move(stream));
+    }
+    if (!reader.atEnd()) {
+        throw std::runtime_error("ERROR::ANIMATION_FILE: Trailing data in " + path);
+    }
+}
+
+const AnimationClip* AnimationFile::findClip(const std::string& name) const {
+    for (const AnimationClip& clip : m_clips) {
+        if (clip.getName() == name) {
+            return &clip;
+        }
+    }
+    return nullptr;
+}
+
+const CompressedClip* AnimationFile::findCompressedClip(const std::string& name) const {
+    for (const CompressedClip& clip : m_compressedClips) {
+        if (clip.getName() == name) {
+            return &clip;
+        }
+    }
+    return nullptr;
+}
+
+// ===== дļ =====
+void AnimationFile::write(const std::string& path, const Skeleton& skeleton, const std::vector<AnimationClip>& clips) {
+    write(path, skeleton, clips, std::vector<CompressedClip>());
+}
+
+void AnimationFile::write(const std::string& path, const Skeleton& skeleton, const std::vector<AnimationClip>& clips,
+    const std::vector<CompressedClip>& compressedClips) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("ERROR::ANIMATION_FILE: Failed to create " + path);
+    }
+
+    Header header = { kMagic, kVersion, skeleton.getJointCount(), static_cast<uint32_t>(clips.size()),
+        static_cast<uint32_t>(compressedClips.size()) };
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    const LocalPose& bindPose = skeleton.getBindPose();
+    for (uint32_t i = 0; i < skeleton.getJointCount(); ++i) {
+        Joint joint;
+        writeName(joint.name, skeleton.getJointName(i));
+        joint.parent = skeleton.getParent(i);
+        glm::vec3 translation = bindPose.getTranslation(i);
+        glm::quat rotation = bindPose.getRotation(i);
+        glm::vec3 scale = bindPose.getScale(i);
+        std::memcpy(joint.translation, glm::value_ptr(translation), sizeof(joint.translation));
+        joint.rotation[0] = rotation.x;
+        joint.rotation[1] = rotation.y;
+        joint.rotation[2] = rotation.z;
+        joint.rotation[3] = rotation.w;
+        std::memcpy(joint.scale, glm::value_ptr(scale), sizeof(joint.scale));
+        std::memcpy(joint.inverseBind, glm::value_ptr(skeleton.getInverseBindMatrix(i)), sizeof(joint.inverseBind));
+        file.write(reinterpret_cast<const char*>(&joint), sizeof(joint));
+    }
+
+    for (const AnimationClip& clip : clips) {
+        ClipHeader clipHeader;
+        writeName(clipHeader.name, clip.getName());
+        clipHeader.duration = clip.getDuration();
+        clipHeader.trackCount = static_cast<uint32_t>(clip.getTracks().size());
+        file.write(reinterpret_cast<const char*>(&clipHeader), sizeof(clipHeader));
+
+        for (const AnimationClip::Track& track : clip.getTracks()) {
+            if (track.translationTimes.size() != track.translations.size() || track.rotationTimes.size() != track.rotations.size()
+                || track.scaleTimes.size() != track.scales.size()) {
+                throw std::runtime_error("ERROR::ANIMATION_FILE: Key time and value counts differ in clip " + clip.getName());
+            }
+            TrackHeader trackHeader = { track.joint, static_cast<uint32_t>(track.translations.size()),
+                static_cast<uint32_t>(track.rotations.size()), static_cast<uint32_t>(track.scales.size()) };
+            file.write(reinterpret_cast<const char*>(&trackHeader), sizeof(trackHeader));
+            writeKeys(file, track.translationTimes, track.translations);
+            writeKeys(file, track.rotationTimes, track.rotations);
+            writeKeys(file, track.scaleTimes, track.scales);
+        }
+    }
+
+    for (const CompressedClip& clip : compressedClips) {
+        CompressedClipHeader clipHeader;
+        writeName(clipHeader.name, clip.getName());
+        clipHeader.duration = clip.getDuration();
+        clipHeader.channelCount = static_cast<uint32_t>(clip.getChannels().size());
+        clipHeader.streamSize = static_cast<uint32_t>(clip.getStream().size());
+        file.write(reinterpret_cast<const char*>(&clipHeader), sizeof(clipHeader));
+        file.write(reinterpret_cast<const char*>(clip.getChannels().data()),
+            static_cast<std::streamsize>(clip.getChannels().size() * sizeof(CompressedClip::Channel)));
+        file.write(reinterpret_cast<const char*>(clip.getStream().data()), static_cast<std::streamsize>(clip.getStream().size()));
+    }
+
+    if (!file) {
+        throw std::runtime_error("ERROR::ANIMATION_FILE: Failed to write " + path);
+    }
+}
+
+// ===== ʹdemo =====
+// // : glLearning.exe --import ../model/character.fbx ../model/character.mesh --skinned
+// //       ͬʱ ../model/character.anim
+// AnimationFile animations("../model/character.anim");
+// const Skeleton& skeleton = animations.getSkeleton();
+// const CompressedClip* walk = animations.findCompressedClip("walk");  // --raw-animations ʱ findClip
+//
+// BlendTree tree;
+// tree.setRoot(tree.addClip(walk));
+// Animator animator(skeleton, tree);
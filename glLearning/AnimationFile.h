@@ -0,0 +1,92 @@
+#ifndef ANIMATION_FILE_H
+#define ANIMATION_FILE_H
+
+#include "AnimationClip.h"
+#include "CompressedClip.h"
+#include "Skeleton.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// AnimationFile: .anim ļ ( MeshImporter  skinned ģʽ .mesh һ), ǼܺȫƬ.
+// Ƭοԭʼؼ֡ (AnimationClip) ѹ (CompressedClip), ʱĬѹ.
+//
+// ļ (С):
+//   Header
+//   Joint[jointCount]             ؽǰ
+//   ÿԭʼƬ: ClipHeader, Ȼ trackCount 
+//   ÿ: TrackHeader, ȻΪ
+//       float ƽʱ[translationCount], float ƽ[3 * translationCount]
+//       float תʱ[rotationCount],    float ת xyzw[4 * rotationCount]
+//       float ʱ[scaleCount],       float [3 * scaleCount]
+//   ÿѹƬ: CompressedClipHeader, CompressedClip::Channel[channelCount], ؼ֡[streamSize]
+// ǼܺƬζС, ʱ Skeleton / AnimationClip / CompressedClip, ļ.
+class AnimationFile {
+public:
+    static constexpr uint32_t kMagic = 0x4D4E4147;  // "GANM"
+    static constexpr uint32_t kVersion = 2;
+    static constexpr uint32_t kMaxNameLength = 64;
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t jointCount;
+        uint32_t clipCount;
+        uint32_t compressedClipCount;
+    };
+
+    struct Joint {
+        char name[kMaxNameLength];
+        int32_t parent;
+        float translation[3];
+        float rotation[4];       // xyzw
+        float scale[3];
+        float inverseBind[16];   // 
+    };
+
+    struct ClipHeader {
+        char name[kMaxNameLength];
+        float duration;
+        uint32_t trackCount;
+    };
+
+    struct TrackHeader {
+        uint32_t joint;
+        uint32_t translationCount;
+        uint32_t rotationCount;
+        uint32_t scaleCount;
+    };
+
+    struct CompressedClipHeader {
+        char name[kMaxNameLength];
+        float duration;
+        uint32_t channelCount;
+        uint32_t streamSize;
+    };
+
+    /**
+     * @brief ͨ AssetFileSystem ȡ.
+     * @throws std::runtime_error ļڡ汾ʱ׳
+     */
+    explicit AnimationFile(const std::string& path);
+
+    const Skeleton& getSkeleton() const { return m_skeleton; }
+    const std::vector<AnimationClip>& getClips() const { return m_clips; }
+    const std::vector<CompressedClip>& getCompressedClips() const { return m_compressedClips; }
+
+    // Ҳ nullptr. ָ AnimationFile ǰЧ
+    const AnimationClip* findClip(const std::string& name) const;
+    const CompressedClip* findCompressedClip(const std::string& name) const;
+
+    // @throws std::runtime_error дļʧʱ׳
+    static void write(const std::string& path, const Skeleton& skeleton, const std::vector<AnimationClip>& clips);
+    static void write(const std::string& path, const Skeleton& skeleton, const std::vector<AnimationClip>& clips,
+        const std::vector<CompressedClip>& compressedClips);
+
+private:
+    Skeleton m_skeleton;
+    std::vector<AnimationClip> m_clips;
+    std::vector<CompressedClip> m_compressedClips;
+};
+
+#endif // ANIMATION_FILE_H
@@ -0,0 +1,44 @@
+#include "Animator.h"
+
+namespace {
+    // ÿµĽɫ. һ 64 ؽڵĽɫԼ΢, ̫Сȿռȹ
+    const size_t kAnimatorsPerJob = 16;
+}
+
+Animator::Animator(const Skeleton& skeleton, const BlendTree& tree)
+    : m_skeleton(skeleton), m_tree(tree), m_pose(skeleton.getBindPose()),
+    m_modelMatrices(skeleton.getJointCount()), m_palette(skeleton.getJointCount()) {
+    m_skeleton.computeSkinningMatrices(m_pose, m_modelMatrices.data(), m_palette.data());
+}
+
+void Animator::update(float deltaTime) {
+    m_tree.update(deltaTime);
+    m_tree.evaluate(m_skeleton, m_pose);
+    m_skeleton.computeSkinningMatrices(m_pose, m_modelMatrices.data(), m_palette.data());
+}
+
+void Animator::updateAll(JobSystem& jobs, Animator* const* animators, size_t count, float deltaTime) {
+    jobs.parallelFor(count, kAnimatorsPerJob, [animators, deltaTime](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            animators[i]->update(deltaTime);
+        }
+    });
+}
+
+// ===== ʹdemo =====
+// std::vector<std::unique_ptr<Animator>> characters;
+// std::vector<Animator*> animators;
+// for (int i = 0; i < 1000; ++i) {
+//     characters.push_back(std::make_unique<Animator>(skeleton, locomotion));
+//     animators.push_back(characters.back().get());
+// }
+//
+// std::vector<uint32_t> paletteOffsets(animators.size());
+//
+// // ÿ֡: ȸнɫ, ٰѵɫ彻 SkinningBuffer, һϴ
+// Animator::updateAll(jobs, animators.data(), animators.size(), deltaTime);
+// skinning.beginFrame();
+// for (size_t i = 0; i < animators.size(); ++i)
+//     paletteOffsets[i] = skinning.addPalette(animators[i]->getSkinningMatrices(), skeleton.getJointCount());
+// skinning.upload();
+// // Ƶ i ɫǰ: skinnedShader.setUInt("paletteOffset", skinning.bind(paletteOffsets[i]));
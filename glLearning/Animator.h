@@ -0,0 +1,40 @@
+#ifndef ANIMATOR_H
+#define ANIMATOR_H
+
+#include "BlendTree.h"
+#include "JobSystem.h"
+#include "LocalPose.h"
+#include "Skeleton.h"
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <vector>
+
+// Animator: һɫʱ״̬ (ʵơƤɫ).
+// update ֻԼݺֻĹǼ / Ƭ, ͬʵڶ߳ͬʱ.
+class Animator {
+public:
+    Animator(const Skeleton& skeleton, const BlendTree& tree);
+
+    BlendTree& getBlendTree() { return m_tree; }
+    const Skeleton& getSkeleton() const { return m_skeleton; }
+    const LocalPose& getPose() const { return m_pose; }
+
+    // ƽʱ, ֵ¼ɫ
+    void update(float deltaTime);
+
+    // ģͿռؽھƤɫ,  getSkeleton().getJointCount() 
+    const glm::mat4* getModelMatrices() const { return m_modelMatrices.data(); }
+    const glm::mat4* getSkinningMatrices() const { return m_palette.data(); }
+
+    //  JobSystem ϲиһɫ
+    static void updateAll(JobSystem& jobs, Animator* const* animators, size_t count, float deltaTime);
+
+private:
+    const Skeleton& m_skeleton;
+    BlendTree m_tree;
+    LocalPose m_pose;
+    std::vector<glm::mat4> m_modelMatrices;
+    std::vector<glm::mat4> m_palette;
+};
+
+#endif // ANIMATOR_H
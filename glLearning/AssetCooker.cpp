@@ -0,0 +1,462 @@
+#include "AssetCooker.h"
+#include "AnimationFile.h"
+#include "AssetPack.h"
+#include "JobSystem.h"
+#include "Shader.h"
+#include "Texture.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace {
+    std::string toLower(std::string text) {
+        std::transform(text.begin(), text.end(), text.begin(),
+            [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return text;
+    }
+
+    std::string normalize(const std::filesystem::path& path) {
+        return path.lexically_normal().generic_string();
+    }
+
+    // .obj ͨ "mtllib xxx.mtl" òʿ, ʿ仯ʱģҲҪº決
+    std::vector<std::string> findMaterialLibraries(const std::string& objPath) {
+        std::vector<std::string> libraries;
+        std::ifstream file(objPath);
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.compare(0, 7, "mtllib ") != 0) {
+                continue;
+            }
+            std::string name = line.substr(7);
+            name.erase(name.find_last_not_of(" \t\r") + 1);
+            libraries.push_back(normalize(std::filesystem::path(objPath).parent_path() / name));
+        }
+        return libraries;
+    }
+
+    std::vector<std::string> split(const std::string& line, char separator) {
+        std::vector<std::string> fields;
+        std::istringstream stream(line);
+        std::string field;
+        while (std::getline(stream, field, separator)) {
+            fields.push_back(field);
+        }
+        return fields;
+    }
+}
+
+// =====  =====
+AssetCooker::AssetCooker(JobSystem& jobs)
+    : AssetCooker(jobs, Settings()) {
+}
+
+AssetCooker::AssetCooker(JobSystem& jobs, const Settings& settings)
+    : m_jobs(jobs), m_settings(settings) {
+    if (m_settings.databasePath.empty()) {
+        m_settings.databasePath = m_settings.outputDirectory + "/cook.db";
+    }
+}
+
+void AssetCooker::addDirectory(const std::string& sourceDirectory) {
+    std::filesystem::path root = std::filesystem::path(sourceDirectory).lexically_normal();
+    if (!root.has_filename()) {
+        root = root.parent_path();  // ȥβķָ
+    }
+    std::filesystem::path outputRoot = std::filesystem::path(m_settings.outputDirectory) / root.filename();
+
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(root)) {
+        if (!entry.is_regular_file()) {
+            continue;
+        }
+        Asset asset;
+        asset.source = normalize(entry.path());
+        asset.type = classify(asset.source);
+
+        std::filesystem::path relative = entry.path().lexically_relative(root);
+        relative.replace_filename(getOutputName(relative.filename().string(), asset.type));
+        asset.output = normalize(outputRoot / relative);
+        if (asset.type == Type::Model && m_settings.modelOptions.skinned) {
+            asset.extraOutputs.push_back(normalize(MeshImporter::getAnimationPath(asset.output)));
+        }
+        m_assets.push_back(std::move(asset));
+    }
+}
+
+// ===== 決 =====
+AssetCooker::Stats AssetCooker::cook() {
+    auto start = std::chrono::steady_clock::now();
+    Stats stats;
+    stats.assets = static_cast<uint32_t>(m_assets.size());
+
+    if (!m_settings.forceRebuild) {
+        loadDatabase();
+    }
+
+    // ׶ֻڵǰ߳ stat ļ, ûļᱻȡ
+    std::vector<const Asset*> dirty;
+    for (const Asset& asset : m_assets) {
+        auto it = m_records.find(asset.source);
+        uint64_t sourceHash = 0;
+        uint64_t outputHash = 0;
+        bool upToDate = it != m_records.end()
+            && it->second.output == asset.output
+            && it->second.extraOutputs == asset.extraOutputs
+            && hashFile(asset.source, sourceHash)
+            && it->second.key == computeKey(asset, sourceHash, it->second.dependencies)
+            && hashOutputs(asset, outputHash)
+            && it->second.outputHash == outputHash;
+        if (upToDate) {
+            ++stats.upToDate;
+        }
+        else {
+            dirty.push_back(&asset);
+        }
+    }
+
+    // ڵԴ, ÿһ
+    std::vector<CookResult> results(dirty.size());
+    JobCounter counter;
+    for (size_t i = 0; i < dirty.size(); ++i) {
+        const Asset* asset = dirty[i];
+        CookResult* result = &results[i];
+        m_jobs.schedule([this, asset, result]() { cookAsset(*asset, *result); }, &counter);
+    }
+    m_jobs.wait(counter);
+
+    for (size_t i = 0; i < dirty.size(); ++i) {
+        const Asset& asset = *dirty[i];
+        CookResult& result = results[i];
+
+        Record record;
+        uint64_t sourceHash = 0;
+        if (result.success && (!hashFile(asset.source, sourceHash) || !hashOutputs(asset, record.outputHash))) {
+            result.success = false;
+            result.error = "Output or source disappeared during cook";
+        }
+        if (!result.success) {
+            std::cerr << "ERROR::ASSET_COOKER: Failed to cook '" << asset.source << "': " << result.error << std::endl;
+            m_records.erase(asset.source);
+            ++stats.failed;
+            continue;
+        }
+
+        record.output = asset.output;
+        record.extraOutputs = asset.extraOutputs;
+        record.dependencies = std::move(result.dependencies);
+        record.key = computeKey(asset, sourceHash, record.dependencies);
+        m_records[asset.source] = std::move(record);
+        ++stats.cooked;
+        std::cout << "COOK: " << asset.source << " -> " << asset.output << " (" << result.milliseconds << " ms)" << std::endl;
+    }
+
+    // ԴļѾ (ڱεԴĿ¼) ļ¼
+    std::unordered_set<std::string> sources;
+    for (const Asset& asset : m_assets) {
+        sources.insert(asset.source);
+    }
+    for (auto it = m_records.begin(); it != m_records.end();) {
+        if (sources.count(it->first)) {
+            ++it;
+        }
+        else {
+            it = m_records.erase(it);
+            ++stats.removed;
+        }
+    }
+
+    saveDatabase();
+    stats.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return stats;
+}
+
+void AssetCooker::cookAsset(const Asset& asset, CookResult& result) const {
+    auto start = std::chrono::steady_clock::now();
+    try {
+        std::filesystem::create_directories(std::filesystem::path(asset.output).parent_path());
+
+        // дʱļ滻, ;ʧܲ¿ЧĲ.
+        // .anim · .mesh ·Ƴ, ģ͵ʱļչ: foo.tmp.mesh  foo.tmp.anim
+        std::string temporary = asset.output + ".tmp";
+        if (asset.type == Type::Model) {
+            temporary = std::filesystem::path(asset.output).replace_extension(".tmp.mesh").string();
+        }
+        switch (asset.type) {
+        case Type::Texture:
+            Texture::writeCooked(temporary, Texture::decode(asset.source, m_settings.flipTextures), m_settings.flipTextures);
+            break;
+        case Type::Shader: {
+            std::string source = Shader::preprocess(asset.source, &result.dependencies);
+            std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+            file.write(source.data(), static_cast<std::streamsize>(source.size()));
+            if (!file) {
+                throw std::runtime_error("Failed to write " + temporary);
+            }
+            break;
+        }
+        case Type::Model:
+            MeshImporter::importFile(asset.source, temporary, m_settings.modelOptions);
+            if (toLower(std::filesystem::path(asset.source).extension().string()) == ".obj") {
+                result.dependencies = findMaterialLibraries(asset.source);
+            }
+            break;
+        case Type::Copy:
+            std::filesystem::copy_file(asset.source, temporary, std::filesystem::copy_options::overwrite_existing);
+            break;
+        }
+        if (asset.type == Type::Model && m_settings.modelOptions.skinned) {
+            std::filesystem::rename(MeshImporter::getAnimationPath(temporary), MeshImporter::getAnimationPath(asset.output));
+        }
+        std::filesystem::rename(temporary, asset.output);
+        result.success = true;
+    }
+    catch (const std::exception& e) {
+        result.error = e.what();
+    }
+    result.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// ===== ϣ =====
+bool AssetCooker::hashFile(const std::string& path, uint64_t& hash) {
+    std::error_code error;
+    uint64_t size = std::filesystem::file_size(path, error);
+    if (error) {
+        return false;
+    }
+    int64_t modifiedTime = static_cast<int64_t>(std::filesystem::last_write_time(path, error).time_since_epoch().count());
+    if (error) {
+        return false;
+    }
+
+    auto used = m_usedFileStates.find(path);
+    if (used != m_usedFileStates.end() && used->second.size == size && used->second.modifiedTime == modifiedTime) {
+        hash = used->second.hash;
+        return true;
+    }
+
+    auto cached = m_fileStates.find(path);
+    if (cached != m_fileStates.end() && cached->second.size == size && cached->second.modifiedTime == modifiedTime) {
+        hash = cached->second.hash;
+    }
+    else {
+        std::ifstream file(path, std::ios::binary);
+        std::vector<char> data(static_cast<size_t>(size));
+        if (!file.read(data.data(), static_cast<std::streamsize>(data.size()))) {
+            return false;
+        }
+        hash = AssetPack::hashBytes(data.data(), data.size());
+    }
+
+    FileState& state = m_usedFileStates[path];
+    state.size = size;
+    state.modifiedTime = modifiedTime;
+    state.hash = hash;
+    return true;
+}
+
+bool AssetCooker::hashOutputs(const Asset& asset, uint64_t& hash) {
+    if (!hashFile(asset.output, hash)) {
+        return false;
+    }
+    if (asset.extraOutputs.empty()) {
+        return true;
+    }
+
+    std::string text = std::to_string(hash);
+    for (const std::string& output : asset.extraOutputs) {
+        uint64_t outputHash = 0;
+        if (!hashFile(output, outputHash)) {
+            return false;
+        }
+        text += "\n" + std::to_string(outputHash);
+    }
+    hash = AssetPack::hashBytes(text.data(), text.size());
+    return true;
+}
+
+uint64_t AssetCooker::computeKey(const Asset& asset, uint64_t sourceHash, const std::vector<std::string>& dependencies) {
+    std::string text = getSettingsString(asset.type) + "\n" + std::to_string(sourceHash);
+    for (const std::string& dependency : dependencies) {
+        uint64_t hash = 0;
+        text += "\n" + dependency + "=" + (hashFile(dependency, hash) ? std::to_string(hash) : "missing");
+    }
+    return AssetPack::hashBytes(text.data(), text.size());
+}
+
+std::string AssetCooker::getSettingsString(Type type) const {
+    // 決ʽ仯ʱİ汾, жӦԴº決
+    switch (type) {
+    case Type::Texture:
+        return "texture v" + std::to_string(Texture::kCookedVersion) + " flip=" + std::to_string(m_settings.flipTextures);
+    case Type::Shader:
+        return "shader v1";
+    case Type::Model: {
+        const MeshImporter::Options& options = m_settings.modelOptions;
+        std::ostringstream text;
+        text << "model v" << MeshFile::kVersion
+            << " flipUVs=" << options.flipUVs
+            << " tangents=" << options.generateTangents
+            << " optimize=" << options.optimize
+            << " skinned=" << options.skinned;
+        // ֻӰĲ key: ƤģͲ .anim, ѹʱݲ
+        if (options.skinned) {
+            text << " anim v" << AnimationFile::kVersion << " compress=" << options.compressAnimations;
+        }
+        if (options.skinned && options.compressAnimations) {
+            // ݲ㹻λ, κθĶı key
+            text << std::setprecision(9)
+                << " translationTolerance=" << options.compression.translationTolerance
+                << " rotationTolerance=" << options.compression.rotationTolerance
+                << " scaleTolerance=" << options.compression.scaleTolerance;
+        }
+        return text.str();
+    }
+    case Type::Copy:
+        break;
+    }
+    return "copy v1";
+}
+
+AssetCooker::Type AssetCooker::classify(const std::string& path) {
+    std::string extension = toLower(std::filesystem::path(path).extension().string());
+    static const char* const kTextures[] = { ".jpg", ".jpeg", ".png", ".bmp", ".tga" };
+    static const char* const kShaders[] = { ".vs", ".fs", ".gs", ".vert", ".frag", ".geom", ".comp", ".glsl" };
+    static const char* const kModels[] = { ".obj", ".fbx", ".gltf", ".glb", ".dae", ".3ds", ".blend" };
+
+    auto contains = [&](const auto& list) {
+        return std::find(std::begin(list), std::end(list), extension) != std::end(list);
+    };
+    if (contains(kTextures)) {
+        return Type::Texture;
+    }
+    if (contains(kShaders)) {
+        return Type::Shader;
+    }
+    if (contains(kModels)) {
+        return Type::Model;
+    }
+    return Type::Copy;
+}
+
+std::string AssetCooker::getOutputName(const std::string& fileName, Type type) {
+    if (type == Type::Model) {
+        return std::filesystem::path(fileName).stem().string() + ".mesh";
+    }
+    return fileName;
+}
+
+// ===== ݿ =====
+// ıʽ, ֶ tab ָ:
+//   GLCOOKDB <汾>
+//   F <·> <С> <޸ʱ> <ݹϣ>
+//   A <Դļ> <> <key> <ϣ> <Ӳ> [Ӳ...] [...]
+void AssetCooker::loadDatabase() {
+    m_records.clear();
+    m_fileStates.clear();
+
+    std::ifstream file(m_settings.databasePath);
+    std::string line;
+    if (!file || !std::getline(file, line)) {
+        return;  // һκ決
+    }
+    if (line != "GLCOOKDB " + std::to_string(kDatabaseVersion)) {
+        std::cerr << "WARNING::ASSET_COOKER: Database version mismatch, rebuilding everything" << std::endl;
+        return;
+    }
+
+    try {
+        while (std::getline(file, line)) {
+            std::vector<std::string> fields = split(line, '\t');
+            if (fields.size() == 5 && fields[0] == "F") {
+                FileState& state = m_fileStates[fields[1]];
+                state.size = std::stoull(fields[2]);
+                state.modifiedTime = std::stoll(fields[3]);
+                state.hash = std::stoull(fields[4], nullptr, 16);
+            }
+            else if (fields.size() >= 6 && fields[0] == "A") {
+                Record& record = m_records[fields[1]];
+                record.output = fields[2];
+                record.key = std::stoull(fields[3], nullptr, 16);
+                record.outputHash = std::stoull(fields[4], nullptr, 16);
+                size_t extraCount = std::stoull(fields[5]);
+                if (fields.size() < 6 + extraCount) {
+                    throw std::runtime_error(line);
+                }
+                record.extraOutputs.assign(fields.begin() + 6, fields.begin() + 6 + extraCount);
+                record.dependencies.assign(fields.begin() + 6 + extraCount, fields.end());
+            }
+            else if (!line.empty()) {
+                throw std::runtime_error(line);
+            }
+        }
+    }
+    catch (const std::exception&) {
+        std::cerr << "WARNING::ASSET_COOKER: Corrupt database '" << m_settings.databasePath << "', rebuilding everything" << std::endl;
+        m_records.clear();
+        m_fileStates.clear();
+    }
+}
+
+void AssetCooker::saveDatabase() const {
+    std::filesystem::path path(m_settings.databasePath);
+    if (path.has_parent_path()) {
+        std::filesystem::create_directories(path.parent_path());
+    }
+
+    // ·, ȶ
+    std::vector<const std::string*> files;
+    for (const auto& state : m_usedFileStates) {
+        files.push_back(&state.first);
+    }
+    std::vector<const std::string*> sources;
+    for (const auto& record : m_records) {
+        sources.push_back(&record.first);
+    }
+    auto byName = [](const std::string* a, const std::string* b) { return *a < *b; };
+    std::sort(files.begin(), files.end(), byName);
+    std::sort(sources.begin(), sources.end(), byName);
+
+    std::string temporary = m_settings.databasePath + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::trunc);
+        file << "GLCOOKDB " << kDatabaseVersion << "\n";
+        for (const std::string* name : files) {
+            const FileState& state = m_usedFileStates.at(*name);
+            file << "F\t" << *name << "\t" << state.size << "\t" << state.modifiedTime << "\t"
+                << std::hex << state.hash << std::dec << "\n";
+        }
+        for (const std::string* name : sources) {
+            const Record& record = m_records.at(*name);
+            file << "A\t" << *name << "\t" << record.output << "\t" << std::hex << record.key << "\t"
+                << record.outputHash << std::dec << "\t" << record.extraOutputs.size();
+            for (const std::string& output : record.extraOutputs) {
+                file << "\t" << output;
+            }
+            for (const std::string& dependency : record.dependencies) {
+                file << "\t" << dependency;
+            }
+            file << "\n";
+        }
+        if (!file) {
+            throw std::runtime_error("ERROR::ASSET_COOKER: Failed to write database: " + temporary);
+        }
+    }
+    std::filesystem::rename(temporary, m_settings.databasePath);
+}
+
+// ===== ʹdemo =====
+// JobSystem jobs;
+// AssetCooker cooker(jobs);
+// cooker.addDirectory("../Shader");   // -> ../cooked/Shader/...
+// cooker.addDirectory("../texture");  // -> ../cooked/texture/...
+// AssetCooker::Stats stats = cooker.cook();  // ڶʱֻ決Ķļ
+//
+// // ֮Ѳ, ʱԴ·ø:
+// // glLearning --pack ../assets.pak ../cooked/Shader ../cooked/texture
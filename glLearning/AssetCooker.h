@@ -0,0 +1,122 @@
+#ifndef ASSET_COOKER_H
+#define ASSET_COOKER_H
+
+#include "MeshImporter.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class JobSystem;
+
+// AssetCooker: Դ決. ԴĿ¼ (texture / Shader / ģ) 決Ŀ¼, ֱ֮ --pack.
+//      Ϊ Texture::CookedHeader + ԭʼ, ļ, ʱ
+//   ɫ չ #include, ļΪ
+//   ģ    MeshImporter ת .mesh, .obj õ .mtl Ϊ; Ƥģͬʱ .anim (ڶ)
+//      ԭ
+//
+// ݿ (Ĭ <Ŀ¼>/cook.db, ıʽ) ¼ÿԴ
+//   key = hash(決汾 + 決 + Դļݹϣ + ݹϣ) Լȫݹϣ.
+// ֻ key 仯ȱʧﱻĶԴŻº決, ˱ .glsl ʱɫغ決.
+// ļݹϣ (С, ޸ʱ) , ûļֻҪһ stat, Ըһֻغ決һ.
+// Ҫ決Դ, Ϊύ JobSystem ִ.
+class AssetCooker {
+public:
+    struct Settings {
+        std::string outputDirectory = "../cooked";
+        std::string databasePath;             // Ϊʱʹ outputDirectory + "/cook.db"
+        bool flipTextures = true;             //  Texture::Parameters::flipVertically Ĭֵһ
+        MeshImporter::Options modelOptions;
+        bool forceRebuild = false;            // ݿ, ȫº決
+    };
+
+    struct Stats {
+        uint32_t assets = 0;
+        uint32_t cooked = 0;
+        uint32_t upToDate = 0;
+        uint32_t failed = 0;
+        uint32_t removed = 0;                 // Դļɾ, ݿƳļ¼
+        double milliseconds = 0.0;
+    };
+
+    explicit AssetCooker(JobSystem& jobs);
+    AssetCooker(JobSystem& jobs, const Settings& settings);
+
+    // ֹ
+    AssetCooker(const AssetCooker&) = delete;
+    AssetCooker& operator=(const AssetCooker&) = delete;
+
+    // ݹԴĿ¼, ·Ϊ Ŀ¼/Ŀ¼/· ( --pack İ·һ)
+    void addDirectory(const std::string& sourceDirectory);
+
+    /**
+     * @brief 決йڵԴݿ. Դʧֻ¼, ´Ի.
+     * @throws std::runtime_error ݿ޷дʱ׳
+     */
+    Stats cook();
+
+private:
+    static constexpr uint32_t kDatabaseVersion = 2;
+
+    enum class Type {
+        Texture,
+        Shader,
+        Model,
+        Copy,
+    };
+
+    struct Asset {
+        std::string source;
+        std::string output;
+        std::vector<std::string> extraOutputs;  // ͬʱɵ (Ƥģ͵ .anim)
+        Type type;
+    };
+
+    // ļ״̬: С޸ʱ䶼ûʱֱʹϴεݹϣ
+    struct FileState {
+        uint64_t size = 0;
+        int64_t modifiedTime = 0;
+        uint64_t hash = 0;
+    };
+
+    struct Record {
+        std::string output;
+        std::vector<std::string> extraOutputs;
+        uint64_t key = 0;
+        uint64_t outputHash = 0;   // ȫݹϣ
+        std::vector<std::string> dependencies;
+    };
+
+    struct CookResult {
+        bool success = false;
+        std::string error;
+        std::vector<std::string> dependencies;
+        double milliseconds = 0.0;
+    };
+
+    static Type classify(const std::string& path);
+    static std::string getOutputName(const std::string& fileName, Type type);
+
+    // 決Դ. ڹִ߳, ֻȡԴļд, ݿ
+    void cookAsset(const Asset& asset, CookResult& result) const;
+
+    // ļݹϣ, ļʱ false
+    bool hashFile(const std::string& path, uint64_t& hash);
+
+    // Դȫĺϲϣ, κһʱ false
+    bool hashOutputs(const Asset& asset, uint64_t& hash);
+    uint64_t computeKey(const Asset& asset, uint64_t sourceHash, const std::vector<std::string>& dependencies);
+    std::string getSettingsString(Type type) const;
+
+    void loadDatabase();
+    void saveDatabase() const;
+
+    JobSystem& m_jobs;
+    Settings m_settings;
+    std::vector<Asset> m_assets;
+    std::unordered_map<std::string, Record> m_records;       // Դļ· -> ¼
+    std::unordered_map<std::string, FileState> m_fileStates;
+    std::unordered_map<std::string, FileState> m_usedFileStates;  // õ, ʱֻдЩ
+};
+
+#endif // ASSET_COOKER_H
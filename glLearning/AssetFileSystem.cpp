@@ -0,0 +1,75 @@
+#include "AssetFileSystem.h"
+#include <filesystem>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+
+AssetFileSystem& AssetFileSystem::getInstance() {
+    static AssetFileSystem instance;
+    return instance;
+}
+
+void AssetFileSystem::mount(const std::string& packPath) {
+    auto pack = std::make_unique<AssetPack>(packPath);
+    std::cout << "ASSET_FILE_SYSTEM: Mounted '" << packPath << "' (" << pack->getEntryCount() << " entries)" << std::endl;
+
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    m_packs.push_back(std::move(pack));
+}
+
+void AssetFileSystem::unmountAll() {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    m_packs.clear();
+}
+
+AssetData AssetFileSystem::read(const std::string& path) const {
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        for (auto it = m_packs.rbegin(); it != m_packs.rend(); ++it) {
+            if (const AssetPack::Entry* entry = (*it)->find(path)) {
+                return (*it)->read(*entry);
+            }
+        }
+    }
+
+    std::error_code error;
+    if (!std::filesystem::is_regular_file(path, error)) {
+        throw std::runtime_error("ERROR::ASSET_FILE_SYSTEM: File not found: " + path);
+    }
+    auto file = std::make_shared<MappedFile>(path);
+    const uint8_t* data = file->data();
+    size_t size = file->size();
+    return AssetData::fromMapping(std::move(file), data, size);
+}
+
+std::string AssetFileSystem::readText(const std::string& path) const {
+    AssetData data = read(path);
+    return std::string(reinterpret_cast<const char*>(data.data()), data.size());
+}
+
+bool AssetFileSystem::exists(const std::string& path) const {
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        for (const auto& pack : m_packs) {
+            if (pack->find(path)) {
+                return true;
+            }
+        }
+    }
+    std::error_code error;
+    return std::filesystem::is_regular_file(path, error);
+}
+
+size_t AssetFileSystem::getPackCount() const {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    return m_packs.size();
+}
+
+// ===== ʹdemo =====
+// // ʱ, ֮ԴȡȲ
+// AssetFileSystem::getInstance().mount("../assets.pak");
+//
+// AssetData image = AssetFileSystem::getInstance().read("../texture/wall.jpg");  // δѹ: 㿽
+// stbi_load_from_memory(image.data(), static_cast<int>(image.size()), &w, &h, &c, 0);
+//
+// std::string source = AssetFileSystem::getInstance().readText("../Shader/learn.vs");
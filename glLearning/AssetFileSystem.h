@@ -0,0 +1,52 @@
+#ifndef ASSET_FILE_SYSTEM_H
+#define ASSET_FILE_SYSTEM_H
+
+#include "AssetPack.h"
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+// AssetFileSystem: Դȡͳһ ()
+// ȰصԴв, Ҳٶɢļ (ͬڴӳ), ԿʱĶɢļ
+// ֻҪڰֱЧ. Shader / Texture / MeshFile ͨȡ, ֱʹ std::ifstream.
+// ȡ̰߳ȫ, ڹ߳ϲн.
+class AssetFileSystem {
+public:
+    static AssetFileSystem& getInstance();
+
+    // ֹ͸ֵ
+    AssetFileSystem(const AssetFileSystem&) = delete;
+    void operator=(const AssetFileSystem&) = delete;
+
+    /**
+     * @brief Դ, ص.
+     * @throws std::runtime_error Чʱ׳
+     */
+    void mount(const std::string& packPath);
+
+    // жԴ. Ѿ AssetData ȻЧ (ӳȨ)
+    void unmountAll();
+
+    /**
+     * @brief ȡԴ (е·ڹĿ¼ɢļ·).
+     * @throws std::runtime_error Ҳʱ׳
+     */
+    AssetData read(const std::string& path) const;
+
+    // ȡΪַ (ɫԴ)
+    std::string readText(const std::string& path) const;
+
+    bool exists(const std::string& path) const;
+
+    size_t getPackCount() const;
+
+private:
+    AssetFileSystem() = default;
+    ~AssetFileSystem() = default;
+
+    mutable std::shared_mutex m_mutex;
+    std::vector<std::unique_ptr<AssetPack>> m_packs;
+};
+
+#endif // ASSET_FILE_SYSTEM_H
@@ -0,0 +1,425 @@
+#include "AssetPack.h"
+#include "Lz4.h"
+#include "Texture.h"
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+static_assert(sizeof(AssetPack::Header) == 48, "Unexpected pack header size");
+static_assert(sizeof(AssetPack::Entry) == 56, "Unexpected pack entry size");
+
+// ===== AssetData =====
+AssetData::AssetData(AssetData&& other) noexcept {
+    *this = std::move(other);
+}
+
+AssetData& AssetData::operator=(AssetData&& other) noexcept {
+    if (this != &other) {
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+        m_mapping = std::move(other.m_mapping);
+        m_buffer = std::move(other.m_buffer);  // ƶ vector ıԪصַ, m_data ȻЧ
+    }
+    return *this;
+}
+
+AssetData AssetData::fromMapping(std::shared_ptr<const MappedFile> mapping, const uint8_t* data, size_t size) {
+    AssetData asset;
+    asset.m_mapping = std::move(mapping);
+    asset.m_data = data;
+    asset.m_size = size;
+    return asset;
+}
+
+AssetData AssetData::fromBuffer(std::vector<uint8_t> buffer) {
+    AssetData asset;
+    asset.m_buffer = std::move(buffer);
+    asset.m_data = asset.m_buffer.data();
+    asset.m_size = asset.m_buffer.size();
+    return asset;
+}
+
+// ===== AssetPack =====
+AssetPack::AssetPack(const std::string& path)
+    : m_file(std::make_shared<MappedFile>(path)) {
+    const MappedFile& file = *m_file;
+    if (file.size() < sizeof(Header)) {
+        throw std::runtime_error("ERROR::ASSET_PACK: File too small: " + path);
+    }
+    const Header* header = reinterpret_cast<const Header*>(file.data());
+    if (header->magic != kMagic || header->version != kVersion || header->headerSize != sizeof(Header)) {
+        throw std::runtime_error("ERROR::ASSET_PACK: Not a supported pack file: " + path);
+    }
+
+    uint64_t size = file.size();
+    uint64_t indexBytes = uint64_t(header->entryCount) * sizeof(Entry);
+    if (header->fileSize != size || header->indexOffset % alignof(Entry) != 0
+        || header->indexOffset > size || indexBytes > size - header->indexOffset
+        || header->stringsOffset > size || header->stringsSize > size - header->stringsOffset) {
+        throw std::runtime_error("ERROR::ASSET_PACK: Corrupt section table in " + path);
+    }
+
+    const Entry* entries = reinterpret_cast<const Entry*>(file.data() + header->indexOffset);
+    for (uint32_t i = 0; i < header->entryCount; ++i) {
+        const Entry& entry = entries[i];
+        if (entry.offset > size || entry.storedSize > size - entry.offset
+            || uint64_t(entry.nameOffset) + entry.nameLength > header->stringsSize
+            || (entry.compression == Compression::None && entry.storedSize != entry.size)
+            || (i > 0 && entries[i - 1].pathHash >= entry.pathHash)) {
+            throw std::runtime_error("ERROR::ASSET_PACK: Corrupt entry " + std::to_string(i) + " in " + path);
+        }
+    }
+
+    m_header = header;
+    m_entries = entries;
+    m_strings = reinterpret_cast<const char*>(file.data() + header->stringsOffset);
+}
+
+const AssetPack::Entry* AssetPack::find(const std::string& path) const {
+    std::string normalized = normalizePath(path);
+    uint64_t hash = hashPath(normalized);
+
+    const Entry* end = m_entries + m_header->entryCount;
+    const Entry* entry = std::lower_bound(m_entries, end, hash,
+        [](const Entry& e, uint64_t h) { return e.pathHash < h; });
+    if (entry == end || entry->pathHash != hash) {
+        return nullptr;
+    }
+    // ϣͬٱȽ·
+    if (normalized.size() != entry->nameLength
+        || std::memcmp(normalized.data(), m_strings + entry->nameOffset, entry->nameLength) != 0) {
+        return nullptr;
+    }
+    return entry;
+}
+
+AssetData AssetPack::read(const Entry& entry) const {
+    const uint8_t* stored = m_file->data() + entry.offset;
+    if (entry.compression == Compression::None) {
+        return AssetData::fromMapping(m_file, stored, static_cast<size_t>(entry.size));
+    }
+    if (entry.compression != Compression::Lz4) {
+        throw std::runtime_error("ERROR::ASSET_PACK: Unsupported compression for " + getEntryPath(entry));
+    }
+
+    std::string error = "ERROR::ASSET_PACK: Corrupt compressed data for " + getEntryPath(entry);
+    uint64_t chunkCount = (entry.size + kChunkSize - 1) / kChunkSize;
+    uint64_t tableBytes = sizeof(uint32_t) * (chunkCount + 1);
+    if (entry.storedSize < tableBytes) {
+        throw std::runtime_error(error);
+    }
+    uint32_t storedCount;
+    std::memcpy(&storedCount, stored, sizeof(storedCount));
+    if (storedCount != chunkCount) {
+        throw std::runtime_error(error);
+    }
+
+    std::vector<uint8_t> buffer(static_cast<size_t>(entry.size));
+    uint64_t position = tableBytes;
+    for (uint64_t chunk = 0; chunk < chunkCount; ++chunk) {
+        uint32_t chunkBytes;
+        std::memcpy(&chunkBytes, stored + sizeof(uint32_t) * (chunk + 1), sizeof(chunkBytes));
+        bool raw = (chunkBytes & kStoredChunkFlag) != 0;
+        chunkBytes &= ~kStoredChunkFlag;
+
+        size_t outputOffset = static_cast<size_t>(chunk * kChunkSize);
+        size_t outputSize = static_cast<size_t>(std::min<uint64_t>(kChunkSize, entry.size - outputOffset));
+        if (chunkBytes > entry.storedSize - position) {
+            throw std::runtime_error(error);
+        }
+        if (raw) {
+            if (chunkBytes != outputSize) {
+                throw std::runtime_error(error);
+            }
+            std::memcpy(buffer.data() + outputOffset, stored + position, outputSize);
+        }
+        else if (!Lz4::decompress(stored + position, chunkBytes, buffer.data() + outputOffset, outputSize)) {
+            throw std::runtime_error(error);
+        }
+        position += chunkBytes;
+    }
+    return AssetData::fromBuffer(std::move(buffer));
+}
+
+std::string AssetPack::getEntryPath(const Entry& entry) const {
+    return std::string(m_strings + entry.nameOffset, entry.nameLength);
+}
+
+std::string AssetPack::normalizePath(const std::string& path) {
+    std::vector<std::string> parts;
+    std::string part;
+    auto flush = [&]() {
+        if (part == "..") {
+            if (!parts.empty()) {
+                parts.pop_back();
+            }
+        }
+        else if (!part.empty() && part != ".") {
+            parts.push_back(part);
+        }
+        part.clear();
+    };
+    for (char c : path) {
+        if (c == '/' || c == '\\') {
+            flush();
+        }
+        else {
+            part += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        }
+    }
+    flush();
+
+    std::string normalized;
+    for (const std::string& p : parts) {
+        if (!normalized.empty()) {
+            normalized += '/';
+        }
+        normalized += p;
+    }
+    return normalized;
+}
+
+uint64_t AssetPack::hashBytes(const void* data, size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    uint64_t hash = 1469598103934665603ull;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+    return hash;
+}
+
+// ===== AssetPackWriter =====
+AssetPackWriter::AssetPackWriter(bool compress)
+    : m_compress(compress) {
+}
+
+void AssetPackWriter::addData(const std::string& packPath, std::vector<uint8_t> data) {
+    std::string path = AssetPack::normalizePath(packPath);
+    for (File& file : m_files) {
+        if (file.path == path) {
+            file.data = std::move(data);
+            return;
+        }
+    }
+    m_files.push_back({ path, std::move(data) });
+}
+
+void AssetPackWriter::addFile(const std::string& packPath, const std::string& diskPath) {
+    std::ifstream file(diskPath, std::ios::binary | std::ios::ate);
+    if (!file) {
+        throw std::runtime_error("ERROR::ASSET_PACK: Failed to open " + diskPath);
+    }
+    std::vector<uint8_t> data(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()))) {
+        throw std::runtime_error("ERROR::ASSET_PACK: Failed to read " + diskPath);
+    }
+    addData(packPath, std::move(data));
+}
+
+void AssetPackWriter::addDirectory(const std::string& diskDirectory, const std::string& packPrefix) {
+    namespace fs = std::filesystem;
+    for (const fs::directory_entry& entry : fs::recursive_directory_iterator(diskDirectory)) {
+        if (entry.is_regular_file()) {
+            std::string relative = fs::relative(entry.path(), diskDirectory).generic_string();
+            addFile(packPrefix + "/" + relative, entry.path().string());
+        }
+    }
+}
+
+bool AssetPackWriter::shouldCompress(const File& file) {
+    // 決δѹ, ȻԴͼƬչ
+    if (file.data.size() >= sizeof(Texture::CookedHeader) &&
+        std::memcmp(file.data.data(), &Texture::kCookedMagic, sizeof(Texture::kCookedMagic)) == 0) {
+        return true;
+    }
+
+    // Ѿѹĸʽ, ԼҪ㿽ӳ
+    const std::string& path = file.path;
+    static const char* const kStoredExtensions[] = { ".mesh", ".jpg", ".jpeg", ".png", ".zip", ".pak" };
+    for (const char* extension : kStoredExtensions) {
+        size_t length = std::strlen(extension);
+        if (path.size() >= length && path.compare(path.size() - length, length, extension) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+AssetPackWriter::Stats AssetPackWriter::write(const std::string& outputPath) const {
+    Stats stats;
+
+    // ȥ: ݹϣֽͬͬļһݿ
+    struct Blob {
+        const File* source;
+        uint64_t contentHash;
+        AssetPack::Compression compression;
+        std::vector<uint8_t> stored;  // ѹ, ѹʱΪ (ֱд source->data)
+        uint64_t offset;
+    };
+    std::vector<Blob> blobs;
+    std::unordered_multimap<uint64_t, size_t> blobsByHash;
+    std::vector<size_t> fileBlob(m_files.size());
+
+    for (size_t i = 0; i < m_files.size(); ++i) {
+        const File& file = m_files[i];
+        uint64_t hash = AssetPack::hashBytes(file.data.data(), file.data.size());
+        stats.rawBytes += file.data.size();
+
+        size_t blobIndex = blobs.size();
+        auto range = blobsByHash.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (blobs[it->second].source->data == file.data) {
+                blobIndex = it->second;
+                break;
+            }
+        }
+        if (blobIndex == blobs.size()) {
+            blobs.push_back({ &file, hash, AssetPack::Compression::None, {}, 0 });
+            blobsByHash.emplace(hash, blobIndex);
+        }
+        else {
+            stats.dedupedBytes += file.data.size();
+        }
+        fileBlob[i] = blobIndex;
+    }
+
+    // ֿѹ, ʡ 10% ʱѹ
+    for (Blob& blob : blobs) {
+        const std::vector<uint8_t>& data = blob.source->data;
+        if (!m_compress || data.empty() || !shouldCompress(*blob.source)) {
+            continue;
+        }
+        size_t chunkCount = (data.size() + AssetPack::kChunkSize - 1) / AssetPack::kChunkSize;
+        std::vector<uint8_t> stored(sizeof(uint32_t) * (chunkCount + 1));
+        uint32_t count = static_cast<uint32_t>(chunkCount);
+        std::memcpy(stored.data(), &count, sizeof(count));
+
+        std::vector<uint8_t> scratch(Lz4::compressBound(AssetPack::kChunkSize));
+        for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+            size_t offset = chunk * AssetPack::kChunkSize;
+            size_t size = std::min<size_t>(AssetPack::kChunkSize, data.size() - offset);
+            size_t compressed = Lz4::compress(data.data() + offset, size, scratch.data(), scratch.size());
+
+            uint32_t chunkBytes;
+            if (compressed == 0 || compressed >= size) {
+                chunkBytes = static_cast<uint32_t>(size) | AssetPack::kStoredChunkFlag;
+                stored.insert(stored.end(), data.begin() + offset, data.begin() + offset + size);
+            }
+            else {
+                chunkBytes = static_cast<uint32_t>(compressed);
+                stored.insert(stored.end(), scratch.begin(), scratch.begin() + compressed);
+            }
+            std::memcpy(stored.data() + sizeof(uint32_t) * (chunk + 1), &chunkBytes, sizeof(chunkBytes));
+        }
+
+        if (stored.size() * 10 < data.size() * 9) {
+            blob.compression = AssetPack::Compression::Lz4;
+            blob.stored = std::move(stored);
+            ++stats.compressedBlobs;
+        }
+    }
+
+    // : ͷ, 4KB ݿ, , ַ
+    auto alignUp = [](uint64_t value, uint64_t alignment) { return (value + alignment - 1) & ~(alignment - 1); };
+    uint64_t offset = AssetPack::kDataAlignment;
+    uint64_t dataEnd = offset;
+    for (Blob& blob : blobs) {
+        uint64_t size = blob.compression == AssetPack::Compression::None ? blob.source->data.size() : blob.stored.size();
+        blob.offset = offset;
+        stats.storedBytes += size;
+        dataEnd = offset + size;
+        offset = alignUp(dataEnd, AssetPack::kDataAlignment);
+    }
+
+    std::vector<AssetPack::Entry> entries;
+    std::string strings;
+    for (size_t i = 0; i < m_files.size(); ++i) {
+        const File& file = m_files[i];
+        const Blob& blob = blobs[fileBlob[i]];
+        AssetPack::Entry entry;
+        std::memset(&entry, 0, sizeof(entry));
+        entry.pathHash = AssetPack::hashPath(file.path);
+        entry.contentHash = blob.contentHash;
+        entry.offset = blob.offset;
+        entry.storedSize = blob.compression == AssetPack::Compression::None ? file.data.size() : blob.stored.size();
+        entry.size = file.data.size();
+        entry.compression = blob.compression;
+        entry.nameOffset = static_cast<uint32_t>(strings.size());
+        entry.nameLength = static_cast<uint32_t>(file.path.size());
+        strings += file.path;
+        entries.push_back(entry);
+    }
+    std::sort(entries.begin(), entries.end(),
+        [](const AssetPack::Entry& a, const AssetPack::Entry& b) { return a.pathHash < b.pathHash; });
+    for (size_t i = 1; i < entries.size(); ++i) {
+        if (entries[i].pathHash == entries[i - 1].pathHash) {
+            throw std::runtime_error("ERROR::ASSET_PACK: Path hash collision: "
+                + strings.substr(entries[i].nameOffset, entries[i].nameLength));
+        }
+    }
+
+    AssetPack::Header header;
+    std::memset(&header, 0, sizeof(header));
+    header.magic = AssetPack::kMagic;
+    header.version = AssetPack::kVersion;
+    header.headerSize = sizeof(header);
+    header.entryCount = static_cast<uint32_t>(entries.size());
+    header.indexOffset = alignUp(dataEnd, alignof(AssetPack::Entry));
+    header.stringsOffset = header.indexOffset + entries.size() * sizeof(AssetPack::Entry);
+    header.stringsSize = strings.size();
+    header.fileSize = header.stringsOffset + strings.size();
+
+    std::ofstream file(outputPath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("ERROR::ASSET_PACK: Failed to create " + outputPath);
+    }
+    uint64_t written = 0;
+    auto writeAt = [&](uint64_t position, const void* bytes, uint64_t size) {
+        static const char zeros[AssetPack::kDataAlignment] = {};
+        while (written < position) {
+            uint64_t padding = std::min<uint64_t>(position - written, sizeof(zeros));
+            file.write(zeros, static_cast<std::streamsize>(padding));
+            written += padding;
+        }
+        file.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(size));
+        written += size;
+    };
+    writeAt(0, &header, sizeof(header));
+    for (const Blob& blob : blobs) {
+        if (blob.compression == AssetPack::Compression::None) {
+            writeAt(blob.offset, blob.source->data.data(), blob.source->data.size());
+        }
+        else {
+            writeAt(blob.offset, blob.stored.data(), blob.stored.size());
+        }
+    }
+    writeAt(header.indexOffset, entries.data(), entries.size() * sizeof(AssetPack::Entry));
+    writeAt(header.stringsOffset, strings.data(), strings.size());
+    if (!file) {
+        throw std::runtime_error("ERROR::ASSET_PACK: Failed to write " + outputPath);
+    }
+
+    stats.files = static_cast<uint32_t>(m_files.size());
+    stats.blobs = static_cast<uint32_t>(blobs.size());
+    stats.fileSize = header.fileSize;
+    return stats;
+}
+
+// ===== ʹdemo =====
+// // ߴ: glLearning.exe --pack ../assets.pak ../Shader ../texture ../model
+// AssetPackWriter writer;
+// writer.addDirectory("../Shader", "Shader");    // · "shader/learn.vs"
+// writer.addDirectory("../texture", "texture");
+// AssetPackWriter::Stats stats = writer.write("../assets.pak");
+//
+// // ʱһͨ AssetFileSystem , ҲֱӶ
+// AssetPack pack("../assets.pak");
+// if (const AssetPack::Entry* entry = pack.find("../texture/wall.jpg")) {
+//     AssetData data = pack.read(*entry);  // δѹ: ָӳ, ûп
+// }
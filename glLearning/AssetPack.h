@@ -0,0 +1,171 @@
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+#include "MappedFile.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// AssetData: һֻԴ.
+// δѹİĿɢļʱֱָڴӳ (㿽, ӳȨ);
+// ѹĿʱнѹĸ. ƶԭΪ.
+class AssetData {
+public:
+    AssetData() = default;
+
+    // ֹ, ƶ
+    AssetData(const AssetData&) = delete;
+    AssetData& operator=(const AssetData&) = delete;
+    AssetData(AssetData&& other) noexcept;
+    AssetData& operator=(AssetData&& other) noexcept;
+
+    const uint8_t* data() const { return m_data; }
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    // Ƿֱӳڴ (ûп)
+    bool isMapped() const { return m_mapping != nullptr; }
+
+    static AssetData fromMapping(std::shared_ptr<const MappedFile> mapping, const uint8_t* data, size_t size);
+    static AssetData fromBuffer(std::vector<uint8_t> buffer);
+
+private:
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+    std::shared_ptr<const MappedFile> m_mapping;
+    std::vector<uint8_t> m_buffer;
+};
+
+// AssetPack: Դ (.pak), ʱֻӳļ, ȡδѹĿûκο.
+//
+// ļ:
+//   Header
+//      ÿݿ鰴 4KB , ͬļͬһݿ
+//        Entry[entryCount], ·ϣ, ֲ
+//   ַ Ŀ· (淶,  0 β)
+// ѹݿ鰴 kChunkSize ֿѹ: uint32 ֿ, uint32 ÿС[ֿ], .
+// ֿСλʾÿûѹ (ѹ󷴶).
+class AssetPack {
+public:
+    static constexpr uint32_t kMagic = 0x4B415047;  // "GPAK"
+    static constexpr uint32_t kVersion = 1;
+    static constexpr uint64_t kDataAlignment = 4096;
+    static constexpr uint32_t kChunkSize = 64 * 1024;
+    static constexpr uint32_t kStoredChunkFlag = 0x80000000u;
+
+    enum class Compression : uint32_t {
+        None = 0,
+        Lz4 = 1,
+    };
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t headerSize;
+        uint32_t entryCount;
+        uint64_t indexOffset;
+        uint64_t stringsOffset;
+        uint64_t stringsSize;
+        uint64_t fileSize;
+    };
+
+    struct Entry {
+        uint64_t pathHash;     // hashPath(淶·)
+        uint64_t contentHash;  // ԭʼݵĹϣ, ȥ
+        uint64_t offset;       // ݿļеƫ
+        uint64_t storedSize;   // ݿС
+        uint64_t size;         // ԭʼС
+        Compression compression;
+        uint32_t nameOffset;   // ַеλ
+        uint32_t nameLength;
+        uint32_t reserved;
+    };
+
+    /**
+     * @brief ӳ䲢УԴ.
+     * @throws std::runtime_error ļЧʱ׳
+     */
+    explicit AssetPack(const std::string& path);
+
+    // ֹ
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+
+    // ·Ŀ, ·ȹ淶 ("../texture/a.jpg"  "texture\\a.jpg" ȼ). ûʱ nullptr
+    const Entry* find(const std::string& path) const;
+
+    /**
+     * @brief ȡĿ. δѹĿֱָӳ, ѹĿѹµĻ. ̰߳ȫ.
+     * @throws std::runtime_error ѹʱ׳
+     */
+    AssetData read(const Entry& entry) const;
+
+    uint32_t getEntryCount() const { return m_header->entryCount; }
+    const Entry& getEntry(uint32_t index) const { return m_entries[index]; }
+    std::string getEntryPath(const Entry& entry) const;
+    const std::string& getPath() const { return m_file->getPath(); }
+
+    /**
+     * @brief 淶·: бתΪб, ȥͷ "./"  "../" Լظķָ, תΪСд.
+     * Դʱ "../texture/a.jpg" ڹĿ¼·, б "texture/a.jpg".
+     */
+    static std::string normalizePath(const std::string& path);
+
+    // FNV-1a 64
+    static uint64_t hashBytes(const void* data, size_t size);
+    static uint64_t hashPath(const std::string& normalizedPath) { return hashBytes(normalizedPath.data(), normalizedPath.size()); }
+
+private:
+    std::shared_ptr<const MappedFile> m_file;
+    const Header* m_header = nullptr;
+    const Entry* m_entries = nullptr;
+    const char* m_strings = nullptr;
+};
+
+// AssetPackWriter: ߴ. ռļһд .pak
+class AssetPackWriter {
+public:
+    struct Stats {
+        uint32_t files = 0;
+        uint32_t blobs = 0;          // ȥغݿ
+        uint32_t compressedBlobs = 0;
+        uint64_t rawBytes = 0;       // ļԭʼС֮
+        uint64_t dedupedBytes = 0;   // ͬʡµֽ
+        uint64_t storedBytes = 0;    // ʵռ ()
+        uint64_t fileSize = 0;
+    };
+
+    // compress: Ƿ LZ4 ѹ. ѹʲ 10% ļ .mesh / .jpg / .png ʼղѹ
+    explicit AssetPackWriter(bool compress = true);
+
+    // һ, packPath ᱻ淶. ͬһ·ظʱ߸ǰ
+    void addData(const std::string& packPath, std::vector<uint8_t> data);
+
+    // Ӵϵļ. @throws std::runtime_error ȡʧʱ׳
+    void addFile(const std::string& packPath, const std::string& diskPath);
+
+    // ݹĿ¼µļ, ·Ϊ packPrefix + "/" + ·
+    void addDirectory(const std::string& diskDirectory, const std::string& packPrefix);
+
+    /**
+     * @brief дԴ.
+     * @throws std::runtime_error дļʧʱ׳
+     */
+    Stats write(const std::string& outputPath) const;
+
+private:
+    struct File {
+        std::string path;  // 淶·
+        std::vector<uint8_t> data;
+    };
+
+    // չųѹĸʽ; 決 .jpg / .png , ļͷʶ
+    static bool shouldCompress(const File& file);
+
+    std::vector<File> m_files;
+    bool m_compress;
+};
+
+#endif // ASSET_PACK_H
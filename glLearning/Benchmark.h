@@ -0,0 +1,42 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <glm/glm.hpp>
+#include <chrono>
+#include <cstdint>
+
+// Benchmark:  --bench-* ׼õļʱ
+class Benchmark {
+public:
+    using Clock = std::chrono::steady_clock;
+    using TimePoint = Clock::time_point;
+
+    static TimePoint now() { return Clock::now(); }
+
+    static double millisecondsSince(TimePoint start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    static double secondsSince(TimePoint start) {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    // [0, 1) ͬ. ̶, ÿеͬ
+    static float random(uint32_t& state) {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<float>(state >> 8) / 16777216.0f;
+    }
+
+    // ȡ random
+    static glm::vec3 randomVector(uint32_t& state) {
+        float x = random(state);
+        float y = random(state);
+        float z = random(state);
+        return glm::vec3(x, y, z);
+    }
+
+private:
+    Benchmark() = delete;
+};
+
+#endif // BENCHMARK_H
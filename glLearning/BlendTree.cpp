@@ -0,0 +1,166 @@
+#include "BlendTree.h"
+#include <cmath>
+#include <stdexcept>
+
+// =====  =====
+BlendTree::NodeIndex BlendTree::addNode(Node node) {
+    for (const auto& child : node.children) {
+        if (child.second >= m_nodes.size()) {
+            throw std::runtime_error("ERROR::BLEND_TREE: Child node added before its parent");
+        }
+    }
+    if (node.type != NodeType::Clip && node.parameter >= m_parameters.size()) {
+        throw std::runtime_error("ERROR::BLEND_TREE: Unknown parameter " + std::to_string(node.parameter));
+    }
+    m_nodes.push_back(std::move(node));
+    return static_cast<NodeIndex>(m_nodes.size() - 1);
+}
+
+BlendTree::NodeIndex BlendTree::addClip(const AnimationClip* clip, float speed, bool loop) {
+    if (!clip) {
+        throw std::runtime_error("ERROR::BLEND_TREE: Null clip");
+    }
+    Node node;
+    node.type = NodeType::Clip;
+    node.clip = clip;
+    node.speed = speed;
+    node.loop = loop;
+    return addNode(std::move(node));
+}
+
+BlendTree::NodeIndex BlendTree::addClip(const CompressedClip* clip, float speed, bool loop) {
+    if (!clip) {
+        throw std::runtime_error("ERROR::BLEND_TREE: Null clip");
+    }
+    Node node;
+    node.type = NodeType::Clip;
+    node.compressedClip = clip;
+    node.speed = speed;
+    node.loop = loop;
+    return addNode(std::move(node));
+}
+
+BlendTree::NodeIndex BlendTree::addLerp(NodeIndex a, NodeIndex b, uint32_t parameter) {
+    Node node;
+    node.type = NodeType::Lerp;
+    node.parameter = parameter;
+    node.children = { { 0.0f, a }, { 1.0f, b } };
+    return addNode(std::move(node));
+}
+
+BlendTree::NodeIndex BlendTree::addBlend1D(const std::vector<std::pair<float, NodeIndex>>& children, uint32_t parameter) {
+    if (children.empty()) {
+        throw std::runtime_error("ERROR::BLEND_TREE: Blend1D without children");
+    }
+    for (size_t i = 1; i < children.size(); ++i) {
+        if (children[i].first <= children[i - 1].first) {
+            throw std::runtime_error("ERROR::BLEND_TREE: Blend1D thresholds must be increasing");
+        }
+    }
+    Node node;
+    node.type = NodeType::Blend1D;
+    node.parameter = parameter;
+    node.children = children;
+    return addNode(std::move(node));
+}
+
+uint32_t BlendTree::addParameter(const std::string& name, float value) {
+    m_parameterNames.push_back(name);
+    m_parameters.push_back(value);
+    return static_cast<uint32_t>(m_parameters.size() - 1);
+}
+
+int32_t BlendTree::findParameter(const std::string& name) const {
+    for (size_t i = 0; i < m_parameterNames.size(); ++i) {
+        if (m_parameterNames[i] == name) {
+            return static_cast<int32_t>(i);
+        }
+    }
+    return -1;
+}
+
+// =====  =====
+void BlendTree::update(float deltaTime) {
+    for (Node& node : m_nodes) {
+        if (node.type != NodeType::Clip) {
+            continue;
+        }
+        float duration = node.clip ? node.clip->getDuration() : node.compressedClip->getDuration();
+        node.time += deltaTime * node.speed;
+        if (node.loop && duration > 0.0f) {
+            node.time = std::fmod(node.time, duration);
+            if (node.time < 0.0f) {
+                node.time += duration;
+            }
+        }
+        else {
+            node.time = std::fmin(std::fmax(node.time, 0.0f), duration);
+        }
+    }
+}
+
+void BlendTree::evaluate(const Skeleton& skeleton, LocalPose& pose) {
+    if (m_root == kInvalidNode) {
+        pose = skeleton.getBindPose();
+        return;
+    }
+    // ݹȲڵ. ȷ, ݹв ()
+    if (m_scratch.size() < m_nodes.size()) {
+        m_scratch.resize(m_nodes.size());
+    }
+    evaluateNode(skeleton, m_root, pose, 0);
+}
+
+void BlendTree::evaluateNode(const Skeleton& skeleton, NodeIndex index, LocalPose& pose, uint32_t depth) {
+    Node& node = m_nodes[index];
+    if (node.type == NodeType::Clip) {
+        pose = skeleton.getBindPose();  // ؽʱ·
+        if (node.clip) {
+            node.clip->sample(node.time, pose);
+        }
+        else {
+            node.compressedClip->sample(node.time, node.cursor, pose);
+        }
+        return;
+    }
+
+    // ҵڵӽڵ
+    const auto& children = node.children;
+    float value = m_parameters[node.parameter];
+    if (children.size() == 1 || value <= children.front().first) {
+        evaluateNode(skeleton, children.front().second, pose, depth + 1);
+        return;
+    }
+    if (value >= children.back().first) {
+        evaluateNode(skeleton, children.back().second, pose, depth + 1);
+        return;
+    }
+    size_t upper = 1;
+    while (children[upper].first < value) {
+        ++upper;
+    }
+    const auto& a = children[upper - 1];
+    const auto& b = children[upper];
+    float weight = (value - a.first) / (b.first - a.first);
+
+    LocalPose& other = m_scratch[depth];
+    evaluateNode(skeleton, a.second, pose, depth + 1);
+    evaluateNode(skeleton, b.second, other, depth + 1);
+    LocalPose::blend(pose, other, weight, pose);
+}
+
+// ===== ʹdemo =====
+// // ģ: ٶ idle / walk / run ֮, ٰ wave ϻ
+// BlendTree locomotion;
+// uint32_t speed = locomotion.addParameter("speed");
+// uint32_t wave = locomotion.addParameter("wave");
+// BlendTree::NodeIndex move = locomotion.addBlend1D({
+//     { 0.0f, locomotion.addClip(&idleClip) },
+//     { 1.5f, locomotion.addClip(&walkClip) },
+//     { 5.0f, locomotion.addClip(&runClip) } }, speed);
+// locomotion.setRoot(locomotion.addLerp(move, locomotion.addClip(&waveClip), wave));
+//
+// BlendTree tree = locomotion;  // ÿɫһ
+// tree.setParameter(speed, 2.0f);
+// tree.update(deltaTime);
+// tree.evaluate(skeleton, pose);
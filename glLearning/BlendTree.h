@@ -0,0 +1,73 @@
+#ifndef BLEND_TREE_H
+#define BLEND_TREE_H
+
+#include "AnimationClip.h"
+#include "CompressedClip.h"
+#include "LocalPose.h"
+#include "Skeleton.h"
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// BlendTree: . ҶƬ, ڲڵ㰴ӽڵ:
+//   Clip     һ AnimationClip  CompressedClip (άʱͶ Cursor)
+//   Lerp      [0, 1] ӽڵ֮
+//   Blend1D  ӽڵ㰴ֵ, ֵ֮ͻ (簴ٶȻ idle / walk / run)
+// ¼״̬, ÿɫһ: һģֱӿ, Ƭαǹֻ.
+// ȨΪ 0  1 ķ֧ᱻֵ.
+class BlendTree {
+public:
+    using NodeIndex = uint32_t;
+    static constexpr NodeIndex kInvalidNode = 0xFFFFFFFFu;
+
+    NodeIndex addClip(const AnimationClip* clip, float speed = 1.0f, bool loop = true);
+    NodeIndex addClip(const CompressedClip* clip, float speed = 1.0f, bool loop = true);
+    NodeIndex addLerp(NodeIndex a, NodeIndex b, uint32_t parameter);
+
+    // children: (ֵ, ӽڵ), ֵ
+    NodeIndex addBlend1D(const std::vector<std::pair<float, NodeIndex>>& children, uint32_t parameter);
+
+    void setRoot(NodeIndex node) { m_root = node; }
+
+    uint32_t addParameter(const std::string& name, float value = 0.0f);
+    int32_t findParameter(const std::string& name) const;  // Ҳ -1
+    void setParameter(uint32_t parameter, float value) { m_parameters[parameter] = value; }
+    float getParameter(uint32_t parameter) const { return m_parameters[parameter]; }
+
+    // ƽƬεĲʱ
+    void update(float deltaTime);
+
+    // ֵ pose (ؽ skeleton һ). ûиڵʱ
+    void evaluate(const Skeleton& skeleton, LocalPose& pose);
+
+private:
+    enum class NodeType {
+        Clip,
+        Lerp,
+        Blend1D,
+    };
+
+    struct Node {
+        NodeType type = NodeType::Clip;
+        const AnimationClip* clip = nullptr;
+        const CompressedClip* compressedClip = nullptr;
+        CompressedClip::Cursor cursor;
+        float speed = 1.0f;
+        bool loop = true;
+        float time = 0.0f;
+        uint32_t parameter = 0;
+        std::vector<std::pair<float, NodeIndex>> children;  // Lerp ̶ֵΪ 0  1
+    };
+
+    NodeIndex addNode(Node node);
+    void evaluateNode(const Skeleton& skeleton, NodeIndex index, LocalPose& pose, uint32_t depth);
+
+    std::vector<Node> m_nodes;
+    std::vector<float> m_parameters;
+    std::vector<std::string> m_parameterNames;
+    NodeIndex m_root = kInvalidNode;
+    std::vector<LocalPose> m_scratch;  // ÿݹһʱ
+};
+
+#endif // BLEND_TREE_H
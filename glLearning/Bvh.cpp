@@ -0,0 +1,622 @@
+#include "Bvh.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    constexpr uint32_t kBinCount = 16;
+    constexpr float kTraversalCost = 1.0f;      // ԲһĴ
+    constexpr uint32_t kMaxSahDepth = 64;       // ʱе㻮, ֹ˻ݰ
+    constexpr uint32_t kParallelThreshold = 4096;
+
+    constexpr uint8_t kDirtyLeaf = 1;
+    constexpr uint8_t kTouched = 2;
+
+    struct Bin {
+        glm::vec3 minCorner = glm::vec3(FLT_MAX);
+        glm::vec3 maxCorner = glm::vec3(-FLT_MAX);
+        uint32_t count = 0;
+    };
+
+    // һ, SAH ֻȽԴС
+    float halfArea(const glm::vec3& minCorner, const glm::vec3& maxCorner) {
+        glm::vec3 extent = maxCorner - minCorner;
+        return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+    }
+
+    uint32_t binOf(float centroid, float minimum, float scale) {
+        return std::min(static_cast<uint32_t>((centroid - minimum) * scale), kBinCount - 1);
+    }
+
+    float distanceSquared(const glm::vec3& point, const glm::vec3& minCorner, const glm::vec3& maxCorner) {
+        glm::vec3 offset = glm::max(glm::max(minCorner - point, point - maxCorner), glm::vec3(0.0f));
+        return glm::dot(offset, offset);
+    }
+
+    // ߽ӵľ, ཻ򳬳 maxDistance ʱ FLT_MAX
+    float intersectRay(const glm::vec3& origin, const glm::vec3& inverseDirection, float maxDistance,
+        const glm::vec3& minCorner, const glm::vec3& maxCorner) {
+        glm::vec3 t1 = (minCorner - origin) * inverseDirection;
+        glm::vec3 t2 = (maxCorner - origin) * inverseDirection;
+        glm::vec3 entries = glm::min(t1, t2);
+        glm::vec3 exits = glm::max(t1, t2);
+        float entry = std::max(std::max(entries.x, entries.y), std::max(entries.z, 0.0f));
+        float exit = std::min(std::min(exits.x, exits.y), std::min(exits.z, maxDistance));
+        return entry <= exit ? entry : FLT_MAX;
+    }
+
+    //  mask еƽ AABB ( Frustum::intersectsAABB ͬ p-vertex ).
+    // ĳƽʱ false; ȫڲƽ mask ȥ, ӽڵ㲻ٲ
+    bool classify(const Frustum& frustum, const glm::vec3& minCorner, const glm::vec3& maxCorner, uint32_t& mask) {
+        for (uint32_t i = 0; i < Frustum::Count; ++i) {
+            if (!(mask & (1u << i))) {
+                continue;
+            }
+            const glm::vec4& plane = frustum.planes[i];
+            float px = plane.x >= 0.0f ? maxCorner.x : minCorner.x;
+            float py = plane.y >= 0.0f ? maxCorner.y : minCorner.y;
+            float pz = plane.z >= 0.0f ? maxCorner.z : minCorner.z;
+            if (plane.x * px + plane.y * py + plane.z * pz + plane.w < 0.0f) {
+                return false;
+            }
+            float nx = plane.x >= 0.0f ? minCorner.x : maxCorner.x;
+            float ny = plane.y >= 0.0f ? minCorner.y : maxCorner.y;
+            float nz = plane.z >= 0.0f ? minCorner.z : maxCorner.z;
+            if (plane.x * nx + plane.y * ny + plane.z * nz + plane.w >= 0.0f) {
+                mask &= ~(1u << i);
+            }
+        }
+        return true;
+    }
+
+    // ջ: ջ, ʱŷ
+    template<typename T>
+    class TraversalStack {
+    public:
+        bool empty() const { return m_size == 0; }
+
+        void push(const T& value) {
+            if (m_size < kLocalSize) {
+                m_local[m_size] = value;
+            }
+            else {
+                m_overflow.push_back(value);
+            }
+            ++m_size;
+        }
+
+        T pop() {
+            --m_size;
+            if (m_size < kLocalSize) {
+                return m_local[m_size];
+            }
+            T value = m_overflow.back();
+            m_overflow.pop_back();
+            return value;
+        }
+
+    private:
+        static constexpr uint32_t kLocalSize = 64;
+        T m_local[kLocalSize];
+        std::vector<T> m_overflow;
+        uint32_t m_size = 0;
+    };
+
+    struct FrustumEntry {
+        uint32_t node;
+        uint32_t mask;  // Եƽ
+    };
+
+    struct DistanceEntry {
+        uint32_t node;
+        float distance;  // ڵľ () 򵽽ڵľƽ ()
+    };
+}
+
+// =====  =====
+void Bvh::build(const glm::vec3* minCorners, const glm::vec3* maxCorners, uint32_t count) {
+    buildTree(nullptr, minCorners, maxCorners, count);
+}
+
+void Bvh::build(JobSystem& jobs, const glm::vec3* minCorners, const glm::vec3* maxCorners, uint32_t count) {
+    buildTree(&jobs, minCorners, maxCorners, count);
+}
+
+void Bvh::buildTree(JobSystem* jobs, const glm::vec3* minCorners, const glm::vec3* maxCorners, uint32_t count) {
+    m_itemMin.assign(minCorners, minCorners + count);
+    m_itemMax.assign(maxCorners, maxCorners + count);
+    m_centroids.resize(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        m_centroids[i] = (minCorners[i] + maxCorners[i]) * 0.5f;
+    }
+    m_itemIndices.resize(count);
+    std::iota(m_itemIndices.begin(), m_itemIndices.end(), 0u);
+    m_itemLeaves.resize(count);
+    m_dirtyLeaves.clear();
+    m_touched.clear();
+
+    if (count == 0) {
+        m_nodes.clear();
+        m_parents.clear();
+        m_nodeFlags.clear();
+        m_nodeCount = 0;
+        return;
+    }
+
+    // count  count Ҷ, 2 * count - 1 ڵ. ڵ֮ɶԷ
+    m_nodes.resize(2 * count - 1);
+    m_parents.resize(2 * count - 1);
+    m_parents[0] = kNoParent;
+    m_nextNode.store(1, std::memory_order_relaxed);
+    buildNode(jobs, 0, 0, count, 0);
+
+    m_nodeCount = m_nextNode.load(std::memory_order_relaxed);
+    m_nodes.resize(m_nodeCount);
+    m_parents.resize(m_nodeCount);
+    m_nodeFlags.assign(m_nodeCount, 0);
+}
+
+void Bvh::buildNode(JobSystem* jobs, uint32_t node, uint32_t begin, uint32_t end, uint32_t depth) {
+    uint32_t count = end - begin;
+    glm::vec3 minCorner(FLT_MAX), maxCorner(-FLT_MAX);
+    glm::vec3 centroidMin(FLT_MAX), centroidMax(-FLT_MAX);
+    for (uint32_t i = begin; i < end; ++i) {
+        uint32_t item = m_itemIndices[i];
+        minCorner = glm::min(minCorner, m_itemMin[item]);
+        maxCorner = glm::max(maxCorner, m_itemMax[item]);
+        centroidMin = glm::min(centroidMin, m_centroids[item]);
+        centroidMax = glm::max(centroidMax, m_centroids[item]);
+    }
+    m_nodes[node].minCorner = minCorner;
+    m_nodes[node].maxCorner = maxCorner;
+    if (count == 1) {
+        makeLeaf(node, begin, end);
+        return;
+    }
+
+    // ͬʱ, ÿ kBinCount - 1 λ
+    glm::vec3 extent = centroidMax - centroidMin;
+    int bestAxis = -1;
+    uint32_t bestBin = 0;
+    float bestCost = FLT_MAX;
+    if (depth < kMaxSahDepth) {
+        Bin bins[3][kBinCount];
+        glm::vec3 scale;
+        for (int axis = 0; axis < 3; ++axis) {
+            scale[axis] = extent[axis] > 0.0f ? kBinCount / extent[axis] : 0.0f;
+        }
+        for (uint32_t i = begin; i < end; ++i) {
+            uint32_t item = m_itemIndices[i];
+            for (int axis = 0; axis < 3; ++axis) {
+                Bin& bin = bins[axis][binOf(m_centroids[item][axis], centroidMin[axis], scale[axis])];
+                bin.minCorner = glm::min(bin.minCorner, m_itemMin[item]);
+                bin.maxCorner = glm::max(bin.maxCorner, m_itemMax[item]);
+                ++bin.count;
+            }
+        }
+
+        for (int axis = 0; axis < 3; ++axis) {
+            if (extent[axis] <= 0.0f) {
+                continue;
+            }
+            // rightCost[b]:  b + 1 Ӽ֮ * ǵı
+            float rightCost[kBinCount - 1];
+            Bin right;
+            for (uint32_t b = kBinCount - 1; b > 0; --b) {
+                const Bin& bin = bins[axis][b];
+                right.minCorner = glm::min(right.minCorner, bin.minCorner);
+                right.maxCorner = glm::max(right.maxCorner, bin.maxCorner);
+                right.count += bin.count;
+                rightCost[b - 1] = right.count ? right.count * halfArea(right.minCorner, right.maxCorner) : 0.0f;
+            }
+            Bin left;
+            for (uint32_t b = 0; b < kBinCount - 1; ++b) {
+                const Bin& bin = bins[axis][b];
+                left.minCorner = glm::min(left.minCorner, bin.minCorner);
+                left.maxCorner = glm::max(left.maxCorner, bin.maxCorner);
+                left.count += bin.count;
+                if (left.count == 0 || left.count == count) {
+                    continue;
+                }
+                float cost = left.count * halfArea(left.minCorner, left.maxCorner) + rightCost[b];
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestBin = b;
+                }
+            }
+        }
+    }
+
+    // ֱֲӲȫʱҶ
+    float area = halfArea(minCorner, maxCorner);
+    if (count <= kMaxLeafSize && (bestAxis < 0 || kTraversalCost + bestCost / std::max(area, FLT_MIN) >= count)) {
+        makeLeaf(node, begin, end);
+        return;
+    }
+
+    uint32_t middle;
+    if (bestAxis >= 0) {
+        float minimum = centroidMin[bestAxis];
+        float scale = kBinCount / extent[bestAxis];
+        middle = static_cast<uint32_t>(std::partition(m_itemIndices.begin() + begin, m_itemIndices.begin() + end,
+            [&](uint32_t item) { return binOf(m_centroids[item][bestAxis], minimum, scale) <= bestBin; }) - m_itemIndices.begin());
+    }
+    else {
+        // ĵغ, Ѿ̫: ᰴλ԰
+        int axis = extent.x >= extent.y && extent.x >= extent.z ? 0 : (extent.y >= extent.z ? 1 : 2);
+        middle = begin + count / 2;
+        std::nth_element(m_itemIndices.begin() + begin, m_itemIndices.begin() + middle, m_itemIndices.begin() + end,
+            [&](uint32_t a, uint32_t b) { return m_centroids[a][axis] < m_centroids[b][axis]; });
+    }
+
+    uint32_t left = m_nextNode.fetch_add(2, std::memory_order_relaxed);
+    m_nodes[node].index = left;
+    m_nodes[node].count = 0;
+    m_parents[left] = node;
+    m_parents[left + 1] = node;
+
+    // ߳, ֻдԼĽڵ
+    if (jobs && count >= kParallelThreshold) {
+        JobCounter counter;
+        jobs->schedule([this, jobs, left, begin, middle, depth]() {
+            buildNode(jobs, left, begin, middle, depth + 1);
+        }, &counter);
+        buildNode(jobs, left + 1, middle, end, depth + 1);
+        jobs->wait(counter);
+    }
+    else {
+        buildNode(jobs, left, begin, middle, depth + 1);
+        buildNode(jobs, left + 1, middle, end, depth + 1);
+    }
+}
+
+void Bvh::makeLeaf(uint32_t node, uint32_t begin, uint32_t end) {
+    m_nodes[node].index = begin;
+    m_nodes[node].count = end - begin;
+    for (uint32_t i = begin; i < end; ++i) {
+        m_itemLeaves[m_itemIndices[i]] = node;
+    }
+}
+
+// =====  =====
+void Bvh::updateItem(uint32_t item, const glm::vec3& minCorner, const glm::vec3& maxCorner) {
+    if (item >= m_itemMin.size()) {
+        throw std::runtime_error("ERROR::BVH: Invalid item " + std::to_string(item));
+    }
+    m_itemMin[item] = minCorner;
+    m_itemMax[item] = maxCorner;
+    uint32_t leaf = m_itemLeaves[item];
+    if (!(m_nodeFlags[leaf] & kDirtyLeaf)) {
+        m_nodeFlags[leaf] |= kDirtyLeaf;
+        m_dirtyLeaves.push_back(leaf);
+    }
+}
+
+uint32_t Bvh::refit() {
+    uint32_t fitted = 0;
+    for (uint32_t leaf : m_dirtyLeaves) {
+        m_nodeFlags[leaf] &= ~kDirtyLeaf;
+        fitNode(leaf);
+        ++fitted;
+
+        // , ΧвʱҲ
+        for (uint32_t node = m_parents[leaf]; node != kNoParent; node = m_parents[node]) {
+            if (!(m_nodeFlags[node] & kTouched)) {
+                m_nodeFlags[node] |= kTouched;
+                m_touched.push_back(node);
+            }
+            glm::vec3 oldMin = m_nodes[node].minCorner;
+            glm::vec3 oldMax = m_nodes[node].maxCorner;
+            fitNode(node);
+            ++fitted;
+            if (m_nodes[node].minCorner == oldMin && m_nodes[node].maxCorner == oldMax) {
+                break;
+            }
+        }
+    }
+    m_dirtyLeaves.clear();
+
+    // ȼĽڵҶӽ, ¶ת. תıڵİΧ, Ȳ
+    for (uint32_t node : m_touched) {
+        m_nodeFlags[node] &= ~kTouched;
+        rotate(node);
+    }
+    m_touched.clear();
+    return fitted;
+}
+
+void Bvh::fitNode(uint32_t node) {
+    Node& target = m_nodes[node];
+    if (target.count == 0) {
+        const Node& left = m_nodes[target.index];
+        const Node& right = m_nodes[target.index + 1];
+        target.minCorner = glm::min(left.minCorner, right.minCorner);
+        target.maxCorner = glm::max(left.maxCorner, right.maxCorner);
+        return;
+    }
+    glm::vec3 minCorner(FLT_MAX), maxCorner(-FLT_MAX);
+    for (uint32_t i = target.index; i < target.index + target.count; ++i) {
+        minCorner = glm::min(minCorner, m_itemMin[m_itemIndices[i]]);
+        maxCorner = glm::max(maxCorner, m_itemMax[m_itemIndices[i]]);
+    }
+    target.minCorner = minCorner;
+    target.maxCorner = maxCorner;
+}
+
+void Bvh::swapNodes(uint32_t a, uint32_t b) {
+    std::swap(m_nodes[a], m_nodes[b]);
+    for (uint32_t position : { a, b }) {
+        const Node& node = m_nodes[position];
+        if (node.count == 0) {
+            m_parents[node.index] = position;
+            m_parents[node.index + 1] = position;
+        }
+        else {
+            for (uint32_t i = node.index; i < node.index + node.count; ++i) {
+                m_itemLeaves[m_itemIndices[i]] = position;
+            }
+        }
+    }
+}
+
+bool Bvh::rotate(uint32_t node) {
+    const Node& parent = m_nodes[node];
+    if (parent.count != 0) {
+        return false;
+    }
+
+    // һӽڵֵܵĳڵ㽻: ֵܵİΧбΪ (ӽڵ + һڵ), ȡС
+    float bestSaving = 0.0f;
+    uint32_t bestChild = 0, bestGrandchild = 0;
+    for (uint32_t side = 0; side < 2; ++side) {
+        const Node& child = m_nodes[parent.index + side];
+        const Node& sibling = m_nodes[parent.index + 1 - side];
+        if (sibling.count != 0) {
+            continue;
+        }
+        float siblingArea = halfArea(sibling.minCorner, sibling.maxCorner);
+        for (uint32_t k = 0; k < 2; ++k) {
+            const Node& other = m_nodes[sibling.index + 1 - k];
+            float area = halfArea(glm::min(child.minCorner, other.minCorner), glm::max(child.maxCorner, other.maxCorner));
+            if (siblingArea - area > bestSaving) {
+                bestSaving = siblingArea - area;
+                bestChild = parent.index + side;
+                bestGrandchild = sibling.index + k;
+            }
+        }
+    }
+    if (bestSaving <= 0.0f) {
+        return false;
+    }
+
+    uint32_t sibling = bestChild == parent.index ? parent.index + 1 : parent.index;
+    swapNodes(bestChild, bestGrandchild);
+    fitNode(sibling);
+    return true;
+}
+
+// ===== ѯ =====
+void Bvh::queryFrustum(const Frustum& frustum, std::vector<uint32_t>& visible) const {
+    visible.clear();
+    if (m_nodeCount == 0) {
+        return;
+    }
+    TraversalStack<FrustumEntry> stack;
+    stack.push({ 0, (1u << Frustum::Count) - 1 });
+    while (!stack.empty()) {
+        FrustumEntry entry = stack.pop();
+        const Node& node = m_nodes[entry.node];
+        if (entry.mask && !classify(frustum, node.minCorner, node.maxCorner, entry.mask)) {
+            continue;
+        }
+        if (node.count == 0) {
+            stack.push({ node.index, entry.mask });
+            stack.push({ node.index + 1, entry.mask });
+            continue;
+        }
+        for (uint32_t i = node.index; i < node.index + node.count; ++i) {
+            uint32_t item = m_itemIndices[i];
+            uint32_t mask = entry.mask;
+            if (!mask || classify(frustum, m_itemMin[item], m_itemMax[item], mask)) {
+                visible.push_back(item);
+            }
+        }
+    }
+}
+
+void Bvh::queryBox(const glm::vec3& minCorner, const glm::vec3& maxCorner, std::vector<uint32_t>& items) const {
+    items.clear();
+    if (m_nodeCount == 0) {
+        return;
+    }
+    auto overlaps = [&](const glm::vec3& otherMin, const glm::vec3& otherMax) {
+        return minCorner.x <= otherMax.x && minCorner.y <= otherMax.y && minCorner.z <= otherMax.z
+            && otherMin.x <= maxCorner.x && otherMin.y <= maxCorner.y && otherMin.z <= maxCorner.z;
+    };
+    TraversalStack<uint32_t> stack;
+    stack.push(0);
+    while (!stack.empty()) {
+        const Node& node = m_nodes[stack.pop()];
+        if (!overlaps(node.minCorner, node.maxCorner)) {
+            continue;
+        }
+        if (node.count == 0) {
+            stack.push(node.index);
+            stack.push(node.index + 1);
+            continue;
+        }
+        for (uint32_t i = node.index; i < node.index + node.count; ++i) {
+            uint32_t item = m_itemIndices[i];
+            if (overlaps(m_itemMin[item], m_itemMax[item])) {
+                items.push_back(item);
+            }
+        }
+    }
+}
+
+void Bvh::querySphere(const glm::vec3& center, float radius, std::vector<uint32_t>& items) const {
+    items.clear();
+    if (m_nodeCount == 0) {
+        return;
+    }
+    float radiusSquared = radius * radius;
+    TraversalStack<uint32_t> stack;
+    stack.push(0);
+    while (!stack.empty()) {
+        const Node& node = m_nodes[stack.pop()];
+        if (distanceSquared(center, node.minCorner, node.maxCorner) > radiusSquared) {
+            continue;
+        }
+        if (node.count == 0) {
+            stack.push(node.index);
+            stack.push(node.index + 1);
+            continue;
+        }
+        for (uint32_t i = node.index; i < node.index + node.count; ++i) {
+            uint32_t item = m_itemIndices[i];
+            if (distanceSquared(center, m_itemMin[item], m_itemMax[item]) <= radiusSquared) {
+                items.push_back(item);
+            }
+        }
+    }
+}
+
+uint32_t Bvh::raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, float& distance) const {
+    return raycast(origin, direction, maxDistance, distance, [](uint32_t, float boxDistance) { return boxDistance; });
+}
+
+uint32_t Bvh::raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, float& distance,
+    const RayTest& test) const {
+    uint32_t best = kInvalidItem;
+    float bestDistance = maxDistance;
+    if (m_nodeCount == 0) {
+        distance = bestDistance;
+        return best;
+    }
+
+    // ȷȽӽڵ, иʱԶĽڵ
+    glm::vec3 inverseDirection = glm::vec3(1.0f) / direction;
+    TraversalStack<DistanceEntry> stack;
+    float rootDistance = intersectRay(origin, inverseDirection, bestDistance, m_nodes[0].minCorner, m_nodes[0].maxCorner);
+    if (rootDistance != FLT_MAX) {
+        stack.push({ 0, rootDistance });
+    }
+    while (!stack.empty()) {
+        DistanceEntry entry = stack.pop();
+        if (entry.distance > bestDistance) {
+            continue;
+        }
+        const Node& node = m_nodes[entry.node];
+        if (node.count == 0) {
+            const Node& left = m_nodes[node.index];
+            const Node& right = m_nodes[node.index + 1];
+            DistanceEntry closer = { node.index, intersectRay(origin, inverseDirection, bestDistance, left.minCorner, left.maxCorner) };
+            DistanceEntry farther = { node.index + 1, intersectRay(origin, inverseDirection, bestDistance, right.minCorner, right.maxCorner) };
+            if (farther.distance < closer.distance) {
+                std::swap(closer, farther);
+            }
+            if (farther.distance != FLT_MAX) {
+                stack.push(farther);
+            }
+            if (closer.distance != FLT_MAX) {
+                stack.push(closer);
+            }
+            continue;
+        }
+        for (uint32_t i = node.index; i < node.index + node.count; ++i) {
+            uint32_t item = m_itemIndices[i];
+            float boxDistance = intersectRay(origin, inverseDirection, bestDistance, m_itemMin[item], m_itemMax[item]);
+            if (boxDistance == FLT_MAX) {
+                continue;
+            }
+            float hit = test(item, boxDistance);
+            if (hit >= 0.0f && hit <= bestDistance) {
+                best = item;
+                bestDistance = hit;
+            }
+        }
+    }
+    distance = bestDistance;
+    return best;
+}
+
+uint32_t Bvh::findNearest(const glm::vec3& point, float maxDistance, float& distance) const {
+    uint32_t best = kInvalidItem;
+    float bestSquared = maxDistance * maxDistance;
+    if (m_nodeCount == 0) {
+        distance = maxDistance;
+        return best;
+    }
+
+    // ȷʸӽڵ, ҵľԶ
+    TraversalStack<DistanceEntry> stack;
+    stack.push({ 0, distanceSquared(point, m_nodes[0].minCorner, m_nodes[0].maxCorner) });
+    while (!stack.empty()) {
+        DistanceEntry entry = stack.pop();
+        if (entry.distance > bestSquared) {
+            continue;
+        }
+        const Node& node = m_nodes[entry.node];
+        if (node.count == 0) {
+            const Node& left = m_nodes[node.index];
+            const Node& right = m_nodes[node.index + 1];
+            DistanceEntry closer = { node.index, distanceSquared(point, left.minCorner, left.maxCorner) };
+            DistanceEntry farther = { node.index + 1, distanceSquared(point, right.minCorner, right.maxCorner) };
+            if (farther.distance < closer.distance) {
+                std::swap(closer, farther);
+            }
+            if (farther.distance <= bestSquared) {
+                stack.push(farther);
+            }
+            if (closer.distance <= bestSquared) {
+                stack.push(closer);
+            }
+            continue;
+        }
+        for (uint32_t i = node.index; i < node.index + node.count; ++i) {
+            uint32_t item = m_itemIndices[i];
+            float squared = distanceSquared(point, m_itemMin[item], m_itemMax[item]);
+            if (squared <= bestSquared && (best == kInvalidItem || squared < bestSquared)) {
+                best = item;
+                bestSquared = squared;
+            }
+        }
+    }
+    distance = best == kInvalidItem ? maxDistance : std::sqrt(bestSquared);
+    return best;
+}
+
+float Bvh::computeCost() const {
+    if (m_nodeCount == 0) {
+        return 0.0f;
+    }
+    float cost = 0.0f;
+    for (uint32_t i = 0; i < m_nodeCount; ++i) {
+        const Node& node = m_nodes[i];
+        float area = halfArea(node.minCorner, node.maxCorner);
+        cost += node.count == 0 ? kTraversalCost * area : node.count * area;
+    }
+    return cost / std::max(halfArea(m_nodes[0].minCorner, m_nodes[0].maxCorner), FLT_MIN);
+}
+
+// ===== ʹdemo =====
+// // ռ AABB ( EntitySystems::updateBounds  Bounds::worldMin / worldMax)
+// Bvh bvh;
+// bvh.build(jobs, worldMin.data(), worldMax.data(), static_cast<uint32_t>(worldMin.size()));
+//
+// // ÿ֡: ֻƶ彻 BVH, Ȼһ refit
+// for (uint32_t item : movedItems) {
+//     bvh.updateItem(item, worldMin[item], worldMax[item]);
+// }
+// bvh.refit();
+//
+// std::vector<uint32_t> visible, lit;
+// bvh.queryFrustum(Frustum::fromMatrix(projection * view), visible);
+// bvh.querySphere(light.position, light.radius, lit);  // յԴӰ
+//
+// float distance;
+// uint32_t picked = bvh.raycast(camera.Position, rayDirection, 1000.0f, distance);
@@ -0,0 +1,115 @@
+#ifndef BVH_H
+#define BVH_H
+
+#include "Frustum.h"
+#include "JobSystem.h"
+#include <glm/glm.hpp>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// Bvh:  ( AABB ʾ,  0 ~ count-1) ĲΰΧ, ׶޳ʰȡ
+// ԴӰ췶Χڽѯ, ÿβѯֻѯཻ.
+//
+// ÷ SAH (),  JobSystem ϲй. ڵ 32 ֽ, ӽڵڴ.
+// ƶ updateItem ֻ¼Ķ, refit ظڵΧ, ھĽڵת
+// (ӽڵֵܵӽڵ㽻, ܼС), ƶɵ½. ɾƶ build.
+class Bvh {
+public:
+    static constexpr uint32_t kInvalidItem = 0xFFFFFFFFu;
+    static constexpr uint32_t kMaxLeafSize = 4;
+
+    // 32 ֽ. count Ϊ 0 ڲڵ, ӽڵΪ index  index + 1; Ҷ, Ϊ getItemIndices()[index, index + count)
+    struct Node {
+        glm::vec3 minCorner;
+        uint32_t index;
+        glm::vec3 maxCorner;
+        uint32_t count;
+    };
+
+    // ľȷ: о, δзظ. boxDistance ߽ AABB ľ
+    using RayTest = std::function<float(uint32_t item, float boxDistance)>;
+
+    Bvh() = default;
+
+    // ֹ
+    Bvh(const Bvh&) = delete;
+    Bvh& operator=(const Bvh&) = delete;
+
+    //  count  AABB ؽ, Ϊ±
+    void build(const glm::vec3* minCorners, const glm::vec3* maxCorners, uint32_t count);
+
+    // ͬ,  jobs ϲй. ܵȴ jobs ߳ϵ
+    void build(JobSystem& jobs, const glm::vec3* minCorners, const glm::vec3* maxCorners, uint32_t count);
+
+    // ޸һİΧ, һ refit ʱЧ
+    void updateItem(uint32_t item, const glm::vec3& minCorner, const glm::vec3& maxCorner);
+
+    // 㱻޸ĵȲת, ΧеĽڵ
+    uint32_t refit();
+
+    // ׶ཻ. ׶ʱ. visible ȱ, ˳ȷ (ͬ)
+    void queryFrustum(const Frustum& frustum, std::vector<uint32_t>& visible) const;
+
+    //  AABB / ཻ, ԴӰ塢ĳλø
+    void queryBox(const glm::vec3& minCorner, const glm::vec3& maxCorner, std::vector<uint32_t>& items) const;
+    void querySphere(const glm::vec3& center, float radius, std::vector<uint32_t>& items) const;
+
+    /**
+     * @brief ʰȡ:  direction  maxDistance , ûʱ kInvalidItem.
+     * direction Ӧѹһ.  test ʱ AABB ĽΪо, distance о
+     */
+    uint32_t raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, float& distance) const;
+    uint32_t raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, float& distance, const RayTest& test) const;
+
+    // AABB  point  (point ںʱΪ 0), maxDistance ûʱ kInvalidItem
+    uint32_t findNearest(const glm::vec3& point, float maxDistance, float& distance) const;
+
+    //  SAH  (ڲڵҶ尴Ȩ, Ըڵ), 
+    float computeCost() const;
+
+    uint32_t getItemCount() const { return static_cast<uint32_t>(m_itemMin.size()); }
+    uint32_t getNodeCount() const { return m_nodeCount; }
+    const std::vector<Node>& getNodes() const { return m_nodes; }
+    const std::vector<uint32_t>& getItemIndices() const { return m_itemIndices; }
+
+private:
+    static constexpr uint32_t kNoParent = 0xFFFFFFFFu;
+
+    void buildTree(JobSystem* jobs, const glm::vec3* minCorners, const glm::vec3* maxCorners, uint32_t count);
+
+    // Ϊ [begin, end) ڵ彨 node Ϊ
+    void buildNode(JobSystem* jobs, uint32_t node, uint32_t begin, uint32_t end, uint32_t depth);
+
+    void makeLeaf(uint32_t node, uint32_t begin, uint32_t end);
+
+    // ӽڵҶеΧ
+    void fitNode(uint32_t node);
+
+    // λϵ, λõĸڵ㲻
+    void swapNodes(uint32_t a, uint32_t b);
+
+    //  node ӽڵڵ֮һܼСĽ, ɹʱ true
+    bool rotate(uint32_t node);
+
+    // ṹΧ. m_parents ֻڹ refit ʱʹ, ͽڵһ
+    std::vector<Node> m_nodes;
+    std::vector<uint32_t> m_parents;
+    uint32_t m_nodeCount = 0;
+    std::atomic<uint32_t> m_nextNode{ 0 };
+
+    // 
+    std::vector<glm::vec3> m_itemMin;
+    std::vector<glm::vec3> m_itemMax;
+    std::vector<glm::vec3> m_centroids;    // ֻڹʱʹ
+    std::vector<uint32_t> m_itemIndices;   // Ҷõ
+    std::vector<uint32_t> m_itemLeaves;    // ڵҶ
+
+    // refit ĴҶ뾭ڲڵ
+    std::vector<uint32_t> m_dirtyLeaves;
+    std::vector<uint32_t> m_touched;
+    std::vector<uint8_t> m_nodeFlags;      // ڵ, ظб
+};
+
+#endif // BVH_H
@@ -0,0 +1,242 @@
+#include "BvhBenchmark.h"
+#include "Benchmark.h"
+#include "Bvh.h"
+#include "CpuCuller.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+namespace {
+    const int kFrames = 20;
+    const int kBuildRuns = 3;
+    const uint32_t kRayCount = 1000;
+    const uint32_t kLightCount = 256;
+    const float kLightRadius = 15.0f;
+    const uint32_t kNearestCount = 1000;
+    const float kNearestDistance = 50.0f;
+
+    glm::vec3 randomPoint(uint32_t& state) {
+        float x = Benchmark::random(state) - 0.5f;
+        float y = Benchmark::random(state) * 0.1f - 0.05f;
+        float z = Benchmark::random(state) - 0.5f;
+        return glm::vec3(x, y, z) * 1000.0f;
+    }
+
+    size_t countMismatches(std::vector<uint32_t>& a, std::vector<uint32_t>& b) {
+        std::sort(a.begin(), a.end());
+        std::sort(b.begin(), b.end());
+        std::vector<uint32_t> difference;
+        std::set_symmetric_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(difference));
+        return difference.size();
+    }
+
+    // ===== ɨ =====
+    float distanceSquared(const glm::vec3& point, const glm::vec3& minCorner, const glm::vec3& maxCorner) {
+        glm::vec3 offset = glm::max(glm::max(minCorner - point, point - maxCorner), glm::vec3(0.0f));
+        return glm::dot(offset, offset);
+    }
+
+    //  AABB , ûʱ maxDistance
+    float raycastLinear(const std::vector<glm::vec3>& minCorners, const std::vector<glm::vec3>& maxCorners,
+        const glm::vec3& origin, const glm::vec3& direction, float maxDistance) {
+        glm::vec3 inverseDirection = glm::vec3(1.0f) / direction;
+        float best = maxDistance;
+        for (size_t i = 0; i < minCorners.size(); ++i) {
+            glm::vec3 t1 = (minCorners[i] - origin) * inverseDirection;
+            glm::vec3 t2 = (maxCorners[i] - origin) * inverseDirection;
+            glm::vec3 entries = glm::min(t1, t2);
+            glm::vec3 exits = glm::max(t1, t2);
+            float entry = std::max(std::max(entries.x, entries.y), std::max(entries.z, 0.0f));
+            float exit = std::min(std::min(exits.x, exits.y), std::min(exits.z, best));
+            if (entry <= exit) {
+                best = entry;
+            }
+        }
+        return best;
+    }
+
+    void querySphereLinear(const std::vector<glm::vec3>& minCorners, const std::vector<glm::vec3>& maxCorners,
+        const glm::vec3& center, float radius, std::vector<uint32_t>& items) {
+        items.clear();
+        for (uint32_t i = 0; i < minCorners.size(); ++i) {
+            if (distanceSquared(center, minCorners[i], maxCorners[i]) <= radius * radius) {
+                items.push_back(i);
+            }
+        }
+    }
+
+    float findNearestLinear(const std::vector<glm::vec3>& minCorners, const std::vector<glm::vec3>& maxCorners,
+        const glm::vec3& point, float maxDistance) {
+        float best = maxDistance * maxDistance;
+        for (size_t i = 0; i < minCorners.size(); ++i) {
+            best = std::min(best, distanceSquared(point, minCorners[i], maxCorners[i]));
+        }
+        return std::sqrt(best);
+    }
+}
+
+BvhBenchmarkResult runBvhBenchmark(JobSystem& jobs, uint32_t objectCount, bool print) {
+    BvhBenchmarkResult result;
+    result.objectCount = objectCount;
+
+    uint32_t seed = 1;
+    std::vector<glm::vec3> minCorners(objectCount), maxCorners(objectCount);
+    BoundingVolumes boxes(BoundingVolumes::Boxes);
+    boxes.reserve(objectCount);
+    for (uint32_t i = 0; i < objectCount; ++i) {
+        glm::vec3 center = randomPoint(seed);
+        glm::vec3 extents = Benchmark::randomVector(seed) * 2.0f + glm::vec3(0.25f);
+        minCorners[i] = center - extents;
+        maxCorners[i] = center + extents;
+        boxes.addBox(minCorners[i], maxCorners[i]);
+    }
+
+    // =====  =====
+    Bvh bvh;
+    Benchmark::TimePoint start = Benchmark::now();
+    for (int run = 0; run < kBuildRuns; ++run) {
+        bvh.build(minCorners.data(), maxCorners.data(), objectCount);
+    }
+    result.buildMs = Benchmark::millisecondsSince(start) / kBuildRuns;
+    start = Benchmark::now();
+    for (int run = 0; run < kBuildRuns; ++run) {
+        bvh.build(jobs, minCorners.data(), maxCorners.data(), objectCount);
+    }
+    result.parallelBuildMs = Benchmark::millisecondsSince(start) / kBuildRuns;
+    result.nodeCount = bvh.getNodeCount();
+    result.buildCost = bvh.computeCost();
+
+    // ===== ׶޳:  CullingBenchmark ͬ =====
+    glm::mat4 view = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    Frustum frustum = Frustum::fromMatrix(glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 500.0f) * view);
+    std::vector<uint32_t> linearVisible, bvhVisible;
+    start = Benchmark::now();
+    for (int frame = 0; frame < kFrames; ++frame) {
+        CpuCuller::cull(boxes, frustum, linearVisible);
+    }
+    result.linearFrustumMs = Benchmark::millisecondsSince(start) / kFrames;
+    start = Benchmark::now();
+    for (int frame = 0; frame < kFrames; ++frame) {
+        bvh.queryFrustum(frustum, bvhVisible);
+    }
+    result.bvhFrustumMs = Benchmark::millisecondsSince(start) / kFrames;
+    result.visibleCount = bvhVisible.size();
+    result.mismatchCount += countMismatches(linearVisible, bvhVisible);
+
+    // ===== ʰȡ: Ϸϵ =====
+    std::vector<glm::vec3> origins(kRayCount), directions(kRayCount);
+    for (uint32_t r = 0; r < kRayCount; ++r) {
+        origins[r] = randomPoint(seed) + glm::vec3(0.0f, 100.0f, 0.0f);
+        directions[r] = glm::normalize(randomPoint(seed) - origins[r]);
+    }
+    std::vector<float> linearDistances(kRayCount), bvhDistances(kRayCount);
+    start = Benchmark::now();
+    for (uint32_t r = 0; r < kRayCount; ++r) {
+        linearDistances[r] = raycastLinear(minCorners, maxCorners, origins[r], directions[r], FLT_MAX);
+    }
+    result.linearRaysMs = Benchmark::millisecondsSince(start);
+    start = Benchmark::now();
+    for (uint32_t r = 0; r < kRayCount; ++r) {
+        bvh.raycast(origins[r], directions[r], FLT_MAX, bvhDistances[r]);
+    }
+    result.bvhRaysMs = Benchmark::millisecondsSince(start);
+    for (uint32_t r = 0; r < kRayCount; ++r) {
+        result.mismatchCount += linearDistances[r] != bvhDistances[r];
+    }
+
+    // ===== ԴӰ =====
+    std::vector<glm::vec3> lights(kLightCount);
+    for (glm::vec3& light : lights) {
+        light = randomPoint(seed);
+    }
+    std::vector<std::vector<uint32_t>> linearLit(kLightCount), bvhLit(kLightCount);
+    start = Benchmark::now();
+    for (uint32_t l = 0; l < kLightCount; ++l) {
+        querySphereLinear(minCorners, maxCorners, lights[l], kLightRadius, linearLit[l]);
+    }
+    result.linearLightsMs = Benchmark::millisecondsSince(start);
+    start = Benchmark::now();
+    for (uint32_t l = 0; l < kLightCount; ++l) {
+        bvh.querySphere(lights[l], kLightRadius, bvhLit[l]);
+    }
+    result.bvhLightsMs = Benchmark::millisecondsSince(start);
+    for (uint32_t l = 0; l < kLightCount; ++l) {
+        result.mismatchCount += countMismatches(linearLit[l], bvhLit[l]);
+    }
+
+    // =====  =====
+    std::vector<glm::vec3> points(kNearestCount);
+    for (glm::vec3& point : points) {
+        point = randomPoint(seed);
+    }
+    std::vector<float> linearNearest(kNearestCount), bvhNearest(kNearestCount);
+    start = Benchmark::now();
+    for (uint32_t p = 0; p < kNearestCount; ++p) {
+        linearNearest[p] = findNearestLinear(minCorners, maxCorners, points[p], kNearestDistance);
+    }
+    result.linearNearestMs = Benchmark::millisecondsSince(start);
+    start = Benchmark::now();
+    for (uint32_t p = 0; p < kNearestCount; ++p) {
+        bvh.findNearest(points[p], kNearestDistance, bvhNearest[p]);
+    }
+    result.bvhNearestMs = Benchmark::millisecondsSince(start);
+    for (uint32_t p = 0; p < kNearestCount; ++p) {
+        result.mismatchCount += linearNearest[p] != bvhNearest[p];
+    }
+
+    // ===== ÿ֡ƶ 1%  =====
+    uint32_t movedCount = std::max(objectCount / 100, 1u);
+    double refitTotal = 0.0;
+    for (int frame = 0; frame < kFrames; ++frame) {
+        std::vector<uint32_t> moved(movedCount);
+        for (uint32_t& item : moved) {
+            item = static_cast<uint32_t>(Benchmark::random(seed) * objectCount) % objectCount;
+            float x = Benchmark::random(seed) - 0.5f;
+            float z = Benchmark::random(seed) - 0.5f;
+            glm::vec3 offset = glm::vec3(x, 0.0f, z) * 20.0f;
+            minCorners[item] += offset;
+            maxCorners[item] += offset;
+            boxes.setBox(item, minCorners[item], maxCorners[item]);
+        }
+        start = Benchmark::now();
+        for (uint32_t item : moved) {
+            bvh.updateItem(item, minCorners[item], maxCorners[item]);
+        }
+        bvh.refit();
+        refitTotal += Benchmark::millisecondsSince(start);
+    }
+    result.refitMs = refitTotal / kFrames;
+    result.refitCost = bvh.computeCost();
+    CpuCuller::cull(boxes, frustum, linearVisible);
+    bvh.queryFrustum(frustum, bvhVisible);
+    result.mismatchCount += countMismatches(linearVisible, bvhVisible);
+
+    if (print) {
+        std::cout << "===== BVH benchmark (" << objectCount << " objects, " << result.nodeCount << " nodes, "
+            << jobs.getWorkerCount() << " workers) =====" << std::endl;
+        std::cout << "build:             " << result.buildMs << " ms" << std::endl;
+        std::cout << "build parallel:    " << result.parallelBuildMs << " ms ("
+            << result.buildMs / std::max(result.parallelBuildMs, 1e-6) << "x)" << std::endl;
+        std::cout << "frustum linear:    " << result.linearFrustumMs << " ms/frame (" << result.visibleCount << " visible)" << std::endl;
+        std::cout << "frustum BVH:       " << result.bvhFrustumMs << " ms/frame ("
+            << result.linearFrustumMs / std::max(result.bvhFrustumMs, 1e-6) << "x)" << std::endl;
+        std::cout << kRayCount << " rays linear:  " << result.linearRaysMs << " ms" << std::endl;
+        std::cout << kRayCount << " rays BVH:     " << result.bvhRaysMs << " ms ("
+            << result.linearRaysMs / std::max(result.bvhRaysMs, 1e-6) << "x)" << std::endl;
+        std::cout << kLightCount << " lights linear: " << result.linearLightsMs << " ms" << std::endl;
+        std::cout << kLightCount << " lights BVH:    " << result.bvhLightsMs << " ms ("
+            << result.linearLightsMs / std::max(result.bvhLightsMs, 1e-6) << "x)" << std::endl;
+        std::cout << kNearestCount << " nearest linear: " << result.linearNearestMs << " ms" << std::endl;
+        std::cout << kNearestCount << " nearest BVH:    " << result.bvhNearestMs << " ms ("
+            << result.linearNearestMs / std::max(result.bvhNearestMs, 1e-6) << "x)" << std::endl;
+        std::cout << "refit (1% moved):  " << result.refitMs << " ms/frame" << std::endl;
+        std::cout << "SAH cost:          " << result.buildCost << " built, " << result.refitCost << " after "
+            << kFrames << " refits" << std::endl;
+        std::cout << "mismatches:        " << result.mismatchCount << std::endl;
+    }
+    return result;
+}
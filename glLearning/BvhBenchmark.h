@@ -0,0 +1,34 @@
+#ifndef BVH_BENCHMARK_H
+#define BVH_BENCHMARK_H
+
+#include "JobSystem.h"
+#include <cstddef>
+#include <cstdint>
+
+// BVH ׼:  CullingBenchmark ֲͬ, Ա Bvh ɨ
+//    (߳ / JobSystem ), ׶޳ ( CpuCuller), ʰȡ, ԴӰ췶Χ, ,
+//   Լÿ֡ƶ 1%  refit ¹ĺʱ
+struct BvhBenchmarkResult {
+    uint32_t objectCount = 0;
+    uint32_t nodeCount = 0;
+    double buildMs = 0.0;
+    double parallelBuildMs = 0.0;
+    double linearFrustumMs = 0.0;  // CpuCuller (SIMD) ɨȫ
+    double bvhFrustumMs = 0.0;
+    double linearRaysMs = 0.0;     // ȫ / Դ / ѯܺʱ
+    double bvhRaysMs = 0.0;
+    double linearLightsMs = 0.0;
+    double bvhLightsMs = 0.0;
+    double linearNearestMs = 0.0;
+    double bvhNearestMs = 0.0;
+    double refitMs = 0.0;          // ÿ֡ updateItem + refit
+    float buildCost = 0.0f;        // Bvh::computeCost: չʱ / ֡ refit ֮
+    float refitCost = 0.0f;
+    size_t visibleCount = 0;
+    size_t mismatchCount = 0;      // ɨһµĸ (вԺϼ)
+};
+
+// л׼ӡ (main  --bench-bvh ). ڴ jobs ߳ϵ
+BvhBenchmarkResult runBvhBenchmark(JobSystem& jobs, uint32_t objectCount = 100000, bool print = true);
+
+#endif // BVH_BENCHMARK_H
@@ -0,0 +1,44 @@
+#include "CommandBuffer.h"
+#include "Material.h"
+#include <iostream>
+
+CommandBuffer::CommandBuffer(size_t arenaBlockSize)
+    : m_arena(arenaBlockSize) {
+}
+
+void CommandBuffer::reset() {
+    m_commands.clear();
+    m_arena.reset();
+}
+
+void CommandBuffer::draw(const RenderQueue::DrawItem& item) {
+    if ((!item.shader && !item.material) || item.vertexArray == 0) {
+        std::cerr << "ERROR::COMMAND_BUFFER: Draw item without shader or vertex array" << std::endl;
+        return;
+    }
+
+    RenderQueue::RenderCommand command;
+    if (item.material) {
+        command.materialHash = item.material->getID();
+        command.shader = item.material->getShader();
+        command.textures = nullptr;
+        command.material = item.material;
+    }
+    else {
+        RenderQueue::TextureSet textures;
+        for (uint32_t i = 0; i < RenderQueue::kMaxTextures; ++i) {
+            textures.textures[i] = item.textures[i];
+        }
+        command.materialHash = RenderQueue::makeMaterialHash(textures);
+        command.shader = item.shader;
+        command.textures = m_arena.create(textures);
+        command.material = nullptr;
+    }
+    command.key = RenderQueue::makeKey(item, command.materialHash);
+    command.transform = item.model ? m_arena.create(*item.model) : nullptr;
+    command.vertexArray = item.vertexArray;
+    command.indexCount = item.indexCount;
+    command.firstIndex = item.firstIndex;
+    command.baseVertex = item.baseVertex;
+    m_commands.push_back(command);
+}
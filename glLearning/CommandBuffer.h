@@ -0,0 +1,35 @@
+#ifndef COMMAND_BUFFER_H
+#define COMMAND_BUFFER_H
+
+#include "RenderQueue.h"
+#include "LinearArena.h"
+#include <vector>
+
+// CommandBuffer: һ̵߳. κ GL , ߳¼;
+// ¼ʱ, 任ͲʿԼԷ.
+// ¼ɺ󽻸 RenderQueue::submit(const CommandBuffer&), Ⱦ̺߳ϲִ.
+// һ reset() ֮ǰ뱣Ч (RenderQueue::flush ֮ reset).
+class alignas(64) CommandBuffer {
+public:
+    explicit CommandBuffer(size_t arenaBlockSize = 64 * 1024);
+
+    // ֹ
+    CommandBuffer(const CommandBuffer&) = delete;
+    CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+    // , ѷڴ
+    void reset();
+
+    // ¼һλ. ̰߳ȫǰÿֻ߳дԼ CommandBuffer
+    void draw(const RenderQueue::DrawItem& item);
+
+    const std::vector<RenderQueue::RenderCommand>& getCommands() const { return m_commands; }
+    size_t getCommandCount() const { return m_commands.size(); }
+    size_t getArenaBytes() const { return m_arena.getUsedBytes(); }
+
+private:
+    std::vector<RenderQueue::RenderCommand> m_commands;
+    LinearArena m_arena;
+};
+
+#endif // COMMAND_BUFFER_H
@@ -0,0 +1,70 @@
+#include "CommandRecorder.h"
+
+CommandRecorder::CommandRecorder(JobSystem& jobs, uint32_t sliceCount)
+    : m_jobs(jobs) {
+    if (sliceCount == 0) {
+        sliceCount = jobs.getThreadCount();
+    }
+
+    for (uint32_t i = 0; i < sliceCount; ++i) {
+        m_buffers.push_back(std::make_unique<CommandBuffer>());
+    }
+}
+
+void CommandRecorder::record(size_t itemCount, const RecordFunction& recordFunction) {
+    for (auto& buffer : m_buffers) {
+        buffer->reset();
+    }
+
+    // ÿһ, ֻȡڶκ; 쳣 parallelFor ڵ߳׳
+    size_t sliceCount = m_buffers.size();
+    m_jobs.parallelFor(sliceCount, 1, [&](size_t firstSlice, size_t lastSlice) {
+        for (size_t slice = firstSlice; slice < lastSlice; ++slice) {
+            size_t begin = itemCount * slice / sliceCount;
+            size_t end = itemCount * (slice + 1) / sliceCount;
+            if (begin != end) {
+                recordFunction(*m_buffers[slice], begin, end);
+            }
+        }
+    });
+}
+
+void CommandRecorder::submitTo(RenderQueue& queue) const {
+    for (const auto& buffer : m_buffers) {
+        queue.submit(*buffer);
+    }
+}
+
+size_t CommandRecorder::getCommandCount() const {
+    size_t count = 0;
+    for (const auto& buffer : m_buffers) {
+        count += buffer->getCommandCount();
+    }
+    return count;
+}
+
+// ===== ʹdemo =====
+// JobSystem jobs;                 // ȫΨһ, ĬʹȫӲ߳
+// CommandRecorder recorder(jobs);
+// RenderQueue queue;
+//
+// // ÿ֡ (Ⱦ߳)
+// queue.beginFrame();
+// recorder.record(objects.size(), [&](CommandBuffer& buffer, size_t begin, size_t end) {
+//     for (size_t i = begin; i < end; ++i) {
+//         const Object& object = objects[i];
+//         if (!frustum.intersectsSphere(object.center, object.radius)) {
+//             continue;  // ޳Ҳڹ߳
+//         }
+//         RenderQueue::DrawItem item;
+//         item.shader = object.shader;
+//         item.vertexArray = object.vao;
+//         item.textures[0] = object.diffuse;
+//         item.indexCount = object.indexCount;
+//         item.model = &object.model;
+//         item.depth = glm::length(object.center - cameraPos);
+//         buffer.draw(item);
+//     }
+// });
+// recorder.submitTo(queue);
+// queue.flush();
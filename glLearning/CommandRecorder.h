@@ -0,0 +1,44 @@
+#ifndef COMMAND_RECORDER_H
+#define COMMAND_RECORDER_H
+
+#include "CommandBuffer.h"
+#include "JobSystem.h"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+// CommandRecorder: ϵͳϲ¼ƻ (޳uniform ),
+// Ⱦ߳ submitTo() Ѹε CommandBuffer ϲ RenderQueue ִ.
+// ÿι̶Ӧһ CommandBuffer, 䰴κž̬, ˺ϲ̵߳޹.
+class CommandRecorder {
+public:
+    // ¼ƺ:  [begin, end) Χڵ¼Ƶ buffer. õ GL
+    using RecordFunction = std::function<void(CommandBuffer& buffer, size_t begin, size_t end)>;
+
+    // sliceCount: ֵĶ (ÿһ CommandBuffer), 0 ʾʹϵͳ߳
+    explicit CommandRecorder(JobSystem& jobs, uint32_t sliceCount = 0);
+
+    // ֹ
+    CommandRecorder(const CommandRecorder&) = delete;
+    CommandRecorder& operator=(const CommandRecorder&) = delete;
+
+    /**
+     * @brief , ¼ itemCount , ʱȫ¼.
+     * ¼ƺ׳쳣ڵ߳׳.
+     */
+    void record(size_t itemCount, const RecordFunction& recordFunction);
+
+    // ϲ (Ⱦ߳).  flush ֮ǰҪٴ record
+    void submitTo(RenderQueue& queue) const;
+
+    uint32_t getSliceCount() const { return static_cast<uint32_t>(m_buffers.size()); }
+    const CommandBuffer& getBuffer(uint32_t slice) const { return *m_buffers[slice]; }
+    size_t getCommandCount() const;
+
+private:
+    JobSystem& m_jobs;
+    std::vector<std::unique_ptr<CommandBuffer>> m_buffers;
+};
+
+#endif // COMMAND_RECORDER_H
@@ -0,0 +1,154 @@
+#include "CommandRecorderBenchmark.h"
+#include "Benchmark.h"
+#include "CommandRecorder.h"
+#include "Frustum.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    const int kFrames = 20;
+    const GLuint kVertexArrayCount = 64;  // ٵ VAO , ֻ, ᱻ
+
+    struct BenchmarkObject {
+        glm::mat4 model;
+        glm::vec3 center;
+        float radius;
+        GLuint vertexArray;
+        uint32_t indexCount;
+        uint8_t layer;
+    };
+
+    struct BenchmarkScene {
+        std::vector<BenchmarkObject> objects;
+        Frustum frustum;
+        glm::vec3 cameraPosition;
+        Shader* shader;
+    };
+
+    void recordObjects(const BenchmarkScene& scene, CommandBuffer& buffer, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const BenchmarkObject& object = scene.objects[i];
+            if (!scene.frustum.intersectsSphere(object.center, object.radius)) {
+                continue;
+            }
+            RenderQueue::DrawItem item;
+            item.shader = scene.shader;
+            item.vertexArray = object.vertexArray;
+            item.indexCount = object.indexCount;
+            item.model = &object.model;
+            item.depth = glm::length(object.center - scene.cameraPosition);
+            item.layer = object.layer;
+            buffer.draw(item);
+        }
+    }
+
+    // κ˳ƴӵ,  submitTo ϲ˳
+    std::vector<uint64_t> collectKeys(const CommandRecorder& recorder) {
+        std::vector<uint64_t> keys;
+        for (uint32_t slice = 0; slice < recorder.getSliceCount(); ++slice) {
+            for (const RenderQueue::RenderCommand& command : recorder.getBuffer(slice).getCommands()) {
+                keys.push_back(command.key);
+            }
+        }
+        return keys;
+    }
+
+    // 2, 4, 8, ... ߳, һΪӲ߳ ( 2)
+    std::vector<uint32_t> makeThreadCounts() {
+        uint32_t hardware = std::max(std::thread::hardware_concurrency(), 2u);
+        std::vector<uint32_t> counts;
+        for (uint32_t count = 2; count < hardware; count *= 2) {
+            counts.push_back(count);
+        }
+        counts.push_back(hardware);
+        return counts;
+    }
+}
+
+CommandRecorderBenchmarkResult runCommandRecorderBenchmark(Shader& shader, uint32_t objectCount, bool print) {
+    CommandRecorderBenchmarkResult result;
+    result.objectCount = objectCount;
+
+    // ԭ㿴 -Z, ɢ 1000 x 100 x 1000 ķΧ, Լ 1/4 ׶
+    uint32_t seed = 1;
+    BenchmarkScene scene;
+    scene.shader = &shader;
+    scene.cameraPosition = glm::vec3(0.0f);
+    glm::mat4 view = glm::lookAt(scene.cameraPosition, glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    scene.frustum = Frustum::fromMatrix(glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 1000.0f) * view);
+    scene.objects.resize(objectCount);
+    for (BenchmarkObject& object : scene.objects) {
+        glm::vec3 position = (Benchmark::randomVector(seed) - glm::vec3(0.5f)) * glm::vec3(1000.0f, 100.0f, 1000.0f);
+        object.radius = 0.5f + Benchmark::random(seed) * 2.0f;
+        object.center = position;
+        object.model = glm::scale(glm::translate(glm::mat4(1.0f), position), glm::vec3(object.radius));
+        object.vertexArray = 1 + static_cast<GLuint>(Benchmark::random(seed) * kVertexArrayCount);
+        object.indexCount = 36;
+        object.layer = Benchmark::random(seed) < 0.1f ? 1 : 0;
+    }
+
+    // ===== : ߳¼Ƶ =====
+    CommandBuffer serialBuffer;
+    Benchmark::TimePoint start = Benchmark::now();
+    for (int frame = 0; frame < kFrames; ++frame) {
+        serialBuffer.reset();
+        recordObjects(scene, serialBuffer, 0, scene.objects.size());
+    }
+    result.serialMs = Benchmark::millisecondsSince(start) / kFrames;
+    result.commandCount = serialBuffer.getCommandCount();
+
+    std::vector<uint64_t> serialKeys;
+    for (const RenderQueue::RenderCommand& command : serialBuffer.getCommands()) {
+        serialKeys.push_back(command.key);
+    }
+
+    // ===== CommandRecorder: ÿ߳һ JobSystem, ÿ߳һ =====
+    RenderQueue queue;
+    auto recordFunction = [&](CommandBuffer& buffer, size_t begin, size_t end) {
+        recordObjects(scene, buffer, begin, end);
+    };
+    for (uint32_t threadCount : makeThreadCounts()) {
+        JobSystem::Settings settings;
+        settings.workerCount = threadCount - 1;
+        JobSystem jobs(settings);
+        CommandRecorder recorder(jobs, threadCount);
+        recorder.record(scene.objects.size(), recordFunction);  // Ԥ, øεԷڴ
+
+        CommandRecorderBenchmarkResult::Run run;
+        run.threadCount = threadCount;
+        double mergeMs = 0.0;
+        start = Benchmark::now();
+        for (int frame = 0; frame < kFrames; ++frame) {
+            recorder.record(scene.objects.size(), recordFunction);
+        }
+        run.recordMs = Benchmark::millisecondsSince(start) / kFrames;
+
+        for (int frame = 0; frame < kFrames; ++frame) {
+            Benchmark::TimePoint mergeStart = Benchmark::now();
+            queue.beginFrame();
+            recorder.submitTo(queue);
+            mergeMs += Benchmark::millisecondsSince(mergeStart);
+        }
+        run.mergeMs = mergeMs / kFrames;
+        run.speedup = result.serialMs / std::max(run.recordMs, 1e-6);
+        result.deterministic = result.deterministic && collectKeys(recorder) == serialKeys;
+        result.runs.push_back(run);
+    }
+    queue.beginFrame();
+
+    if (print) {
+        std::cout << "===== Command recorder benchmark (" << objectCount << " objects, " << result.commandCount
+            << " visible, " << std::thread::hardware_concurrency() << " hardware threads) =====" << std::endl;
+        std::cout << "1 thread (serial):  record " << result.serialMs << " ms/frame" << std::endl;
+        for (const CommandRecorderBenchmarkResult::Run& run : result.runs) {
+            std::cout << run.threadCount << " threads:" << std::string(run.threadCount < 10 ? 10 : 9, ' ')
+                << "record " << run.recordMs << " ms/frame (" << run.speedup << "x), merge " << run.mergeMs << " ms" << std::endl;
+        }
+        std::cout << "merged order matches serial: " << (result.deterministic ? "yes" : "NO") << std::endl;
+    }
+    return result;
+}
@@ -0,0 +1,34 @@
+#ifndef COMMAND_RECORDER_BENCHMARK_H
+#define COMMAND_RECORDER_BENCHMARK_H
+
+#include "shader.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// CommandRecorder չԻ׼: ÿ֡޳¼ objectCount  (׶ԡȡ任),
+// ڵ߳¼Ƶ CommandBuffer Ϊ, ٶ 2, 4, ... ߳ (ֱӲ߳) һ
+// JobSystem  CommandRecorder ¼, ¼ƺʱϲ RenderQueue ĺʱԻߵļٱ
+struct CommandRecorderBenchmarkResult {
+    struct Run {
+        uint32_t threadCount = 0;   // ߳ + ߳, Ҳ CommandRecorder Ķ
+        double recordMs = 0.0;
+        double mergeMs = 0.0;       // submitTo ϲ RenderQueue
+        double speedup = 0.0;       // serialMs / recordMs
+    };
+
+    uint32_t objectCount = 0;
+    size_t commandCount = 0;        // ޳ÿ֡¼Ƶ
+    double serialMs = 0.0;
+    std::vector<Run> runs;
+    bool deterministic = true;      // ߳ϲ˳ȫһ
+};
+
+/**
+ * @brief л׼ӡ (main  --bench-recorder ).
+ * shader ֻȡ, ¼Ʊ GL. ڲΪÿ߳Լ JobSystem,
+ * ʱӦ JobSystem Ĺ߳
+ */
+CommandRecorderBenchmarkResult runCommandRecorderBenchmark(Shader& shader, uint32_t objectCount = 100000, bool print = true);
+
+#endif // COMMAND_RECORDER_BENCHMARK_H
@@ -0,0 +1,208 @@
+#include "CompressedClip.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+static_assert(std::is_trivially_copyable<CompressedClip::Channel>::value, "Compressed channel must be POD");
+static_assert(sizeof(CompressedClip::Channel) == 4, "Unexpected compressed channel size");
+
+namespace {
+    const float kComponentRange = 0.70710678f;  // , λԪľֵ 1/sqrt(2)
+    const float kComponentScale = 32767.0f;     // ÿ 15 λ
+    const float kTimeScale = 65535.0f;
+
+    template<typename T>
+    T readAt(const uint8_t* data) {
+        T value;
+        std::memcpy(&value, data, sizeof(T));
+        return value;
+    }
+}
+
+CompressedClip::CompressedClip(const std::string& name, float duration, std::vector<Channel> channels, std::vector<uint8_t> stream)
+    : m_name(name), m_duration(duration), m_channels(std::move(channels)), m_stream(std::move(stream)) {
+    // ʱ߽, һ
+    std::vector<uint32_t> keyCounts(m_channels.size(), 0);
+    size_t offset = 0;
+    while (offset < m_stream.size()) {
+        if (m_stream.size() - offset < kEntryHeaderSize) {
+            throw std::runtime_error("ERROR::COMPRESSED_CLIP: Truncated key stream in " + m_name);
+        }
+        uint16_t channel = readAt<uint16_t>(m_stream.data() + offset);
+        if (channel >= m_channels.size()) {
+            throw std::runtime_error("ERROR::COMPRESSED_CLIP: Key for unknown channel " + std::to_string(channel) + " in " + m_name);
+        }
+        size_t size = getEntrySize(m_channels[channel].type);
+        if (m_stream.size() - offset < size) {
+            throw std::runtime_error("ERROR::COMPRESSED_CLIP: Truncated key stream in " + m_name);
+        }
+        ++keyCounts[channel];
+        offset += size;
+    }
+    for (uint32_t count : keyCounts) {
+        if (count == 0) {
+            throw std::runtime_error("ERROR::COMPRESSED_CLIP: Channel without keys in " + m_name);
+        }
+        m_keyCount += count;
+    }
+}
+
+// =====  =====
+void CompressedClip::encodeRotation(const glm::quat& rotation, uint16_t (&encoded)[3]) {
+    const float components[4] = { rotation.x, rotation.y, rotation.z, rotation.w };
+    uint32_t largest = 0;
+    for (uint32_t i = 1; i < 4; ++i) {
+        if (std::fabs(components[i]) > std::fabs(components[largest])) {
+            largest = i;
+        }
+    }
+    // q  -q ͬһת, תΪ, ʱ
+    float sign = components[largest] < 0.0f ? -1.0f : 1.0f;
+    uint32_t slot = 0;
+    for (uint32_t i = 0; i < 4; ++i) {
+        if (i == largest) {
+            continue;
+        }
+        float value = std::min(std::max(components[i] * sign / kComponentRange, -1.0f), 1.0f);
+        encoded[slot++] = static_cast<uint16_t>(std::lround((value * 0.5f + 0.5f) * kComponentScale) << 1);
+    }
+    // ±ǰλ
+    encoded[0] |= static_cast<uint16_t>(largest & 1);
+    encoded[1] |= static_cast<uint16_t>(largest >> 1);
+}
+
+glm::quat CompressedClip::decodeRotation(const uint16_t (&encoded)[3]) {
+    uint32_t largest = (encoded[0] & 1) | ((encoded[1] & 1) << 1);
+    float components[4];
+    float sum = 0.0f;
+    uint32_t slot = 0;
+    for (uint32_t i = 0; i < 4; ++i) {
+        if (i == largest) {
+            continue;
+        }
+        float value = ((encoded[slot++] >> 1) / kComponentScale * 2.0f - 1.0f) * kComponentRange;
+        components[i] = value;
+        sum += value * value;
+    }
+    components[largest] = std::sqrt(std::max(1.0f - sum, 0.0f));
+    return glm::quat(components[3], components[0], components[1], components[2]);
+}
+
+uint16_t CompressedClip::quantizeTime(float time, float duration) {
+    if (duration <= 0.0f) {
+        return 0;
+    }
+    float normalized = std::min(std::max(time / duration, 0.0f), 1.0f);
+    return static_cast<uint16_t>(std::lround(normalized * kTimeScale));
+}
+
+float CompressedClip::dequantizeTime(uint16_t time, float duration) {
+    return time / kTimeScale * duration;
+}
+
+// =====  =====
+void CompressedClip::reset(Cursor& cursor) const {
+    cursor.offset = 0;
+    cursor.time = 0.0f;
+    cursor.keys.resize(m_channels.size());
+    for (Cursor::Keys& keys : cursor.keys) {
+        keys.time[1] = -1.0f;  // ûжؼ֡, һؼ֡
+    }
+}
+
+void CompressedClip::sample(float time, Cursor& cursor, LocalPose& pose) const {
+    time = std::min(std::max(time, 0.0f), m_duration);
+    if (cursor.keys.size() != m_channels.size() || time < cursor.time) {
+        reset(cursor);
+    }
+    cursor.time = time;
+
+    // һͨǰյʱ䴦: յѾȥͶ벢ƽ, ò
+    const uint8_t* stream = m_stream.data();
+    while (cursor.offset < m_stream.size()) {
+        const uint8_t* entry = stream + cursor.offset;
+        uint16_t channel = readAt<uint16_t>(entry);
+        Cursor::Keys& keys = cursor.keys[channel];
+        if (keys.time[1] > time) {
+            break;
+        }
+        float value[4];
+        if (m_channels[channel].type == ChannelType::Rotation) {
+            uint16_t encoded[3];
+            std::memcpy(encoded, entry + kEntryHeaderSize, sizeof(encoded));
+            glm::quat rotation = decodeRotation(encoded);
+            value[0] = rotation.x;
+            value[1] = rotation.y;
+            value[2] = rotation.z;
+            value[3] = rotation.w;
+        }
+        else {
+            std::memcpy(value, entry + kEntryHeaderSize, kVectorSize);
+            value[3] = 0.0f;
+        }
+        float keyTime = dequantizeTime(readAt<uint16_t>(entry + sizeof(uint16_t)), m_duration);
+        if (keys.time[1] < 0.0f) {
+            keys.time[0] = keyTime;
+            std::memcpy(keys.value[0], value, sizeof(value));
+        }
+        else {
+            keys.time[0] = keys.time[1];
+            std::memcpy(keys.value[0], keys.value[1], sizeof(value));
+        }
+        keys.time[1] = keyTime;
+        std::memcpy(keys.value[1], value, sizeof(value));
+        cursor.offset += getEntrySize(m_channels[channel].type);
+    }
+
+    for (size_t c = 0; c < m_channels.size(); ++c) {
+        const Channel& channel = m_channels[c];
+        if (channel.joint >= pose.getJointCount()) {
+            continue;
+        }
+        const Cursor::Keys& keys = cursor.keys[c];
+        float span = keys.time[1] - keys.time[0];
+        float factor = span > 0.0f ? std::min(std::max((time - keys.time[0]) / span, 0.0f), 1.0f) : 1.0f;
+        const float* a = keys.value[0];
+        const float* b = keys.value[1];
+
+        if (channel.type == ChannelType::Rotation) {
+            float sign = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3] < 0.0f ? -factor : factor;
+            float q[4];
+            float lengthSquared = 0.0f;
+            for (int i = 0; i < 4; ++i) {
+                q[i] = a[i] * (1.0f - factor) + b[i] * sign;
+                lengthSquared += q[i] * q[i];
+            }
+            float scale = 1.0f / std::sqrt(lengthSquared);
+            pose.getChannel(LocalPose::RotationX)[channel.joint] = q[0] * scale;
+            pose.getChannel(LocalPose::RotationY)[channel.joint] = q[1] * scale;
+            pose.getChannel(LocalPose::RotationZ)[channel.joint] = q[2] * scale;
+            pose.getChannel(LocalPose::RotationW)[channel.joint] = q[3] * scale;
+        }
+        else {
+            uint32_t first = channel.type == ChannelType::Translation ? LocalPose::TranslationX : LocalPose::ScaleX;
+            for (uint32_t i = 0; i < 3; ++i) {
+                pose.getChannel(static_cast<LocalPose::Channel>(first + i))[channel.joint] = a[i] + (b[i] - a[i]) * factor;
+            }
+        }
+    }
+}
+
+void CompressedClip::sample(float time, LocalPose& pose) const {
+    Cursor cursor;
+    sample(time, cursor, pose);
+}
+
+// ===== ʹdemo =====
+// // : AnimationCompressor ѹ,  --import --skinned ֱд .anim
+// CompressedClip walk = AnimationCompressor::compress(rawWalk, skeleton);
+//
+// // ʱ: ÿʵһ Cursor, ʱ䵥ǰʱֻ˳
+// CompressedClip::Cursor cursor;
+// LocalPose pose = skeleton.getBindPose();
+// for (float time = 0.0f; time < walk.getDuration(); time += deltaTime) {
+//     pose = skeleton.getBindPose();
+//     walk.sample(time, cursor, pose);
+// }
@@ -0,0 +1,92 @@
+#ifndef COMPRESSED_CLIP_H
+#define COMPRESSED_CLIP_H
+
+#include "LocalPose.h"
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// CompressedClip: AnimationCompressor Ĳ,  AnimationClip ͬ (ѹݲ).
+// ÿĹؽڷ (ƽ / ת / ) һͨ, ͨĹؼ֡һʱ:
+//    k ؼ֡ǰһؼ֡ʱ䴦, ҲǲֵƽҪһ
+// ˳򲥷ʱ Cursor ֻǰ, ÿͨ浱ǰؼ֡, ֲҲŷڴ.
+// ÿ:
+//   uint16 ͨ, uint16 ʱ ( duration ), Ȼ
+//   ת:        3 x uint16, smallest-three  ( 48 λ)
+//   ƽ / : 3 x float
+class CompressedClip {
+public:
+    enum class ChannelType : uint8_t {
+        Translation,
+        Rotation,
+        Scale,
+    };
+
+    struct Channel {
+        uint16_t joint;
+        ChannelType type;
+        uint8_t reserved;
+    };
+
+    // ״̬, ÿʵһ. ʱ (ѭ) ʱĿͷ¶
+    struct Cursor {
+        struct Keys {
+            float time[2];
+            float value[2][4];  // ƽ / ֻǰ
+        };
+        size_t offset = 0;
+        float time = 0.0f;
+        std::vector<Keys> keys;  // ÿͨһ
+    };
+
+    static constexpr size_t kEntryHeaderSize = 2 * sizeof(uint16_t);
+    static constexpr size_t kRotationSize = 3 * sizeof(uint16_t);
+    static constexpr size_t kVectorSize = 3 * sizeof(float);
+
+    CompressedClip() = default;
+
+    /**
+     * @brief  AnimationCompressor  AnimationFile . һ.
+     * @throws std::runtime_error ضϻ˲ڵͨʱ׳
+     */
+    CompressedClip(const std::string& name, float duration, std::vector<Channel> channels, std::vector<uint8_t> stream);
+
+    const std::string& getName() const { return m_name; }
+    float getDuration() const { return m_duration; }
+    const std::vector<Channel>& getChannels() const { return m_channels; }
+    const std::vector<uint8_t>& getStream() const { return m_stream; }
+    size_t getKeyCount() const { return m_keyCount; }
+
+    // ͨ + ֽ
+    size_t getDataSize() const { return m_channels.size() * sizeof(Channel) + m_stream.size(); }
+
+    /**
+     * @brief  time , д pose ͨķ. time  [0, duration].
+     * ûͨķ pose ԭֵ (ѹʱȥ˵ڰƵĳͨ), ҪȰ pose Ϊ.
+     */
+    void sample(float time, Cursor& cursor, LocalPose& pose) const;
+
+    // : ÿζĿͷ, ֻʺżһ
+    void sample(float time, LocalPose& pose) const;
+
+    // =====  (ѹ) =====
+    static void encodeRotation(const glm::quat& rotation, uint16_t (&encoded)[3]);
+    static glm::quat decodeRotation(const uint16_t (&encoded)[3]);
+    static uint16_t quantizeTime(float time, float duration);
+    static float dequantizeTime(uint16_t time, float duration);
+    static size_t getEntrySize(ChannelType type) { return kEntryHeaderSize + (type == ChannelType::Rotation ? kRotationSize : kVectorSize); }
+
+private:
+    void reset(Cursor& cursor) const;
+
+    std::string m_name;
+    float m_duration = 0.0f;
+    std::vector<Channel> m_channels;
+    std::vector<uint8_t> m_stream;
+    size_t m_keyCount = 0;
+};
+
+#endif // COMPRESSED_CLIP_H
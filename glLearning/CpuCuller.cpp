@@ -0,0 +1,236 @@
+#include "CpuCuller.h"
+#include "Simd.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    // ÿİΧ,  Simd::kWidth ı
+    const uint32_t kParallelGrain = 16 * 1024;
+
+    // һƽ㲥ͨ, abs  AABB ͶӰ뾶
+    struct PlaneLanes {
+        Simd::Float x, y, z, w;
+        Simd::Float absX, absY, absZ;
+    };
+
+    void checkViewCount(uint32_t viewCount) {
+        if (viewCount > CpuCuller::kMaxViews) {
+            throw std::runtime_error("ERROR::CPU_CULLER: Too many views (" + std::to_string(viewCount) + "), at most "
+                + std::to_string(CpuCuller::kMaxViews));
+        }
+    }
+
+    /**
+     * ޳ [begin, end) ڵİΧ,  v ׶Ŀɼ± outputs[v][counts[v]] ʼд counts[v].
+     * ÿȰ kWidth ±ȫд, ֻǰɼĸ,  outputs[v] ҪȽ kWidth λ
+     */
+    template<bool Boxes>
+    void cullRange(const BoundingVolumes& volumes, const Frustum* frustums, uint32_t viewCount, uint32_t begin, uint32_t end,
+        uint32_t* const* outputs, uint32_t* counts) {
+        PlaneLanes planes[CpuCuller::kMaxViews][Frustum::Count];
+        for (uint32_t v = 0; v < viewCount; ++v) {
+            for (int p = 0; p < Frustum::Count; ++p) {
+                const glm::vec4& plane = frustums[v].planes[p];
+                planes[v][p] = { Simd::set1(plane.x), Simd::set1(plane.y), Simd::set1(plane.z), Simd::set1(plane.w),
+                    Simd::set1(std::fabs(plane.x)), Simd::set1(std::fabs(plane.y)), Simd::set1(std::fabs(plane.z)) };
+            }
+        }
+
+        const float* centerX = volumes.getData(BoundingVolumes::CenterX);
+        const float* centerY = volumes.getData(BoundingVolumes::CenterY);
+        const float* centerZ = volumes.getData(BoundingVolumes::CenterZ);
+        const float* extentX = volumes.getData(BoundingVolumes::ExtentX);
+        const float* extentY = volumes.getData(BoundingVolumes::ExtentY);
+        const float* extentZ = volumes.getData(BoundingVolumes::ExtentZ);
+        const Simd::Float zero = Simd::set1(0.0f);
+
+        for (uint32_t i = begin; i < end; i += Simd::kWidth) {
+            Simd::Float x = Simd::load(centerX + i);
+            Simd::Float y = Simd::load(centerY + i);
+            Simd::Float z = Simd::load(centerZ + i);
+            Simd::Float ex = Simd::load(extentX + i);
+            Simd::Float ey = Boxes ? Simd::load(extentY + i) : zero;
+            Simd::Float ez = Boxes ? Simd::load(extentZ + i) : zero;
+            Simd::Float negativeRadius = Simd::sub(zero, ex);
+            uint32_t remaining = end - i;
+            int laneMask = remaining >= static_cast<uint32_t>(Simd::kWidth) ? (1 << Simd::kWidth) - 1 : (1 << remaining) - 1;
+
+            for (uint32_t v = 0; v < viewCount; ++v) {
+                Simd::Float inside = zero;
+                for (int p = 0; p < Frustum::Count; ++p) {
+                    const PlaneLanes& plane = planes[v][p];
+                    //  Frustum ı汾ͬ˳
+                    Simd::Float distance = Simd::add(Simd::add(Simd::add(Simd::mul(plane.x, x), Simd::mul(plane.y, y)),
+                        Simd::mul(plane.z, z)), plane.w);
+                    Simd::Float test;
+                    if (Boxes) {
+                        // ĵƽľϺڷϵͶӰ뾶, ȼ p-vertex 
+                        Simd::Float radius = Simd::add(Simd::add(Simd::mul(plane.absX, ex), Simd::mul(plane.absY, ey)),
+                            Simd::mul(plane.absZ, ez));
+                        test = Simd::greaterEqual(Simd::add(distance, radius), zero);
+                    }
+                    else {
+                        test = Simd::greaterEqual(distance, negativeRadius);
+                    }
+                    inside = p == 0 ? test : Simd::maskAnd(inside, test);
+                }
+
+                int bits = Simd::maskBits(inside) & laneMask;
+                uint32_t* output = outputs[v] + counts[v];
+                uint32_t count = 0;
+                for (int lane = 0; lane < Simd::kWidth; ++lane) {
+                    output[count] = i + lane;
+                    count += (bits >> lane) & 1;
+                }
+                counts[v] += count;
+            }
+        }
+    }
+
+    void cullRange(const BoundingVolumes& volumes, const Frustum* frustums, uint32_t viewCount, uint32_t begin, uint32_t end,
+        uint32_t* const* outputs, uint32_t* counts) {
+        if (volumes.getType() == BoundingVolumes::Boxes) {
+            cullRange<true>(volumes, frustums, viewCount, begin, end, outputs, counts);
+        }
+        else {
+            cullRange<false>(volumes, frustums, viewCount, begin, end, outputs, counts);
+        }
+    }
+}
+
+// ===== Χ =====
+BoundingVolumes::BoundingVolumes(Type type)
+    : m_type(type) {
+    clear();
+}
+
+void BoundingVolumes::checkType(Type type) const {
+    if (type != m_type) {
+        throw std::runtime_error(type == Spheres ? "ERROR::CPU_CULLER: Adding a sphere to a box set"
+            : "ERROR::CPU_CULLER: Adding a box to a sphere set");
+    }
+}
+
+uint32_t BoundingVolumes::addSphere(const glm::vec3& center, float radius) {
+    checkType(Spheres);
+    for (std::vector<float>& data : m_data) {
+        data.push_back(0.0f);  // ĩβĲ
+    }
+    setSphere(m_count, center, radius);
+    return m_count++;
+}
+
+uint32_t BoundingVolumes::addBox(const glm::vec3& minCorner, const glm::vec3& maxCorner) {
+    checkType(Boxes);
+    for (std::vector<float>& data : m_data) {
+        data.push_back(0.0f);
+    }
+    setBox(m_count, minCorner, maxCorner);
+    return m_count++;
+}
+
+void BoundingVolumes::setSphere(uint32_t index, const glm::vec3& center, float radius) {
+    m_data[CenterX][index] = center.x;
+    m_data[CenterY][index] = center.y;
+    m_data[CenterZ][index] = center.z;
+    m_data[ExtentX][index] = radius;
+}
+
+void BoundingVolumes::setBox(uint32_t index, const glm::vec3& minCorner, const glm::vec3& maxCorner) {
+    glm::vec3 center = (minCorner + maxCorner) * 0.5f;
+    glm::vec3 extents = (maxCorner - minCorner) * 0.5f;
+    m_data[CenterX][index] = center.x;
+    m_data[CenterY][index] = center.y;
+    m_data[CenterZ][index] = center.z;
+    m_data[ExtentX][index] = extents.x;
+    m_data[ExtentY][index] = extents.y;
+    m_data[ExtentZ][index] = extents.z;
+}
+
+void BoundingVolumes::clear() {
+    m_count = 0;
+    for (std::vector<float>& data : m_data) {
+        data.assign(Simd::kWidth, 0.0f);
+    }
+}
+
+void BoundingVolumes::reserve(uint32_t count) {
+    for (std::vector<float>& data : m_data) {
+        data.reserve(count + Simd::kWidth);
+    }
+}
+
+// ===== ޳ =====
+void CpuCuller::cull(const BoundingVolumes& volumes, const Frustum& frustum, std::vector<uint32_t>& visible) {
+    cull(volumes, &frustum, 1, &visible);
+}
+
+void CpuCuller::cull(const BoundingVolumes& volumes, const Frustum* frustums, uint32_t viewCount, std::vector<uint32_t>* visible) {
+    checkViewCount(viewCount);
+    uint32_t* outputs[kMaxViews];
+    uint32_t counts[kMaxViews] = {};
+    for (uint32_t v = 0; v < viewCount; ++v) {
+        visible[v].resize(volumes.getCount() + Simd::kWidth);
+        outputs[v] = visible[v].data();
+    }
+    cullRange(volumes, frustums, viewCount, 0, volumes.getCount(), outputs, counts);
+    for (uint32_t v = 0; v < viewCount; ++v) {
+        visible[v].resize(counts[v]);
+    }
+}
+
+void CpuCuller::cull(JobSystem& jobs, const BoundingVolumes& volumes, const Frustum* frustums, uint32_t viewCount,
+    std::vector<uint32_t>* visible) {
+    checkViewCount(viewCount);
+    const uint32_t count = volumes.getCount();
+    const uint32_t rangeCount = (count + kParallelGrain - 1) / kParallelGrain;
+    if (rangeCount <= 1) {
+        cull(volumes, frustums, viewCount, visible);
+        return;
+    }
+
+    // ÿθд (ȫɼԤ), 󰴶ε˳ǰ
+    std::vector<uint32_t> rangeCounts(static_cast<size_t>(rangeCount) * viewCount, 0);
+    for (uint32_t v = 0; v < viewCount; ++v) {
+        visible[v].resize(count + Simd::kWidth);
+    }
+    jobs.parallelFor(rangeCount, 1, [&](size_t first, size_t last) {
+        for (size_t range = first; range < last; ++range) {
+            uint32_t begin = static_cast<uint32_t>(range) * kParallelGrain;
+            uint32_t end = std::min(begin + kParallelGrain, count);
+            uint32_t* outputs[kMaxViews];
+            for (uint32_t v = 0; v < viewCount; ++v) {
+                outputs[v] = visible[v].data() + begin;
+            }
+            cullRange(volumes, frustums, viewCount, begin, end, outputs, &rangeCounts[range * viewCount]);
+        }
+    });
+
+    for (uint32_t v = 0; v < viewCount; ++v) {
+        uint32_t* data = visible[v].data();
+        uint32_t total = 0;
+        for (uint32_t range = 0; range < rangeCount; ++range) {
+            uint32_t rangeVisible = rangeCounts[static_cast<size_t>(range) * viewCount + v];
+            std::copy(data + range * kParallelGrain, data + range * kParallelGrain + rangeVisible, data + total);
+            total += rangeVisible;
+        }
+        visible[v].resize(total);
+    }
+}
+
+// ===== ʹdemo =====
+// BoundingVolumes volumes(BoundingVolumes::Boxes);
+// for (const Object& object : objects) {
+//     volumes.addBox(object.worldMin, object.worldMax);
+// }
+//
+// // ÿ֡: Ӱһ
+// Frustum views[4] = { Frustum::fromMatrix(projection * view), Frustum::fromMatrix(cascades[0]),
+//     Frustum::fromMatrix(cascades[1]), Frustum::fromMatrix(cascades[2]) };
+// std::vector<uint32_t> visible[4];
+// CpuCuller::cull(jobs, volumes, views, 4, visible);
+// for (uint32_t index : visible[0]) {
+//     submitDraw(objects[index]);
+// }
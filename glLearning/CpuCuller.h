@@ -0,0 +1,64 @@
+#ifndef CPU_CULLER_H
+#define CPU_CULLER_H
+
+#include "Frustum.h"
+#include "JobSystem.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+// BoundingVolumes: ޳õһΧ, ȫȫ AABB,  SoA .
+// AABB Ϊ + ߳, İ뾶ڰ߳ x λ. ĩβ뵽 Simd::kWidth, ȡԽ
+class BoundingVolumes {
+public:
+    enum Type { Spheres, Boxes };
+    enum Component { CenterX = 0, CenterY, CenterZ, ExtentX, ExtentY, ExtentZ, ComponentCount };
+
+    explicit BoundingVolumes(Type type);
+
+    // Ͳʱ׳ std::runtime_error. ±
+    uint32_t addSphere(const glm::vec3& center, float radius);
+    uint32_t addBox(const glm::vec3& minCorner, const glm::vec3& maxCorner);
+    void setSphere(uint32_t index, const glm::vec3& center, float radius);
+    void setBox(uint32_t index, const glm::vec3& minCorner, const glm::vec3& maxCorner);
+
+    void clear();
+    void reserve(uint32_t count);
+
+    Type getType() const { return m_type; }
+    uint32_t getCount() const { return m_count; }
+    const float* getData(Component component) const { return m_data[component].data(); }
+
+private:
+    void checkType(Type type) const;
+
+    Type m_type;
+    uint32_t m_count = 0;
+    std::vector<float> m_data[ComponentCount];  // ÿ m_count + Simd::kWidth 
+};
+
+// CpuCuller:  CPU  SIMD ׶޳, һβ Simd::kWidth Χ (AVX 8 , SSE 4 ),
+// ɼΧĽ±б. ׶ ( + Ӱ) һα, ÿΧֻһ.
+// ж Frustum::intersectsSphere / intersectsAABB ͬ: , ֻ޳ȫĳƽİΧ.
+class CpuCuller {
+public:
+    static constexpr uint32_t kMaxViews = 8;
+
+    // visible պɼΧ± ()
+    static void cull(const BoundingVolumes& volumes, const Frustum& frustum, std::vector<uint32_t>& visible);
+
+    /**
+     * @brief  viewCount ׶һ޳,  v ׶Ľд visible[v].
+     * @throws std::runtime_error viewCount  kMaxViews ʱ׳
+     */
+    static void cull(const BoundingVolumes& volumes, const Frustum* frustums, uint32_t viewCount, std::vector<uint32_t>* visible);
+
+    // ͬ, ֶ jobs ϲ, 뵥߳ȫͬ. ܵȴ jobs ߳ϵ
+    static void cull(JobSystem& jobs, const BoundingVolumes& volumes, const Frustum* frustums, uint32_t viewCount,
+        std::vector<uint32_t>* visible);
+
+private:
+    CpuCuller() = delete;
+};
+
+#endif // CPU_CULLER_H
@@ -0,0 +1,174 @@
+#include "CullingBenchmark.h"
+#include "Benchmark.h"
+#include "CpuCuller.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+namespace {
+    const uint32_t kViewCount = 4;
+    const int kFrames = 20;
+
+    // : ÿһṹ
+    struct ScalarObject {
+        glm::vec3 minCorner;
+        glm::vec3 maxCorner;
+        glm::vec3 center;
+        float radius;
+    };
+
+    void cullScalarBoxes(const std::vector<ScalarObject>& objects, const Frustum& frustum, std::vector<uint32_t>& visible) {
+        visible.clear();
+        for (uint32_t i = 0; i < objects.size(); ++i) {
+            if (frustum.intersectsAABB(objects[i].minCorner, objects[i].maxCorner)) {
+                visible.push_back(i);
+            }
+        }
+    }
+
+    void cullScalarSpheres(const std::vector<ScalarObject>& objects, const Frustum& frustum, std::vector<uint32_t>& visible) {
+        visible.clear();
+        for (uint32_t i = 0; i < objects.size(); ++i) {
+            if (frustum.intersectsSphere(objects[i].center, objects[i].radius)) {
+                visible.push_back(i);
+            }
+        }
+    }
+
+    // ±бĶԳƲС
+    size_t countMismatches(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b) {
+        std::vector<uint32_t> difference;
+        std::set_symmetric_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(difference));
+        return difference.size();
+    }
+
+    // ԭ㿴 -Z, Զƽ 500; ƽйбϷ, ߷򸲸 [0, 30], [30, 120], [120, 500]
+    void buildViews(Frustum* views) {
+        glm::mat4 view = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        views[0] = Frustum::fromMatrix(glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 500.0f) * view);
+
+        const float splits[kViewCount] = { 0.0f, 30.0f, 120.0f, 500.0f };
+        glm::vec3 lightDirection = glm::normalize(glm::vec3(-0.3f, -1.0f, -0.4f));
+        for (uint32_t c = 1; c < kViewCount; ++c) {
+            float nearDistance = splits[c - 1];
+            float farDistance = splits[c];
+            glm::vec3 center(0.0f, 0.0f, -(nearDistance + farDistance) * 0.5f);
+            float radius = (farDistance - nearDistance) * 0.5f + farDistance * 0.6f;
+            glm::mat4 lightView = glm::lookAt(center - lightDirection * radius * 2.0f, center, glm::vec3(0.0f, 0.0f, -1.0f));
+            glm::mat4 lightProjection = glm::ortho(-radius, radius, -radius, radius, 0.0f, radius * 4.0f);
+            views[c] = Frustum::fromMatrix(lightProjection * lightView);
+        }
+    }
+}
+
+CullingBenchmarkResult runCullingBenchmark(JobSystem& jobs, uint32_t objectCount, bool print) {
+    CullingBenchmarkResult result;
+    result.objectCount = objectCount;
+    result.viewCount = kViewCount;
+
+    uint32_t seed = 1;
+    std::vector<ScalarObject> objects(objectCount);
+    BoundingVolumes spheres(BoundingVolumes::Spheres);
+    BoundingVolumes boxes(BoundingVolumes::Boxes);
+    spheres.reserve(objectCount);
+    boxes.reserve(objectCount);
+    for (ScalarObject& object : objects) {
+        float x = Benchmark::random(seed) - 0.5f;
+        float y = Benchmark::random(seed) * 0.1f - 0.05f;
+        float z = Benchmark::random(seed) - 0.5f;
+        glm::vec3 center = glm::vec3(x, y, z) * 1000.0f;
+        glm::vec3 extents = Benchmark::randomVector(seed) * 2.0f + glm::vec3(0.25f);
+        object.minCorner = center - extents;
+        object.maxCorner = center + extents;
+        object.center = center;
+        object.radius = glm::length(extents);
+        spheres.addSphere(object.center, object.radius);
+        boxes.addBox(object.minCorner, object.maxCorner);
+    }
+
+    Frustum views[kViewCount];
+    buildViews(views);
+    std::vector<uint32_t> scalarVisible[kViewCount];
+    std::vector<uint32_t> simdVisible[kViewCount];
+
+    // ===== ׶:  / AABB =====
+    Benchmark::TimePoint start = Benchmark::now();
+    for (int frame = 0; frame < kFrames; ++frame) {
+        cullScalarSpheres(objects, views[0], scalarVisible[0]);
+    }
+    result.scalarSphereMs = Benchmark::millisecondsSince(start) / kFrames;
+    start = Benchmark::now();
+    for (int frame = 0; frame < kFrames; ++frame) {
+        CpuCuller::cull(spheres, views[0], simdVisible[0]);
+    }
+    result.simdSphereMs = Benchmark::millisecondsSince(start) / kFrames;
+    result.mismatchCount += countMismatches(scalarVisible[0], simdVisible[0]);
+
+    start = Benchmark::now();
+    for (int frame = 0; frame < kFrames; ++frame) {
+        cullScalarBoxes(objects, views[0], scalarVisible[0]);
+    }
+    result.scalarBoxMs = Benchmark::millisecondsSince(start) / kFrames;
+    start = Benchmark::now();
+    for (int frame = 0; frame < kFrames; ++frame) {
+        CpuCuller::cull(boxes, views[0], simdVisible[0]);
+    }
+    result.simdBoxMs = Benchmark::millisecondsSince(start) / kFrames;
+    result.mismatchCount += countMismatches(scalarVisible[0], simdVisible[0]);
+    result.visibleCount = simdVisible[0].size();
+
+    // =====  + Ӱ =====
+    start = Benchmark::now();
+    for (int frame = 0; frame < kFrames; ++frame) {
+        for (uint32_t v = 0; v < kViewCount; ++v) {
+            cullScalarBoxes(objects, views[v], scalarVisible[v]);
+        }
+    }
+    result.scalarViewsMs = Benchmark::millisecondsSince(start) / kFrames;
+
+    start = Benchmark::now();
+    for (int frame = 0; frame < kFrames; ++frame) {
+        for (uint32_t v = 0; v < kViewCount; ++v) {
+            CpuCuller::cull(boxes, views[v], simdVisible[v]);
+        }
+    }
+    result.separateViewsMs = Benchmark::millisecondsSince(start) / kFrames;
+
+    start = Benchmark::now();
+    for (int frame = 0; frame < kFrames; ++frame) {
+        CpuCuller::cull(boxes, views, kViewCount, simdVisible);
+    }
+    result.multiViewMs = Benchmark::millisecondsSince(start) / kFrames;
+    for (uint32_t v = 0; v < kViewCount; ++v) {
+        result.mismatchCount += countMismatches(scalarVisible[v], simdVisible[v]);
+    }
+
+    start = Benchmark::now();
+    for (int frame = 0; frame < kFrames; ++frame) {
+        CpuCuller::cull(jobs, boxes, views, kViewCount, simdVisible);
+    }
+    result.parallelViewsMs = Benchmark::millisecondsSince(start) / kFrames;
+    for (uint32_t v = 0; v < kViewCount; ++v) {
+        result.mismatchCount += countMismatches(scalarVisible[v], simdVisible[v]);
+    }
+
+    if (print) {
+        std::cout << "===== Culling benchmark (" << objectCount << " objects, " << result.visibleCount << " visible, "
+            << jobs.getWorkerCount() << " workers) =====" << std::endl;
+        std::cout << "spheres glm:       " << result.scalarSphereMs << " ms/frame" << std::endl;
+        std::cout << "spheres SIMD:      " << result.simdSphereMs << " ms/frame ("
+            << result.scalarSphereMs / std::max(result.simdSphereMs, 1e-6) << "x)" << std::endl;
+        std::cout << "boxes glm:         " << result.scalarBoxMs << " ms/frame" << std::endl;
+        std::cout << "boxes SIMD:        " << result.simdBoxMs << " ms/frame ("
+            << result.scalarBoxMs / std::max(result.simdBoxMs, 1e-6) << "x)" << std::endl;
+        std::cout << kViewCount << " views glm:       " << result.scalarViewsMs << " ms/frame" << std::endl;
+        std::cout << kViewCount << " views separate:  " << result.separateViewsMs << " ms/frame" << std::endl;
+        std::cout << kViewCount << " views one pass:  " << result.multiViewMs << " ms/frame ("
+            << result.scalarViewsMs / std::max(result.multiViewMs, 1e-6) << "x)" << std::endl;
+        std::cout << kViewCount << " views parallel:  " << result.parallelViewsMs << " ms/frame" << std::endl;
+        std::cout << "mismatches:        " << result.mismatchCount << std::endl;
+    }
+    return result;
+}
@@ -0,0 +1,29 @@
+#ifndef CULLING_BENCHMARK_H
+#define CULLING_BENCHMARK_H
+
+#include "JobSystem.h"
+#include <cstddef>
+#include <cstdint>
+
+// CPU ޳׼: ֲ, ׶ + 3 Ӱ, Ա
+//    glm (Frustum::intersectsSphere / intersectsAABB, AoS)  CpuCuller (SoA + SIMD)
+//   4 ׶ 4 ޳һαͬʱ޳, Լ JobSystem 
+struct CullingBenchmarkResult {
+    uint32_t objectCount = 0;
+    uint32_t viewCount = 0;
+    double scalarSphereMs = 0.0;   // ׶ ()
+    double simdSphereMs = 0.0;
+    double scalarBoxMs = 0.0;
+    double simdBoxMs = 0.0;
+    double scalarViewsMs = 0.0;    // ȫ׶, AABB
+    double separateViewsMs = 0.0;  // ÿ׶һ CpuCuller::cull
+    double multiViewMs = 0.0;      // һε޳ȫ׶
+    double parallelViewsMs = 0.0;
+    size_t visibleCount = 0;       // ׶ڵ AABB 
+    size_t mismatchCount = 0;      //  glm һµĸ (вԺϼ)
+};
+
+// л׼ӡ (main  --bench-cull ). ڴ jobs ߳ϵ
+CullingBenchmarkResult runCullingBenchmark(JobSystem& jobs, uint32_t objectCount = 100000, bool print = true);
+
+#endif // CULLING_BENCHMARK_H
@@ -0,0 +1,87 @@
+#include "DepthPyramid.h"
+#include "GLStateCache.h"
+#include <algorithm>
+
+namespace {
+    //  value  2 
+    int previousPowerOfTwo(int value) {
+        int result = 1;
+        while (result * 2 <= value) {
+            result *= 2;
+        }
+        return result;
+    }
+}
+
+DepthPyramid::DepthPyramid(const std::string& shaderPath)
+    : m_reduceShader(shaderPath) {
+}
+
+DepthPyramid::~DepthPyramid() {
+    if (m_texture != 0) {
+        GLStateCache::getInstance().deleteTexture(m_texture);
+    }
+}
+
+void DepthPyramid::allocate(int sourceWidth, int sourceHeight) {
+    if (m_texture != 0) {
+        GLStateCache::getInstance().deleteTexture(m_texture);
+    }
+
+    // ײȡȻ 2 , ֮ÿϸ, ԼʱᶪʧԵ
+    m_sourceWidth = sourceWidth;
+    m_sourceHeight = sourceHeight;
+    m_width = previousPowerOfTwo(sourceWidth);
+    m_height = previousPowerOfTwo(sourceHeight);
+    m_levels = 1;
+    while ((m_width >> m_levels) > 0 || (m_height >> m_levels) > 0) {
+        ++m_levels;
+    }
+
+    glGenTextures(1, &m_texture);
+    GLStateCache::getInstance().bindTextureOnActiveUnit(GL_TEXTURE_2D, m_texture);
+    glTexStorage2D(GL_TEXTURE_2D, m_levels, GL_R32F, m_width, m_height);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+}
+
+void DepthPyramid::build(GLuint depthTexture, int width, int height) {
+    if (m_texture == 0 || width != m_sourceWidth || height != m_sourceHeight) {
+        allocate(width, height);
+    }
+
+    m_reduceShader.use();
+    m_reduceShader.setInt("inputDepth", 0);
+    GLStateCache& state = GLStateCache::getInstance();
+
+    // Ԫ 0 Ͽܲ Texture::bind 󶨵Ĺ, Ĳ
+    state.bindSampler(0, 0);
+
+    int inputWidth = width;
+    int inputHeight = height;
+    for (int level = 0; level < m_levels; ++level) {
+        int outputWidth = std::max(1, m_width >> level);
+        int outputHeight = std::max(1, m_height >> level);
+
+        //  0 ȡ, ȡһ
+        if (level == 0) {
+            state.bindTexture(0, GL_TEXTURE_2D, depthTexture);
+            m_reduceShader.setInt("inputLevel", 0);
+        }
+        else {
+            state.bindTexture(0, GL_TEXTURE_2D, m_texture);
+            m_reduceShader.setInt("inputLevel", level - 1);
+        }
+        m_reduceShader.setIVec2("inputSize", glm::ivec2(inputWidth, inputHeight));
+        m_reduceShader.setIVec2("outputSize", glm::ivec2(outputWidth, outputHeight));
+        glBindImageTexture(0, m_texture, level, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+
+        m_reduceShader.dispatch((outputWidth + 7) / 8, (outputHeight + 7) / 8);
+        glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+
+        inputWidth = outputWidth;
+        inputHeight = outputHeight;
+    }
+}
@@ -0,0 +1,45 @@
+#ifndef DEPTH_PYRAMID_H
+#define DEPTH_PYRAMID_H
+
+#include "Shader.h"
+#include <glad/glad.h>
+#include <string>
+
+// DepthPyramid: 㼶Ȼ (Hi-Z), ÿһһ 2x2 Զ
+//  Shader/depth_pyramid.comp ,  GpuCuller ڵ޳
+class DepthPyramid {
+public:
+    // shaderPath: ȹԼɫ·
+    explicit DepthPyramid(const std::string& shaderPath = "../Shader/depth_pyramid.comp");
+    ~DepthPyramid();
+
+    // ֹ
+    DepthPyramid(const DepthPyramid&) = delete;
+    DepthPyramid& operator=(const DepthPyramid&) = delete;
+
+    /**
+     * @brief ɽ. ߴ仯ʱ·.
+     * @param depthTexture һ֡ (GL_DEPTH_COMPONENT*).
+     * @param width .
+     * @param height ߶.
+     */
+    void build(GLuint depthTexture, int width, int height);
+
+    GLuint getTexture() const { return m_texture; }
+    int getWidth() const { return m_width; }
+    int getHeight() const { return m_height; }
+    int getLevels() const { return m_levels; }
+
+private:
+    Shader m_reduceShader;
+    GLuint m_texture = 0;
+    int m_width = 0;
+    int m_height = 0;
+    int m_levels = 0;
+    int m_sourceWidth = 0;
+    int m_sourceHeight = 0;
+
+    void allocate(int sourceWidth, int sourceHeight);
+};
+
+#endif // DEPTH_PYRAMID_H
@@ -0,0 +1,146 @@
+#include "EntityBenchmark.h"
+#include "Benchmark.h"
+#include "EntityCommandBuffer.h"
+#include "EntityManager.h"
+#include "SceneComponents.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace {
+    const int kFrames = 20;
+
+    // : ÿʵһṹ
+    struct ArrayEntity {
+        Transform transform;
+        Bounds bounds;
+    };
+
+    //  EntitySystems::updateBounds ͬļ
+    void transformBounds(const Transform& transform, Bounds& bounds) {
+        const glm::mat4& m = transform.world;
+        glm::vec3 center = (bounds.localMin + bounds.localMax) * 0.5f;
+        glm::vec3 extents = (bounds.localMax - bounds.localMin) * 0.5f;
+        glm::vec3 worldCenter = glm::vec3(m * glm::vec4(center, 1.0f));
+        glm::vec3 worldExtents;
+        for (int row = 0; row < 3; ++row) {
+            worldExtents[row] = std::fabs(m[0][row]) * extents.x + std::fabs(m[1][row]) * extents.y + std::fabs(m[2][row]) * extents.z;
+        }
+        bounds.worldMin = worldCenter - worldExtents;
+        bounds.worldMax = worldCenter + worldExtents;
+    }
+
+    // ʵžĽṹ仯: 0 ɾ, 1  MeshRef, ಻. ɾʵбΪ 8 ıٱһϵͳɾһ
+    bool shouldDestroy(Entity entity) { return entity.index % 4 == 0; }
+    bool shouldAddMesh(Entity entity) { return entity.index % 4 == 1; }
+    bool isDestroyedTwice(Entity entity) { return entity.index % 8 == 0; }
+}
+
+EntityBenchmarkResult runEntityBenchmark(JobSystem& jobs, uint32_t entityCount, bool print) {
+    EntityBenchmarkResult result;
+    result.entityCount = entityCount;
+
+    uint32_t seed = 1;
+    EntityManager entities;
+    std::vector<ArrayEntity> arrayEntities(entityCount);
+    std::vector<Entity> handles(entityCount);
+    for (uint32_t i = 0; i < entityCount; ++i) {
+        glm::vec3 position = (Benchmark::randomVector(seed) - glm::vec3(0.5f)) * 1000.0f;
+        glm::vec3 axis = glm::normalize(Benchmark::randomVector(seed) - glm::vec3(0.5f));
+        ArrayEntity& entity = arrayEntities[i];
+        entity.transform.world = glm::rotate(glm::translate(glm::mat4(1.0f), position), Benchmark::random(seed) * 6.2831853f, axis);
+        entity.bounds.localMin = glm::vec3(-0.5f);
+        entity.bounds.localMax = glm::vec3(0.5f);
+        handles[i] = entities.createEntity(entity.transform, entity.bounds);
+    }
+    result.chunkCount = entities.getChunkCount();
+
+    // ===== : ṹ vs  vs 鲢 =====
+    Benchmark::TimePoint start = Benchmark::now();
+    for (int frame = 0; frame < kFrames; ++frame) {
+        for (ArrayEntity& entity : arrayEntities) {
+            transformBounds(entity.transform, entity.bounds);
+        }
+    }
+    result.arrayMs = Benchmark::millisecondsSince(start) / kFrames;
+
+    start = Benchmark::now();
+    for (int frame = 0; frame < kFrames; ++frame) {
+        entities.forEach<Transform, Bounds>([](Entity, const Transform& transform, Bounds& bounds) {
+            transformBounds(transform, bounds);
+        });
+    }
+    result.forEachMs = Benchmark::millisecondsSince(start) / kFrames;
+
+    start = Benchmark::now();
+    for (int frame = 0; frame < kFrames; ++frame) {
+        entities.parallelForEach<Transform, Bounds>(jobs, [](Entity, const Transform& transform, Bounds& bounds) {
+            transformBounds(transform, bounds);
+        });
+    }
+    result.parallelForEachMs = Benchmark::millisecondsSince(start) / kFrames;
+
+    // ===== : ¼, ߳ playback =====
+    EntityCommandBuffer commands(jobs);
+    start = Benchmark::now();
+    entities.parallelForEach<Transform, Bounds>(jobs, [&](Entity entity, const Transform&, const Bounds&) {
+        if (shouldDestroy(entity)) {
+            commands.destroyEntity(entity);
+            if (isDestroyedTwice(entity)) {
+                commands.destroyEntity(entity);  // ڶϵͳ: playback ʱĿѱɾ, 
+            }
+        }
+        else if (shouldAddMesh(entity)) {
+            commands.addComponent(entity, MeshRef());
+        }
+    });
+    result.recordMs = Benchmark::millisecondsSince(start);
+    result.commandCount = commands.getCommandCount();
+
+    start = Benchmark::now();
+    commands.playback(entities);
+    result.playbackMs = Benchmark::millisecondsSince(start);
+
+    // ȫɾִһ
+    EntityCommandBuffer deadCommands;
+    for (Entity entity : handles) {
+        if (shouldDestroy(entity)) {
+            deadCommands.destroyEntity(entity);
+        }
+    }
+    result.deadCommandCount = deadCommands.getCommandCount();
+    start = Benchmark::now();
+    deadCommands.playback(entities);
+    result.deadPlaybackMs = Benchmark::millisecondsSince(start);
+
+    // ===== ȷ =====
+    uint32_t expectedAlive = 0;
+    uint32_t expectedMeshes = 0;
+    for (Entity entity : handles) {
+        bool alive = entities.isAlive(entity);
+        result.valid = result.valid && alive != shouldDestroy(entity) &&
+            (!alive || entities.hasComponent<MeshRef>(entity) == shouldAddMesh(entity));
+        expectedAlive += shouldDestroy(entity) ? 0 : 1;
+        expectedMeshes += shouldAddMesh(entity) ? 1 : 0;
+    }
+    uint32_t meshCount = 0;
+    entities.forEach<MeshRef>([&](Entity, const MeshRef&) { ++meshCount; });
+    result.valid = result.valid && entities.getEntityCount() == expectedAlive && meshCount == expectedMeshes;
+
+    if (print) {
+        std::cout << "===== Entity benchmark (" << entityCount << " entities, " << result.chunkCount << " chunks, "
+            << jobs.getWorkerCount() << " workers) =====" << std::endl;
+        std::cout << "array of structs:  " << result.arrayMs << " ms/frame" << std::endl;
+        std::cout << "chunk forEach:     " << result.forEachMs << " ms/frame ("
+            << result.arrayMs / std::max(result.forEachMs, 1e-6) << "x)" << std::endl;
+        std::cout << "parallelForEach:   " << result.parallelForEachMs << " ms/frame ("
+            << result.arrayMs / std::max(result.parallelForEachMs, 1e-6) << "x)" << std::endl;
+        std::cout << "record commands:   " << result.recordMs << " ms (" << result.commandCount << " commands)" << std::endl;
+        std::cout << "playback:          " << result.playbackMs << " ms" << std::endl;
+        std::cout << "playback (dead):   " << result.deadPlaybackMs << " ms (" << result.deadCommandCount << " skipped)" << std::endl;
+        std::cout << "result:            " << (result.valid ? "valid" : "INVALID") << std::endl;
+    }
+    return result;
+}
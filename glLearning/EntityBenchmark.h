@@ -0,0 +1,29 @@
+#ifndef ENTITY_BENCHMARK_H
+#define ENTITY_BENCHMARK_H
+
+#include "JobSystem.h"
+#include <cstddef>
+#include <cstdint>
+
+// ʵ洢׼: entityCount  (Transform, Bounds) ʵ, Ա
+//    (forEach, ߳) ṹ, Լ parallelForEach  JobSystem ϰ鲢
+//    parallelForEach  EntityCommandBuffer ¼ƽṹ仯 (1/4 ɾ, 1/4  MeshRef, һϵͳظɾһ),
+//   playback ĺʱ, ԼĿȫɾʱ playback ĺʱ
+struct EntityBenchmarkResult {
+    uint32_t entityCount = 0;
+    size_t chunkCount = 0;
+    double arrayMs = 0.0;             // : std::vector<ṹ> ϵͬ
+    double forEachMs = 0.0;
+    double parallelForEachMs = 0.0;
+    size_t commandCount = 0;
+    double recordMs = 0.0;            // ¼
+    double playbackMs = 0.0;
+    size_t deadCommandCount = 0;
+    double deadPlaybackMs = 0.0;      // ɾĿ궼Ѳ
+    bool valid = true;                // playback ֮ʵԤ
+};
+
+// л׼ӡ (main  --bench-ecs ). ڴ jobs ߳ϵ
+EntityBenchmarkResult runEntityBenchmark(JobSystem& jobs, uint32_t entityCount = 100000, bool print = true);
+
+#endif // ENTITY_BENCHMARK_H
@@ -0,0 +1,119 @@
+#include "EntityCommandBuffer.h"
+#include <cstring>
+#include <stdexcept>
+
+EntityCommandBuffer::EntityCommandBuffer()
+    : m_streams(1) {
+}
+
+EntityCommandBuffer::EntityCommandBuffer(JobSystem& jobs)
+    : m_jobs(&jobs), m_streams(jobs.getThreadCount()) {
+}
+
+// ===== ¼ =====
+EntityCommandBuffer::Stream& EntityCommandBuffer::getStream() {
+    if (!m_jobs) {
+        return m_streams[0];
+    }
+    int index = m_jobs->getCurrentThreadIndex();
+    if (index < 0) {
+        throw std::runtime_error("ERROR::ENTITY_COMMAND_BUFFER: Recording from a thread outside the job system");
+    }
+    return m_streams[index];
+}
+
+void EntityCommandBuffer::append(Stream& stream, const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    stream.data.insert(stream.data.end(), bytes, bytes + size);
+}
+
+void EntityCommandBuffer::beginCommand(Stream& stream, CommandType type, Entity entity, ComponentId component, ComponentMask mask, size_t size) {
+    CommandHeader header = { type, component, entity, mask, size };
+    append(stream, &header, sizeof(header));
+    ++stream.commandCount;
+}
+
+void EntityCommandBuffer::appendComponent(Stream& stream, ComponentId id, const void* value, size_t size) {
+    append(stream, &id, sizeof(id));
+    append(stream, value, size);
+}
+
+void EntityCommandBuffer::destroyEntity(Entity entity) {
+    beginCommand(getStream(), CommandType::Destroy, entity, 0, 0, 0);
+}
+
+// ===== ִ =====
+void EntityCommandBuffer::playback(EntityManager& manager) {
+    // еֵûж, manager  memcpy , ᰴͷ
+    for (Stream& stream : m_streams) {
+        size_t offset = 0;
+        while (offset < stream.data.size()) {
+            CommandHeader header;
+            std::memcpy(&header, stream.data.data() + offset, sizeof(header));
+            offset += sizeof(header);
+            const uint8_t* payload = stream.data.data() + offset;
+            offset += static_cast<size_t>(header.size);
+
+            switch (header.type) {
+            case CommandType::Create: {
+                const void* values[ComponentRegistry::kMaxComponents] = {};
+                size_t position = 0;
+                while (position < header.size) {
+                    ComponentId id;
+                    std::memcpy(&id, payload + position, sizeof(id));
+                    position += sizeof(id);
+                    values[id] = payload + position;
+                    position += ComponentRegistry::getSize(id);
+                }
+                manager.create(header.mask, values);
+                break;
+            }
+            case CommandType::Destroy:
+                if (manager.isAlive(header.entity)) {
+                    manager.destroyEntity(header.entity);
+                }
+                break;
+            case CommandType::Add:
+                if (manager.isAlive(header.entity)) {
+                    manager.add(header.entity, header.component, payload);
+                }
+                break;
+            case CommandType::Remove:
+                if (manager.isAlive(header.entity)) {
+                    manager.remove(header.entity, header.component);
+                }
+                break;
+            }
+        }
+    }
+    clear();
+}
+
+void EntityCommandBuffer::clear() {
+    for (Stream& stream : m_streams) {
+        stream.data.clear();
+        stream.commandCount = 0;
+    }
+}
+
+size_t EntityCommandBuffer::getCommandCount() const {
+    size_t count = 0;
+    for (const Stream& stream : m_streams) {
+        count += stream.commandCount;
+    }
+    return count;
+}
+
+// ===== ʹdemo =====
+// EntityCommandBuffer commands(jobs);
+//
+// // вѯֻ¼
+// entities.parallelForEach<Health, Transform>(jobs, [&](Entity entity, Health& health, Transform& transform) {
+//     if (health.value <= 0.0f) {
+//         commands.destroyEntity(entity);
+//         commands.createEntity(transform, Explosion{ 1.0f });
+//     }
+// });
+//
+// // ѯ߳ͳһִ
+// commands.playback(entities);
@@ -0,0 +1,82 @@
+#ifndef ENTITY_COMMAND_BUFFER_H
+#define ENTITY_COMMAND_BUFFER_H
+
+#include "EntityManager.h"
+#include "JobSystem.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// EntityCommandBuffer: ӳִеĽṹ仯 ( / ɾʵ, ɾ).
+// вѯвֱ޸ EntityManager, ȼ¼, ѯ߳ playback ͳһִ.
+//  JobSystem ʱÿ̸߳дһ, ¼ƲҪ; ͬһ߳¼Ƶ˳ִ, ֮䰴̱߳.
+// ֵ¼ʱ.
+class EntityCommandBuffer {
+public:
+    // ֻһ߳¼
+    EntityCommandBuffer();
+
+    //  jobs ߳¼ (). δע߳¼ʱ׳ std::runtime_error
+    explicit EntityCommandBuffer(JobSystem& jobs);
+
+    // ֹ
+    EntityCommandBuffer(const EntityCommandBuffer&) = delete;
+    EntityCommandBuffer& operator=(const EntityCommandBuffer&) = delete;
+
+    template<typename... Ts>
+    void createEntity(const Ts&... components) {
+        Stream& stream = getStream();
+        size_t size = (size_t(0) + ... + (sizeof(ComponentId) + sizeof(Ts)));
+        beginCommand(stream, CommandType::Create, Entity(), 0, ComponentRegistry::getMask<Ts...>(), size);
+        (appendComponent(stream, ComponentRegistry::getId<Ts>(), &components, sizeof(Ts)), ...);
+    }
+
+    void destroyEntity(Entity entity);
+
+    template<typename T>
+    void addComponent(Entity entity, const T& component) {
+        Stream& stream = getStream();
+        beginCommand(stream, CommandType::Add, entity, ComponentRegistry::getId<T>(), 0, sizeof(T));
+        append(stream, &component, sizeof(T));
+    }
+
+    template<typename T>
+    void removeComponent(Entity entity) {
+        beginCommand(getStream(), CommandType::Remove, entity, ComponentRegistry::getId<T>(), 0, 0);
+    }
+
+    //  manager ִв (߳, ûвѯʱ). ĿʵѾڵ,
+    // Զϵͳɾͬһʵǰȫ
+    void playback(EntityManager& manager);
+
+    void clear();
+    size_t getCommandCount() const;
+    bool isEmpty() const { return getCommandCount() == 0; }
+
+private:
+    enum class CommandType : uint32_t { Create, Destroy, Add, Remove };
+
+    struct CommandHeader {
+        CommandType type;
+        ComponentId component;  // Add / Remove
+        Entity entity;          // Destroy / Add / Remove
+        ComponentMask mask;     // Create
+        uint64_t size;          // ֽ
+    };
+
+    // жα
+    struct alignas(64) Stream {
+        std::vector<uint8_t> data;
+        size_t commandCount = 0;
+    };
+
+    Stream& getStream();
+    void beginCommand(Stream& stream, CommandType type, Entity entity, ComponentId component, ComponentMask mask, size_t size);
+    void appendComponent(Stream& stream, ComponentId id, const void* value, size_t size);
+    static void append(Stream& stream, const void* data, size_t size);
+
+    JobSystem* m_jobs = nullptr;
+    std::vector<Stream> m_streams;
+};
+
+#endif // ENTITY_COMMAND_BUFFER_H
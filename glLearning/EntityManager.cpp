@@ -0,0 +1,265 @@
+#include "EntityManager.h"
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    struct ComponentInfo {
+        size_t size = 0;
+        size_t alignment = 0;
+        const char* name = nullptr;
+    };
+
+    // ֻעʱ; ŷ֮ǰϢѾд, ȡҪ
+    ComponentInfo g_components[ComponentRegistry::kMaxComponents];
+    uint32_t g_componentCount = 0;
+    std::mutex g_componentMutex;
+
+    size_t alignUp(size_t value, size_t alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+}
+
+// =====  =====
+ComponentId ComponentRegistry::registerType(size_t size, size_t alignment, const char* name) {
+    std::lock_guard<std::mutex> lock(g_componentMutex);
+    if (g_componentCount == kMaxComponents) {
+        throw std::runtime_error("ERROR::ENTITY_MANAGER: Too many component types, cannot register " + std::string(name));
+    }
+    if (alignment > EntityChunk::kAlignment) {
+        throw std::runtime_error("ERROR::ENTITY_MANAGER: Component " + std::string(name) + " needs a larger alignment than a chunk");
+    }
+    g_components[g_componentCount] = { size, alignment, name };
+    return g_componentCount++;
+}
+
+size_t ComponentRegistry::getSize(ComponentId id) {
+    return g_components[id].size;
+}
+
+size_t ComponentRegistry::getAlignment(ComponentId id) {
+    return g_components[id].alignment;
+}
+
+const char* ComponentRegistry::getName(ComponentId id) {
+    return g_components[id].name;
+}
+
+// =====  =====
+EntityChunk::EntityChunk(const uint16_t* offsets, uint32_t capacity)
+    : m_capacity(capacity), m_offsets(offsets) {
+    m_data = static_cast<uint8_t*>(::operator new(kSize, std::align_val_t(kAlignment)));
+}
+
+EntityChunk::~EntityChunk() {
+    ::operator delete(m_data, std::align_val_t(kAlignment));
+}
+
+// ===== ʵ =====
+EntityManager::EntityManager() {
+    getArchetype(0);
+}
+
+EntityManager::~EntityManager() = default;
+
+EntityManager::EntityRecord& EntityManager::getRecord(Entity entity) {
+    return const_cast<EntityRecord&>(static_cast<const EntityManager*>(this)->getRecord(entity));
+}
+
+const EntityManager::EntityRecord& EntityManager::getRecord(Entity entity) const {
+    if (!isAlive(entity)) {
+        throw std::runtime_error("ERROR::ENTITY_MANAGER: Invalid entity " + std::to_string(entity.index) + ":"
+            + std::to_string(entity.generation));
+    }
+    return m_records[entity.index];
+}
+
+bool EntityManager::isAlive(Entity entity) const {
+    return entity.index < m_records.size() && m_records[entity.index].archetype
+        && m_records[entity.index].generation == entity.generation;
+}
+
+Entity EntityManager::create(ComponentMask mask, const void* const* values) {
+    Archetype& archetype = getArchetype(mask);
+
+    Entity entity;
+    if (!m_freeIndices.empty()) {
+        entity.index = m_freeIndices.back();
+        m_freeIndices.pop_back();
+    }
+    else {
+        entity.index = static_cast<uint32_t>(m_records.size());
+        m_records.emplace_back();
+    }
+    EntityRecord& record = m_records[entity.index];
+    entity.generation = record.generation;
+
+    record.archetype = &archetype;
+    record.chunk = allocateRow(archetype, entity, record.row);
+    for (ComponentId id : archetype.components) {
+        size_t size = ComponentRegistry::getSize(id);
+        std::memcpy(record.chunk->m_data + archetype.offsets[id] + size * record.row, values[id], size);
+    }
+    ++m_entityCount;
+    return entity;
+}
+
+void EntityManager::destroyEntity(Entity entity) {
+    EntityRecord& record = getRecord(entity);
+    removeRow(*record.archetype, record.chunk, record.row);
+    record.archetype = nullptr;
+    record.chunk = nullptr;
+    ++record.generation;  // ɾӴʧЧ
+    m_freeIndices.push_back(entity.index);
+    --m_entityCount;
+}
+
+void EntityManager::add(Entity entity, ComponentId id, const void* value) {
+    EntityRecord& record = getRecord(entity);
+    ComponentMask bit = ComponentMask(1) << id;
+    if (!(record.archetype->mask & bit)) {
+        moveEntity(entity, record, getArchetype(record.archetype->mask | bit));
+    }
+    size_t size = ComponentRegistry::getSize(id);
+    std::memcpy(record.chunk->m_data + record.archetype->offsets[id] + size * record.row, value, size);
+}
+
+void EntityManager::remove(Entity entity, ComponentId id) {
+    EntityRecord& record = getRecord(entity);
+    ComponentMask bit = ComponentMask(1) << id;
+    if (record.archetype->mask & bit) {
+        moveEntity(entity, record, getArchetype(record.archetype->mask & ~bit));
+    }
+}
+
+void* EntityManager::find(Entity entity, ComponentId id) const {
+    const EntityRecord& record = getRecord(entity);
+    if (!record.chunk->has(id)) {
+        return nullptr;
+    }
+    return record.chunk->m_data + record.archetype->offsets[id] + ComponentRegistry::getSize(id) * record.row;
+}
+
+// ===== ԭ =====
+EntityManager::Archetype& EntityManager::getArchetype(ComponentMask mask) {
+    auto found = m_archetypes.find(mask);
+    if (found != m_archetypes.end()) {
+        return *found->second;
+    }
+
+    std::unique_ptr<Archetype> archetype = std::make_unique<Archetype>();
+    archetype->mask = mask;
+    size_t rowSize = sizeof(Entity);
+    for (ComponentId id = 0; id < ComponentRegistry::kMaxComponents; ++id) {
+        archetype->offsets[id] = EntityChunk::kNoOffset;
+        if (mask & (ComponentMask(1) << id)) {
+            archetype->components.push_back(id);
+            rowSize += ComponentRegistry::getSize(id);
+        }
+    }
+
+    // ȰÿеܴС, ٿ۵Ķ
+    uint32_t capacity = static_cast<uint32_t>(EntityChunk::kSize / rowSize);
+    for (;; --capacity) {
+        size_t offset = sizeof(Entity) * capacity;
+        for (ComponentId id : archetype->components) {
+            offset = alignUp(offset, ComponentRegistry::getAlignment(id));
+            archetype->offsets[id] = static_cast<uint16_t>(offset);
+            offset += ComponentRegistry::getSize(id) * capacity;
+        }
+        if (offset <= EntityChunk::kSize) {
+            break;
+        }
+    }
+    if (capacity == 0) {
+        throw std::runtime_error("ERROR::ENTITY_MANAGER: Component set of " + std::to_string(rowSize) + " bytes does not fit in a chunk");
+    }
+    archetype->capacity = capacity;
+
+    Archetype& result = *archetype;
+    m_archetypeList.push_back(archetype.get());
+    m_archetypes.emplace(mask, std::move(archetype));
+    return result;
+}
+
+EntityChunk* EntityManager::allocateRow(Archetype& archetype, Entity entity, uint32_t& row) {
+    if (archetype.chunks.empty() || archetype.chunks.back()->m_count == archetype.capacity) {
+        archetype.chunks.push_back(std::unique_ptr<EntityChunk>(new EntityChunk(archetype.offsets, archetype.capacity)));
+    }
+    EntityChunk* chunk = archetype.chunks.back().get();
+    row = chunk->m_count++;
+    chunk->getEntities()[row] = entity;
+    return chunk;
+}
+
+void EntityManager::removeRow(Archetype& archetype, EntityChunk* chunk, uint32_t row) {
+    EntityChunk* last = archetype.chunks.back().get();
+    uint32_t lastRow = last->m_count - 1;
+    if (last != chunk || lastRow != row) {
+        Entity moved = last->getEntities()[lastRow];
+        chunk->getEntities()[row] = moved;
+        for (ComponentId id : archetype.components) {
+            size_t size = ComponentRegistry::getSize(id);
+            std::memcpy(chunk->m_data + archetype.offsets[id] + size * row, last->m_data + archetype.offsets[id] + size * lastRow, size);
+        }
+        m_records[moved.index].chunk = chunk;
+        m_records[moved.index].row = row;
+    }
+    if (--last->m_count == 0) {
+        archetype.chunks.pop_back();
+    }
+}
+
+void EntityManager::moveEntity(Entity entity, EntityRecord& record, Archetype& target) {
+    Archetype& source = *record.archetype;
+    EntityChunk* sourceChunk = record.chunk;
+    uint32_t sourceRow = record.row;
+
+    uint32_t row;
+    EntityChunk* chunk = allocateRow(target, entity, row);
+    for (ComponentId id : target.components) {
+        if (source.mask & (ComponentMask(1) << id)) {
+            size_t size = ComponentRegistry::getSize(id);
+            std::memcpy(chunk->m_data + target.offsets[id] + size * row, sourceChunk->m_data + source.offsets[id] + size * sourceRow, size);
+        }
+    }
+    removeRow(source, sourceChunk, sourceRow);
+
+    record.archetype = &target;
+    record.chunk = chunk;
+    record.row = row;
+}
+
+// ===== ѯ =====
+void EntityManager::getChunks(ComponentMask mask, std::vector<EntityChunk*>& chunks) const {
+    for (const Archetype* archetype : m_archetypeList) {
+        if ((archetype->mask & mask) != mask) {
+            continue;
+        }
+        for (const std::unique_ptr<EntityChunk>& chunk : archetype->chunks) {
+            chunks.push_back(chunk.get());
+        }
+    }
+}
+
+size_t EntityManager::getChunkCount() const {
+    size_t count = 0;
+    for (const Archetype* archetype : m_archetypeList) {
+        count += archetype->chunks.size();
+    }
+    return count;
+}
+
+// ===== ʹdemo =====
+// struct Velocity { glm::vec3 value; };
+//
+// EntityManager entities;
+// Entity crate = entities.createEntity(Transform(), Velocity{ glm::vec3(0.0f, -1.0f, 0.0f) });
+// entities.addComponent(crate, Bounds{ glm::vec3(-0.5f), glm::vec3(0.5f) });
+//
+// // ÿ֡: ֻɨͬʱ Transform  Velocity Ŀ
+// entities.parallelForEach<Transform, Velocity>(jobs, [&](Entity, Transform& transform, Velocity& velocity) {
+//     transform.world[3] += glm::vec4(velocity.value * deltaTime, 0.0f);
+// });
@@ -0,0 +1,217 @@
+#ifndef ENTITY_MANAGER_H
+#define ENTITY_MANAGER_H
+
+#include "JobSystem.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+// ʵ. ᱻ, generation ͬһȺڵʵ. ĬϹľЧ
+struct Entity {
+    uint32_t index = 0xFFFFFFFFu;
+    uint32_t generation = 0;
+
+    bool operator==(const Entity& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const Entity& other) const { return !(*this == other); }
+};
+
+using ComponentId = uint32_t;
+using ComponentMask = uint64_t;  //  i λʾбΪ i 
+
+// ComponentRegistry: ͱ. ÿ͵һʹʱһ, ̰߳ȫ.
+// ƽɿ POD (û麯ӵԴ), ڿ֮ƶʱֱ memcpy
+class ComponentRegistry {
+public:
+    static constexpr uint32_t kMaxComponents = 64;
+
+    template<typename T>
+    static ComponentId getId() {
+        static_assert(std::is_trivially_copyable<T>::value, "Components must be trivially copyable");
+        static const ComponentId id = registerType(sizeof(T), alignof(T), typeid(T).name());
+        return id;
+    }
+
+    template<typename... Ts>
+    static ComponentMask getMask() {
+        return (ComponentMask(0) | ... | (ComponentMask(1) << getId<Ts>()));
+    }
+
+    static size_t getSize(ComponentId id);
+    static size_t getAlignment(ComponentId id);
+    static const char* getName(ComponentId id);
+
+private:
+    // @throws std::runtime_error ͳ kMaxComponents Ҫ󳬹Ķʱ׳
+    static ComponentId registerType(size_t size, size_t alignment, const char* name);
+};
+
+// EntityChunk: һ 16KB Ŀ, ͬһԭ (ͬ) ʵ.
+// ڰֱ (SoA): ʵ, Ȼÿһ,  i ʵݶڸĵ i 
+class EntityChunk {
+public:
+    static constexpr size_t kSize = 16 * 1024;
+    static constexpr size_t kAlignment = 64;
+
+    ~EntityChunk();
+
+    // ֹ
+    EntityChunk(const EntityChunk&) = delete;
+    EntityChunk& operator=(const EntityChunk&) = delete;
+
+    uint32_t getCount() const { return m_count; }
+    uint32_t getCapacity() const { return m_capacity; }
+    const Entity* getEntities() const { return reinterpret_cast<const Entity*>(m_data); }
+
+    bool has(ComponentId id) const { return m_offsets[id] != kNoOffset; }
+
+    // , вʱ nullptr
+    void* get(ComponentId id) const { return has(id) ? m_data + m_offsets[id] : nullptr; }
+
+    template<typename T>
+    T* get() const { return static_cast<T*>(get(ComponentRegistry::getId<T>())); }
+
+private:
+    friend class EntityManager;
+    static constexpr uint16_t kNoOffset = 0xFFFF;
+
+    EntityChunk(const uint16_t* offsets, uint32_t capacity);
+
+    Entity* getEntities() { return reinterpret_cast<Entity*>(m_data); }
+
+    uint8_t* m_data = nullptr;
+    uint32_t m_count = 0;
+    uint32_t m_capacity = 0;
+    const uint16_t* m_offsets;  // ԭ͵ƫƱ,  ComponentId 
+};
+
+// EntityManager: ԭ (archetype) ʽʵ洢. ͬʵͬһ,
+// ѯֻҳԭ, ɨǵĿ, ûʵ麯ָ׷.
+//
+// ÿԭ͵Ŀһⶼ: ɾʵʱһʵλ.
+// ɾʵƵһԭ (ȫ), ָͿֻһνṹ仯֮ǰЧ.
+// ṹ仯ֻ߳ϡûвѯڽʱֱӵ; вѯ EntityCommandBuffer ¼, ֮ͳһִ.
+class EntityManager {
+public:
+    EntityManager();
+    ~EntityManager();
+
+    // ֹ
+    EntityManager(const EntityManager&) = delete;
+    EntityManager& operator=(const EntityManager&) = delete;
+
+    template<typename... Ts>
+    Entity createEntity(const Ts&... components) {
+        const void* values[ComponentRegistry::kMaxComponents] = {};
+        ((values[ComponentRegistry::getId<Ts>()] = &components), ...);
+        return create(ComponentRegistry::getMask<Ts...>(), values);
+    }
+
+    // Чľ׳ std::runtime_error (ͬ)
+    void destroyEntity(Entity entity);
+    bool isAlive(Entity entity) const;
+
+    // иʱֵֻ
+    template<typename T>
+    void addComponent(Entity entity, const T& component) { add(entity, ComponentRegistry::getId<T>(), &component); }
+
+    template<typename T>
+    void removeComponent(Entity entity) { remove(entity, ComponentRegistry::getId<T>()); }
+
+    template<typename T>
+    bool hasComponent(Entity entity) const { return find(entity, ComponentRegistry::getId<T>()) != nullptr; }
+
+    // ʵ岻ʱ nullptr
+    template<typename T>
+    T* getComponent(Entity entity) const { return static_cast<T*>(find(entity, ComponentRegistry::getId<T>())); }
+
+    // ԭʹ˳׷Ӱ mask ȫķǿտ
+    void getChunks(ComponentMask mask, std::vector<EntityChunk*>& chunks) const;
+
+    template<typename... Ts>
+    void getChunks(std::vector<EntityChunk*>& chunks) const { getChunks(ComponentRegistry::getMask<Ts...>(), chunks); }
+
+    // ÿ Ts ʵ function(Entity, Ts&...)
+    template<typename... Ts, typename F>
+    void forEach(F&& function) const {
+        std::vector<EntityChunk*> chunks;
+        getChunks<Ts...>(chunks);
+        for (EntityChunk* chunk : chunks) {
+            forEachInChunk<Ts...>(*chunk, function);
+        }
+    }
+
+    // ͬ, ԿΪλ jobs ϲ. function ڶ߳ͬʱ, вṹ仯
+    template<typename... Ts, typename F>
+    void parallelForEach(JobSystem& jobs, F&& function) const {
+        std::vector<EntityChunk*> chunks;
+        getChunks<Ts...>(chunks);
+        jobs.parallelFor(chunks.size(), 1, [&](size_t begin, size_t end) {
+            for (size_t c = begin; c < end; ++c) {
+                forEachInChunk<Ts...>(*chunks[c], function);
+            }
+        });
+    }
+
+    template<typename... Ts, typename F>
+    static void forEachInChunk(const EntityChunk& chunk, F& function) {
+        const Entity* entities = chunk.getEntities();
+        std::tuple<Ts*...> arrays(chunk.get<Ts>()...);
+        for (uint32_t i = 0; i < chunk.getCount(); ++i) {
+            function(entities[i], std::get<Ts*>(arrays)[i]...);
+        }
+    }
+
+    uint32_t getEntityCount() const { return m_entityCount; }
+    size_t getArchetypeCount() const { return m_archetypeList.size(); }
+    size_t getChunkCount() const;
+
+private:
+    friend class EntityCommandBuffer;
+
+    struct Archetype {
+        ComponentMask mask = 0;
+        uint32_t capacity = 0;  // ÿʵ
+        uint16_t offsets[ComponentRegistry::kMaxComponents];
+        std::vector<ComponentId> components;
+        std::vector<std::unique_ptr<EntityChunk>> chunks;
+    };
+
+    struct EntityRecord {
+        Archetype* archetype = nullptr;  // Ϊձʾ
+        EntityChunk* chunk = nullptr;
+        uint32_t row = 0;
+        uint32_t generation = 1;
+    };
+
+    // values  ComponentId , mask еÿֵ
+    Entity create(ComponentMask mask, const void* const* values);
+    void add(Entity entity, ComponentId id, const void* value);
+    void remove(Entity entity, ComponentId id);
+    void* find(Entity entity, ComponentId id) const;
+
+    EntityRecord& getRecord(Entity entity);
+    const EntityRecord& getRecord(Entity entity) const;
+    Archetype& getArchetype(ComponentMask mask);
+
+    // ԭĩβ׷һ, ڵĿк
+    EntityChunk* allocateRow(Archetype& archetype, Entity entity, uint32_t& row);
+
+    // ԭ͵һʵ (chunk, row), Ҫʱͷһ
+    void removeRow(Archetype& archetype, EntityChunk* chunk, uint32_t row);
+
+    // ʵƵһԭ, ߹е
+    void moveEntity(Entity entity, EntityRecord& record, Archetype& target);
+
+    std::unordered_map<ComponentMask, std::unique_ptr<Archetype>> m_archetypes;
+    std::vector<Archetype*> m_archetypeList;  // ˳, ѯ˳򷵻ؿ
+    std::vector<EntityRecord> m_records;
+    std::vector<uint32_t> m_freeIndices;
+    uint32_t m_entityCount = 0;
+};
+
+#endif // ENTITY_MANAGER_H
@@ -0,0 +1,106 @@
+#include "EntitySystems.h"
+#include "Animator.h"
+#include "CpuCuller.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// ===== 任 =====
+void EntitySystems::copySceneTransforms(EntityManager& entities, const SceneGraph& scene, JobSystem& jobs) {
+    entities.parallelForEach<SceneNode, Transform>(jobs, [&](Entity, const SceneNode& node, Transform& transform) {
+        transform.world = scene.getWorldMatrix(node.node);
+    });
+}
+
+void EntitySystems::updateBounds(EntityManager& entities, JobSystem& jobs) {
+    entities.parallelForEach<Transform, Bounds>(jobs, [](Entity, const Transform& transform, Bounds& bounds) {
+        // ĵ任, ߳Ԫصľֵ任 (Arvo), õסתӵС AABB
+        const glm::mat4& m = transform.world;
+        glm::vec3 center = (bounds.localMin + bounds.localMax) * 0.5f;
+        glm::vec3 extents = (bounds.localMax - bounds.localMin) * 0.5f;
+        glm::vec3 worldCenter = glm::vec3(m * glm::vec4(center, 1.0f));
+        glm::vec3 worldExtents;
+        for (int row = 0; row < 3; ++row) {
+            worldExtents[row] = std::fabs(m[0][row]) * extents.x + std::fabs(m[1][row]) * extents.y + std::fabs(m[2][row]) * extents.z;
+        }
+        bounds.worldMin = worldCenter - worldExtents;
+        bounds.worldMax = worldCenter + worldExtents;
+    });
+}
+
+// =====  =====
+void EntitySystems::updateAnimators(EntityManager& entities, JobSystem& jobs, float deltaTime) {
+    // һܷǧ AnimatorRef, 黮̫; ռٰɫ
+    std::vector<Animator*> animators;
+    entities.forEach<AnimatorRef>([&](Entity, const AnimatorRef& ref) {
+        if (ref.animator) {
+            animators.push_back(ref.animator);
+        }
+    });
+    Animator::updateAll(jobs, animators.data(), animators.size(), deltaTime);
+}
+
+// ===== Ⱦ =====
+size_t EntitySystems::recordVisible(const EntityManager& entities, const Frustum& frustum, const glm::vec3& cameraPosition,
+    CommandRecorder& recorder) {
+    std::vector<EntityChunk*> chunks;
+    entities.getChunks<Transform, MeshRef, Bounds>(chunks);
+
+    // пΧа˳򿽽һ SoA Χ, chunkStarts[c] ǵ c ĵһΧ±
+    std::vector<uint32_t> chunkStarts(chunks.size() + 1, 0);
+    for (size_t c = 0; c < chunks.size(); ++c) {
+        chunkStarts[c + 1] = chunkStarts[c] + chunks[c]->getCount();
+    }
+    BoundingVolumes volumes(BoundingVolumes::Boxes);
+    volumes.reserve(chunkStarts.back());
+    for (const EntityChunk* chunk : chunks) {
+        const Bounds* bounds = chunk->get<Bounds>();
+        for (uint32_t i = 0; i < chunk->getCount(); ++i) {
+            volumes.addBox(bounds[i].worldMin, bounds[i].worldMax);
+        }
+    }
+
+    std::vector<uint32_t> visible;
+    CpuCuller::cull(volumes, frustum, visible);
+
+    // ɼ±, ÿȶҵʼĿ, ֮˳ƽ
+    recorder.record(visible.size(), [&](CommandBuffer& buffer, size_t begin, size_t end) {
+        size_t c = std::upper_bound(chunkStarts.begin(), chunkStarts.end(), visible[begin]) - chunkStarts.begin() - 1;
+        for (size_t v = begin; v < end; ++v) {
+            while (visible[v] >= chunkStarts[c + 1]) {
+                ++c;
+            }
+            const EntityChunk& chunk = *chunks[c];
+            uint32_t row = visible[v] - chunkStarts[c];
+            const Bounds& bounds = chunk.get<Bounds>()[row];
+            const MeshRef& mesh = chunk.get<MeshRef>()[row];
+            RenderQueue::DrawItem item;
+            item.material = mesh.material;
+            item.vertexArray = mesh.vertexArray;
+            item.indexCount = mesh.indexCount;
+            item.firstIndex = mesh.firstIndex;
+            item.baseVertex = mesh.baseVertex;
+            item.model = &chunk.get<Transform>()[row].world;
+            item.depth = glm::length((bounds.worldMin + bounds.worldMax) * 0.5f - cameraPosition);
+            item.layer = mesh.layer;
+            item.translucent = mesh.translucent;
+            buffer.draw(item);
+        }
+    });
+    return visible.size();
+}
+
+// ===== ʹdemo =====
+// EntityManager entities;
+// Entity crate = entities.createEntity(Transform(), SceneNode{ scene.createNode(room) },
+//     MeshRef{ crateMaterial, crateVAO, crateIndexCount }, Bounds{ glm::vec3(-0.5f), glm::vec3(0.5f) });
+//
+// // ÿ֡ (߳)
+// EntitySystems::updateAnimators(entities, jobs, deltaTime);
+// scene.update(jobs);
+// EntitySystems::copySceneTransforms(entities, scene, jobs);
+// EntitySystems::updateBounds(entities, jobs);
+// queue.beginFrame();
+// EntitySystems::recordVisible(entities, Frustum::fromMatrix(projection * view), cameraPos, recorder);
+// recorder.submitTo(queue);
+// queue.flush();
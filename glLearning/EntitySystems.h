@@ -0,0 +1,39 @@
+#ifndef ENTITY_SYSTEMS_H
+#define ENTITY_SYSTEMS_H
+
+#include "CommandRecorder.h"
+#include "EntityManager.h"
+#include "Frustum.h"
+#include "JobSystem.h"
+#include "SceneComponents.h"
+#include "SceneGraph.h"
+#include <glm/glm.hpp>
+#include <cstddef>
+
+// EntitySystems:  SceneComponents ÿ֡ϵͳ,  JobSystem ϲ.
+// ˳: updateAnimators -> copySceneTransforms -> updateBounds -> recordVisible.
+// ִڼ䲻ܶ entities ṹ仯.
+class EntitySystems {
+public:
+    // (SceneNode, Transform): ӳͼ. scene ҪѾ update
+    static void copySceneTransforms(EntityManager& entities, const SceneGraph& scene, JobSystem& jobs);
+
+    // (Transform, Bounds): ѾֲΧб任ռ
+    static void updateBounds(EntityManager& entities, JobSystem& jobs);
+
+    // AnimatorRef:  Animator::updateAll ƽнɫ
+    static void updateAnimators(EntityManager& entities, JobSystem& jobs, float deltaTime);
+
+    /**
+     * @brief (Transform, MeshRef, Bounds): Χ׶޳ (CpuCuller, һβ Simd::kWidth ),
+     * ѿɼʵ尴˳ֶ¼ƽ recorder.
+     * 任¼ʱ, غ entities Լ޸. ؿɼʵ.
+     */
+    static size_t recordVisible(const EntityManager& entities, const Frustum& frustum, const glm::vec3& cameraPosition,
+        CommandRecorder& recorder);
+
+private:
+    EntitySystems() = delete;
+};
+
+#endif // ENTITY_SYSTEMS_H
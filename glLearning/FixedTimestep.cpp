@@ -0,0 +1,32 @@
+#include "FixedTimestep.h"
+#include <stdexcept>
+
+FixedTimestep::FixedTimestep(double stepSeconds, uint32_t maxStepsPerUpdate)
+    : m_step(stepSeconds), m_maxStepsPerUpdate(maxStepsPerUpdate) {
+    if (stepSeconds <= 0.0 || maxStepsPerUpdate == 0) {
+        throw std::runtime_error("ERROR::FIXED_TIMESTEP: Invalid step configuration");
+    }
+}
+
+void FixedTimestep::reset(double now) {
+    m_nextStepTime = now + m_step;
+    m_stepCount = 0;
+    m_droppedSteps = 0;
+}
+
+uint32_t FixedTimestep::advance(double now) {
+    uint32_t steps = 0;
+    while (now >= m_nextStepTime && steps < m_maxStepsPerUpdate) {
+        m_nextStepTime += m_step;
+        ++steps;
+    }
+
+    // Ȼ: ѹ, ¼ʱ
+    if (now >= m_nextStepTime) {
+        m_droppedSteps += static_cast<uint64_t>((now - m_nextStepTime) / m_step) + 1;
+        m_nextStepTime = now + m_step;
+    }
+
+    m_stepCount += steps;
+    return steps;
+}
@@ -0,0 +1,38 @@
+#ifndef FIXED_TIMESTEP_H
+#define FIXED_TIMESTEP_H
+
+#include <cstdint>
+
+// FixedTimestep: ̶ģʱ.
+// ÿ advance() صǰʱΪֹӦģĲ, ģ֡޹.
+// 󳬹 maxStepsPerUpdate ʱѹ, Խ׷Խѭ.
+class FixedTimestep {
+public:
+    explicit FixedTimestep(double stepSeconds, uint32_t maxStepsPerUpdate = 8);
+
+    //  now ʼʱ ()
+    void reset(double now);
+
+    // Ҫִеģⲽ
+    uint32_t advance(double now);
+
+    double getStep() const { return m_step; }
+
+    // һĵʱ, ߳̿ɾݴ˵ȴ¼
+    double getNextStepTime() const { return m_nextStepTime; }
+
+    // һʱӦʱ, ǰģ״̬ʱ
+    double getCurrentStepTime() const { return m_nextStepTime - m_step; }
+
+    uint64_t getStepCount() const { return m_stepCount; }
+    uint64_t getDroppedSteps() const { return m_droppedSteps; }
+
+private:
+    double m_step;
+    uint32_t m_maxStepsPerUpdate;
+    double m_nextStepTime = 0.0;
+    uint64_t m_stepCount = 0;
+    uint64_t m_droppedSteps = 0;
+};
+
+#endif // FIXED_TIMESTEP_H
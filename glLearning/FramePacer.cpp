@@ -0,0 +1,204 @@
+#include "FramePacer.h"
+#include <GLFW/glfw3.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
+
+namespace {
+    constexpr double kSmoothing = 0.1;              // ָƽϵ
+    constexpr GLuint64 kWaitChunkNs = 100000000;    //  glClientWaitSync  100ms
+    constexpr double kMaxFenceWaitSeconds = 2.0;    // ΪդʧЧ, ֱӶ
+
+    double smooth(double average, double sample) {
+        return average == 0.0 ? sample : average + (sample - average) * kSmoothing;
+    }
+}
+
+FramePacer::FramePacer()
+    : FramePacer(Settings()) {
+}
+
+FramePacer::FramePacer(const Settings& settings) {
+    setSettings(settings);
+}
+
+// ===== ͳ (߳) =====
+void FramePacer::setSettings(const Settings& settings) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_settings = settings;
+    m_settings.framesInFlight = std::min(std::max(settings.framesInFlight, 1u), kMaxFramesInFlight);
+}
+
+FramePacer::Settings FramePacer::getSettings() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_settings;
+}
+
+FramePacer::Stats FramePacer::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+// ===== ֡ (Ⱦ߳) =====
+void FramePacer::beginFrame() {
+    Settings settings = getSettings();
+
+    if (settings.swapInterval != m_appliedSwapInterval) {
+        glfwSwapInterval(settings.swapInterval);
+        m_appliedSwapInterval = settings.swapInterval;
+    }
+
+    // ;֡: һ֮֡ǰ, CPU ٿʼµһ֡
+    double waitStart = glfwGetTime();
+    pollFences(waitStart);
+    while (m_pending.size() >= settings.framesInFlight) {
+        waitOldestFence();
+    }
+    double waitEnd = glfwGetTime();
+
+    // ӳģʽ: Ԥһˢµʱ, ȥ֡ԤƵĹʱ, ˯֮ǰٿʼ
+    double sleepSeconds = 0.0;
+    if (settings.lowLatency && settings.swapInterval > 0 && settings.refreshRate > 0.0 && m_lastSwapTime >= 0.0) {
+        double workSeconds;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            workSeconds = (m_stats.cpuTimeMs + m_stats.gpuTimeMs) / 1000.0;
+        }
+        double period = settings.swapInterval / settings.refreshRate;
+        double nextRefresh = m_lastSwapTime + period * std::ceil((waitEnd - m_lastSwapTime) / period);
+        double start = nextRefresh - workSeconds - settings.latencyMarginSeconds;
+        sleepSeconds = std::min(start - waitEnd, period);
+        if (sleepSeconds > 0.0) {
+            std::this_thread::sleep_for(std::chrono::duration<double>(sleepSeconds));
+        }
+        else {
+            sleepSeconds = 0.0;
+        }
+    }
+
+    m_frameStartTime = glfwGetTime();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_lastFrameStartTime >= 0.0) {
+        m_stats.frameTimeMs = smooth(m_stats.frameTimeMs, (m_frameStartTime - m_lastFrameStartTime) * 1000.0);
+    }
+    m_stats.fenceWaitMs = smooth(m_stats.fenceWaitMs, (waitEnd - waitStart) * 1000.0);
+    m_stats.latencySleepMs = smooth(m_stats.latencySleepMs, sleepSeconds * 1000.0);
+    m_lastFrameStartTime = m_frameStartTime;
+}
+
+void FramePacer::endFrame(double inputTime) {
+    m_frameInputTime = inputTime;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.cpuTimeMs = smooth(m_stats.cpuTimeMs, (glfwGetTime() - m_frameStartTime) * 1000.0);
+}
+
+void FramePacer::afterSwap() {
+    FrameRecord record;
+    record.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    record.swapTime = glfwGetTime();
+    record.inputTime = m_frameInputTime;
+    m_frameInputTime = -1.0;
+    if (!record.fence) {
+        std::cerr << "ERROR::FRAME_PACER: glFenceSync failed" << std::endl;
+        return;
+    }
+    m_pending.push_back(record);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.framesInFlight = static_cast<uint32_t>(m_pending.size());
+    ++m_stats.frames;
+}
+
+void FramePacer::releaseFences() {
+    for (FrameRecord& record : m_pending) {
+        glDeleteSync(record.fence);
+    }
+    m_pending.clear();
+    m_appliedSwapInterval = -1;
+    m_lastFrameStartTime = -1.0;
+    m_lastSwapTime = -1.0;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.framesInFlight = 0;
+}
+
+// ===== ˽и =====
+void FramePacer::pollFences(double now) {
+    while (!m_pending.empty()) {
+        GLenum result = glClientWaitSync(m_pending.front().fence, 0, 0);
+        if (result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED) {
+            break;
+        }
+        retireOldest(now);
+    }
+}
+
+void FramePacer::waitOldestFence() {
+    GLsync fence = m_pending.front().fence;
+    double start = glfwGetTime();
+    while (true) {
+        // һεȴʱˢ, դԶᱻύ GPU
+        GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, kWaitChunkNs);
+        if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED) {
+            break;
+        }
+        if (result == GL_WAIT_FAILED) {
+            std::cerr << "ERROR::FRAME_PACER: glClientWaitSync failed" << std::endl;
+            break;
+        }
+        if (glfwGetTime() - start > kMaxFenceWaitSeconds) {
+            std::cerr << "ERROR::FRAME_PACER: Fence wait timed out" << std::endl;
+            break;
+        }
+    }
+    retireOldest(glfwGetTime());
+}
+
+void FramePacer::retireOldest(double presentTime) {
+    FrameRecord record = m_pending.front();
+    m_pending.pop_front();
+    glDeleteSync(record.fence);
+
+    m_lastSwapTime = record.swapTime;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.gpuTimeMs = smooth(m_stats.gpuTimeMs, std::max(presentTime - record.swapTime, 0.0) * 1000.0);
+    m_stats.framesInFlight = static_cast<uint32_t>(m_pending.size());
+
+    if (record.inputTime >= 0.0) {
+        double latencyMs = (presentTime - record.inputTime) * 1000.0;
+        m_stats.inputToPresentMs = smooth(m_stats.inputToPresentMs, latencyMs);
+
+        // ֵһĴͳ
+        if (presentTime - m_maxWindowStart > 1.0) {
+            m_stats.inputToPresentMaxMs = m_maxInWindow;
+            m_maxInWindow = 0.0;
+            m_maxWindowStart = presentTime;
+        }
+        m_maxInWindow = std::max(m_maxInWindow, latencyMs);
+    }
+}
+
+// ===== ʹdemo =====
+// FramePacer::Settings settings;
+// settings.framesInFlight = 1;  // ӳ, һЩ
+// settings.lowLatency = true;
+// FramePacer pacer(settings);    // ̴߳, ڸȾ߳
+//
+// // Ⱦ߳
+// callbacks.renderFrame = [&] {
+//     pacer.beginFrame();           // ȵȴ/˯
+//     snapshots.acquire();          // ٶ
+//     ......
+//     pacer.endFrame(snapshots.getReadBuffer().inputTime);
+// };
+// callbacks.frameSwapped = [&] { pacer.afterSwap(); };
+// callbacks.shutdown = [&] { pacer.releaseFences(); };
+//
+// // ߳
+// FramePacer::Stats stats = pacer.getStats();
+// std::cout << stats.inputToPresentMs << " ms" << std::endl;
@@ -0,0 +1,104 @@
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include <glad/glad.h>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+// FramePacer: ֡ CPU/GPU ͬ (Ⱦ߳ʹ)
+// - ÿ֡ glFenceSync, beginFrame()  glClientWaitSync ;֡ framesInFlight ,
+//    CPU  GPU ǰ̫֡ӳٶ.
+// -  (ֱͬ)  glfwSwapInterval , ʱ޸.
+// - ӳģʽ: ڶȡ¿֮ǰ˯һʱ, ʹ֡պһˢǰ,
+//   ûʹþµ. ˢλȡصʱ, ԲֻǴԹ.
+// - ͳ뵽ֵӳ: ֡դ۲쵽ɵʱΪʱ (ֵ).
+class FramePacer {
+public:
+    struct Settings {
+        uint32_t framesInFlight = 2;          // 1 ~ kMaxFramesInFlight
+        int swapInterval = 1;                 // 0 رմֱͬ, 1 ÿˢ½һ
+        bool lowLatency = false;              // ȡ֮ǰ˯
+        double refreshRate = 60.0;            // ʾˢ (Hz), ߳ glfwGetVideoMode ѯ
+        double latencyMarginSeconds = 0.002;  // ӳģʽΪԤ
+    };
+
+    // ͳֵλΪ,  frames ⶼָƽ
+    struct Stats {
+        double frameTimeMs = 0.0;             // ֡ʼ֮ļ
+        double fenceWaitMs = 0.0;             // beginFrame դϵʱ
+        double latencySleepMs = 0.0;          // ӳģʽ˯ߵʱ
+        double cpuTimeMs = 0.0;               // ֡ʼύ (ӳģʽԤ֮һ)
+        double gpuTimeMs = 0.0;               // صդ,  GPU  CPU ʱ
+        double inputToPresentMs = 0.0;
+        double inputToPresentMaxMs = 0.0;     // һڵֵ
+        uint32_t framesInFlight = 0;          // ǰ;֡
+        uint64_t frames = 0;
+    };
+
+    static constexpr uint32_t kMaxFramesInFlight = 4;
+
+    // 첻 GL, ̴߳, Ⱦ̹߳
+    FramePacer();
+    explicit FramePacer(const Settings& settings);
+
+    // ֹ
+    FramePacer(const FramePacer&) = delete;
+    FramePacer& operator=(const FramePacer&) = delete;
+
+    // ޸ (߳), һ beginFrame Ч
+    void setSettings(const Settings& settings);
+    Settings getSettings() const;
+
+    // ͳ (߳)
+    Stats getStats() const;
+
+    // ===== Ⱦ߳, Ҫǰ =====
+
+    /**
+     * @brief ֡ʼ: Ӧ, ȴֱ;֡С framesInFlight, ӳģʽ˯ԤĿʼʱ.
+     * ֮ٶȡ.
+     */
+    void beginFrame();
+
+    /**
+     * @brief ƽ֮ǰ, ¼֡ CPU ʱ.
+     * @param inputTime ֡Ĳʱ (glfwGetTime), ͳ뵽ֵӳ. С 0 ʾͳ.
+     */
+    void endFrame(double inputTime);
+
+    // ֮: Ϊһ֡դ
+    void afterSwap();
+
+    // ɾδ֡դ. Ⱦ߳˳ (ͷ) ֮ǰ
+    void releaseFences();
+
+private:
+    struct FrameRecord {
+        GLsync fence = nullptr;
+        double swapTime = 0.0;
+        double inputTime = -1.0;
+    };
+
+    // ɵ֡ ()
+    void pollFences(double now);
+    // ֱһ֡
+    void waitOldestFence();
+    void retireOldest(double presentTime);
+
+    mutable std::mutex m_mutex;  //  m_settings  m_stats
+    Settings m_settings;
+    Stats m_stats;
+
+    // ֻȾ̷߳
+    std::deque<FrameRecord> m_pending;
+    int m_appliedSwapInterval = -1;
+    double m_frameStartTime = 0.0;
+    double m_frameInputTime = -1.0;
+    double m_lastFrameStartTime = -1.0;
+    double m_lastSwapTime = -1.0;  // ɵһ֡صʱ, ΪˢλĲο
+    double m_maxWindowStart = 0.0;
+    double m_maxInWindow = 0.0;
+};
+
+#endif // FRAME_PACER_H
@@ -0,0 +1,192 @@
+#include "Framebuffer.h"
+#include "GLStateCache.h"
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    // ȾĿʽ:  glTexImage2D  format/type (Ϊ, ֻϷ) ÿֽ
+    struct TargetFormat {
+        GLenum internalFormat;
+        GLenum format;
+        GLenum type;
+        size_t bytesPerPixel;
+    };
+
+    const TargetFormat kTargetFormats[] = {
+        { GL_R8,                 GL_RED,             GL_UNSIGNED_BYTE,                    1 },
+        { GL_RG8,                GL_RG,              GL_UNSIGNED_BYTE,                    2 },
+        { GL_RGB8,               GL_RGB,             GL_UNSIGNED_BYTE,                    3 },
+        { GL_RGBA8,              GL_RGBA,            GL_UNSIGNED_BYTE,                    4 },
+        { GL_SRGB8_ALPHA8,       GL_RGBA,            GL_UNSIGNED_BYTE,                    4 },
+        { GL_RGB10_A2,           GL_RGBA,            GL_UNSIGNED_INT_2_10_10_10_REV,      4 },
+        { GL_R11F_G11F_B10F,     GL_RGB,             GL_FLOAT,                            4 },
+        { GL_R16F,               GL_RED,             GL_HALF_FLOAT,                       2 },
+        { GL_RG16F,              GL_RG,              GL_HALF_FLOAT,                       4 },
+        { GL_RGBA16F,            GL_RGBA,            GL_HALF_FLOAT,                       8 },
+        { GL_R32F,               GL_RED,             GL_FLOAT,                            4 },
+        { GL_RG32F,              GL_RG,              GL_FLOAT,                            8 },
+        { GL_RGBA32F,            GL_RGBA,            GL_FLOAT,                            16 },
+        { GL_R32UI,              GL_RED_INTEGER,     GL_UNSIGNED_INT,                     4 },
+        { GL_DEPTH_COMPONENT16,  GL_DEPTH_COMPONENT, GL_UNSIGNED_SHORT,                   2 },
+        { GL_DEPTH_COMPONENT24,  GL_DEPTH_COMPONENT, GL_UNSIGNED_INT,                     4 },
+        { GL_DEPTH_COMPONENT32F, GL_DEPTH_COMPONENT, GL_FLOAT,                            4 },
+        { GL_DEPTH24_STENCIL8,   GL_DEPTH_STENCIL,   GL_UNSIGNED_INT_24_8,                4 },
+        { GL_DEPTH32F_STENCIL8,  GL_DEPTH_STENCIL,   GL_FLOAT_32_UNSIGNED_INT_24_8_REV,   8 },
+    };
+
+    const TargetFormat& findTargetFormat(GLenum internalFormat) {
+        for (const TargetFormat& format : kTargetFormats) {
+            if (format.internalFormat == internalFormat) {
+                return format;
+            }
+        }
+        throw std::runtime_error("ERROR::FRAMEBUFFER: Unsupported render target format " + std::to_string(internalFormat));
+    }
+}
+
+Framebuffer::Framebuffer() {
+    glGenFramebuffers(1, &m_rendererID);
+}
+
+Framebuffer::~Framebuffer() {
+    if (m_rendererID != 0) {
+        GLStateCache::getInstance().deleteFramebuffer(m_rendererID);
+    }
+}
+
+Framebuffer::Framebuffer(Framebuffer&& other) noexcept
+    : m_rendererID(other.m_rendererID), m_colorMask(other.m_colorMask) {
+    other.m_rendererID = 0;
+    other.m_colorMask = 0;
+}
+
+Framebuffer& Framebuffer::operator=(Framebuffer&& other) noexcept {
+    if (this != &other) {
+        if (m_rendererID != 0) {
+            GLStateCache::getInstance().deleteFramebuffer(m_rendererID);
+        }
+        m_rendererID = other.m_rendererID;
+        m_colorMask = other.m_colorMask;
+        other.m_rendererID = 0;
+        other.m_colorMask = 0;
+    }
+    return *this;
+}
+
+// =====  =====
+void Framebuffer::attachTexture(GLenum attachment, const Texture& texture, GLint level) {
+    attachTexture(attachment, texture.getID(), level);
+}
+
+void Framebuffer::attachTexture(GLenum attachment, GLuint texture, GLint level) {
+    if (GLAD_GL_VERSION_4_5) {
+        glNamedFramebufferTexture(m_rendererID, attachment, texture, level);
+    }
+    else {
+        GLStateCache::getInstance().bindFramebuffer(GL_FRAMEBUFFER, m_rendererID);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, GL_TEXTURE_2D, texture, level);
+    }
+
+    if (attachment >= GL_COLOR_ATTACHMENT0 && attachment < GL_COLOR_ATTACHMENT0 + kMaxColorAttachments) {
+        m_colorMask |= 1u << (attachment - GL_COLOR_ATTACHMENT0);
+    }
+}
+
+void Framebuffer::attachRenderbuffer(GLenum attachment, GLuint renderbuffer) {
+    if (GLAD_GL_VERSION_4_5) {
+        glNamedFramebufferRenderbuffer(m_rendererID, attachment, GL_RENDERBUFFER, renderbuffer);
+    }
+    else {
+        GLStateCache::getInstance().bindFramebuffer(GL_FRAMEBUFFER, m_rendererID);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, attachment, GL_RENDERBUFFER, renderbuffer);
+    }
+
+    if (attachment >= GL_COLOR_ATTACHMENT0 && attachment < GL_COLOR_ATTACHMENT0 + kMaxColorAttachments) {
+        m_colorMask |= 1u << (attachment - GL_COLOR_ATTACHMENT0);
+    }
+}
+
+void Framebuffer::finalize() {
+    // ûɫ (ֻдȵӰͼ) ʱرɫ
+    std::vector<GLenum> drawBuffers;
+    for (uint32_t i = 0; i < kMaxColorAttachments; ++i) {
+        if (m_colorMask & (1u << i)) {
+            drawBuffers.resize(i + 1, GL_NONE);
+            drawBuffers[i] = GL_COLOR_ATTACHMENT0 + i;
+        }
+    }
+    GLenum status;
+    if (GLAD_GL_VERSION_4_5) {
+        if (drawBuffers.empty()) {
+            glNamedFramebufferDrawBuffer(m_rendererID, GL_NONE);
+            glNamedFramebufferReadBuffer(m_rendererID, GL_NONE);
+        }
+        else {
+            glNamedFramebufferDrawBuffers(m_rendererID, static_cast<GLsizei>(drawBuffers.size()), drawBuffers.data());
+        }
+        status = glCheckNamedFramebufferStatus(m_rendererID, GL_FRAMEBUFFER);
+    }
+    else {
+        GLStateCache::getInstance().bindFramebuffer(GL_FRAMEBUFFER, m_rendererID);
+        if (drawBuffers.empty()) {
+            glDrawBuffer(GL_NONE);
+            glReadBuffer(GL_NONE);
+        }
+        else {
+            glDrawBuffers(static_cast<GLsizei>(drawBuffers.size()), drawBuffers.data());
+        }
+        status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    }
+
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+        throw std::runtime_error("ERROR::FRAMEBUFFER: Framebuffer is not complete (status " + std::to_string(status) + ")");
+    }
+}
+
+void Framebuffer::bind() const {
+    GLStateCache::getInstance().bindFramebuffer(GL_FRAMEBUFFER, m_rendererID);
+}
+
+void Framebuffer::unbind() const {
+    GLStateCache::getInstance().bindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+// ===== ȾĿʽ =====
+bool Framebuffer::isDepthFormat(GLenum internalFormat) {
+    GLenum format = findTargetFormat(internalFormat).format;
+    return format == GL_DEPTH_COMPONENT || format == GL_DEPTH_STENCIL;
+}
+
+bool Framebuffer::hasStencil(GLenum internalFormat) {
+    return findTargetFormat(internalFormat).format == GL_DEPTH_STENCIL;
+}
+
+GLenum Framebuffer::getAttachmentPoint(GLenum internalFormat, uint32_t colorIndex) {
+    if (hasStencil(internalFormat)) {
+        return GL_DEPTH_STENCIL_ATTACHMENT;
+    }
+    if (isDepthFormat(internalFormat)) {
+        return GL_DEPTH_ATTACHMENT;
+    }
+    return GL_COLOR_ATTACHMENT0 + colorIndex;
+}
+
+size_t Framebuffer::getBytesPerPixel(GLenum internalFormat) {
+    return findTargetFormat(internalFormat).bytesPerPixel;
+}
+
+std::unique_ptr<Texture> Framebuffer::createTargetTexture(int width, int height, GLenum internalFormat) {
+    const TargetFormat& format = findTargetFormat(internalFormat);
+    auto texture = std::make_unique<Texture>(width, height, internalFormat, format.format, format.type);
+
+    // Ĭϲ mipmap , ȾĿû mipmap, ľǲ
+    bool depth = format.format == GL_DEPTH_COMPONENT || format.format == GL_DEPTH_STENCIL;
+    bool integer = format.format == GL_RED_INTEGER;
+    GLint filter = depth || integer ? GL_NEAREST : GL_LINEAR;
+    texture->setParameter(GL_TEXTURE_MIN_FILTER, filter);
+    texture->setParameter(GL_TEXTURE_MAG_FILTER, filter);
+    texture->setParameter(GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    texture->setParameter(GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    return texture;
+}
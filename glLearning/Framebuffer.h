@@ -0,0 +1,66 @@
+#ifndef FRAMEBUFFER_H
+#define FRAMEBUFFER_H
+
+#include "Texture.h"
+#include <glad/glad.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// װ֡ (FBO) 
+//  () ɵ÷, ֻ֡¼عϵ. ɾ֮ǰɾ֡.
+class Framebuffer {
+public:
+    static constexpr uint32_t kMaxColorAttachments = 8;
+
+    Framebuffer();
+    ~Framebuffer();
+
+    // ֹ, ƶ
+    Framebuffer(const Framebuffer&) = delete;
+    Framebuffer& operator=(const Framebuffer&) = delete;
+    Framebuffer(Framebuffer&& other) noexcept;
+    Framebuffer& operator=(Framebuffer&& other) noexcept;
+
+    /**
+     * @brief .
+     * @param attachment GL_COLOR_ATTACHMENTi / GL_DEPTH_ATTACHMENT / GL_DEPTH_STENCIL_ATTACHMENT.
+     */
+    void attachTexture(GLenum attachment, const Texture& texture, GLint level = 0);
+    void attachTexture(GLenum attachment, GLuint texture, GLint level = 0);
+
+    // Ⱦ (زȲҪĿ)
+    void attachRenderbuffer(GLenum attachment, GLuint renderbuffer);
+
+    /**
+     * @brief ѹصɫ glDrawBuffers .
+     * @throws std::runtime_error ֡岻ʱ׳
+     */
+    void finalize();
+
+    void bind() const;
+    void unbind() const;
+
+    GLuint getID() const { return m_rendererID; }
+
+    // ===== ȾĿʽ =====
+    static bool isDepthFormat(GLenum internalFormat);
+    static bool hasStencil(GLenum internalFormat);
+
+    // ɫʽ GL_COLOR_ATTACHMENT0 + colorIndex, ȸʽ (ģ) ص
+    static GLenum getAttachmentPoint(GLenum internalFormat, uint32_t colorIndex = 0);
+
+    // ÿֽ, ͳԴ
+    static size_t getBytesPerPixel(GLenum internalFormat);
+
+    /**
+     * @brief ȾĿ:  mipmap, Թ (Ϊ), Եȡ.
+     */
+    static std::unique_ptr<Texture> createTargetTexture(int width, int height, GLenum internalFormat);
+
+private:
+    GLuint m_rendererID = 0;
+    uint32_t m_colorMask = 0;  // ѹصɫ
+};
+
+#endif // FRAMEBUFFER_H
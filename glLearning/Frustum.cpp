@@ -0,0 +1,50 @@
+#include "Frustum.h"
+
+Frustum Frustum::fromMatrix(const glm::mat4& m) {
+    // glm Ϊ: m[][],  i Ϊ (m[0][i], m[1][i], m[2][i], m[3][i])
+    glm::vec4 row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+    glm::vec4 row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+    glm::vec4 row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+    glm::vec4 row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+    Frustum frustum;
+    frustum.planes[Left] = row3 + row0;
+    frustum.planes[Right] = row3 - row0;
+    frustum.planes[Bottom] = row3 + row1;
+    frustum.planes[Top] = row3 - row1;
+    frustum.planes[Near] = row3 + row2;
+    frustum.planes[Far] = row3 - row2;
+
+    for (int i = 0; i < Count; ++i) {
+        glm::vec4& plane = frustum.planes[i];
+        float length = glm::length(glm::vec3(plane.x, plane.y, plane.z));
+        if (length > 0.0f) {
+            plane = plane / length;
+        }
+    }
+    return frustum;
+}
+
+bool Frustum::intersectsSphere(const glm::vec3& center, float radius) const {
+    for (int i = 0; i < Count; ++i) {
+        const glm::vec4& plane = planes[i];
+        if (plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w < -radius) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Frustum::intersectsAABB(const glm::vec3& minCorner, const glm::vec3& maxCorner) const {
+    for (int i = 0; i < Count; ++i) {
+        const glm::vec4& plane = planes[i];
+        // ȡƽ淨߷ԶĶ, Ҳ
+        float x = plane.x >= 0.0f ? maxCorner.x : minCorner.x;
+        float y = plane.y >= 0.0f ? maxCorner.y : minCorner.y;
+        float z = plane.z >= 0.0f ? maxCorner.z : minCorner.z;
+        if (plane.x * x + plane.y * y + plane.z * z + plane.w < 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
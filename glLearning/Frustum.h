@@ -0,0 +1,22 @@
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+#include <glm/glm.hpp>
+
+// ׶: 6 һƽ, ָ׶ڲ (dot(n, p) + d >= 0 ʾڲ)
+struct Frustum {
+    enum Plane { Left = 0, Right, Bottom, Top, Near, Far, Count };
+
+    glm::vec4 planes[Count];
+
+    //  ͶӰ * ͼ ȡƽ (Gribb-Hartmann, OpenGL  [-w, w] üռ)
+    static Frustum fromMatrix(const glm::mat4& viewProjection);
+
+    // ׶Ƿཻ (ز)
+    bool intersectsSphere(const glm::vec3& center, float radius) const;
+
+    // AABB ׶Ƿཻ (p-vertex , )
+    bool intersectsAABB(const glm::vec3& minCorner, const glm::vec3& maxCorner) const;
+};
+
+#endif // FRUSTUM_H
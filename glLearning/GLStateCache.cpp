@@ -0,0 +1,358 @@
+#include "GLStateCache.h"
+
+GLStateCache& GLStateCache::getInstance() {
+    static GLStateCache instance;
+    return instance;
+}
+
+GLStateCache::GLStateCache() {
+    invalidate();
+}
+
+void GLStateCache::invalidate() {
+    m_program = kUnknown;
+    m_vao = kUnknown;
+    for (GLuint& buffer : m_buffers) {
+        buffer = kUnknown;
+    }
+    for (auto& bindings : m_indexedBuffers) {
+        for (GLuint& buffer : bindings) {
+            buffer = kUnknown;
+        }
+    }
+    m_activeUnit = kUnknown;
+    for (auto& unit : m_textures) {
+        for (GLuint& texture : unit) {
+            texture = kUnknown;
+        }
+    }
+    for (GLuint& sampler : m_samplers) {
+        sampler = kUnknown;
+    }
+    m_drawFramebuffer = m_readFramebuffer = kUnknown;
+    for (GLuint& capability : m_capabilities) {
+        capability = kUnknown;
+    }
+    m_blendSrc = m_blendDst = kUnknown;
+    m_depthWrite = kUnknown;
+    m_depthFunc = kUnknown;
+    m_cullFaceMode = kUnknown;
+    m_viewport[0] = m_viewport[1] = m_viewport[2] = m_viewport[3] = 0;
+    m_viewportKnown = false;
+}
+
+bool GLStateCache::update(GLuint& cached, GLuint value) {
+    if (cached == value) {
+        ++m_stats.skipped;
+        return false;
+    }
+    cached = value;
+    ++m_stats.issued;
+    return true;
+}
+
+// ===== Ŀ -> λ =====
+int GLStateCache::bufferSlot(GLenum target) {
+    switch (target) {
+    case GL_ARRAY_BUFFER: return ArrayBuffer;
+    case GL_ELEMENT_ARRAY_BUFFER: return ElementArrayBuffer;
+    case GL_UNIFORM_BUFFER: return UniformBuffer;
+    case GL_SHADER_STORAGE_BUFFER: return ShaderStorageBuffer;
+    case GL_DRAW_INDIRECT_BUFFER: return DrawIndirectBuffer;
+    case GL_DISPATCH_INDIRECT_BUFFER: return DispatchIndirectBuffer;
+    case 0x80EE: return ParameterBuffer;  // GL_PARAMETER_BUFFER (GL 4.6)
+    case GL_ATOMIC_COUNTER_BUFFER: return AtomicCounterBuffer;
+    case GL_COPY_READ_BUFFER: return CopyReadBuffer;
+    case GL_COPY_WRITE_BUFFER: return CopyWriteBuffer;
+    case GL_PIXEL_PACK_BUFFER: return PixelPackBuffer;
+    case GL_PIXEL_UNPACK_BUFFER: return PixelUnpackBuffer;
+    default: return -1;
+    }
+}
+
+int GLStateCache::textureSlot(GLenum target) {
+    switch (target) {
+    case GL_TEXTURE_2D: return Texture2D;
+    case GL_TEXTURE_CUBE_MAP: return TextureCubeMap;
+    case GL_TEXTURE_2D_ARRAY: return Texture2DArray;
+    case GL_TEXTURE_3D: return Texture3D;
+    case GL_TEXTURE_2D_MULTISAMPLE: return Texture2DMultisample;
+    default: return -1;
+    }
+}
+
+int GLStateCache::indexedSlot(GLenum target) {
+    switch (target) {
+    case GL_UNIFORM_BUFFER: return IndexedUniform;
+    case GL_SHADER_STORAGE_BUFFER: return IndexedShaderStorage;
+    case GL_ATOMIC_COUNTER_BUFFER: return IndexedAtomicCounter;
+    default: return -1;
+    }
+}
+
+// =====  =====
+void GLStateCache::useProgram(GLuint program) {
+    if (update(m_program, program)) {
+        glUseProgram(program);
+    }
+}
+
+void GLStateCache::bindVertexArray(GLuint vao) {
+    if (update(m_vao, vao)) {
+        glBindVertexArray(vao);
+        // GL_ELEMENT_ARRAY_BUFFER  VAO ״̬, л VAO ٿ֪
+        m_buffers[ElementArrayBuffer] = kUnknown;
+    }
+}
+
+void GLStateCache::bindBuffer(GLenum target, GLuint buffer) {
+    int slot = bufferSlot(target);
+    if (slot < 0) {
+        ++m_stats.issued;
+        glBindBuffer(target, buffer);
+        return;
+    }
+    if (update(m_buffers[slot], buffer)) {
+        glBindBuffer(target, buffer);
+    }
+}
+
+void GLStateCache::bindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+    int slot = indexedSlot(target);
+    int generic = bufferSlot(target);
+    if (slot < 0 || index >= kMaxIndexedBindings) {
+        ++m_stats.issued;
+        glBindBufferBase(target, index, buffer);
+        if (generic >= 0) {
+            m_buffers[generic] = buffer;
+        }
+        return;
+    }
+    if (update(m_indexedBuffers[slot][index], buffer)) {
+        glBindBufferBase(target, index, buffer);
+        // glBindBufferBase ͬʱ޸ͨð󶨵
+        m_buffers[generic] = buffer;
+    }
+}
+
+void GLStateCache::bindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+    ++m_stats.issued;
+    glBindBufferRange(target, index, buffer, offset, size);
+    // ֮ͬһ bindBufferBase ܱ
+    int slot = indexedSlot(target);
+    if (slot >= 0 && index < kMaxIndexedBindings) {
+        m_indexedBuffers[slot][index] = kUnknown;
+    }
+    int generic = bufferSlot(target);
+    if (generic >= 0) {
+        m_buffers[generic] = buffer;
+    }
+}
+
+void GLStateCache::activeTexture(GLuint unit) {
+    if (update(m_activeUnit, unit)) {
+        glActiveTexture(GL_TEXTURE0 + unit);
+    }
+}
+
+void GLStateCache::bindTexture(GLuint unit, GLenum target, GLuint texture) {
+    int slot = textureSlot(target);
+    if (slot < 0 || unit >= kMaxTextureUnits) {
+        activeTexture(unit);
+        ++m_stats.issued;
+        glBindTexture(target, texture);
+        return;
+    }
+
+    GLuint& cached = m_textures[unit][slot];
+    if (cached == texture) {
+        ++m_stats.skipped;
+        return;
+    }
+    activeTexture(unit);
+    cached = texture;
+    ++m_stats.issued;
+    glBindTexture(target, texture);
+}
+
+void GLStateCache::bindTextureOnActiveUnit(GLenum target, GLuint texture) {
+    // Ԫδ֪ʱʹõԪ 0
+    bindTexture(m_activeUnit == kUnknown ? 0 : m_activeUnit, target, texture);
+}
+
+void GLStateCache::bindSampler(GLuint unit, GLuint sampler) {
+    if (unit >= kMaxTextureUnits) {
+        ++m_stats.issued;
+        glBindSampler(unit, sampler);
+        return;
+    }
+    if (update(m_samplers[unit], sampler)) {
+        glBindSampler(unit, sampler);
+    }
+}
+
+void GLStateCache::bindFramebuffer(GLenum target, GLuint framebuffer) {
+    if (target == GL_FRAMEBUFFER) {
+        if (m_drawFramebuffer == framebuffer && m_readFramebuffer == framebuffer) {
+            ++m_stats.skipped;
+            return;
+        }
+        m_drawFramebuffer = m_readFramebuffer = framebuffer;
+        ++m_stats.issued;
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        return;
+    }
+
+    GLuint& cached = target == GL_READ_FRAMEBUFFER ? m_readFramebuffer : m_drawFramebuffer;
+    if (update(cached, framebuffer)) {
+        glBindFramebuffer(target, framebuffer);
+    }
+}
+
+// ===== ɾ =====
+void GLStateCache::deleteProgram(GLuint program) {
+    if (program == 0) {
+        return;
+    }
+    glDeleteProgram(program);
+    if (m_program == program) {
+        m_program = kUnknown;
+    }
+}
+
+void GLStateCache::deleteVertexArray(GLuint vao) {
+    if (vao == 0) {
+        return;
+    }
+    glDeleteVertexArrays(1, &vao);
+    if (m_vao == vao) {
+        m_vao = kUnknown;
+        m_buffers[ElementArrayBuffer] = kUnknown;
+    }
+}
+
+void GLStateCache::deleteBuffer(GLuint buffer) {
+    if (buffer == 0) {
+        return;
+    }
+    glDeleteBuffers(1, &buffer);
+    for (GLuint& cached : m_buffers) {
+        if (cached == buffer) {
+            cached = kUnknown;
+        }
+    }
+    for (auto& bindings : m_indexedBuffers) {
+        for (GLuint& cached : bindings) {
+            if (cached == buffer) {
+                cached = kUnknown;
+            }
+        }
+    }
+}
+
+void GLStateCache::deleteTexture(GLuint texture) {
+    if (texture == 0) {
+        return;
+    }
+    glDeleteTextures(1, &texture);
+    for (auto& unit : m_textures) {
+        for (GLuint& cached : unit) {
+            if (cached == texture) {
+                cached = kUnknown;
+            }
+        }
+    }
+}
+
+void GLStateCache::deleteSampler(GLuint sampler) {
+    if (sampler == 0) {
+        return;
+    }
+    glDeleteSamplers(1, &sampler);
+    for (GLuint& cached : m_samplers) {
+        if (cached == sampler) {
+            cached = kUnknown;
+        }
+    }
+}
+
+void GLStateCache::deleteFramebuffer(GLuint framebuffer) {
+    if (framebuffer == 0) {
+        return;
+    }
+    glDeleteFramebuffers(1, &framebuffer);
+    if (m_drawFramebuffer == framebuffer) {
+        m_drawFramebuffer = kUnknown;
+    }
+    if (m_readFramebuffer == framebuffer) {
+        m_readFramebuffer = kUnknown;
+    }
+}
+
+// ===== ״̬ =====
+void GLStateCache::setCapability(Capability capability, GLenum cap, bool enabled) {
+    if (update(m_capabilities[capability], enabled ? 1u : 0u)) {
+        if (enabled) {
+            glEnable(cap);
+        }
+        else {
+            glDisable(cap);
+        }
+    }
+}
+
+void GLStateCache::setBlend(bool enabled) {
+    setCapability(Blend, GL_BLEND, enabled);
+}
+
+void GLStateCache::setBlendFunc(GLenum srcFactor, GLenum dstFactor) {
+    if (m_blendSrc == srcFactor && m_blendDst == dstFactor) {
+        ++m_stats.skipped;
+        return;
+    }
+    m_blendSrc = srcFactor;
+    m_blendDst = dstFactor;
+    ++m_stats.issued;
+    glBlendFunc(srcFactor, dstFactor);
+}
+
+void GLStateCache::setDepthTest(bool enabled) {
+    setCapability(DepthTest, GL_DEPTH_TEST, enabled);
+}
+
+void GLStateCache::setDepthWrite(bool enabled) {
+    if (update(m_depthWrite, enabled ? 1u : 0u)) {
+        glDepthMask(enabled ? GL_TRUE : GL_FALSE);
+    }
+}
+
+void GLStateCache::setDepthFunc(GLenum func) {
+    if (update(m_depthFunc, func)) {
+        glDepthFunc(func);
+    }
+}
+
+void GLStateCache::setCullFace(bool enabled) {
+    setCapability(CullFace, GL_CULL_FACE, enabled);
+}
+
+void GLStateCache::setCullFaceMode(GLenum mode) {
+    if (update(m_cullFaceMode, mode)) {
+        glCullFace(mode);
+    }
+}
+
+void GLStateCache::setViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    if (m_viewportKnown && m_viewport[0] == x && m_viewport[1] == y &&
+        m_viewport[2] == width && m_viewport[3] == height) {
+        ++m_stats.skipped;
+        return;
+    }
+    m_viewport[0] = x;
+    m_viewport[1] = y;
+    m_viewport[2] = width;
+    m_viewport[3] = height;
+    m_viewportKnown = true;
+    ++m_stats.issued;
+    glViewport(x, y, width, height);
+}
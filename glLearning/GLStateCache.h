@@ -0,0 +1,122 @@
+#ifndef GL_STATE_CACHE_H
+#define GL_STATE_CACHE_H
+
+#include <glad/glad.h>
+#include <cstdint>
+
+// GLStateCache: ǰ GL ״̬ӰӸ ()
+// зװ (Shader / Texture / VertexArray /  Buffer) ͨ󶨶޸Ĺ״̬,
+// 뻺ֵͬĵֱ, ͳ.
+// ע: ƹֱӵ gl* ޸ͬ״̬, Ҫ invalidate(), 򻺴ʵ״̬һ.
+class GLStateCache {
+public:
+    // ͳ: ʵʷĵ뱻
+    struct Stats {
+        uint64_t issued = 0;
+        uint64_t skipped = 0;
+    };
+
+    static constexpr GLuint kMaxTextureUnits = 32;
+    static constexpr GLuint kMaxIndexedBindings = 16;
+
+    // ȡʵ
+    static GLStateCache& getInstance();
+
+    // ֹ͸ֵ
+    GLStateCache(const GLStateCache&) = delete;
+    void operator=(const GLStateCache&) = delete;
+
+    // =====  =====
+    void useProgram(GLuint program);
+    void bindVertexArray(GLuint vao);
+    void bindBuffer(GLenum target, GLuint buffer);
+    void bindBufferBase(GLenum target, GLuint index, GLuint buffer);
+    // Χ󶨵ƫÿζܲͬ, Ƚ, Ƿ
+    void bindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+    void bindTexture(GLuint unit, GLenum target, GLuint texture);
+    void bindSampler(GLuint unit, GLuint sampler);
+    // target Ϊ GL_FRAMEBUFFER ʱͬʱûȡ֡
+    void bindFramebuffer(GLenum target, GLuint framebuffer);
+
+    // 󶨵ǰԪ, ޸ ( DSA ·) . ޸ĺ󲻱ٽ 0, ¼ʵ״̬
+    void bindTextureOnActiveUnit(GLenum target, GLuint texture);
+
+    // ===== ɾ =====
+    // ɾж (GL ɾİΪ 0, Ҳܱ)
+    void deleteProgram(GLuint program);
+    void deleteVertexArray(GLuint vao);
+    void deleteBuffer(GLuint buffer);
+    void deleteTexture(GLuint texture);
+    void deleteSampler(GLuint sampler);
+    void deleteFramebuffer(GLuint framebuffer);
+
+    // ===== ״̬ =====
+    void setBlend(bool enabled);
+    void setBlendFunc(GLenum srcFactor, GLenum dstFactor);
+    void setDepthTest(bool enabled);
+    void setDepthWrite(bool enabled);
+    void setDepthFunc(GLenum func);
+    void setCullFace(bool enabled);
+    void setCullFaceMode(GLenum mode);
+    void setViewport(GLint x, GLint y, GLsizei width, GLsizei height);
+
+    // ===== ѯ =====
+    GLuint getProgram() const { return m_program; }
+    GLuint getVertexArray() const { return m_vao; }
+    GLuint getActiveTextureUnit() const { return m_activeUnit; }
+    GLuint getDrawFramebuffer() const { return m_drawFramebuffer; }
+
+    // л״̬, һһᷢ GL  (ⲿֱӸ״̬, л)
+    void invalidate();
+
+    const Stats& getStats() const { return m_stats; }
+    void resetStats() { m_stats = Stats(); }
+
+private:
+    GLStateCache();
+
+    // ʾ "δ֪" Ļֵ, κʵ GL ֵ
+    static constexpr GLuint kUnknown = 0xFFFFFFFFu;
+
+    enum BufferSlot {
+        ArrayBuffer = 0, ElementArrayBuffer, UniformBuffer, ShaderStorageBuffer,
+        DrawIndirectBuffer, DispatchIndirectBuffer, ParameterBuffer, AtomicCounterBuffer,
+        CopyReadBuffer, CopyWriteBuffer, PixelPackBuffer, PixelUnpackBuffer, BufferSlotCount
+    };
+    enum TextureSlot {
+        Texture2D = 0, TextureCubeMap, Texture2DArray, Texture3D, Texture2DMultisample, TextureSlotCount
+    };
+    enum IndexedSlot { IndexedUniform = 0, IndexedShaderStorage, IndexedAtomicCounter, IndexedSlotCount };
+    enum Capability { Blend = 0, DepthTest, CullFace, CapabilityCount };
+
+    static int bufferSlot(GLenum target);
+    static int textureSlot(GLenum target);
+    static int indexedSlot(GLenum target);
+
+    void activeTexture(GLuint unit);
+    void setCapability(Capability capability, GLenum cap, bool enabled);
+
+    // Ƚϲ»ֵ.  true ʾҪ GL 
+    bool update(GLuint& cached, GLuint value);
+
+    GLuint m_program;
+    GLuint m_vao;
+    GLuint m_buffers[BufferSlotCount];
+    GLuint m_indexedBuffers[IndexedSlotCount][kMaxIndexedBindings];
+    GLuint m_activeUnit;
+    GLuint m_textures[kMaxTextureUnits][TextureSlotCount];
+    GLuint m_samplers[kMaxTextureUnits];
+    GLuint m_drawFramebuffer, m_readFramebuffer;
+
+    GLuint m_capabilities[CapabilityCount];
+    GLuint m_blendSrc, m_blendDst;
+    GLuint m_depthWrite;
+    GLuint m_depthFunc;
+    GLuint m_cullFaceMode;
+    GLint m_viewport[4];
+    bool m_viewportKnown;
+
+    Stats m_stats;
+};
+
+#endif // GL_STATE_CACHE_H
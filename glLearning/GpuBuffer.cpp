@@ -0,0 +1,81 @@
+#include "GpuBuffer.h"
+#include "GLStateCache.h"
+#include <stdexcept>
+
+GpuBuffer::GpuBuffer(GLenum target, const void* data, size_t size, GLenum usage)
+    : m_target(target), m_usage(usage), m_size(size) {
+    glGenBuffers(1, &m_rendererID);
+    GLStateCache::getInstance().bindBuffer(m_target, m_rendererID);
+    glBufferData(m_target, static_cast<GLsizeiptr>(size), data, usage);
+}
+
+GpuBuffer::~GpuBuffer() {
+    if (m_rendererID != 0) {
+        GLStateCache::getInstance().deleteBuffer(m_rendererID);
+    }
+}
+
+GpuBuffer::GpuBuffer(GpuBuffer&& other) noexcept
+    : m_rendererID(other.m_rendererID), m_target(other.m_target),
+    m_usage(other.m_usage), m_size(other.m_size) {
+    other.m_rendererID = 0;
+    other.m_size = 0;
+}
+
+GpuBuffer& GpuBuffer::operator=(GpuBuffer&& other) noexcept {
+    if (this != &other) {
+        if (m_rendererID != 0) {
+            GLStateCache::getInstance().deleteBuffer(m_rendererID);
+        }
+        m_rendererID = other.m_rendererID;
+        m_target = other.m_target;
+        m_usage = other.m_usage;
+        m_size = other.m_size;
+        other.m_rendererID = 0;
+        other.m_size = 0;
+    }
+    return *this;
+}
+
+void GpuBuffer::bind() const {
+    GLStateCache::getInstance().bindBuffer(m_target, m_rendererID);
+}
+
+void GpuBuffer::unbind() const {
+    GLStateCache::getInstance().bindBuffer(m_target, 0);
+}
+
+void GpuBuffer::bindBase(GLuint index) const {
+    GLStateCache::getInstance().bindBufferBase(m_target, index, m_rendererID);
+}
+
+void GpuBuffer::bindBase(GLenum target, GLuint index) const {
+    GLStateCache::getInstance().bindBufferBase(target, index, m_rendererID);
+}
+
+void GpuBuffer::bindRange(GLuint index, size_t offset, size_t size) const {
+    GLStateCache::getInstance().bindBufferRange(m_target, index, m_rendererID,
+        static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size));
+}
+
+void GpuBuffer::setData(const void* data, size_t size) {
+    GLStateCache::getInstance().bindBuffer(m_target, m_rendererID);
+    glBufferData(m_target, static_cast<GLsizeiptr>(size), data, m_usage);
+    m_size = size;
+}
+
+void GpuBuffer::updateData(size_t offset, const void* data, size_t size) {
+    if (offset + size > m_size) {
+        throw std::runtime_error("ERROR::GPU_BUFFER: updateData out of range");
+    }
+    GLStateCache::getInstance().bindBuffer(m_target, m_rendererID);
+    glBufferSubData(m_target, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data);
+}
+
+void GpuBuffer::reserve(size_t size) {
+    if (size <= m_size) {
+        return;
+    }
+    size_t newSize = m_size + m_size / 2;
+    setData(nullptr, newSize > size ? newSize : size);
+}
@@ -0,0 +1,52 @@
+#ifndef GPU_BUFFER_H
+#define GPU_BUFFER_H
+
+#include <glad/glad.h>
+#include <cstdint>
+#include <cstddef>
+
+// ͨûװ,  SSBO / UBO / ӻƻȷǶ;
+class GpuBuffer {
+public:
+    // target: GL_SHADER_STORAGE_BUFFER, GL_UNIFORM_BUFFER, GL_DRAW_INDIRECT_BUFFER 
+    // data Ϊ nullptr, ʱֻ洢
+    GpuBuffer(GLenum target, const void* data, size_t size, GLenum usage = GL_DYNAMIC_DRAW);
+    ~GpuBuffer();
+
+    // ֹ, ƶ
+    GpuBuffer(const GpuBuffer&) = delete;
+    GpuBuffer& operator=(const GpuBuffer&) = delete;
+    GpuBuffer(GpuBuffer&& other) noexcept;
+    GpuBuffer& operator=(GpuBuffer&& other) noexcept;
+
+    void bind() const;
+    void unbind() const;
+
+    // 󶨵󶨵 (SSBO / UBO / ԭӼ), Ӧɫе binding = index
+    void bindBase(GLuint index) const;
+    void bindBase(GLenum target, GLuint index) const;
+
+    // ֻ [offset, offset + size) һ, offset ӦĿĶҪ
+    void bindRange(GLuint index, size_t offset, size_t size) const;
+
+    // ·䲢ϴȫ
+    void setData(const void* data, size_t size);
+
+    // ², ǰСʱ׳쳣
+    void updateData(size_t offset, const void* data, size_t size);
+
+    // ʱ 1.5  ()
+    void reserve(size_t size);
+
+    GLuint getID() const { return m_rendererID; }
+    GLenum getTarget() const { return m_target; }
+    size_t getSize() const { return m_size; }
+
+private:
+    GLuint m_rendererID = 0;
+    GLenum m_target = GL_SHADER_STORAGE_BUFFER;
+    GLenum m_usage = GL_DYNAMIC_DRAW;
+    size_t m_size = 0;
+};
+
+#endif // GPU_BUFFER_H
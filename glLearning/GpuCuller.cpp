@@ -0,0 +1,240 @@
+#include "GpuCuller.h"
+#include "GLStateCache.h"
+#include "Frustum.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+    // GL 4.6 / ARB_indirect_parameters еĲĿ, GLAD 4.5 δ
+    const GLenum kParameterBuffer = 0x80EE;
+}
+
+GpuCuller::GpuCuller(MeshPool& pool, uint32_t maxObjects, uint32_t bucketCount, GLADloadproc loader,
+    const std::string& shaderPath)
+    : m_pool(pool), m_maxObjects(maxObjects), m_bucketCount(bucketCount), m_cullShader(shaderPath) {
+    if (!GLAD_GL_VERSION_4_3) {
+        throw std::runtime_error("ERROR::GPU_CULLER: GPU culling requires OpenGL 4.3");
+    }
+    if (maxObjects > pool.getMaxDraws()) {
+        throw std::runtime_error("ERROR::GPU_CULLER: maxObjects exceeds the mesh pool draw index stream");
+    }
+    if (bucketCount == 0) {
+        throw std::runtime_error("ERROR::GPU_CULLER: bucketCount must be at least 1");
+    }
+
+    if (loader) {
+        m_multiDrawIndirectCount = reinterpret_cast<MultiDrawIndirectCountProc>(
+            loader("glMultiDrawElementsIndirectCount"));
+        if (!m_multiDrawIndirectCount) {
+            m_multiDrawIndirectCount = reinterpret_cast<MultiDrawIndirectCountProc>(
+                loader("glMultiDrawElementsIndirectCountARB"));
+        }
+    }
+
+    m_objectBuffer = std::make_unique<GpuBuffer>(GL_SHADER_STORAGE_BUFFER, nullptr,
+        maxObjects * sizeof(ObjectData), GL_DYNAMIC_DRAW);
+    m_drawDataBuffer = std::make_unique<GpuBuffer>(GL_SHADER_STORAGE_BUFFER, nullptr,
+        maxObjects * sizeof(IndirectRenderer::DrawData), GL_DYNAMIC_DRAW);
+    m_commandBuffer = std::make_unique<GpuBuffer>(GL_DRAW_INDIRECT_BUFFER, nullptr,
+        maxObjects * sizeof(DrawElementsIndirectCommand), GL_DYNAMIC_COPY);
+    m_counterBuffer = std::make_unique<GpuBuffer>(GL_SHADER_STORAGE_BUFFER, nullptr,
+        bucketCount * sizeof(uint32_t), GL_DYNAMIC_COPY);
+    m_bucketOffsetBuffer = std::make_unique<GpuBuffer>(GL_SHADER_STORAGE_BUFFER, nullptr,
+        (bucketCount + 1) * sizeof(uint32_t), GL_DYNAMIC_DRAW);
+
+    m_objects.reserve(maxObjects);
+    m_drawData.reserve(maxObjects);
+    m_bucketOffsets.assign(bucketCount + 1, 0);
+}
+
+void GpuCuller::markDirty(uint32_t object) {
+    if (!m_objectsDirty) {
+        m_dirtyBegin = object;
+        m_dirtyEnd = object + 1;
+        m_objectsDirty = true;
+    }
+    else {
+        m_dirtyBegin = std::min(m_dirtyBegin, object);
+        m_dirtyEnd = std::max(m_dirtyEnd, object + 1);
+    }
+}
+
+uint32_t GpuCuller::addObject(uint32_t bucket, const MeshPool::MeshRange& mesh,
+    const glm::vec3& aabbMin, const glm::vec3& aabbMax, const IndirectRenderer::DrawData& data) {
+    if (m_objects.size() >= m_maxObjects) {
+        throw std::runtime_error("ERROR::GPU_CULLER: Too many objects");
+    }
+    if (bucket >= m_bucketCount) {
+        throw std::runtime_error("ERROR::GPU_CULLER: Bucket index out of range");
+    }
+
+    ObjectData object;
+    object.indexCount = mesh.indexCount;
+    object.firstIndex = mesh.firstIndex;
+    object.baseVertex = mesh.baseVertex;
+    object.bucket = bucket;
+    m_objects.push_back(object);
+    m_drawData.push_back(data);
+
+    uint32_t index = static_cast<uint32_t>(m_objects.size() - 1);
+    updateObject(index, aabbMin, aabbMax, data);
+    m_layoutDirty = true;
+    return index;
+}
+
+void GpuCuller::updateObject(uint32_t object, const glm::vec3& aabbMin, const glm::vec3& aabbMax,
+    const IndirectRenderer::DrawData& data) {
+    ObjectData& target = m_objects.at(object);
+    glm::vec3 center = (aabbMin + aabbMax) * 0.5f;
+    float radius = glm::length(aabbMax - center);
+    target.sphere = glm::vec4(center, radius);
+    target.aabbMin = glm::vec4(aabbMin, 0.0f);
+    target.aabbMax = glm::vec4(aabbMax, 0.0f);
+    m_drawData[object] = data;
+    markDirty(object);
+}
+
+void GpuCuller::upload() {
+    if (m_layoutDirty) {
+        // ÿͰͰ, ǰ׺͵õͰеʼλ
+        std::fill(m_bucketOffsets.begin(), m_bucketOffsets.end(), 0u);
+        for (const ObjectData& object : m_objects) {
+            m_bucketOffsets[object.bucket + 1]++;
+        }
+        for (uint32_t b = 0; b < m_bucketCount; ++b) {
+            m_bucketOffsets[b + 1] += m_bucketOffsets[b];
+        }
+        m_bucketOffsetBuffer->updateData(0, m_bucketOffsets.data(), m_bucketOffsets.size() * sizeof(uint32_t));
+        m_layoutDirty = false;
+    }
+
+    if (m_objectsDirty) {
+        uint32_t count = m_dirtyEnd - m_dirtyBegin;
+        m_objectBuffer->updateData(m_dirtyBegin * sizeof(ObjectData),
+            &m_objects[m_dirtyBegin], count * sizeof(ObjectData));
+        m_drawDataBuffer->updateData(m_dirtyBegin * sizeof(IndirectRenderer::DrawData),
+            &m_drawData[m_dirtyBegin], count * sizeof(IndirectRenderer::DrawData));
+        m_objectsDirty = false;
+    }
+}
+
+void GpuCuller::cull(const glm::mat4& viewProjection, const DepthPyramid* pyramid,
+    const glm::mat4& pyramidViewProjection) {
+    upload();
+    uint32_t objectCount = getObjectCount();
+    if (objectCount == 0) {
+        return;
+    }
+
+    // ; û IndirectCount ʱҪ, βΪջ
+    const uint32_t zero = 0;
+    m_counterBuffer->bind();
+    glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, &zero);
+    if (!m_multiDrawIndirectCount) {
+        m_commandBuffer->bind();
+        glClearBufferSubData(GL_DRAW_INDIRECT_BUFFER, GL_R32UI, 0,
+            objectCount * sizeof(DrawElementsIndirectCommand), GL_RED_INTEGER, GL_UNSIGNED_INT, &zero);
+    }
+
+    Frustum frustum = Frustum::fromMatrix(viewProjection);
+
+    m_cullShader.use();
+    m_cullShader.setVec4Array("frustumPlanes", frustum.planes, Frustum::Count);
+    m_cullShader.setUInt("objectCount", objectCount);
+    m_cullShader.setBool("occlusionEnabled", pyramid != nullptr);
+    if (pyramid) {
+        GLStateCache::getInstance().bindTexture(0, GL_TEXTURE_2D, pyramid->getTexture());
+        GLStateCache::getInstance().bindSampler(0, 0);  // 
+        m_cullShader.setInt("depthPyramid", 0);
+        m_cullShader.setIVec2("pyramidSize", glm::ivec2(pyramid->getWidth(), pyramid->getHeight()));
+        m_cullShader.setInt("pyramidLevels", pyramid->getLevels());
+        m_cullShader.setMat4("pyramidViewProjection", pyramidViewProjection);
+    }
+
+    m_objectBuffer->bindBase(kObjectBinding);
+    m_commandBuffer->bindBase(GL_SHADER_STORAGE_BUFFER, kCommandBinding);
+    m_counterBuffer->bindBase(kCounterBinding);
+    m_bucketOffsetBuffer->bindBase(kBucketOffsetBinding);
+
+    m_cullShader.dispatch((objectCount + 63) / 64);
+
+    // 󱻼ӻƶȡ
+    glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
+}
+
+void GpuCuller::draw(const std::function<void(uint32_t bucket)>& bindBucket) {
+    if (m_objects.empty()) {
+        return;
+    }
+
+    m_drawDataBuffer->bindBase(IndirectRenderer::kDrawDataBinding);
+    m_pool.getVertexArray().bind();
+    m_commandBuffer->bind();
+    if (m_multiDrawIndirectCount) {
+        GLStateCache::getInstance().bindBuffer(kParameterBuffer, m_counterBuffer->getID());
+    }
+
+    for (uint32_t bucket = 0; bucket < m_bucketCount; ++bucket) {
+        uint32_t first = m_bucketOffsets[bucket];
+        uint32_t capacity = m_bucketOffsets[bucket + 1] - first;
+        if (capacity == 0) {
+            continue;
+        }
+
+        if (bindBucket) {
+            bindBucket(bucket);
+        }
+
+        const void* offset = (const void*)(uintptr_t(first) * sizeof(DrawElementsIndirectCommand));
+        if (m_multiDrawIndirectCount) {
+            m_multiDrawIndirectCount(GL_TRIANGLES, GL_UNSIGNED_INT, offset,
+                GLintptr(bucket * sizeof(uint32_t)), static_cast<GLsizei>(capacity), 0);
+        }
+        else {
+            glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, offset,
+                static_cast<GLsizei>(capacity), 0);
+        }
+    }
+
+    if (m_multiDrawIndirectCount) {
+        GLStateCache::getInstance().bindBuffer(kParameterBuffer, 0);
+    }
+}
+
+uint32_t GpuCuller::readVisibleCount() const {
+    std::vector<uint32_t> counts(m_bucketCount, 0);
+    m_counterBuffer->bind();
+    glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, m_bucketCount * sizeof(uint32_t), counts.data());
+
+    uint32_t total = 0;
+    for (uint32_t count : counts) {
+        total += count;
+    }
+    return total;
+}
+
+std::vector<uint32_t> GpuCuller::readVisibleObjects() const {
+    // ɫдĻҪ glGetBufferSubData ȡ
+    glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+
+    std::vector<uint32_t> counts(m_bucketCount, 0);
+    m_counterBuffer->bind();
+    glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, m_bucketCount * sizeof(uint32_t), counts.data());
+
+    std::vector<DrawElementsIndirectCommand> commands(m_objects.size());
+    if (!commands.empty()) {
+        m_commandBuffer->bind();
+        glGetBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, commands.size() * sizeof(DrawElementsIndirectCommand), commands.data());
+    }
+
+    // ÿͰֻǰ counts[b] Ǳ޳д, ֮Ŀһ֡Ĳ
+    std::vector<uint32_t> objects;
+    for (uint32_t bucket = 0; bucket < m_bucketCount; ++bucket) {
+        uint32_t first = m_bucketOffsets[bucket];
+        uint32_t count = std::min(counts[bucket], m_bucketOffsets[bucket + 1] - first);
+        for (uint32_t i = 0; i < count; ++i) {
+            objects.push_back(commands[first + i].baseInstance);
+        }
+    }
+    return objects;
+}
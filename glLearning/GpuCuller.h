@@ -0,0 +1,111 @@
+#ifndef GPU_CULLER_H
+#define GPU_CULLER_H
+
+#include "MeshPool.h"
+#include "GpuBuffer.h"
+#include "IndirectRenderer.h"
+#include "DepthPyramid.h"
+#include "Shader.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+// GpuCuller: ڼɫ׶ + Hi-Z ڵ޳, ֱɼӻ (Ҫ GL 4.3)
+// ݳפ GPU, ÿ֡ CPU ֻϴ uniform, ޳޹.
+// ԭӼͰѹǰ:
+//   - ṩ glMultiDrawElementsIndirectCount (GL 4.6 / ARB_indirect_parameters) ʱ, ֱΪ;
+//   - ÿ֡, βĿ (count = 0)  glMultiDrawElementsIndirect .
+class GpuCuller {
+public:
+    // ޳,  Shader/cull.comp е std430 һ (64 ֽ)
+    struct ObjectData {
+        glm::vec4 sphere;   // xyz: ռ, w: 뾶
+        glm::vec4 aabbMin;  // xyz: ռ AABB
+        glm::vec4 aabbMax;
+        uint32_t indexCount;
+        uint32_t firstIndex;
+        int32_t baseVertex;
+        uint32_t bucket;
+    };
+
+    // ɫе binding Ӧ
+    static constexpr GLuint kObjectBinding = 1;
+    static constexpr GLuint kCommandBinding = 2;
+    static constexpr GLuint kCounterBinding = 3;
+    static constexpr GLuint kBucketOffsetBinding = 4;
+
+    // loader: ڲѯ GL 4.6 ,  (GLADloadproc)glfwGetProcAddress.  nullptr ʱʹû·
+    GpuCuller(MeshPool& pool, uint32_t maxObjects, uint32_t bucketCount, GLADloadproc loader = nullptr,
+        const std::string& shaderPath = "../Shader/cull.comp");
+
+    // ֹ
+    GpuCuller(const GpuCuller&) = delete;
+    GpuCuller& operator=(const GpuCuller&) = delete;
+
+    /**
+     * @brief һ. ΧΪռ.
+     * @return , ͬʱҲ DrawData SSBO е± ( baseInstance).
+     */
+    uint32_t addObject(uint32_t bucket, const MeshPool::MeshRange& mesh,
+        const glm::vec3& aabbMin, const glm::vec3& aabbMax, const IndirectRenderer::DrawData& data);
+
+    // İΧ (ƶ)
+    void updateObject(uint32_t object, const glm::vec3& aabbMin, const glm::vec3& aabbMax,
+        const IndirectRenderer::DrawData& data);
+
+    // иĶϴ GPU. Ͱֲ仯ʱؽͰƫ
+    void upload();
+
+    /**
+     * @brief ִ޳.
+     * @param viewProjection ǰ֡ ͶӰ * ͼ .
+     * @param pyramid ѡ, һ֡Ƚ; Ϊʱֻ׶޳.
+     * @param pyramidViewProjection  pyramid ʱõ ͶӰ * ͼ .
+     */
+    void cull(const glm::mat4& viewProjection, const DepthPyramid* pyramid = nullptr,
+        const glm::mat4& pyramidViewProjection = glm::mat4(1.0f));
+
+    // ޳, ÿͰһζؼӻ
+    void draw(const std::function<void(uint32_t bucket)>& bindBucket);
+
+    // ظͰ֮. ᵼ CPU/GPU ͬ, ڵͳ
+    uint32_t readVisibleCount() const;
+
+    // شı (Ͱ, Ͱ˳ȷ). ͬͬ, ڵԺԼ
+    std::vector<uint32_t> readVisibleObjects() const;
+
+    uint32_t getObjectCount() const { return static_cast<uint32_t>(m_objects.size()); }
+    bool hasIndirectCount() const { return m_multiDrawIndirectCount != nullptr; }
+
+private:
+    // GLAD ֻɵ 4.5, ֶ 4.6  glMultiDrawElementsIndirectCount
+    typedef void (APIENTRYP MultiDrawIndirectCountProc)(GLenum mode, GLenum type, const void* indirect,
+        GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride);
+
+    MeshPool& m_pool;
+    uint32_t m_maxObjects;
+    uint32_t m_bucketCount;
+    Shader m_cullShader;
+    MultiDrawIndirectCountProc m_multiDrawIndirectCount = nullptr;
+
+    std::vector<ObjectData> m_objects;
+    std::vector<IndirectRenderer::DrawData> m_drawData;
+    std::vector<uint32_t> m_bucketOffsets;   // ÿͰеʼλ, ĩβΪ
+    bool m_objectsDirty = false;
+    bool m_layoutDirty = false;
+    uint32_t m_dirtyBegin = 0;
+    uint32_t m_dirtyEnd = 0;
+
+    std::unique_ptr<GpuBuffer> m_objectBuffer;
+    std::unique_ptr<GpuBuffer> m_drawDataBuffer;
+    std::unique_ptr<GpuBuffer> m_commandBuffer;
+    std::unique_ptr<GpuBuffer> m_counterBuffer;
+    std::unique_ptr<GpuBuffer> m_bucketOffsetBuffer;
+
+    void markDirty(uint32_t object);
+};
+
+#endif // GPU_CULLER_H
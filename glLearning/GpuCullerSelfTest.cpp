@@ -0,0 +1,204 @@
+#include "GpuCullerSelfTest.h"
+#include "Benchmark.h"
+#include "DepthPyramid.h"
+#include "Frustum.h"
+#include "GLStateCache.h"
+#include "GpuCuller.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+    const uint32_t kObjectCount = 20000;
+    const uint32_t kBucketCount = 3;
+    const int kDepthWidth = 300;     // ⲻ 2 , ǽײ 3x3 Լ
+    const int kDepthHeight = 200;
+    const float kOccluderDepth = 0.5f;
+
+    struct TestScene {
+        std::vector<glm::vec3> minCorners;
+        std::vector<glm::vec3> maxCorners;
+        glm::mat4 viewProjection;
+    };
+
+    // ԭ㿴 -Z, 󲿷ǰ, һ׶
+    TestScene makeScene() {
+        TestScene scene;
+        scene.viewProjection = glm::perspective(glm::radians(60.0f), 1.5f, 0.1f, 100.0f)
+            * glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        uint32_t seed = 7;
+        for (uint32_t i = 0; i < kObjectCount; ++i) {
+            glm::vec3 center = (Benchmark::randomVector(seed) - glm::vec3(0.5f, 0.5f, 0.9f)) * glm::vec3(120.0f, 120.0f, 130.0f);
+            glm::vec3 halfSize(0.25f + Benchmark::random(seed) * 1.5f);
+            scene.minCorners.push_back(center - halfSize);
+            scene.maxCorners.push_back(center + halfSize);
+        }
+        return scene;
+    }
+
+    // һ, 干
+    MeshPool::MeshRange addCube(MeshPool& pool) {
+        float vertices[8 * 8] = {};
+        for (int i = 0; i < 8; ++i) {
+            vertices[i * 8 + 0] = (i & 1) ? 0.5f : -0.5f;
+            vertices[i * 8 + 1] = (i & 2) ? 0.5f : -0.5f;
+            vertices[i * 8 + 2] = (i & 4) ? 0.5f : -0.5f;
+        }
+        const uint32_t indices[36] = { 0, 1, 3, 3, 2, 0, 4, 6, 7, 7, 5, 4, 0, 4, 5, 5, 1, 0,
+                                       2, 3, 7, 7, 6, 2, 0, 2, 6, 6, 4, 0, 1, 5, 7, 7, 3, 1 };
+        return pool.addMesh(vertices, 8, indices, 36);
+    }
+
+    // ΧжͶӰұڵԶ, ڵȫס
+    bool isOccluded(const TestScene& scene, uint32_t object) {
+        for (int i = 0; i < 8; ++i) {
+            glm::vec3 corner((i & 1) ? scene.maxCorners[object].x : scene.minCorners[object].x,
+                             (i & 2) ? scene.maxCorners[object].y : scene.minCorners[object].y,
+                             (i & 4) ? scene.maxCorners[object].z : scene.minCorners[object].z);
+            glm::vec4 clip = scene.viewProjection * glm::vec4(corner, 1.0f);
+            if (clip.w <= 0.0f || clip.x / clip.w >= 0.0f || (clip.z / clip.w) * 0.5f + 0.5f <= kOccluderDepth) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Ϊ kOccluderDepthҰΪ (1.0) 
+    GLuint createDepthTexture() {
+        std::vector<float> depth(kDepthWidth * kDepthHeight);
+        for (int y = 0; y < kDepthHeight; ++y) {
+            for (int x = 0; x < kDepthWidth; ++x) {
+                depth[y * kDepthWidth + x] = x < kDepthWidth / 2 ? kOccluderDepth : 1.0f;
+            }
+        }
+
+        GLuint texture = 0;
+        glGenTextures(1, &texture);
+        GLStateCache::getInstance().bindTextureOnActiveUnit(GL_TEXTURE_2D, texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT32F, kDepthWidth, kDepthHeight, 0,
+            GL_DEPTH_COMPONENT, GL_FLOAT, depth.data());
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        return texture;
+    }
+
+    bool check(bool condition, const std::string& name, bool print) {
+        if (print) {
+            std::cout << (condition ? "  PASS  " : "  FAIL  ") << name << std::endl;
+        }
+        return condition;
+    }
+}
+
+bool runGpuCullerSelfTest(GLADloadproc loader, bool print) {
+    if (print) {
+        std::cout << "===== GpuCuller self-test (" << kObjectCount << " objects, " << glGetString(GL_RENDERER) << ") =====" << std::endl;
+    }
+    if (!GLAD_GL_VERSION_4_3) {
+        return check(false, "OpenGL 4.3 context", print);
+    }
+
+    try {
+        TestScene scene = makeScene();
+        Frustum frustum = Frustum::fromMatrix(scene.viewProjection);
+        std::vector<uint8_t> inFrustum(kObjectCount, 0);
+        uint32_t cpuVisible = 0;
+        for (uint32_t i = 0; i < kObjectCount; ++i) {
+            inFrustum[i] = frustum.intersectsAABB(scene.minCorners[i], scene.maxCorners[i]) ? 1 : 0;
+            cpuVisible += inFrustum[i];
+        }
+
+        VertexBufferLayout layout;
+        layout.push<float>(3);
+        layout.push<float>(3);
+        layout.push<float>(2);
+        MeshPool pool(layout, 8, 36, kObjectCount);
+        MeshPool::MeshRange cube = addCube(pool);
+
+        // Ȳ·, ٲ IndirectCount · (֧ʱ)
+        bool passed = true;
+        for (int pass = 0; pass < (loader ? 2 : 1); ++pass) {
+            GpuCuller culler(pool, kObjectCount, kBucketCount, pass == 0 ? nullptr : loader);
+            if (pass == 1 && !culler.hasIndirectCount()) {
+                break;
+            }
+            for (uint32_t i = 0; i < kObjectCount; ++i) {
+                IndirectRenderer::DrawData data = { glm::mat4(1.0f), glm::vec4(0.0f) };
+                culler.addObject(i % kBucketCount, cube, scene.minCorners[i], scene.maxCorners[i], data);
+            }
+
+            // ===== ׶:  CPU ȫһ =====
+            culler.cull(scene.viewProjection);
+            uint32_t gpuCount = culler.readVisibleCount();
+            std::vector<uint32_t> gpuObjects = culler.readVisibleObjects();
+            std::vector<uint8_t> gpuVisible(kObjectCount, 0);
+            for (uint32_t object : gpuObjects) {
+                if (object < kObjectCount) {
+                    gpuVisible[object] = 1;
+                }
+            }
+
+            std::string path = culler.hasIndirectCount() ? "IndirectCount" : "fallback";
+            if (print) {
+                std::cout << "  [" << path << "] frustum: GPU " << gpuCount << ", CPU Frustum " << cpuVisible << std::endl;
+            }
+            passed &= check(gpuCount == cpuVisible, path + ": visible count matches CPU frustum", print);
+            passed &= check(gpuObjects.size() == gpuCount && gpuVisible == inFrustum, path + ": same visible objects as CPU frustum", print);
+
+            // ===== Hi-Z: ֻ޳ס, ׶ =====
+            if (pass == 0) {
+                GLuint depthTexture = createDepthTexture();
+                DepthPyramid pyramid;
+                pyramid.build(depthTexture, kDepthWidth, kDepthHeight);
+                culler.cull(scene.viewProjection, &pyramid, scene.viewProjection);
+                std::vector<uint32_t> survivors = culler.readVisibleObjects();
+                GLStateCache::getInstance().deleteTexture(depthTexture);
+
+                std::vector<uint8_t> survived(kObjectCount, 0);
+                uint32_t outsideFrustum = 0;
+                for (uint32_t object : survivors) {
+                    survived[object] = 1;
+                    outsideFrustum += inFrustum[object] ? 0 : 1;
+                }
+                uint32_t occluded = 0;
+                uint32_t culled = 0;
+                uint32_t wronglyCulled = 0;
+                for (uint32_t i = 0; i < kObjectCount; ++i) {
+                    if (!inFrustum[i]) {
+                        continue;
+                    }
+                    bool hidden = isOccluded(scene, i);
+                    occluded += hidden ? 1 : 0;
+                    if (!survived[i]) {
+                        ++culled;
+                        wronglyCulled += hidden ? 0 : 1;
+                    }
+                }
+
+                if (print) {
+                    std::cout << "  Hi-Z (" << pyramid.getWidth() << "x" << pyramid.getHeight() << ", " << pyramid.getLevels()
+                              << " levels): survivors " << survivors.size() << ", occluded " << occluded << ", culled " << culled
+                              << ", culled but visible " << wronglyCulled << ", outside frustum " << outsideFrustum << std::endl;
+                }
+                passed &= check(wronglyCulled == 0, "Hi-Z never culls a visible object", print);
+                passed &= check(outsideFrustum == 0, "Hi-Z survivors are within the CPU frustum set", print);
+                passed &= check(culled > 0, "Hi-Z culls occluded objects", print);
+            }
+        }
+        passed &= check(glGetError() == GL_NO_ERROR, "no GL errors", print);
+
+        if (print) {
+            std::cout << (passed ? "All checks passed" : "Some checks FAILED") << std::endl;
+        }
+        return passed;
+    }
+    catch (const std::exception& e) {
+        if (print) {
+            std::cout << e.what() << std::endl;
+        }
+        return check(false, "GPU culling resources created", print);
+    }
+}
@@ -0,0 +1,14 @@
+#ifndef GPU_CULLER_SELF_TEST_H
+#define GPU_CULLER_SELF_TEST_H
+
+#include <glad/glad.h>
+
+// GpuCuller Լ (Ҫǰ߳ GL 4.3 ): Թ̶峡 cull.comp, 
+//   - ֻ׶޳ʱ, readVisibleCount 弯϶ CPU ϵ Frustum::intersectsAABB ȫһ
+//     (loader Բ鵽 glMultiDrawElementsIndirectCount ʱ, ·һ)
+//   -  depth_pyramid.comp ɵ Hi-Z ڵ޳ʱ, ޳ CPU жΪɼ,
+//     ׶, ȷʵ޳һֱڵ
+// ӡÿһĽ (main  --test-gpucull ), ȫͨʱ true
+bool runGpuCullerSelfTest(GLADloadproc loader = nullptr, bool print = true);
+
+#endif // GPU_CULLER_SELF_TEST_H
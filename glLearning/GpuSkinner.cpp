@@ -0,0 +1,76 @@
+#include "GpuSkinner.h"
+#include "GLStateCache.h"
+#include <stdexcept>
+
+namespace {
+    uint32_t attributeOffset(const MeshFile& mesh, MeshFile::Semantic semantic) {
+        int index = mesh.findAttribute(semantic);
+        if (index < 0) {
+            throw std::runtime_error("ERROR::GPU_SKINNER: " + mesh.getPath() + " is not a skinned mesh (import with --skinned)");
+        }
+        uint32_t offset = 0;
+        for (int i = 0; i < index; ++i) {
+            const MeshFile::Attribute& attribute = mesh.getHeader().attributes[i];
+            offset += attribute.count * VertexAttribute::getSizeOfType(attribute.type);
+        }
+        return offset;
+    }
+}
+
+GpuSkinner::Layout GpuSkinner::Layout::fromMesh(const MeshFile& mesh) {
+    Layout layout;
+    layout.stride = mesh.getHeader().vertexStride;
+    layout.normalOffset = attributeOffset(mesh, MeshFile::Semantic::Normal);
+    layout.jointsOffset = attributeOffset(mesh, MeshFile::Semantic::Joints);
+    layout.weightsOffset = attributeOffset(mesh, MeshFile::Semantic::Weights);
+    return layout;
+}
+
+GpuSkinner::GpuSkinner(const std::string& shaderPath)
+    : m_shader(shaderPath) {
+    if (!GLAD_GL_VERSION_4_3) {
+        throw std::runtime_error("ERROR::GPU_SKINNER: Compute skinning requires OpenGL 4.3");
+    }
+}
+
+void GpuSkinner::skin(const SkinningBuffer& palettes, uint32_t paletteOffset, GLuint source, GLuint output,
+    const Layout& layout, uint32_t vertexCount, uint32_t outputVertex) {
+    if (vertexCount == 0) {
+        return;
+    }
+    GLStateCache& state = GLStateCache::getInstance();
+    state.bindBufferBase(GL_SHADER_STORAGE_BUFFER, kSourceBinding, source);
+    state.bindBufferBase(GL_SHADER_STORAGE_BUFFER, kOutputBinding, output);
+
+    m_shader.use();
+    m_shader.setUInt("paletteOffset", palettes.bind(paletteOffset));
+    m_shader.setUInt("vertexCount", vertexCount);
+    m_shader.setUInt("stride", layout.stride / sizeof(float));
+    m_shader.setUInt("normalOffset", layout.normalOffset / sizeof(float));
+    m_shader.setUInt("jointsOffset", layout.jointsOffset / sizeof(float));
+    m_shader.setUInt("weightsOffset", layout.weightsOffset / sizeof(float));
+    m_shader.setUInt("outputVertex", outputVertex);
+    m_shader.dispatch((vertexCount + 63) / 64);
+}
+
+void GpuSkinner::finish() const {
+    // ΪԶȡ
+    glMemoryBarrier(GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT);
+}
+
+// ===== ʹdemo =====
+// MeshFile mesh("../model/character.mesh");
+// Model character(mesh.getPath());
+// GpuSkinner::Layout layout = GpuSkinner::Layout::fromMesh(mesh);
+//
+// // ʵһ, ԴĲֽ, Ҳ
+// VertexBuffer skinnedVertices(nullptr, layout.stride * mesh.getVertexCount() * instanceCount, GL_DYNAMIC_COPY);
+// VertexArray skinnedVao;
+// skinnedVao.addBuffer(skinnedVertices, mesh.getLayout());
+//
+// // ÿ֡: ɫϴ֮
+// for (uint32_t i = 0; i < instanceCount; ++i)
+//     skinner.skin(skinning, paletteOffsets[i], characterVboId, skinnedVertices.getID(),
+//         layout, mesh.getVertexCount(), i * mesh.getVertexCount());
+// skinner.finish();
+// //  i ʵ: baseVertex = i * mesh.getVertexCount(), þ̬ɫ
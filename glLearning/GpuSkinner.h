@@ -0,0 +1,50 @@
+#ifndef GPU_SKINNER_H
+#define GPU_SKINNER_H
+
+#include "MeshFile.h"
+#include "Shader.h"
+#include "SkinningBuffer.h"
+#include <cstdint>
+#include <string>
+
+// GpuSkinner: üɫԤƤ (Ҫ GL 4.3, Shader/skin.comp).
+// ÿɫÿ֡Ƥһ, д㻺, ֮ӰԤpasspass ȶλ
+// ͨľ̬ɫ, ÿpassĶɫظƤ.
+class GpuSkinner {
+public:
+    //  skin.comp е binding Ӧ (ɫΪ SkinningBuffer::kBinding)
+    static constexpr GLuint kSourceBinding = 2;
+    static constexpr GLuint kOutputBinding = 3;
+
+    // ƤĶ㲼 (ֽڼ), Դͬ
+    struct Layout {
+        uint32_t stride = 0;
+        uint32_t normalOffset = 0;
+        uint32_t jointsOffset = 0;
+        uint32_t weightsOffset = 0;
+
+        // @throws std::runtime_error ûйؽ / Ȩʱ׳
+        static Layout fromMesh(const MeshFile& mesh);
+    };
+
+    explicit GpuSkinner(const std::string& shaderPath = "../Shader/skin.comp");
+
+    // ֹ
+    GpuSkinner(const GpuSkinner&) = delete;
+    GpuSkinner& operator=(const GpuSkinner&) = delete;
+
+    /**
+     * @brief Ƥ source е vertexCount , д output д outputVertex ʼλ.
+     * @param paletteOffset SkinningBuffer::addPalette ķֵ, ɫ upload
+     */
+    void skin(const SkinningBuffer& palettes, uint32_t paletteOffset, GLuint source, GLuint output,
+        const Layout& layout, uint32_t vertexCount, uint32_t outputVertex);
+
+    // ֡ skin ֮󡢻֮ǰһ
+    void finish() const;
+
+private:
+    Shader m_shader;
+};
+
+#endif // GPU_SKINNER_H
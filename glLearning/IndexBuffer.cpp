@@ -1,15 +1,17 @@
 #include "IndexBuffer.h"
+#include "GLStateCache.h"
+#include <stdexcept>
 
-IndexBuffer::IndexBuffer(const uint32_t* indices, uint32_t count)
+IndexBuffer::IndexBuffer(const uint32_t* indices, uint32_t count, GLenum usage)
     : m_count(count) {
     glGenBuffers(1, &m_rendererID);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_rendererID);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint32_t), indices, GL_STATIC_DRAW);
+    GLStateCache::getInstance().bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_rendererID);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint32_t), indices, usage);
 }
 
 IndexBuffer::~IndexBuffer() {
     if (m_rendererID != 0) {
-        glDeleteBuffers(1, &m_rendererID);
+        GLStateCache::getInstance().deleteBuffer(m_rendererID);
     }
 }
 
@@ -22,7 +24,7 @@ IndexBuffer::IndexBuffer(IndexBuffer&& other) noexcept
 IndexBuffer& IndexBuffer::operator=(IndexBuffer&& other) noexcept {
     if (this != &other) {
         if (m_rendererID != 0) {
-            glDeleteBuffers(1, &m_rendererID);
+            GLStateCache::getInstance().deleteBuffer(m_rendererID);
         }
         m_rendererID = other.m_rendererID;
         m_count = other.m_count;
@@ -33,9 +35,18 @@ IndexBuffer& IndexBuffer::operator=(IndexBuffer&& other) noexcept {
 }
 
 void IndexBuffer::bind() const {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_rendererID);
+    GLStateCache::getInstance().bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_rendererID);
 }
 
 void IndexBuffer::unbind() const {
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    GLStateCache::getInstance().bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
+void IndexBuffer::updateData(uint32_t offset, const uint32_t* indices, uint32_t count) {
+    if (offset + count > m_count) {
+        throw std::runtime_error("ERROR::INDEX_BUFFER: updateData out of range");
+    }
+    // ͨ GL_COPY_WRITE_BUFFER ϴ, Ķǰ VAO ¼
+    GLStateCache::getInstance().bindBuffer(GL_COPY_WRITE_BUFFER, m_rendererID);
+    glBufferSubData(GL_COPY_WRITE_BUFFER, offset * sizeof(uint32_t), count * sizeof(uint32_t), indices);
 }
\ No newline at end of file
@@ -9,7 +9,8 @@ public:
     // 캯: IBO
     // indices: ָݵָ (޷)
     // count: 
-    IndexBuffer(const uint32_t* indices, uint32_t count);
+    // usage: ;ʾ, Ҫ updateData ʱ GL_DYNAMIC_DRAW
+    IndexBuffer(const uint32_t* indices, uint32_t count, GLenum usage = GL_STATIC_DRAW);
     ~IndexBuffer();
 
     // ֹ, ƶ
@@ -21,7 +22,11 @@ public:
     void bind() const;
     void unbind() const;
 
+    // ², offset  count 
+    void updateData(uint32_t offset, const uint32_t* indices, uint32_t count);
+
     uint32_t getCount() const { return m_count; }
+    GLuint getID() const { return m_rendererID; }
 
 private:
     GLuint m_rendererID = 0;
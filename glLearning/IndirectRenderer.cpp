@@ -0,0 +1,119 @@
+#include "IndirectRenderer.h"
+#include <algorithm>
+#include <stdexcept>
+
+IndirectRenderer::IndirectRenderer(MeshPool& pool, uint32_t maxDraws)
+    : m_pool(pool), m_maxDraws(maxDraws) {
+    if (!GLAD_GL_VERSION_4_3) {
+        throw std::runtime_error("ERROR::INDIRECT_RENDERER: glMultiDrawElementsIndirect requires OpenGL 4.3");
+    }
+
+    if (maxDraws > pool.getMaxDraws()) {
+        throw std::runtime_error("ERROR::INDIRECT_RENDERER: maxDraws exceeds the mesh pool draw index stream");
+    }
+
+    m_commandBuffer = std::make_unique<GpuBuffer>(GL_DRAW_INDIRECT_BUFFER, nullptr,
+        maxDraws * sizeof(DrawElementsIndirectCommand), GL_STREAM_DRAW);
+    m_drawDataBuffer = std::make_unique<GpuBuffer>(GL_SHADER_STORAGE_BUFFER, nullptr,
+        maxDraws * sizeof(DrawData), GL_STREAM_DRAW);
+
+    m_submissions.reserve(maxDraws);
+    m_order.reserve(maxDraws);
+    m_commands.reserve(maxDraws);
+    m_drawData.reserve(maxDraws);
+}
+
+void IndirectRenderer::beginFrame() {
+    m_submissions.clear();
+    m_drawData.clear();
+    m_multiDrawCalls = 0;
+}
+
+void IndirectRenderer::submit(uint32_t bucket, const MeshPool::MeshRange& mesh, const DrawData& data,
+    uint32_t instanceCount) {
+    if (m_submissions.size() >= m_maxDraws || m_drawData.size() + instanceCount > m_maxDraws) {
+        throw std::runtime_error("ERROR::INDIRECT_RENDERER: Too many draws submitted this frame");
+    }
+
+    // baseInstance û SSBO е±. ʵʱ, ʵ i λ baseInstance + i,
+    // ΪÿʵԤһ DrawData
+    Submission submission;
+    submission.bucket = bucket;
+    submission.command.count = mesh.indexCount;
+    submission.command.instanceCount = instanceCount;
+    submission.command.firstIndex = mesh.firstIndex;
+    submission.command.baseVertex = mesh.baseVertex;
+    submission.command.baseInstance = static_cast<uint32_t>(m_drawData.size());
+    m_submissions.push_back(submission);
+
+    for (uint32_t i = 0; i < instanceCount; ++i) {
+        m_drawData.push_back(data);
+    }
+}
+
+void IndirectRenderer::submitCommands(uint32_t bucket, const DrawData& data,
+    const DrawElementsIndirectCommand* commands, size_t commandCount) {
+    if (commandCount == 0) {
+        return;
+    }
+    if (m_submissions.size() + commandCount > m_maxDraws || m_drawData.size() >= m_maxDraws) {
+        throw std::runtime_error("ERROR::INDIRECT_RENDERER: Too many draws submitted this frame");
+    }
+
+    uint32_t slot = static_cast<uint32_t>(m_drawData.size());
+    m_drawData.push_back(data);
+    for (size_t i = 0; i < commandCount; ++i) {
+        Submission submission;
+        submission.bucket = bucket;
+        submission.command = commands[i];
+        submission.command.baseInstance = slot;
+        m_submissions.push_back(submission);
+    }
+}
+
+void IndirectRenderer::flush(const std::function<void(uint32_t bucket)>& bindBucket) {
+    if (m_submissions.empty()) {
+        return;
+    }
+
+    // Ͱ (ȶ򱣳ͬһͰڵύ˳)
+    m_order.resize(m_submissions.size());
+    for (uint32_t i = 0; i < m_order.size(); ++i) {
+        m_order[i] = i;
+    }
+    std::stable_sort(m_order.begin(), m_order.end(), [this](uint32_t a, uint32_t b) {
+        return m_submissions[a].bucket < m_submissions[b].bucket;
+    });
+
+    // ݲλύʱȷ, ֻ
+    m_commands.clear();
+    for (uint32_t index : m_order) {
+        m_commands.push_back(m_submissions[index].command);
+    }
+
+    m_commandBuffer->setData(m_commands.data(), m_commands.size() * sizeof(DrawElementsIndirectCommand));
+    m_drawDataBuffer->setData(m_drawData.data(), m_drawData.size() * sizeof(DrawData));
+    m_drawDataBuffer->bindBase(kDrawDataBinding);
+
+    m_pool.getVertexArray().bind();
+    m_commandBuffer->bind();
+
+    size_t first = 0;
+    while (first < m_order.size()) {
+        uint32_t bucket = m_submissions[m_order[first]].bucket;
+        size_t last = first + 1;
+        while (last < m_order.size() && m_submissions[m_order[last]].bucket == bucket) {
+            ++last;
+        }
+
+        if (bindBucket) {
+            bindBucket(bucket);
+        }
+        glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT,
+            (const void*)(first * sizeof(DrawElementsIndirectCommand)),
+            static_cast<GLsizei>(last - first), 0);
+        ++m_multiDrawCalls;
+
+        first = last;
+    }
+}
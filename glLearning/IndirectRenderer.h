@@ -0,0 +1,87 @@
+#ifndef INDIRECT_RENDERER_H
+#define INDIRECT_RENDERER_H
+
+#include "MeshPool.h"
+#include "GpuBuffer.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+//  glMultiDrawElementsIndirect Ҫڴ沼һ
+struct DrawElementsIndirectCommand {
+    uint32_t count;
+    uint32_t instanceCount;
+    uint32_t firstIndex;
+    int32_t baseVertex;
+    uint32_t baseInstance;
+};
+
+// IndirectRenderer: GPU Ķؼӻ (Ҫ GL 4.3)
+// ÿ֡лдӻ, д SSBO,
+// Ȼÿ/Ͱֻһ glMultiDrawElementsIndirect.
+// ɫͨ gl_BaseInstance ( Shader/indirect.vs еĻ)  SSBO.
+class IndirectRenderer {
+public:
+    // ,  std430 һ ( Shader/indirect.vs)
+    struct DrawData {
+        glm::mat4 model;
+        glm::vec4 params;  // Զ, /ɫ
+    };
+
+    // Ӧɫ layout(std430, binding = 0)
+    static constexpr GLuint kDrawDataBinding = 0;
+
+    // pool: лƹļ
+    // maxDraws: ÿ֡Ļ, ܳ pool Ļ
+    IndirectRenderer(MeshPool& pool, uint32_t maxDraws);
+
+    // ֹ
+    IndirectRenderer(const IndirectRenderer&) = delete;
+    IndirectRenderer& operator=(const IndirectRenderer&) = delete;
+
+    // ʼµһ֡, ύĻ
+    void beginFrame();
+
+    // ύһλ. bucket ͨǲʻߵı, ͬ bucket ĻƺϲΪһε
+    void submit(uint32_t bucket, const MeshPool::MeshRange& mesh, const DrawData& data,
+        uint32_t instanceCount = 1);
+
+    /**
+     * @brief ύһ鹲ͬһ DrawData  ( MeshletCuller Ŀɼ meshlet).
+     * @param commands ÿ baseInstance ᱻдΪ DrawData Ĳλ, instanceCount ӦΪ 1.
+     */
+    void submitCommands(uint32_t bucket, const DrawData& data,
+        const DrawElementsIndirectCommand* commands, size_t commandCount);
+
+    /**
+     * @brief ϴ֡, Ͱύ.
+     * @param bindBucket ÿͰǰ, ڰɫͲ״̬.
+     */
+    void flush(const std::function<void(uint32_t bucket)>& bindBucket);
+
+    // ͳ
+    uint32_t getSubmittedDraws() const { return static_cast<uint32_t>(m_submissions.size()); }
+    uint32_t getMultiDrawCalls() const { return m_multiDrawCalls; }
+
+private:
+    struct Submission {
+        uint32_t bucket;
+        DrawElementsIndirectCommand command;  // baseInstance ָ m_drawData еĲλ
+    };
+
+    MeshPool& m_pool;
+    uint32_t m_maxDraws;
+
+    std::unique_ptr<GpuBuffer> m_commandBuffer;
+    std::unique_ptr<GpuBuffer> m_drawDataBuffer;
+
+    std::vector<Submission> m_submissions;
+    std::vector<uint32_t> m_order;
+    std::vector<DrawElementsIndirectCommand> m_commands;
+    std::vector<DrawData> m_drawData;
+    uint32_t m_multiDrawCalls = 0;
+};
+
+#endif // INDIRECT_RENDERER_H
@@ -0,0 +1,303 @@
+#include "JobSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+    // ǰ߳ϵͳ
+    thread_local JobSystem* tls_system = nullptr;
+    thread_local int tls_index = -1;
+
+    uint32_t nextRandom(uint32_t& state) {
+        // xorshift32
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+}
+
+// =====  =====
+JobSystem::JobSystem() {
+    start(Settings());
+}
+
+JobSystem::JobSystem(const Settings& settings) {
+    start(settings);
+}
+
+void JobSystem::start(const Settings& settings) {
+    m_settings = settings;
+    uint32_t workerCount = settings.workerCount;
+    if (workerCount == 0) {
+        uint32_t hardware = std::thread::hardware_concurrency();
+        workerCount = hardware > 1 ? hardware - 1 : 1;
+    }
+
+    for (uint32_t i = 0; i <= workerCount; ++i) {
+        m_threads.push_back(std::make_unique<ThreadState>(settings.jobsPerThread));
+        m_threads.back()->randomState = 0x9E3779B9u * (i + 1);
+    }
+
+    //  0 ߳
+    tls_system = this;
+    tls_index = 0;
+
+    for (uint32_t i = 1; i <= workerCount; ++i) {
+        m_workers.emplace_back(&JobSystem::workerLoop, this, i);
+    }
+}
+
+JobSystem::~JobSystem() {
+    m_stopping.store(true);
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_sleepCondition.notify_all();
+    }
+    for (std::thread& worker : m_workers) {
+        worker.join();
+    }
+    if (tls_system == this) {
+        tls_system = nullptr;
+        tls_index = -1;
+    }
+}
+
+int JobSystem::getCurrentThreadIndex() const {
+    return tls_system == this ? tls_index : -1;
+}
+
+// ===== ύ =====
+Job* JobSystem::allocateJob() {
+    int index = getCurrentThreadIndex();
+    if (index >= 0) {
+        // . λԱռ˵û (ڱ̵߳ĵջϵȴ),
+        // ʱԭص, ˻ضѷ
+        ThreadState& state = *m_threads[index];
+        Job* job = &state.jobs[state.nextJob++ & (state.jobs.size() - 1)];
+        if (!job->inUse.load(std::memory_order_acquire)) {
+            job->inUse.store(true, std::memory_order_relaxed);
+            return job;
+        }
+    }
+
+    Job* job = new Job();
+    job->heapAllocated = true;
+    job->inUse.store(true, std::memory_order_relaxed);
+    return job;
+}
+
+void JobSystem::enqueue(Job* job) {
+    int index = getCurrentThreadIndex();
+    if (index >= 0) {
+        if (!m_threads[index]->deque.push(job)) {
+            // , ֱڵǰִ߳
+            execute(job, index);
+            return;
+        }
+    }
+    else {
+        std::lock_guard<std::mutex> lock(m_globalMutex);
+        m_globalQueue.push_back(job);
+        m_globalCount.fetch_add(1, std::memory_order_release);
+    }
+    m_queued.fetch_add(1);
+    wakeWorkers();
+}
+
+void JobSystem::enqueueAfter(Job* job, JobCounter& dependency) {
+    {
+        std::lock_guard<std::mutex> lock(dependency.m_mutex);
+        if (dependency.m_value.load(std::memory_order_acquire) != 0) {
+            dependency.m_waiters.push_back(job);
+            return;
+        }
+    }
+    enqueue(job);
+}
+
+void JobSystem::wakeWorkers() {
+    if (m_sleeping.load() > 0) {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_sleepCondition.notify_one();
+    }
+}
+
+// ===== ִ =====
+Job* JobSystem::findJob(int index) {
+    Job* job = nullptr;
+
+    // 1. ԼĶ (LIFO)
+    if (index >= 0 && m_threads[index]->deque.pop(job)) {
+        m_queued.fetch_sub(1);
+        return job;
+    }
+
+    // 2. ȫֶ
+    if (m_globalCount.load(std::memory_order_acquire) > 0) {
+        std::lock_guard<std::mutex> lock(m_globalMutex);
+        if (!m_globalQueue.empty()) {
+            job = m_globalQueue.back();
+            m_globalQueue.pop_back();
+            m_globalCount.fetch_sub(1, std::memory_order_relaxed);
+            m_queued.fetch_sub(1);
+            return job;
+        }
+    }
+
+    // 3. ܺ߿ʼȡ
+    size_t threadCount = m_threads.size();
+    uint32_t random = index >= 0 ? nextRandom(m_threads[index]->randomState)
+        : static_cast<uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+    for (size_t i = 0; i < threadCount; ++i) {
+        size_t victim = (random + i) % threadCount;
+        if (static_cast<int>(victim) == index) {
+            continue;
+        }
+        if (m_threads[victim]->deque.steal(job)) {
+            m_queued.fetch_sub(1);
+            if (index >= 0) {
+                m_threads[index]->stolen.fetch_add(1, std::memory_order_relaxed);
+            }
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+void JobSystem::execute(Job* job, int index) {
+    try {
+        job->invoke(*job);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "ERROR::JOB_SYSTEM: Unhandled exception in job: " << e.what() << std::endl;
+    }
+    catch (...) {
+        std::cerr << "ERROR::JOB_SYSTEM: Unhandled exception in job" << std::endl;
+    }
+    job->destroy(*job);
+
+    JobCounter* counter = job->counter;
+    if (job->heapAllocated) {
+        delete job;
+    }
+    else {
+        job->inUse.store(false, std::memory_order_release);
+    }
+
+    if (index >= 0) {
+        m_threads[index]->executed.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (counter) {
+        finish(*counter);
+    }
+}
+
+void JobSystem::finish(JobCounter& counter) {
+    // m_finishing ֤ȴ֮ǰΪ ()
+    counter.m_finishing.fetch_add(1);
+    std::vector<Job*> ready;
+    if (counter.m_value.fetch_sub(1) == 1) {
+        // : еȴ
+        std::lock_guard<std::mutex> lock(counter.m_mutex);
+        ready.swap(counter.m_waiters);
+    }
+    counter.m_finishing.fetch_sub(1);
+
+    for (Job* job : ready) {
+        enqueue(job);
+    }
+}
+
+void JobSystem::wait(JobCounter& counter) {
+    int index = getCurrentThreadIndex();
+    while (!counter.isDone()) {
+        if (Job* job = findJob(index)) {
+            execute(job, index);
+        }
+        else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::workerLoop(uint32_t index) {
+    tls_system = this;
+    tls_index = static_cast<int>(index);
+
+    if (m_settings.pinWorkers) {
+        uint32_t cores = std::max(1u, std::thread::hardware_concurrency());
+        uint32_t core = index % cores;
+        if (m_settings.renderThreadCore >= 0 && core == static_cast<uint32_t>(m_settings.renderThreadCore)) {
+            core = (core + 1) % cores;
+        }
+        pinCurrentThread(core);
+    }
+
+    int idleSpins = 0;
+    while (!m_stopping.load(std::memory_order_relaxed)) {
+        if (Job* job = findJob(static_cast<int>(index))) {
+            execute(job, static_cast<int>(index));
+            idleSpins = 0;
+            continue;
+        }
+
+        // һ, Ȼû
+        if (++idleSpins < 64) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        m_sleeping.fetch_add(1);
+        {
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_sleepCondition.wait_for(lock, std::chrono::milliseconds(10), [this] {
+                return m_queued.load() > 0 || m_stopping.load();
+            });
+        }
+        m_sleeping.fetch_sub(1);
+        idleSpins = 0;
+    }
+}
+
+// ===== ̰߳ =====
+bool JobSystem::pinRenderThread() {
+    if (m_settings.renderThreadCore < 0) {
+        return false;
+    }
+    return pinCurrentThread(static_cast<uint32_t>(m_settings.renderThreadCore));
+}
+
+bool JobSystem::pinCurrentThread(uint32_t core) {
+#ifdef _WIN32
+    if (core >= sizeof(DWORD_PTR) * 8) {
+        return false;
+    }
+    return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << core) != 0;
+#else
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#endif
+}
+
+JobSystem::Stats JobSystem::getStats() const {
+    Stats stats;
+    for (const auto& state : m_threads) {
+        stats.executed += state->executed.load(std::memory_order_relaxed);
+        stats.stolen += state->stolen.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
@@ -0,0 +1,214 @@
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+#include "WorkStealingDeque.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+class JobSystem;
+
+// һ. СĿɵöֱӷ洢, ѷ
+struct Job {
+    static constexpr size_t kInlineStorage = 48;
+
+    void (*invoke)(Job& job) = nullptr;
+    void (*destroy)(Job& job) = nullptr;
+    alignas(std::max_align_t) unsigned char storage[kInlineStorage];
+    class JobCounter* counter = nullptr;  // ʱݼ
+    bool heapAllocated = false;           // ڻ, ִк delete
+    std::atomic<bool> inUse{ false };
+
+    template<typename F>
+    void set(F&& function) {
+        using Callable = typename std::decay<F>::type;
+        if constexpr (sizeof(Callable) <= kInlineStorage && alignof(Callable) <= alignof(std::max_align_t)) {
+            new (storage) Callable(std::forward<F>(function));
+            invoke = [](Job& job) { (*reinterpret_cast<Callable*>(job.storage))(); };
+            destroy = [](Job& job) { reinterpret_cast<Callable*>(job.storage)->~Callable(); };
+        }
+        else {
+            Callable* callable = new Callable(std::forward<F>(function));
+            new (storage) Callable*(callable);
+            invoke = [](Job& job) { (**reinterpret_cast<Callable**>(job.storage))(); };
+            destroy = [](Job& job) { delete *reinterpret_cast<Callable**>(job.storage); };
+        }
+    }
+};
+
+// JobCounter: . ύʱ +1, ʱ -1; ʾһȫ.
+// Ҳ: ĳŻ.
+// ø (ͨ wait ֮).
+class JobCounter {
+public:
+    JobCounter() = default;
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    uint32_t getValue() const { return m_value.load(std::memory_order_acquire); }
+
+    // û̻߳ڷʱ, ˺԰ȫ
+    bool isDone() const { return getValue() == 0 && m_finishing.load(std::memory_order_acquire) == 0; }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<uint32_t> m_value{ 0 };
+    std::atomic<uint32_t> m_finishing{ 0 };  // ִ finish ߳
+    std::mutex m_mutex;
+    std::vector<Job*> m_waiters;  // ȴ
+};
+
+// JobSystem: ̶߳ + ÿ߳ Chase-Lev ȡ.
+// ߳ 0 ߳ (ͨ/Ⱦ߳), ύ wait ʱæִ;
+// δע߳ ( IO ߳) ύһȫֶ.
+// ڲԼύ񲢵ȴ, ȴ̲߳, ִ.
+class JobSystem {
+public:
+    struct Settings {
+        uint32_t workerCount = 0;     // ߳, 0 ʾ Ӳ߳ - 1
+        bool pinWorkers = false;      // ѹ̰߳󶨵̶
+        int renderThreadCore = -1;    // >= 0 ʱ pinRenderThread() 󶨵ú, ̱߳ܿ
+        size_t jobsPerThread = 4096;  // ÿ߳ (2 )
+    };
+
+    struct Stats {
+        uint64_t executed = 0;
+        uint64_t stolen = 0;
+    };
+
+    JobSystem();
+    explicit JobSystem(const Settings& settings);
+    ~JobSystem();
+
+    // ֹ
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /**
+     * @brief ύһ.
+     * @param signal ǿʱύǰ +1, ɺ -1.
+     * @param dependency ǿʱſִ.
+     *        Ϊ 0 Ϊ, Աڱύ.
+     */
+    template<typename F>
+    void schedule(F&& function, JobCounter* signal = nullptr, JobCounter* dependency = nullptr) {
+        Job* job = allocateJob();
+        job->set(std::forward<F>(function));
+        job->counter = signal;
+        if (signal) {
+            signal->m_value.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (dependency) {
+            enqueueAfter(job, *dependency);
+        }
+        else {
+            enqueue(job);
+        }
+    }
+
+    // ȴ. ȴڼ䵱ǰִ̻߳
+    void wait(JobCounter& counter);
+
+    /**
+     * @brief д [0, count), ÿ grainSize Ԫ, ߳Ҳ.
+     * function ǩΪ void(size_t begin, size_t end). ׳ĵһ쳣׳.
+     */
+    template<typename F>
+    void parallelFor(size_t count, size_t grainSize, const F& function) {
+        if (count == 0) {
+            return;
+        }
+        if (grainSize == 0) {
+            grainSize = 1;
+        }
+
+        JobCounter counter;
+        std::exception_ptr error;
+        std::mutex errorMutex;
+        for (size_t begin = 0; begin < count; begin += grainSize) {
+            size_t end = begin + grainSize < count ? begin + grainSize : count;
+            schedule([&, begin, end]() {
+                try {
+                    function(begin, end);
+                }
+                catch (...) {
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+            }, &counter);
+        }
+        wait(counter);
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // ѵ̰߳󶨵 Settings::renderThreadCore. δʱ false
+    bool pinRenderThread();
+
+    // ѵ̰߳󶨵ָ
+    static bool pinCurrentThread(uint32_t core);
+
+    // ߳ + 0 ߳
+    uint32_t getThreadCount() const { return static_cast<uint32_t>(m_threads.size()); }
+    uint32_t getWorkerCount() const { return getThreadCount() - 1; }
+
+    // ǰ߳ڱϵͳеı, δע̷߳ -1
+    int getCurrentThreadIndex() const;
+
+    Stats getStats() const;
+
+private:
+    // ÿע̵߳״̬, жα
+    struct alignas(64) ThreadState {
+        explicit ThreadState(size_t capacity) : deque(capacity), jobs(capacity) {}
+
+        WorkStealingDeque<Job*> deque;
+        std::vector<Job> jobs;   // 
+        size_t nextJob = 0;
+        uint32_t randomState = 0;
+        std::atomic<uint64_t> executed{ 0 };
+        std::atomic<uint64_t> stolen{ 0 };
+    };
+
+    void start(const Settings& settings);
+    void workerLoop(uint32_t index);
+
+    Job* allocateJob();
+    void enqueue(Job* job);
+    void enqueueAfter(Job* job, JobCounter& dependency);
+    Job* findJob(int index);
+    void execute(Job* job, int index);
+    void finish(JobCounter& counter);
+    void wakeWorkers();
+
+    Settings m_settings;
+    std::vector<std::unique_ptr<ThreadState>> m_threads;
+    std::vector<std::thread> m_workers;
+
+    // δע߳ύ
+    std::mutex m_globalMutex;
+    std::vector<Job*> m_globalQueue;
+    std::atomic<size_t> m_globalCount{ 0 };
+
+    // й߳
+    std::mutex m_sleepMutex;
+    std::condition_variable m_sleepCondition;
+    std::atomic<int64_t> m_queued{ 0 };
+    std::atomic<int> m_sleeping{ 0 };
+    std::atomic<bool> m_stopping{ false };
+};
+
+#endif // JOB_SYSTEM_H
@@ -0,0 +1,87 @@
+#include "JobSystemBenchmark.h"
+#include "Benchmark.h"
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <vector>
+
+JobSystemBenchmarkResult runJobSystemBenchmark(JobSystem& jobs, bool print) {
+    JobSystemBenchmarkResult result;
+
+    // =====  =====
+    // ÿصһ, ύΪλδͷŶȴ
+    {
+        const size_t totalJobs = 1 << 20;
+        const size_t batch = 1024;
+        std::atomic<uint32_t> executed{ 0 };
+
+        Benchmark::TimePoint start = Benchmark::now();
+        for (size_t submitted = 0; submitted < totalJobs; submitted += batch) {
+            JobCounter counter;
+            for (size_t i = 0; i < batch; ++i) {
+                jobs.schedule([&executed] { executed.fetch_add(1, std::memory_order_relaxed); }, &counter);
+            }
+            jobs.wait(counter);
+        }
+        result.emptyJobsPerSecond = totalJobs / Benchmark::secondsSince(start);
+    }
+
+    // ===== parallelFor  =====
+    {
+        const size_t count = 1 << 24;
+        std::vector<float> values(count, 1.0f);
+
+        Benchmark::TimePoint start = Benchmark::now();
+        for (int repeat = 0; repeat < 4; ++repeat) {
+            jobs.parallelFor(count, 16384, [&values](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    values[i] = values[i] * 0.5f + 1.0f;
+                }
+            });
+        }
+        result.parallelForItemsPerSecond = 4.0 * count / Benchmark::secondsSince(start);
+    }
+
+    // ===== ȡӳ =====
+    // 0 ߳ύһֻæ, ֻܱ߳ȡ
+    if (jobs.getWorkerCount() > 0) {
+        const int samples = 2000;
+        std::vector<double> latencies;
+        latencies.reserve(samples);
+
+        for (int i = 0; i < samples; ++i) {
+            std::atomic<bool> started{ false };
+            Benchmark::TimePoint startTime;
+            JobCounter counter;
+
+            Benchmark::TimePoint submitTime = Benchmark::now();
+            jobs.schedule([&] {
+                startTime = Benchmark::now();
+                started.store(true, std::memory_order_release);
+            }, &counter);
+            while (!started.load(std::memory_order_acquire)) {
+            }
+            jobs.wait(counter);
+
+            latencies.push_back(std::chrono::duration<double, std::micro>(startTime - submitTime).count());
+        }
+
+        std::sort(latencies.begin(), latencies.end());
+        double sum = 0.0;
+        for (double latency : latencies) {
+            sum += latency;
+        }
+        result.stealLatencyMeanUs = sum / latencies.size();
+        result.stealLatencyP50Us = latencies[latencies.size() / 2];
+        result.stealLatencyP99Us = latencies[latencies.size() * 99 / 100];
+    }
+
+    if (print) {
+        std::cout << "===== JobSystem benchmark (" << jobs.getWorkerCount() << " workers) =====" << std::endl;
+        std::cout << "empty jobs:       " << result.emptyJobsPerSecond / 1e6 << " M jobs/s" << std::endl;
+        std::cout << "parallelFor:      " << result.parallelForItemsPerSecond / 1e6 << " M items/s" << std::endl;
+        std::cout << "steal latency:    mean " << result.stealLatencyMeanUs << " us, p50 "
+            << result.stealLatencyP50Us << " us, p99 " << result.stealLatencyP99Us << " us" << std::endl;
+    }
+    return result;
+}
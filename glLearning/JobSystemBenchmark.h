@@ -0,0 +1,18 @@
+#ifndef JOB_SYSTEM_BENCHMARK_H
+#define JOB_SYSTEM_BENCHMARK_H
+
+#include "JobSystem.h"
+
+// ϵͳ΢׼: parallelFor ȡӳ
+struct JobSystemBenchmarkResult {
+    double emptyJobsPerSecond = 0.0;
+    double parallelForItemsPerSecond = 0.0;
+    double stealLatencyMeanUs = 0.0;    // 0 ߳ύ, ߳ȡʼִеʱ
+    double stealLatencyP50Us = 0.0;
+    double stealLatencyP99Us = 0.0;
+};
+
+// л׼ӡ (main  --bench-jobs ). ڴ jobs ߳ϵ
+JobSystemBenchmarkResult runJobSystemBenchmark(JobSystem& jobs, bool print = true);
+
+#endif // JOB_SYSTEM_BENCHMARK_H
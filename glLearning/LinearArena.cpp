@@ -0,0 +1,51 @@
+#include "LinearArena.h"
+#include <algorithm>
+#include <stdexcept>
+
+LinearArena::LinearArena(size_t blockSize)
+    : m_blockSize(blockSize) {
+}
+
+void* LinearArena::allocate(size_t size, size_t alignment) {
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        throw std::runtime_error("ERROR::LINEAR_ARENA: Alignment must be a power of two");
+    }
+
+    // пλ, Ų¾ͻһ (reset Ŀᱻθ)
+    while (m_current < m_blocks.size()) {
+        Block& block = m_blocks[m_current];
+        uintptr_t base = reinterpret_cast<uintptr_t>(block.data.get());
+        uintptr_t aligned = (base + m_offset + alignment - 1) & ~uintptr_t(alignment - 1);
+        size_t end = size_t(aligned - base) + size;
+        if (end <= block.size) {
+            m_used += end - m_offset;
+            m_offset = end;
+            return reinterpret_cast<void*>(aligned);
+        }
+        ++m_current;
+        m_offset = 0;
+    }
+
+    // ¿ܷ±
+    Block block;
+    block.size = std::max(m_blockSize, size + alignment);
+    block.data.reset(new uint8_t[block.size]);
+    m_blocks.push_back(std::move(block));
+    m_current = m_blocks.size() - 1;
+    m_offset = 0;
+    return allocate(size, alignment);
+}
+
+void LinearArena::reset() {
+    m_current = 0;
+    m_offset = 0;
+    m_used = 0;
+}
+
+size_t LinearArena::getCapacity() const {
+    size_t capacity = 0;
+    for (const Block& block : m_blocks) {
+        capacity += block.size;
+    }
+    return capacity;
+}
@@ -0,0 +1,62 @@
+#ifndef LINEAR_ARENA_H
+#define LINEAR_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+// LinearArena:  (bump) . ֻƶָ, ܵͷ,
+// ÿ֡ reset() һ. ڴ reset , ȶкϵͳڴ.
+// ̰߳ȫ, ߳ʱÿ̸߳һ.
+class LinearArena {
+public:
+    explicit LinearArena(size_t blockSize = 64 * 1024);
+
+    // ֹ,ƶ
+    LinearArena(const LinearArena&) = delete;
+    LinearArena& operator=(const LinearArena&) = delete;
+    LinearArena(LinearArena&&) noexcept = default;
+    LinearArena& operator=(LinearArena&&) noexcept = default;
+
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    // һ. ֻƽ, Ϊ reset 
+    template<typename T>
+    T* create(const T& value) {
+        static_assert(std::is_trivially_destructible<T>::value, "LinearArena only holds trivially destructible types");
+        return new (allocate(sizeof(T), alignof(T))) T(value);
+    }
+
+    // һ
+    template<typename T>
+    T* copyArray(const T* values, size_t count) {
+        static_assert(std::is_trivially_copyable<T>::value, "LinearArena::copyArray needs trivially copyable types");
+        T* result = static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+        for (size_t i = 0; i < count; ++i) {
+            result[i] = values[i];
+        }
+        return result;
+    }
+
+    // ȫ, ڴ
+    void reset();
+
+    size_t getUsedBytes() const { return m_used; }
+    size_t getCapacity() const;
+
+private:
+    struct Block {
+        std::unique_ptr<uint8_t[]> data;
+        size_t size;
+    };
+
+    std::vector<Block> m_blocks;
+    size_t m_blockSize;
+    size_t m_current = 0;  // ǰʹõĿ
+    size_t m_offset = 0;   // ǰڵƫ
+    size_t m_used = 0;
+};
+
+#endif // LINEAR_ARENA_H
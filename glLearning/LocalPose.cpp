@@ -0,0 +1,154 @@
+#include "LocalPose.h"
+#include "Simd.h"
+#include <algorithm>
+#include <stdexcept>
+
+static_assert(LocalPose::kPadding % Simd::kWidth == 0, "Pose padding must be a multiple of the SIMD width");
+
+LocalPose::LocalPose(uint32_t jointCount) {
+    resize(jointCount);
+}
+
+void LocalPose::resize(uint32_t jointCount) {
+    m_jointCount = jointCount;
+    m_capacity = (jointCount + kPadding - 1) / kPadding * kPadding;
+    m_data.assign(size_t(ChannelCount) * m_capacity, 0.0f);
+    std::fill_n(getChannel(RotationW), m_capacity, 1.0f);
+    std::fill_n(getChannel(ScaleX), m_capacity, 1.0f);
+    std::fill_n(getChannel(ScaleY), m_capacity, 1.0f);
+    std::fill_n(getChannel(ScaleZ), m_capacity, 1.0f);
+}
+
+void LocalPose::setJoint(uint32_t joint, const glm::vec3& translation, const glm::quat& rotation, const glm::vec3& scale) {
+    getChannel(TranslationX)[joint] = translation.x;
+    getChannel(TranslationY)[joint] = translation.y;
+    getChannel(TranslationZ)[joint] = translation.z;
+    getChannel(RotationX)[joint] = rotation.x;
+    getChannel(RotationY)[joint] = rotation.y;
+    getChannel(RotationZ)[joint] = rotation.z;
+    getChannel(RotationW)[joint] = rotation.w;
+    getChannel(ScaleX)[joint] = scale.x;
+    getChannel(ScaleY)[joint] = scale.y;
+    getChannel(ScaleZ)[joint] = scale.z;
+}
+
+glm::vec3 LocalPose::getTranslation(uint32_t joint) const {
+    return glm::vec3(getChannel(TranslationX)[joint], getChannel(TranslationY)[joint], getChannel(TranslationZ)[joint]);
+}
+
+glm::quat LocalPose::getRotation(uint32_t joint) const {
+    return glm::quat(getChannel(RotationW)[joint], getChannel(RotationX)[joint],
+        getChannel(RotationY)[joint], getChannel(RotationZ)[joint]);
+}
+
+glm::vec3 LocalPose::getScale(uint32_t joint) const {
+    return glm::vec3(getChannel(ScaleX)[joint], getChannel(ScaleY)[joint], getChannel(ScaleZ)[joint]);
+}
+
+// =====  =====
+void LocalPose::blend(const LocalPose& a, const LocalPose& b, float weight, LocalPose& out) {
+    if (a.m_jointCount != b.m_jointCount || a.m_jointCount != out.m_jointCount) {
+        throw std::runtime_error("ERROR::LOCAL_POSE: Blending poses with different joint counts");
+    }
+    const Simd::Float w = Simd::set1(weight);
+
+    // ƽ: a + (b - a) * w
+    static const Channel kLinear[] = { TranslationX, TranslationY, TranslationZ, ScaleX, ScaleY, ScaleZ };
+    for (Channel channel : kLinear) {
+        const float* pa = a.getChannel(channel);
+        const float* pb = b.getChannel(channel);
+        float* po = out.getChannel(channel);
+        for (uint32_t i = 0; i < a.m_capacity; i += Simd::kWidth) {
+            Simd::Float va = Simd::load(pa + i);
+            Simd::store(po + i, Simd::madd(Simd::sub(Simd::load(pb + i), va), w, va));
+        }
+    }
+
+    // ת: dot < 0 ʱ b ȡ·, ֵһ
+    const float* ax = a.getChannel(RotationX); const float* bx = b.getChannel(RotationX); float* ox = out.getChannel(RotationX);
+    const float* ay = a.getChannel(RotationY); const float* by = b.getChannel(RotationY); float* oy = out.getChannel(RotationY);
+    const float* az = a.getChannel(RotationZ); const float* bz = b.getChannel(RotationZ); float* oz = out.getChannel(RotationZ);
+    const float* aw = a.getChannel(RotationW); const float* bw = b.getChannel(RotationW); float* ow = out.getChannel(RotationW);
+    for (uint32_t i = 0; i < a.m_capacity; i += Simd::kWidth) {
+        Simd::Float qax = Simd::load(ax + i), qay = Simd::load(ay + i), qaz = Simd::load(az + i), qaw = Simd::load(aw + i);
+        Simd::Float qbx = Simd::load(bx + i), qby = Simd::load(by + i), qbz = Simd::load(bz + i), qbw = Simd::load(bw + i);
+
+        Simd::Float dot = Simd::madd(qax, qbx, Simd::madd(qay, qby, Simd::madd(qaz, qbz, Simd::mul(qaw, qbw))));
+        qbx = Simd::flipSign(qbx, dot);
+        qby = Simd::flipSign(qby, dot);
+        qbz = Simd::flipSign(qbz, dot);
+        qbw = Simd::flipSign(qbw, dot);
+
+        Simd::Float x = Simd::madd(Simd::sub(qbx, qax), w, qax);
+        Simd::Float y = Simd::madd(Simd::sub(qby, qay), w, qay);
+        Simd::Float z = Simd::madd(Simd::sub(qbz, qaz), w, qaz);
+        Simd::Float s = Simd::madd(Simd::sub(qbw, qaw), w, qaw);
+        Simd::Float length = Simd::sqrt(Simd::madd(x, x, Simd::madd(y, y, Simd::madd(z, z, Simd::mul(s, s)))));
+        Simd::store(ox + i, Simd::div(x, length));
+        Simd::store(oy + i, Simd::div(y, length));
+        Simd::store(oz + i, Simd::div(z, length));
+        Simd::store(ow + i, Simd::div(s, length));
+    }
+}
+
+// ===== ֲ =====
+void LocalPose::computeLocalMatrices(glm::mat4* matrices) const {
+    const float* channels[ChannelCount];
+    for (uint32_t c = 0; c < ChannelCount; ++c) {
+        channels[c] = getChannel(static_cast<Channel>(c));
+    }
+    composeMatrices(channels, 0, m_jointCount, matrices);
+}
+
+void LocalPose::composeMatrices(const float* const* channels, uint32_t begin, uint32_t count, glm::mat4* matrices) {
+    const Simd::Float one = Simd::set1(1.0f);
+    const Simd::Float two = Simd::set1(2.0f);
+    const float* tx = channels[TranslationX] + begin;
+    const float* ty = channels[TranslationY] + begin;
+    const float* tz = channels[TranslationZ] + begin;
+
+    // ÿ 3x3 תŲֵ 9 , д mat4
+    float columns[9][Simd::kWidth];
+    for (uint32_t i = 0; i < count; i += Simd::kWidth) {
+        Simd::Float x = Simd::load(channels[RotationX] + begin + i);
+        Simd::Float y = Simd::load(channels[RotationY] + begin + i);
+        Simd::Float z = Simd::load(channels[RotationZ] + begin + i);
+        Simd::Float w = Simd::load(channels[RotationW] + begin + i);
+        Simd::Float sx = Simd::load(channels[ScaleX] + begin + i);
+        Simd::Float sy = Simd::load(channels[ScaleY] + begin + i);
+        Simd::Float sz = Simd::load(channels[ScaleZ] + begin + i);
+
+        Simd::Float xx = Simd::mul(x, x), yy = Simd::mul(y, y), zz = Simd::mul(z, z);
+        Simd::Float xy = Simd::mul(x, y), xz = Simd::mul(x, z), yz = Simd::mul(y, z);
+        Simd::Float wx = Simd::mul(w, x), wy = Simd::mul(w, y), wz = Simd::mul(w, z);
+
+        Simd::store(columns[0], Simd::mul(Simd::sub(one, Simd::mul(two, Simd::add(yy, zz))), sx));
+        Simd::store(columns[1], Simd::mul(Simd::mul(two, Simd::add(xy, wz)), sx));
+        Simd::store(columns[2], Simd::mul(Simd::mul(two, Simd::sub(xz, wy)), sx));
+        Simd::store(columns[3], Simd::mul(Simd::mul(two, Simd::sub(xy, wz)), sy));
+        Simd::store(columns[4], Simd::mul(Simd::sub(one, Simd::mul(two, Simd::add(xx, zz))), sy));
+        Simd::store(columns[5], Simd::mul(Simd::mul(two, Simd::add(yz, wx)), sy));
+        Simd::store(columns[6], Simd::mul(Simd::mul(two, Simd::add(xz, wy)), sz));
+        Simd::store(columns[7], Simd::mul(Simd::mul(two, Simd::sub(yz, wx)), sz));
+        Simd::store(columns[8], Simd::mul(Simd::sub(one, Simd::mul(two, Simd::add(xx, yy))), sz));
+
+        uint32_t batch = std::min<uint32_t>(Simd::kWidth, count - i);
+        for (uint32_t lane = 0; lane < batch; ++lane) {
+            uint32_t index = i + lane;
+            glm::mat4& m = matrices[index];
+            m[0] = glm::vec4(columns[0][lane], columns[1][lane], columns[2][lane], 0.0f);
+            m[1] = glm::vec4(columns[3][lane], columns[4][lane], columns[5][lane], 0.0f);
+            m[2] = glm::vec4(columns[6][lane], columns[7][lane], columns[8][lane], 0.0f);
+            m[3] = glm::vec4(tx[index], ty[index], tz[index], 1.0f);
+        }
+    }
+}
+
+// ===== ʹdemo =====
+// LocalPose walk(skeleton.getJointCount()), run(skeleton.getJointCount());
+// walkClip.sample(t, walk);
+// runClip.sample(t, run);
+// LocalPose::blend(walk, run, 0.3f, walk);  // д walk
+//
+// std::vector<glm::mat4> local(skeleton.getJointCount());
+// walk.computeLocalMatrices(local.data());
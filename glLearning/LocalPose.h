@@ -0,0 +1,61 @@
+#ifndef LOCAL_POSE_H
+#define LOCAL_POSE_H
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <cstdint>
+#include <vector>
+
+// LocalPose: ǼÿؽԸؽڵı任 (ƽ / תԪ / ), SoA .
+// ÿһ, Ȳ뵽 kPadding ı (ĹؽΪλ任),
+// Ϻת󶼰 Simd::kWidth ؽһ.
+class LocalPose {
+public:
+    static constexpr uint32_t kPadding = 8;  // Сκ Simd::kWidth
+
+    enum Channel : uint32_t {
+        TranslationX, TranslationY, TranslationZ,
+        RotationX, RotationY, RotationZ, RotationW,
+        ScaleX, ScaleY, ScaleZ,
+        ChannelCount,
+    };
+
+    LocalPose() = default;
+    explicit LocalPose(uint32_t jointCount);
+
+    // ıؽ, йؽΪλ任
+    void resize(uint32_t jointCount);
+
+    uint32_t getJointCount() const { return m_jointCount; }
+    uint32_t getCapacity() const { return m_capacity; }
+
+    float* getChannel(Channel channel) { return m_data.data() + size_t(channel) * m_capacity; }
+    const float* getChannel(Channel channel) const { return m_data.data() + size_t(channel) * m_capacity; }
+
+    void setJoint(uint32_t joint, const glm::vec3& translation, const glm::quat& rotation, const glm::vec3& scale);
+    glm::vec3 getTranslation(uint32_t joint) const;
+    glm::quat getRotation(uint32_t joint) const;
+    glm::vec3 getScale(uint32_t joint) const;
+
+    /**
+     * @brief out = a  b  weight  (ƽԲֵ, תȡ· nlerp). out  a  b.
+     * ߵĹؽͬ.
+     */
+    static void blend(const LocalPose& a, const LocalPose& b, float weight, LocalPose& out);
+
+    // ÿؽڵľֲ T * R * S, matrices  getJointCount() 
+    void computeLocalMatrices(glm::mat4* matrices) const;
+
+    /**
+     * @brief  SoA 洢 ( Channel е ChannelCount )  T * R * S,
+     *  begin + i Ԫд matrices[i], i < count.  begin ٿɶ count ȡ kPadding Ԫ.
+     */
+    static void composeMatrices(const float* const* channels, uint32_t begin, uint32_t count, glm::mat4* matrices);
+
+private:
+    uint32_t m_jointCount = 0;
+    uint32_t m_capacity = 0;
+    std::vector<float> m_data;  // ChannelCount * m_capacity
+};
+
+#endif // LOCAL_POSE_H
@@ -0,0 +1,179 @@
+#include "Lz4.h"
+#include <cstring>
+#include <vector>
+
+namespace {
+    const size_t kMinMatch = 4;
+    const size_t kLastLiterals = 5;  //  5 ֽڱ
+    const size_t kMatchLimit = 12;   // һƥڽβ 12 ֽ֮ǰʼ
+    const size_t kMaxOffset = 65535;
+    const int kHashBits = 16;
+
+    uint32_t read32(const uint8_t* p) {
+        uint32_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    uint32_t hashSequence(uint32_t sequence) {
+        return (sequence * 2654435761u) >> (32 - kHashBits);
+    }
+
+    // ֶ: 4 λ token , ﵽ 15 ʱɸ 255 һ
+    bool writeLength(uint8_t*& op, const uint8_t* end, size_t length) {
+        for (; length >= 255; length -= 255) {
+            if (op >= end) {
+                return false;
+            }
+            *op++ = 255;
+        }
+        if (op >= end) {
+            return false;
+        }
+        *op++ = static_cast<uint8_t>(length);
+        return true;
+    }
+
+    bool readLength(const uint8_t*& ip, const uint8_t* end, size_t& length) {
+        uint8_t byte;
+        do {
+            if (ip >= end) {
+                return false;
+            }
+            byte = *ip++;
+            length += byte;
+        } while (byte == 255);
+        return true;
+    }
+
+    // дһ: literals ֮һƥ (matchLength Ϊ 0 ʾһ, ֻ)
+    bool writeSequence(uint8_t*& op, const uint8_t* end, const uint8_t* literals, size_t literalLength,
+        size_t offset, size_t matchLength) {
+        if (op >= end) {
+            return false;
+        }
+        uint8_t* token = op++;
+        *token = static_cast<uint8_t>((literalLength < 15 ? literalLength : 15) << 4);
+        if (literalLength >= 15 && !writeLength(op, end, literalLength - 15)) {
+            return false;
+        }
+        if (static_cast<size_t>(end - op) < literalLength) {
+            return false;
+        }
+        if (literalLength > 0) {
+            std::memcpy(op, literals, literalLength);
+            op += literalLength;
+        }
+
+        if (matchLength == 0) {
+            return true;
+        }
+        if (end - op < 2) {
+            return false;
+        }
+        *op++ = static_cast<uint8_t>(offset & 0xFF);
+        *op++ = static_cast<uint8_t>(offset >> 8);
+        size_t code = matchLength - kMinMatch;
+        *token |= static_cast<uint8_t>(code < 15 ? code : 15);
+        return code < 15 || writeLength(op, end, code - 15);
+    }
+}
+
+size_t Lz4::compress(const uint8_t* src, size_t size, uint8_t* dst, size_t capacity) {
+    uint8_t* op = dst;
+    const uint8_t* end = dst + capacity;
+    size_t anchor = 0;
+
+    if (size > kMatchLimit) {
+        std::vector<int32_t> table(size_t(1) << kHashBits, -1);
+        const size_t matchStartLimit = size - kMatchLimit;
+        const size_t matchEndLimit = size - kLastLiterals;
+
+        size_t ip = 0;
+        while (ip < matchStartLimit) {
+            uint32_t sequence = read32(src + ip);
+            uint32_t hash = hashSequence(sequence);
+            int32_t candidate = table[hash];
+            table[hash] = static_cast<int32_t>(ip);
+
+            if (candidate < 0 || ip - candidate > kMaxOffset || read32(src + candidate) != sequence) {
+                ++ip;
+                continue;
+            }
+
+            size_t length = kMinMatch;
+            while (ip + length < matchEndLimit && src[candidate + length] == src[ip + length]) {
+                ++length;
+            }
+            if (!writeSequence(op, end, src + anchor, ip - anchor, ip - candidate, length)) {
+                return 0;
+            }
+            ip += length;
+            anchor = ip;
+        }
+    }
+
+    if (!writeSequence(op, end, src + anchor, size - anchor, 0, 0)) {
+        return 0;
+    }
+    return static_cast<size_t>(op - dst);
+}
+
+bool Lz4::decompress(const uint8_t* src, size_t size, uint8_t* dst, size_t dstSize) {
+    const uint8_t* ip = src;
+    const uint8_t* inputEnd = src + size;
+    size_t op = 0;
+
+    while (ip < inputEnd) {
+        uint8_t token = *ip++;
+
+        size_t literalLength = token >> 4;
+        if (literalLength == 15 && !readLength(ip, inputEnd, literalLength)) {
+            return false;
+        }
+        if (static_cast<size_t>(inputEnd - ip) < literalLength || dstSize - op < literalLength) {
+            return false;
+        }
+        if (literalLength > 0) {
+            std::memcpy(dst + op, ip, literalLength);
+            ip += literalLength;
+            op += literalLength;
+        }
+
+        if (ip == inputEnd) {
+            break;  // һûƥ
+        }
+        if (inputEnd - ip < 2) {
+            return false;
+        }
+        size_t offset = ip[0] | (size_t(ip[1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > op) {
+            return false;
+        }
+
+        size_t matchLength = token & 15;
+        if (matchLength == 15 && !readLength(ip, inputEnd, matchLength)) {
+            return false;
+        }
+        matchLength += kMinMatch;
+        if (dstSize - op < matchLength) {
+            return false;
+        }
+        // ƥص (offset < matchLength ʱظģʽ), ֽڸ
+        const uint8_t* match = dst + op - offset;
+        for (size_t i = 0; i < matchLength; ++i) {
+            dst[op + i] = match[i];
+        }
+        op += matchLength;
+    }
+    return op == dstSize;
+}
+
+// ===== ʹdemo =====
+// std::vector<uint8_t> packed(Lz4::compressBound(raw.size()));
+// packed.resize(Lz4::compress(raw.data(), raw.size(), packed.data(), packed.size()));
+//
+// std::vector<uint8_t> restored(raw.size());  // ѹҪ֪ԭʼС, ɵ÷Ᵽ
+// if (!Lz4::decompress(packed.data(), packed.size(), restored.data(), restored.size()))
+//     std::cerr << "ERROR::LZ4: Corrupt data" << std::endl;
@@ -0,0 +1,31 @@
+#ifndef LZ4_H
+#define LZ4_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Lz4: LZ4 ʽ (block format) ѹѹ, ⲿ.
+// ѹǵ̰ƥ (൱ LZ4  fast ģʽ), Աκα׼ LZ4 ȡ;
+// ѹԽ, 𻵵ݷ false Խд.
+class Lz4 {
+public:
+    // µѹС
+    static size_t compressBound(size_t size) { return size + size / 255 + 16; }
+
+    /**
+     * @brief ѹһ ( 2GB).
+     * @return ѹֽ, dst ʱ 0. С compressBound(size) ʱһɹ
+     */
+    static size_t compress(const uint8_t* src, size_t size, uint8_t* dst, size_t capacity);
+
+    /**
+     * @brief ѹһ, ѹĴС dstSize.
+     * @return 𻵻Сʱ false
+     */
+    static bool decompress(const uint8_t* src, size_t size, uint8_t* dst, size_t dstSize);
+
+private:
+    Lz4() = delete;
+};
+
+#endif // LZ4_H
@@ -0,0 +1,48 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// MappedFile: ֻڴӳļ (RAII)
+// Windows  CreateFileMapping / MapViewOfFile, ƽ̨ mmap.
+// ɲϵͳҳ, δͬһļҳ; ӳʱ.
+class MappedFile {
+public:
+    MappedFile() = default;
+
+    /**
+     * @brief ֻʽӳļ.
+     * @throws std::runtime_error 򿪻ӳʧʱ׳. ļԴ, data() Ϊ
+     */
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    // ֹ, ƶ
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    const uint8_t* data() const { return m_data; }
+    size_t size() const { return m_size; }
+    bool isOpen() const { return m_data != nullptr; }
+    const std::string& getPath() const { return m_path; }
+
+    // ӳ
+    void close();
+
+private:
+    std::string m_path;
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+#ifdef _WIN32
+    void* m_file = nullptr;     // HANDLE
+    void* m_mapping = nullptr;  // HANDLE
+#else
+    int m_fd = -1;
+#endif
+};
+
+#endif // MAPPED_FILE_H
@@ -0,0 +1,280 @@
+#include "Material.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <glm/gtc/type_ptr.hpp>
+
+namespace {
+    // FNV-1a
+    uint64_t hashBytes(uint64_t hash, const void* data, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        }
+        return hash;
+    }
+
+    // std140 һԪ () ռõ 32 λ
+    uint32_t getColumnWords(GLenum type) {
+        switch (type) {
+        case GL_FLOAT_VEC2: return 2;
+        case GL_FLOAT_VEC3: return 3;
+        case GL_FLOAT_VEC4:
+        case GL_FLOAT_MAT4: return 4;
+        default: return 1;
+        }
+    }
+}
+
+// ===== MaterialDesc =====
+MaterialDesc::MaterialDesc(ShaderPtr shader)
+    : m_shader(std::move(shader)) {
+}
+
+MaterialDesc& MaterialDesc::setTexture(const std::string& sampler, const Texture* texture) {
+    auto it = std::lower_bound(m_textures.begin(), m_textures.end(), sampler,
+        [](const TextureSlot& slot, const std::string& name) { return slot.sampler < name; });
+    if (it != m_textures.end() && it->sampler == sampler) {
+        it->texture = texture;
+    }
+    else {
+        m_textures.insert(it, { sampler, texture });
+    }
+    return *this;
+}
+
+MaterialDesc& MaterialDesc::setFloat(const std::string& name, float value) {
+    return setParameter(name, GL_FLOAT, &value, 1);
+}
+
+MaterialDesc& MaterialDesc::setInt(const std::string& name, int value) {
+    return setParameter(name, GL_INT, &value, 1);
+}
+
+MaterialDesc& MaterialDesc::setVec2(const std::string& name, const glm::vec2& value) {
+    return setParameter(name, GL_FLOAT_VEC2, glm::value_ptr(value), 2);
+}
+
+MaterialDesc& MaterialDesc::setVec3(const std::string& name, const glm::vec3& value) {
+    return setParameter(name, GL_FLOAT_VEC3, glm::value_ptr(value), 3);
+}
+
+MaterialDesc& MaterialDesc::setVec4(const std::string& name, const glm::vec4& value) {
+    return setParameter(name, GL_FLOAT_VEC4, glm::value_ptr(value), 4);
+}
+
+MaterialDesc& MaterialDesc::setMat4(const std::string& name, const glm::mat4& value) {
+    return setParameter(name, GL_FLOAT_MAT4, glm::value_ptr(value), 16);
+}
+
+MaterialDesc& MaterialDesc::setParameter(const std::string& name, GLenum type, const void* value, uint32_t words) {
+    Parameter parameter;
+    parameter.name = name;
+    parameter.type = type;
+    parameter.words = words;
+    std::memset(parameter.value, 0, sizeof(parameter.value));
+    std::memcpy(parameter.value, value, words * sizeof(uint32_t));
+
+    auto it = std::lower_bound(m_parameters.begin(), m_parameters.end(), name,
+        [](const Parameter& p, const std::string& n) { return p.name < n; });
+    if (it != m_parameters.end() && it->name == name) {
+        *it = parameter;
+    }
+    else {
+        m_parameters.insert(it, parameter);
+    }
+    return *this;
+}
+
+uint64_t MaterialDesc::getHash() const {
+    uint64_t hash = 1469598103934665603ull;
+    const Shader* shader = m_shader.get();
+    hash = hashBytes(hash, &shader, sizeof(shader));
+    for (const TextureSlot& slot : m_textures) {
+        hash = hashBytes(hash, slot.sampler.data(), slot.sampler.size());
+        hash = hashBytes(hash, &slot.texture, sizeof(slot.texture));
+    }
+    for (const Parameter& parameter : m_parameters) {
+        hash = hashBytes(hash, parameter.name.data(), parameter.name.size());
+        hash = hashBytes(hash, &parameter.type, sizeof(parameter.type));
+        hash = hashBytes(hash, parameter.value, parameter.words * sizeof(uint32_t));
+    }
+    return hash;
+}
+
+bool MaterialDesc::operator==(const MaterialDesc& other) const {
+    if (m_shader != other.m_shader || m_textures.size() != other.m_textures.size()
+        || m_parameters.size() != other.m_parameters.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < m_textures.size(); ++i) {
+        if (m_textures[i].sampler != other.m_textures[i].sampler || m_textures[i].texture != other.m_textures[i].texture) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < m_parameters.size(); ++i) {
+        const Parameter& a = m_parameters[i];
+        const Parameter& b = other.m_parameters[i];
+        if (a.name != b.name || a.type != b.type || a.words != b.words
+            || std::memcmp(a.value, b.value, a.words * sizeof(uint32_t)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ===== Material =====
+Material::Material(const MaterialDesc& desc, uint32_t id)
+    : m_desc(desc), m_id(id) {
+    resolve();
+}
+
+void Material::bind() const {
+    if (m_linkVersion != getShader()->getLinkVersion()) {
+        resolve();
+    }
+    else if (m_parametersDirty) {
+        uploadParameters();
+    }
+    for (const TextureBinding& binding : m_textureBindings) {
+        binding.texture->bind(binding.unit);
+    }
+    if (m_parameterBuffer) {
+        m_parameterBuffer->bindBase(GL_UNIFORM_BUFFER, Shader::kMaterialBlockBinding);
+    }
+}
+
+void Material::resolve() const {
+    const Shader& shader = *getShader();
+    m_linkVersion = shader.getLinkVersion();
+
+    //  -> Ԫ
+    m_textureBindings.clear();
+    for (const MaterialDesc::TextureSlot& slot : m_desc.m_textures) {
+        GLint unit = shader.getSamplerUnit(slot.sampler);
+        if (unit < 0) {
+            std::cerr << "WARNING::MATERIAL: Sampler '" << slot.sampler << "' not found in shader!" << std::endl;
+            continue;
+        }
+        if (slot.texture) {
+            m_textureBindings.push_back({ static_cast<GLuint>(unit), slot.texture });
+        }
+    }
+
+    uploadParameters();
+}
+
+void Material::setFloat(const std::string& name, float value) {
+    m_desc.setFloat(name, value);
+    m_parametersDirty = true;
+}
+
+// õƫƴ MaterialParams 
+void Material::uploadParameters() const {
+    const Shader& shader = *getShader();
+    m_parametersDirty = false;
+
+    const Shader::UniformBlock* block = shader.findUniformBlock(Shader::kMaterialBlockName);
+    if (!block) {
+        if (!m_desc.m_parameters.empty()) {
+            std::cerr << "WARNING::MATERIAL: Shader has no uniform block '" << Shader::kMaterialBlockName
+                << "', parameters ignored" << std::endl;
+        }
+        m_parameterBuffer.reset();
+        return;
+    }
+
+    std::vector<unsigned char> data(static_cast<size_t>(block->size), 0);
+    for (const MaterialDesc::Parameter& parameter : m_desc.m_parameters) {
+        auto member = std::find_if(block->members.begin(), block->members.end(),
+            [&](const Shader::BlockMember& m) { return m.name == parameter.name; });
+        if (member == block->members.end()) {
+            std::cerr << "WARNING::MATERIAL: Parameter '" << parameter.name << "' not found in "
+                << Shader::kMaterialBlockName << std::endl;
+            continue;
+        }
+        if (member->type != parameter.type) {
+            std::cerr << "ERROR::MATERIAL: Parameter '" << parameter.name << "' type mismatch" << std::endl;
+            continue;
+        }
+
+        // д, ֮ matrixStride
+        uint32_t columnWords = getColumnWords(parameter.type);
+        uint32_t columns = parameter.words / columnWords;
+        for (uint32_t column = 0; column < columns; ++column) {
+            size_t offset = static_cast<size_t>(member->offset) + column * static_cast<size_t>(member->matrixStride);
+            size_t bytes = columnWords * sizeof(uint32_t);
+            if (offset + bytes > data.size()) {
+                break;
+            }
+            std::memcpy(data.data() + offset, parameter.value + column * columnWords, bytes);
+        }
+    }
+
+    if (m_parameterBuffer && m_parameterBuffer->getSize() == data.size()) {
+        m_parameterBuffer->updateData(0, data.data(), data.size());
+    }
+    else {
+        m_parameterBuffer = std::make_unique<GpuBuffer>(GL_UNIFORM_BUFFER, data.data(), data.size(), GL_STATIC_DRAW);
+    }
+}
+
+// ===== MaterialLibrary =====
+MaterialLibrary& MaterialLibrary::getInstance() {
+    static MaterialLibrary instance;
+    return instance;
+}
+
+const Material* MaterialLibrary::intern(const MaterialDesc& desc) {
+    if (!desc.getShader()) {
+        throw std::runtime_error("ERROR::MATERIAL: Material has no shader");
+    }
+
+    std::vector<std::unique_ptr<Material>>& bucket = m_materials[desc.getHash()];
+    for (const auto& material : bucket) {
+        if (material->getDesc() == desc) {
+            return material.get();
+        }
+    }
+
+    bucket.push_back(std::unique_ptr<Material>(new Material(desc, m_nextID++)));
+    ++m_count;
+    return bucket.back().get();
+}
+
+Material* MaterialLibrary::createDynamic(const MaterialDesc& desc) {
+    if (!desc.getShader()) {
+        throw std::runtime_error("ERROR::MATERIAL: Material has no shader");
+    }
+
+    m_dynamicMaterials.push_back(std::unique_ptr<Material>(new Material(desc, m_nextID++)));
+    return m_dynamicMaterials.back().get();
+}
+
+void MaterialLibrary::cleanup() {
+    m_materials.clear();
+    m_dynamicMaterials.clear();
+    m_count = 0;
+}
+
+// ===== ʹdemo =====
+// // ɫ: uniform sampler2D albedoMap;  uniform MaterialParams { vec4 tint; float roughness; };
+// ShaderPtr shader = ShaderManager::getInstance().loadVariant("pbr", "pbr.vs", "pbr.fs", { "USE_NORMAL_MAP" });
+//
+// const Material* brick = MaterialLibrary::getInstance().intern(
+//     MaterialDesc(shader)
+//         .setTexture("albedoMap", &brickAlbedo)   // ԪʱѾ
+//         .setVec4("tint", glm::vec4(1.0f))
+//         .setFloat("roughness", 0.8f));
+// // ͬ intern һ, õͬһָ
+//
+// RenderQueue::DrawItem item;
+// item.material = brick;  // ɫ鶼Բ
+// item.vertexArray = vao;
+// item.indexCount = indexCount;
+// renderQueue.submit(item);  // ͬʵĻֻһ
+//
+// // ÿ֡仯Ĳ: ռ,  GL ߳޸, һ bind ʱϴ
+// Material* fading = MaterialLibrary::getInstance().createDynamic(MaterialDesc(shader).setFloat("fade", 1.0f));
+// fading->setFloat("fade", fadeValue);
@@ -0,0 +1,141 @@
+#ifndef MATERIAL_H
+#define MATERIAL_H
+
+#include "GpuBuffer.h"
+#include "Shader.h"
+#include "Texture.h"
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//  (ֵ): ɫ + ָ + еĲ.
+// ֻ,  GL;  MaterialLibrary::intern õ Material.
+class MaterialDesc {
+public:
+    explicit MaterialDesc(ShaderPtr shader);
+
+    // 󶨵ɫΪ sampler Ĳ, Ԫɫ
+    MaterialDesc& setTexture(const std::string& sampler, const Texture* texture);
+
+    // д uniform  MaterialParams еͬԱ (std140 ƫɷ)
+    MaterialDesc& setFloat(const std::string& name, float value);
+    MaterialDesc& setInt(const std::string& name, int value);
+    MaterialDesc& setVec2(const std::string& name, const glm::vec2& value);
+    MaterialDesc& setVec3(const std::string& name, const glm::vec3& value);
+    MaterialDesc& setVec4(const std::string& name, const glm::vec4& value);
+    MaterialDesc& setMat4(const std::string& name, const glm::mat4& value);
+
+    const ShaderPtr& getShader() const { return m_shader; }
+
+    // ݹϣȽ, ַȽ
+    uint64_t getHash() const;
+    bool operator==(const MaterialDesc& other) const;
+
+private:
+    friend class Material;
+
+    struct TextureSlot {
+        std::string sampler;
+        const Texture* texture;
+    };
+
+    struct Parameter {
+        std::string name;
+        GLenum type;          // GL_FLOAT / GL_INT / GL_FLOAT_VEC2 ... GL_FLOAT_MAT4
+        uint32_t words;       // Ч 32 λ
+        uint32_t value[16];   // λ (int  float )
+    };
+
+    MaterialDesc& setParameter(const std::string& name, GLenum type, const void* value, uint32_t words);
+
+    ShaderPtr m_shader;
+    std::vector<TextureSlot> m_textures;    // , ֤ͬݹϣͬ
+    std::vector<Parameter> m_parameters;    // 
+};
+
+// פĲ: ޸, ƹͬһָ. ȾаָжϲǷͬ,
+// ͬʵֻһ.
+// Ԫƫڴʱɫ, ɫغһ bind ʱ½.
+// ÿ֡仯Ĳ (綯Ļϱ)  MaterialLibrary::createDynamic Ķռ, ͨ setFloat ޸.
+class Material {
+public:
+    // ֹ
+    Material(const Material&) = delete;
+    Material& operator=(const Material&) = delete;
+
+    Shader* getShader() const { return m_desc.getShader().get(); }
+    const MaterialDesc& getDesc() const { return m_desc; }
+
+    // פ ( 1 ʼ), . ̶߳ȡ
+    uint32_t getID() const { return m_id; }
+
+    //  () , л. ֻ GL ̵߳
+    void bind() const;
+
+    // ޸Ĳ, һ bind ʱ´. ֻ createDynamic ؿ޸ĵĲ, ֻ GL ̵߳
+    void setFloat(const std::string& name, float value);
+
+private:
+    friend class MaterialLibrary;
+    Material(const MaterialDesc& desc, uint32_t id);
+
+    struct TextureBinding {
+        GLuint unit;
+        const Texture* texture;
+    };
+
+    void resolve() const;
+    void uploadParameters() const;
+
+    MaterialDesc m_desc;
+    uint32_t m_id;
+    mutable bool m_parametersDirty = false;
+
+    // Ľ, ɫӺ bind ˢ
+    mutable std::vector<TextureBinding> m_textureBindings;
+    mutable std::unique_ptr<GpuBuffer> m_parameterBuffer;
+    mutable uint32_t m_linkVersion = 0;
+};
+
+// MaterialLibrary: פ (,  GL ߳ϴ)
+// ͬͬһ Material, ָ cleanup() ֮ǰһֱЧ.
+class MaterialLibrary {
+public:
+    static MaterialLibrary& getInstance();
+
+    // ֹ͸ֵ
+    MaterialLibrary(const MaterialLibrary&) = delete;
+    void operator=(const MaterialLibrary&) = delete;
+
+    /**
+     * @brief ȡͬĲ, û򴴽 (䲢ϴ).
+     * @throws std::runtime_error ûɫʱ׳
+     */
+    const Material* intern(const MaterialDesc& desc);
+
+    /**
+     * @brief һפĶռ,  Material::setFloat ޸.
+     * @throws std::runtime_error ûɫʱ׳
+     */
+    Material* createDynamic(const MaterialDesc& desc);
+
+    size_t getMaterialCount() const { return m_count; }
+
+    // ͷв (Ⱦ߳˳ǰ, ɫͷ֮ǰ)
+    void cleanup();
+
+private:
+    MaterialLibrary() = default;
+    ~MaterialLibrary() = default;
+
+    std::unordered_map<uint64_t, std::vector<std::unique_ptr<Material>>> m_materials;  // ϣ -> ͬϣĲ
+    std::vector<std::unique_ptr<Material>> m_dynamicMaterials;
+    size_t m_count = 0;
+    uint32_t m_nextID = 1;
+};
+
+#endif // MATERIAL_H
@@ -0,0 +1,113 @@
+#include "MeshFile.h"
+#include "AssetFileSystem.h"
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+static_assert(std::is_trivially_copyable<MeshFile::Header>::value, "Mesh file header must be POD");
+static_assert(sizeof(MeshFile::Attribute) == 16, "Unexpected mesh attribute size");
+static_assert(sizeof(MeshFile::Submesh) == 48, "Unexpected submesh size");
+static_assert(sizeof(MeshFile::MaterialRef) == 336, "Unexpected material reference size");
+
+namespace {
+    // һ [offset, offset + size) ǷļҰζ
+    bool isValidSection(uint64_t offset, uint64_t size, uint64_t fileSize) {
+        return offset % MeshFile::kSectionAlignment == 0 && offset <= fileSize && size <= fileSize - offset;
+    }
+}
+
+MeshFile::MeshFile(const std::string& path)
+    : MeshFile(path, AssetFileSystem::getInstance().read(path)) {
+}
+
+MeshFile::MeshFile(const std::string& path, AssetData data)
+    : m_path(path), m_data(std::move(data)) {
+    if (m_data.size() < sizeof(Header)) {
+        throw std::runtime_error("ERROR::MESH_FILE: File too small: " + path);
+    }
+
+    if (reinterpret_cast<uintptr_t>(m_data.data()) % alignof(Header) != 0) {
+        throw std::runtime_error("ERROR::MESH_FILE: Misaligned data (packed with compression?): " + path);
+    }
+    const Header* header = reinterpret_cast<const Header*>(m_data.data());
+    if (header->magic != kMagic) {
+        throw std::runtime_error("ERROR::MESH_FILE: Not a mesh file: " + path);
+    }
+    if (header->version != kVersion || header->headerSize != sizeof(Header)) {
+        throw std::runtime_error("ERROR::MESH_FILE: Unsupported version " + std::to_string(header->version)
+            + " (expected " + std::to_string(kVersion) + "), re-import " + path);
+    }
+    if (header->fileSize != m_data.size()) {
+        throw std::runtime_error("ERROR::MESH_FILE: Truncated file: " + path);
+    }
+    if (header->attributeCount == 0 || header->attributeCount > kMaxAttributes) {
+        throw std::runtime_error("ERROR::MESH_FILE: Invalid vertex layout in " + path);
+    }
+
+    uint32_t stride = 0;
+    for (uint32_t i = 0; i < header->attributeCount; ++i) {
+        const Attribute& attribute = header->attributes[i];
+        stride += attribute.count * VertexAttribute::getSizeOfType(attribute.type);
+    }
+
+    uint64_t fileSize = m_data.size();
+    bool valid = stride == header->vertexStride
+        && isValidSection(header->vertexOffset, uint64_t(header->vertexCount) * header->vertexStride, fileSize)
+        && isValidSection(header->indexOffset, uint64_t(header->indexCount) * sizeof(uint32_t), fileSize)
+        && isValidSection(header->submeshOffset, uint64_t(header->submeshCount) * sizeof(Submesh), fileSize)
+        && isValidSection(header->materialOffset, uint64_t(header->materialCount) * sizeof(MaterialRef), fileSize);
+    if (!valid) {
+        throw std::runtime_error("ERROR::MESH_FILE: Corrupt section table in " + path);
+    }
+    m_header = header;
+
+    // С, ˳鷶Χ, ⻵ļûԽ
+    const Submesh* submeshes = getSubmeshes();
+    for (uint32_t i = 0; i < header->submeshCount; ++i) {
+        const Submesh& submesh = submeshes[i];
+        if (uint64_t(submesh.firstIndex) + submesh.indexCount > header->indexCount
+            || submesh.baseVertex < 0 || uint64_t(submesh.baseVertex) + submesh.vertexCount > header->vertexCount
+            || (header->materialCount > 0 && submesh.materialIndex >= header->materialCount)) {
+            throw std::runtime_error("ERROR::MESH_FILE: Submesh " + std::to_string(i) + " out of range in " + path);
+        }
+    }
+}
+
+VertexBufferLayout MeshFile::getLayout() const {
+    VertexBufferLayout layout;
+    for (uint32_t i = 0; i < m_header->attributeCount; ++i) {
+        const Attribute& attribute = m_header->attributes[i];
+        if (attribute.type == GL_UNSIGNED_INT) {
+            layout.push<unsigned int>(attribute.count);
+        }
+        else {
+            layout.push<float>(attribute.count);
+        }
+    }
+    return layout;
+}
+
+int MeshFile::findAttribute(Semantic semantic) const {
+    for (uint32_t i = 0; i < m_header->attributeCount; ++i) {
+        if (m_header->attributes[i].semantic == semantic) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+// ===== ʹdemo =====
+// // : glLearning.exe --import ../model/sponza.obj ../model/sponza.mesh
+//
+// MeshFile mesh("../model/sponza.mesh");  // ֻӳļ, 
+// VertexBuffer vbo(mesh.getVertexData(), mesh.getVertexDataSize());  // ֱָӽϴ
+// IndexBuffer ibo(mesh.getIndices(), mesh.getIndexCount());
+// VertexArray vao;
+// vao.addBuffer(vbo, mesh.getLayout());
+// vao.setIndexBuffer(ibo);
+//
+// for (uint32_t i = 0; i < mesh.getSubmeshCount(); ++i) {
+//     const MeshFile::Submesh& submesh = mesh.getSubmeshes()[i];
+//     const MeshFile::MaterialRef& material = mesh.getMaterials()[submesh.materialIndex];
+//     ... material.diffuseTexture ҵ Material,  firstIndex / indexCount / baseVertex ύ...
+// }
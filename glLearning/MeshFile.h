@@ -0,0 +1,135 @@
+#ifndef MESH_FILE_H
+#define MESH_FILE_H
+
+#include "AssetPack.h"
+#include "VertexArray.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <string>
+
+// MeshFile: .mesh ļ ( MeshImporter ), ʱֻڴӳ.
+//
+// ļ (С, ΰ kSectionAlignment ):
+//   Header
+//      ,  Header::attributes , ֱΪ VBO ϴ
+//      uint32, ÿԼ baseVertex
+//      Submesh[submeshCount]
+//   ʱ     MaterialRef[materialCount]
+// нṹǶ POD, ʱֻУͷ͸ηΧ, κν򿽱.
+// ļͨ AssetFileSystem ȡ: ɢļԴе .mesh (ѹ,  4KB ) ֱӳ.
+// صֱָָӳڴ,  MeshFile ǰЧ.
+class MeshFile {
+public:
+    static constexpr uint32_t kMagic = 0x48534D47;  // "GMSH"
+    static constexpr uint32_t kVersion = 1;         // κβֱ仯ҪӰ汾, ļҪµ
+    static constexpr uint32_t kSectionAlignment = 16;
+    static constexpr uint32_t kMaxAttributes = 8;
+    static constexpr uint32_t kMaxNameLength = 64;
+    static constexpr uint32_t kMaxPathLength = 128;
+
+    // Ե. ԰ڱе˳ռλ 0, 1, 2 ...
+    enum class Semantic : uint32_t {
+        Position = 0,  // vec3
+        Normal,        // vec3
+        TexCoord,      // vec2
+        Tangent,       // vec4, w Ϊ߷
+        Joints,        // vec4, ؽ± ( float ), Ƥ
+        Weights,       // vec4, ؽȨ, Ϊ 1
+    };
+
+    struct Attribute {
+        Semantic semantic;
+        uint32_t type;        // GL_FLOAT ...
+        uint32_t count;
+        uint32_t normalized;
+    };
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t headerSize;  // sizeof(Header), ֹߵĽṹ嶨岻һ
+        uint32_t attributeCount;
+        Attribute attributes[kMaxAttributes];
+        uint32_t vertexStride;
+        uint32_t vertexCount;
+        uint32_t indexCount;
+        uint32_t submeshCount;
+        uint32_t materialCount;
+        uint32_t reserved;
+        uint64_t vertexOffset;
+        uint64_t indexOffset;
+        uint64_t submeshOffset;
+        uint64_t materialOffset;
+        uint64_t fileSize;
+        float boundsMin[3];
+        float boundsMax[3];
+    };
+
+    // : ֱ glDrawElementsBaseVertex / DrawElementsIndirectCommand
+    struct Submesh {
+        uint32_t firstIndex;
+        uint32_t indexCount;
+        int32_t baseVertex;
+        uint32_t vertexCount;
+        uint32_t materialIndex;  // ʱ±
+        uint32_t reserved;
+        float boundsMin[3];
+        float boundsMax[3];
+    };
+
+    // : ֻ¼֡ͼ· (Դģļ) ͻɫ, ʱپĸ Material
+    struct MaterialRef {
+        char name[kMaxNameLength];
+        char diffuseTexture[kMaxPathLength];
+        char normalTexture[kMaxPathLength];
+        float baseColor[4];
+    };
+
+    /**
+     * @brief ӳ䲢Уļͷ. ȡ, ҳϴʱɲϵͳ.
+     * @throws std::runtime_error ļڡ汾ƥݶԽʱ׳
+     */
+    explicit MeshFile(const std::string& path);
+
+    // УѾ ( IO ̶߳ú󽻸߳̽), path ֻڴϢ
+    MeshFile(const std::string& path, AssetData data);
+
+    const Header& getHeader() const { return *m_header; }
+
+    // ͷԱɶ㲼, ֱӽ VertexArray::addBuffer
+    VertexBufferLayout getLayout() const;
+
+    // ڲе± (λ), ûиʱ -1
+    int findAttribute(Semantic semantic) const;
+
+    const void* getVertexData() const { return m_data.data() + m_header->vertexOffset; }
+    uint32_t getVertexDataSize() const { return m_header->vertexCount * m_header->vertexStride; }
+    uint32_t getVertexCount() const { return m_header->vertexCount; }
+
+    const uint32_t* getIndices() const {
+        return reinterpret_cast<const uint32_t*>(m_data.data() + m_header->indexOffset);
+    }
+    uint32_t getIndexCount() const { return m_header->indexCount; }
+
+    const Submesh* getSubmeshes() const {
+        return reinterpret_cast<const Submesh*>(m_data.data() + m_header->submeshOffset);
+    }
+    uint32_t getSubmeshCount() const { return m_header->submeshCount; }
+
+    const MaterialRef* getMaterials() const {
+        return reinterpret_cast<const MaterialRef*>(m_data.data() + m_header->materialOffset);
+    }
+    uint32_t getMaterialCount() const { return m_header->materialCount; }
+
+    glm::vec3 getBoundsMin() const { return glm::vec3(m_header->boundsMin[0], m_header->boundsMin[1], m_header->boundsMin[2]); }
+    glm::vec3 getBoundsMax() const { return glm::vec3(m_header->boundsMax[0], m_header->boundsMax[1], m_header->boundsMax[2]); }
+
+    const std::string& getPath() const { return m_path; }
+
+private:
+    std::string m_path;
+    AssetData m_data;
+    const Header* m_header = nullptr;
+};
+
+#endif // MESH_FILE_H
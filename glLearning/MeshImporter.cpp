@@ -0,0 +1,505 @@
+#include "MeshImporter.h"
+#include "AnimationFile.h"
+#include "MeshOptimizer.h"
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <assimp/scene.h>
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace {
+    uint64_t alignSection(uint64_t offset) {
+        return (offset + MeshFile::kSectionAlignment - 1) & ~uint64_t(MeshFile::kSectionAlignment - 1);
+    }
+
+    // ضϸ, ֤ 0 β
+    void copyString(char* destination, size_t capacity, const char* source, const char* what) {
+        size_t length = std::strlen(source);
+        if (length >= capacity) {
+            std::cerr << "WARNING::MESH_IMPORTER: " << what << " '" << source << "' truncated to "
+                << capacity - 1 << " characters" << std::endl;
+            length = capacity - 1;
+        }
+        std::memset(destination, 0, capacity);
+        std::memcpy(destination, source, length);
+    }
+
+    void addAttribute(MeshFile::Header& header, MeshFile::Semantic semantic, uint32_t count) {
+        MeshFile::Attribute& attribute = header.attributes[header.attributeCount++];
+        attribute.semantic = semantic;
+        attribute.type = GL_FLOAT;
+        attribute.count = count;
+        attribute.normalized = GL_FALSE;
+        header.vertexStride += count * sizeof(float);
+    }
+
+    // Assimp ľ
+    glm::mat4 toMat4(const aiMatrix4x4& matrix) {
+        glm::mat4 result;
+        for (int row = 0; row < 4; ++row) {
+            for (int column = 0; column < 4; ++column) {
+                result[column][row] = matrix[row][column];
+            }
+        }
+        return result;
+    }
+
+    // , ڵǰ
+    void collectNodes(const aiNode* node, std::vector<const aiNode*>& nodes) {
+        nodes.push_back(node);
+        for (unsigned int i = 0; i < node->mNumChildren; ++i) {
+            collectNodes(node->mChildren[i], nodes);
+        }
+    }
+
+    // ÿ 4 ؽ, ʱ滻ȨСһ
+    void addJointWeight(float* joints, float* weights, uint32_t joint, float weight) {
+        int slot = 0;
+        for (int i = 1; i < 4; ++i) {
+            if (weights[i] < weights[slot]) {
+                slot = i;
+            }
+        }
+        if (weight > weights[slot]) {
+            joints[slot] = static_cast<float>(joint);
+            weights[slot] = weight;
+        }
+    }
+
+    // ¶ģͿռеλ
+    glm::vec3 bindPosition(const float* vertex, uint32_t jointsOffset, const std::vector<glm::mat4>& palette) {
+        glm::vec4 position(vertex[0], vertex[1], vertex[2], 1.0f);
+        glm::vec4 result(0.0f);
+        for (uint32_t i = 0; i < 4; ++i) {
+            float weight = vertex[jointsOffset + 4 + i];
+            if (weight > 0.0f) {
+                result += (palette[static_cast<uint32_t>(vertex[jointsOffset + i])] * position) * weight;
+            }
+        }
+        return glm::vec3(result);
+    }
+}
+
+// =====  =====
+MeshImporter::Stats MeshImporter::importFile(const std::string& sourcePath, const std::string& outputPath) {
+    return importFile(sourcePath, outputPath, Options());
+}
+
+MeshImporter::Stats MeshImporter::importFile(const std::string& sourcePath, const std::string& outputPath,
+    const Options& options) {
+    Assimp::Importer importer;
+    // ߲Ⱦ, ֱȥ
+    importer.SetPropertyInteger(AI_CONFIG_PP_SBP_REMOVE, aiPrimitiveType_POINT | aiPrimitiveType_LINE);
+
+    unsigned int flags = aiProcess_Triangulate
+        | aiProcess_JoinIdenticalVertices
+        | aiProcess_GenSmoothNormals
+        | aiProcess_SortByPType
+        | aiProcess_RemoveRedundantMaterials
+        | aiProcess_ValidateDataStructure;
+    // չƽᶪͶҪĽڵ㼶
+    flags |= options.skinned ? aiProcess_LimitBoneWeights : aiProcess_PreTransformVertices;
+    if (options.flipUVs) {
+        flags |= aiProcess_FlipUVs;
+    }
+    if (options.generateTangents) {
+        flags |= aiProcess_CalcTangentSpace;
+    }
+
+    const aiScene* scene = importer.ReadFile(sourcePath, flags);
+    if (!scene || (scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE) || scene->mNumMeshes == 0) {
+        throw std::runtime_error("ERROR::MESH_IMPORTER: Failed to import " + sourcePath + ": " + importer.GetErrorString());
+    }
+
+    SkinData skin;
+    if (options.skinned) {
+        buildSkeleton(*scene, skin);
+        convertAnimations(*scene, skin);
+    }
+
+    MeshData data;
+    convertScene(*scene, options, options.skinned ? &skin : nullptr, data);
+    writeFile(outputPath, data);
+    uint64_t animationSourceSize = 0;
+    uint64_t animationSize = 0;
+    if (options.skinned) {
+        std::vector<CompressedClip> compressedClips;
+        for (const AnimationClip& clip : skin.clips) {
+            animationSourceSize += AnimationCompressor::getSourceSize(clip);
+            if (options.compressAnimations) {
+                compressedClips.push_back(AnimationCompressor::compress(clip, skin.skeleton, options.compression));
+                animationSize += compressedClips.back().getDataSize();
+            }
+        }
+        if (options.compressAnimations) {
+            AnimationFile::write(getAnimationPath(outputPath), skin.skeleton, std::vector<AnimationClip>(), compressedClips);
+        }
+        else {
+            AnimationFile::write(getAnimationPath(outputPath), skin.skeleton, skin.clips);
+            animationSize = animationSourceSize;
+        }
+    }
+
+    Stats stats;
+    stats.vertexCount = data.header.vertexCount;
+    stats.indexCount = data.header.indexCount;
+    stats.submeshCount = data.header.submeshCount;
+    stats.materialCount = data.header.materialCount;
+    stats.fileSize = data.header.fileSize;
+    stats.jointCount = skin.skeleton.getJointCount();
+    stats.clipCount = static_cast<uint32_t>(skin.clips.size());
+    stats.animationSourceSize = animationSourceSize;
+    stats.animationSize = animationSize;
+    return stats;
+}
+
+std::string MeshImporter::getAnimationPath(const std::string& meshPath) {
+    return std::filesystem::path(meshPath).replace_extension(".anim").string();
+}
+
+// ===== Ǽ붯 =====
+void MeshImporter::buildSkeleton(const aiScene& scene, SkinData& skin) {
+    // Ǽ = ڵ + Ľڵ + ǵȫ, ڵ㲻Ӱκζ
+    std::unordered_set<const aiNode*> required;
+    auto require = [&required](const aiNode* node) {
+        for (; node && required.insert(node).second; node = node->mParent) {
+        }
+    };
+
+    // ͬһڶʱȡһ󶨾
+    std::unordered_map<const aiNode*, glm::mat4> inverseBinds;
+    for (unsigned int m = 0; m < scene.mNumMeshes; ++m) {
+        const aiMesh& mesh = *scene.mMeshes[m];
+        for (unsigned int b = 0; b < mesh.mNumBones; ++b) {
+            const aiBone& bone = *mesh.mBones[b];
+            const aiNode* node = scene.mRootNode->FindNode(bone.mName);
+            if (!node) {
+                std::cerr << "WARNING::MESH_IMPORTER: Bone '" << bone.mName.C_Str() << "' has no node, ignored" << std::endl;
+                continue;
+            }
+            inverseBinds.emplace(node, toMat4(bone.mOffsetMatrix));
+            require(node);
+        }
+    }
+
+    std::vector<const aiNode*> nodes;
+    collectNodes(scene.mRootNode, nodes);
+    for (const aiNode* node : nodes) {
+        if (node->mNumMeshes > 0) {
+            require(node);
+        }
+    }
+
+    for (const aiNode* node : nodes) {
+        if (required.count(node) == 0) {
+            continue;
+        }
+        aiVector3D scaling, position;
+        aiQuaternion rotation;
+        node->mTransformation.Decompose(scaling, rotation, position);
+
+        int32_t parent = node->mParent ? static_cast<int32_t>(skin.nodeJoints.at(node->mParent)) : Skeleton::kNoParent;
+        auto inverseBind = inverseBinds.find(node);
+        skin.nodeJoints[node] = skin.skeleton.addJoint(node->mName.C_Str(), parent,
+            glm::vec3(position.x, position.y, position.z), glm::quat(rotation.w, rotation.x, rotation.y, rotation.z),
+            glm::vec3(scaling.x, scaling.y, scaling.z),
+            inverseBind != inverseBinds.end() ? inverseBind->second : glm::mat4(1.0f));
+    }
+}
+
+void MeshImporter::convertAnimations(const aiScene& scene, SkinData& skin) {
+    for (unsigned int a = 0; a < scene.mNumAnimations; ++a) {
+        const aiAnimation& animation = *scene.mAnimations[a];
+        double ticksPerSecond = animation.mTicksPerSecond > 0.0 ? animation.mTicksPerSecond : 25.0;
+        std::string name = animation.mName.length > 0 ? animation.mName.C_Str() : "clip" + std::to_string(a);
+        AnimationClip clip(name, static_cast<float>(animation.mDuration / ticksPerSecond));
+
+        for (unsigned int c = 0; c < animation.mNumChannels; ++c) {
+            const aiNodeAnim& channel = *animation.mChannels[c];
+            const aiNode* node = scene.mRootNode->FindNode(channel.mNodeName);
+            auto joint = node ? skin.nodeJoints.find(node) : skin.nodeJoints.end();
+            if (joint == skin.nodeJoints.end()) {
+                continue;  // ڵ㲻ڹǼ, Ӱκ
+            }
+
+            AnimationClip::Track& track = clip.addTrack(joint->second);
+            for (unsigned int k = 0; k < channel.mNumPositionKeys; ++k) {
+                const aiVectorKey& key = channel.mPositionKeys[k];
+                track.translationTimes.push_back(static_cast<float>(key.mTime / ticksPerSecond));
+                track.translations.push_back(glm::vec3(key.mValue.x, key.mValue.y, key.mValue.z));
+            }
+            for (unsigned int k = 0; k < channel.mNumRotationKeys; ++k) {
+                const aiQuatKey& key = channel.mRotationKeys[k];
+                track.rotationTimes.push_back(static_cast<float>(key.mTime / ticksPerSecond));
+                track.rotations.push_back(glm::quat(key.mValue.w, key.mValue.x, key.mValue.y, key.mValue.z));
+            }
+            for (unsigned int k = 0; k < channel.mNumScalingKeys; ++k) {
+                const aiVectorKey& key = channel.mScalingKeys[k];
+                track.scaleTimes.push_back(static_cast<float>(key.mTime / ticksPerSecond));
+                track.scales.push_back(glm::vec3(key.mValue.x, key.mValue.y, key.mValue.z));
+            }
+        }
+        skin.clips.push_back(std::move(clip));
+    }
+}
+
+// ===== ת =====
+void MeshImporter::convertScene(const aiScene& scene, const Options& options, const SkinData* skin, MeshData& data) {
+    MeshFile::Header& header = data.header;
+    std::memset(&header, 0, sizeof(header));
+    header.magic = MeshFile::kMagic;
+    header.version = MeshFile::kVersion;
+    header.headerSize = sizeof(MeshFile::Header);
+
+    // һ. λñڵһ, MeshOptimizer һ
+    addAttribute(header, MeshFile::Semantic::Position, 3);
+    addAttribute(header, MeshFile::Semantic::Normal, 3);
+    addAttribute(header, MeshFile::Semantic::TexCoord, 2);
+    if (options.generateTangents) {
+        addAttribute(header, MeshFile::Semantic::Tangent, 4);
+    }
+    uint32_t jointsOffset = 0;  //  float , Ȩؽ
+    if (skin) {
+        jointsOffset = header.vertexStride / sizeof(float);
+        addAttribute(header, MeshFile::Semantic::Joints, 4);
+        addAttribute(header, MeshFile::Semantic::Weights, 4);
+    }
+    const uint32_t floatsPerVertex = header.vertexStride / sizeof(float);
+
+    VertexBufferLayout layout;
+    for (uint32_t i = 0; i < header.attributeCount; ++i) {
+        layout.push<float>(header.attributes[i].count);
+    }
+
+    // Ҫ. skinned ģʽͬһ񱻶ڵʱһ, ֱ󶨵ڽڵ
+    struct MeshInstance {
+        unsigned int mesh;
+        uint32_t joint;
+    };
+    std::vector<MeshInstance> instances;
+    std::vector<glm::mat4> bindPalette;  // ģͿռΧ
+    if (skin) {
+        std::vector<const aiNode*> nodes;
+        collectNodes(scene.mRootNode, nodes);
+        for (const aiNode* node : nodes) {
+            for (unsigned int i = 0; i < node->mNumMeshes; ++i) {
+                instances.push_back({ node->mMeshes[i], skin->nodeJoints.at(node) });
+            }
+        }
+        std::vector<glm::mat4> modelMatrices(skin->skeleton.getJointCount());
+        bindPalette.resize(skin->skeleton.getJointCount());
+        skin->skeleton.computeSkinningMatrices(skin->skeleton.getBindPose(), modelMatrices.data(), bindPalette.data());
+    }
+    else {
+        for (unsigned int m = 0; m < scene.mNumMeshes; ++m) {
+            instances.push_back({ m, 0 });
+        }
+    }
+
+    glm::vec3 sceneMin(FLT_MAX), sceneMax(-FLT_MAX);
+    std::vector<float> vertices;
+    std::vector<uint32_t> indices;
+    for (const MeshInstance& instance : instances) {
+        const aiMesh& mesh = *scene.mMeshes[instance.mesh];
+        if (!(mesh.mPrimitiveTypes & aiPrimitiveType_TRIANGLE) || mesh.mNumVertices == 0) {
+            continue;
+        }
+
+        vertices.assign(size_t(mesh.mNumVertices) * floatsPerVertex, 0.0f);
+        for (unsigned int v = 0; v < mesh.mNumVertices; ++v) {
+            float* out = &vertices[size_t(v) * floatsPerVertex];
+            const aiVector3D& position = mesh.mVertices[v];
+            out[0] = position.x; out[1] = position.y; out[2] = position.z;
+            if (mesh.mNormals) {
+                const aiVector3D& normal = mesh.mNormals[v];
+                out[3] = normal.x; out[4] = normal.y; out[5] = normal.z;
+            }
+            if (mesh.mTextureCoords[0]) {
+                out[6] = mesh.mTextureCoords[0][v].x;
+                out[7] = mesh.mTextureCoords[0][v].y;
+            }
+            if (options.generateTangents) {
+                if (mesh.mTangents && mesh.mBitangents && mesh.mNormals) {
+                    glm::vec3 n(out[3], out[4], out[5]);
+                    glm::vec3 t(mesh.mTangents[v].x, mesh.mTangents[v].y, mesh.mTangents[v].z);
+                    glm::vec3 b(mesh.mBitangents[v].x, mesh.mBitangents[v].y, mesh.mBitangents[v].z);
+                    out[8] = t.x; out[9] = t.y; out[10] = t.z;
+                    out[11] = glm::dot(glm::cross(n, t), b) < 0.0f ? -1.0f : 1.0f;
+                }
+                else {
+                    out[8] = 1.0f; out[11] = 1.0f;
+                }
+            }
+        }
+        if (skin) {
+            for (unsigned int b = 0; b < mesh.mNumBones; ++b) {
+                const aiBone& bone = *mesh.mBones[b];
+                const aiNode* node = scene.mRootNode->FindNode(bone.mName);
+                if (!node) {
+                    continue;
+                }
+                uint32_t joint = skin->nodeJoints.at(node);
+                for (unsigned int w = 0; w < bone.mNumWeights; ++w) {
+                    const aiVertexWeight& weight = bone.mWeights[w];
+                    if (weight.mVertexId < mesh.mNumVertices) {
+                        float* out = &vertices[size_t(weight.mVertexId) * floatsPerVertex + jointsOffset];
+                        addJointWeight(out, out + 4, joint, weight.mWeight);
+                    }
+                }
+            }
+            // Ȩعһ. κιӰĶ (ûй) ڵĽڵ
+            for (unsigned int v = 0; v < mesh.mNumVertices; ++v) {
+                float* joints = &vertices[size_t(v) * floatsPerVertex + jointsOffset];
+                float* weights = joints + 4;
+                float sum = weights[0] + weights[1] + weights[2] + weights[3];
+                if (sum > 0.0f) {
+                    for (int i = 0; i < 4; ++i) {
+                        weights[i] /= sum;
+                    }
+                }
+                else {
+                    joints[0] = static_cast<float>(instance.joint);
+                    weights[0] = 1.0f;
+                }
+            }
+        }
+
+        indices.clear();
+        indices.reserve(size_t(mesh.mNumFaces) * 3);
+        for (unsigned int f = 0; f < mesh.mNumFaces; ++f) {
+            const aiFace& face = mesh.mFaces[f];
+            if (face.mNumIndices == 3) {
+                indices.insert(indices.end(), face.mIndices, face.mIndices + 3);
+            }
+        }
+        if (indices.empty()) {
+            continue;
+        }
+        if (options.optimize) {
+            MeshOptimizer::optimizeMesh(vertices, indices, layout);
+        }
+
+        MeshFile::Submesh submesh;
+        std::memset(&submesh, 0, sizeof(submesh));
+        submesh.firstIndex = static_cast<uint32_t>(data.indices.size());
+        submesh.indexCount = static_cast<uint32_t>(indices.size());
+        submesh.baseVertex = static_cast<int32_t>(data.vertices.size() / floatsPerVertex);
+        submesh.vertexCount = static_cast<uint32_t>(vertices.size() / floatsPerVertex);
+        submesh.materialIndex = mesh.mMaterialIndex < scene.mNumMaterials ? mesh.mMaterialIndex : 0;
+
+        glm::vec3 boundsMin(FLT_MAX), boundsMax(-FLT_MAX);
+        for (size_t v = 0; v < vertices.size(); v += floatsPerVertex) {
+            glm::vec3 position = skin ? bindPosition(&vertices[v], jointsOffset, bindPalette)
+                : glm::vec3(vertices[v], vertices[v + 1], vertices[v + 2]);
+            boundsMin = glm::min(boundsMin, position);
+            boundsMax = glm::max(boundsMax, position);
+        }
+        for (int axis = 0; axis < 3; ++axis) {
+            submesh.boundsMin[axis] = boundsMin[axis];
+            submesh.boundsMax[axis] = boundsMax[axis];
+        }
+        sceneMin = glm::min(sceneMin, boundsMin);
+        sceneMax = glm::max(sceneMax, boundsMax);
+
+        data.vertices.insert(data.vertices.end(), vertices.begin(), vertices.end());
+        data.indices.insert(data.indices.end(), indices.begin(), indices.end());
+        data.submeshes.push_back(submesh);
+    }
+    if (data.submeshes.empty()) {
+        throw std::runtime_error("ERROR::MESH_IMPORTER: Scene contains no triangles");
+    }
+
+    for (unsigned int i = 0; i < scene.mNumMaterials; ++i) {
+        const aiMaterial& source = *scene.mMaterials[i];
+        MeshFile::MaterialRef material;
+        std::memset(&material, 0, sizeof(material));
+
+        aiString name;
+        if (source.Get(AI_MATKEY_NAME, name) == AI_SUCCESS) {
+            copyString(material.name, sizeof(material.name), name.C_Str(), "Material name");
+        }
+        aiString path;
+        if (source.GetTexture(aiTextureType_DIFFUSE, 0, &path) == AI_SUCCESS) {
+            copyString(material.diffuseTexture, sizeof(material.diffuseTexture), path.C_Str(), "Texture path");
+        }
+        // obj  bump ͼ Assimp Ϊ HEIGHT
+        if (source.GetTexture(aiTextureType_NORMALS, 0, &path) == AI_SUCCESS
+            || source.GetTexture(aiTextureType_HEIGHT, 0, &path) == AI_SUCCESS) {
+            copyString(material.normalTexture, sizeof(material.normalTexture), path.C_Str(), "Texture path");
+        }
+        aiColor4D color(1.0f, 1.0f, 1.0f, 1.0f);
+        source.Get(AI_MATKEY_COLOR_DIFFUSE, color);
+        material.baseColor[0] = color.r;
+        material.baseColor[1] = color.g;
+        material.baseColor[2] = color.b;
+        material.baseColor[3] = color.a;
+        data.materials.push_back(material);
+    }
+
+    header.vertexCount = static_cast<uint32_t>(data.vertices.size() / floatsPerVertex);
+    header.indexCount = static_cast<uint32_t>(data.indices.size());
+    header.submeshCount = static_cast<uint32_t>(data.submeshes.size());
+    header.materialCount = static_cast<uint32_t>(data.materials.size());
+    for (int axis = 0; axis < 3; ++axis) {
+        header.boundsMin[axis] = sceneMin[axis];
+        header.boundsMax[axis] = sceneMax[axis];
+    }
+}
+
+// ===== дļ =====
+void MeshImporter::writeFile(const std::string& outputPath, MeshData& data) {
+    MeshFile::Header& header = data.header;
+    uint64_t vertexBytes = data.vertices.size() * sizeof(float);
+    uint64_t indexBytes = data.indices.size() * sizeof(uint32_t);
+    uint64_t submeshBytes = data.submeshes.size() * sizeof(MeshFile::Submesh);
+    uint64_t materialBytes = data.materials.size() * sizeof(MeshFile::MaterialRef);
+
+    header.vertexOffset = alignSection(sizeof(MeshFile::Header));
+    header.indexOffset = alignSection(header.vertexOffset + vertexBytes);
+    header.submeshOffset = alignSection(header.indexOffset + indexBytes);
+    header.materialOffset = alignSection(header.submeshOffset + submeshBytes);
+    header.fileSize = header.materialOffset + materialBytes;
+
+    std::ofstream file(outputPath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("ERROR::MESH_IMPORTER: Failed to create " + outputPath);
+    }
+
+    const char zeros[MeshFile::kSectionAlignment] = {};
+    uint64_t written = 0;
+    auto writeSection = [&](uint64_t offset, const void* bytes, uint64_t size) {
+        file.write(zeros, static_cast<std::streamsize>(offset - written));
+        file.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(size));
+        written = offset + size;
+    };
+    writeSection(0, &header, sizeof(header));
+    writeSection(header.vertexOffset, data.vertices.data(), vertexBytes);
+    writeSection(header.indexOffset, data.indices.data(), indexBytes);
+    writeSection(header.submeshOffset, data.submeshes.data(), submeshBytes);
+    writeSection(header.materialOffset, data.materials.data(), materialBytes);
+
+    if (!file) {
+        throw std::runtime_error("ERROR::MESH_IMPORTER: Failed to write " + outputPath);
+    }
+}
+
+// ===== ʹdemo =====
+// // : glLearning.exe --import ../model/backpack.obj ../model/backpack.mesh [--tangents] [--no-optimize] [--skinned] [--raw-animations]
+// MeshImporter::Options options;
+// options.generateTangents = true;
+// MeshImporter::Stats stats = MeshImporter::importFile("../model/backpack.obj", "../model/backpack.mesh", options);
+// std::cout << stats.submeshCount << " submeshes, " << stats.vertexCount << " vertices" << std::endl;
+//
+// // ʱֻӳ,  MeshFile
+// MeshFile mesh("../model/backpack.mesh");
+//
+// // ģ: ͬʱ ../model/character.anim
+// MeshImporter::Options skinnedOptions;
+// skinnedOptions.skinned = true;
+// MeshImporter::importFile("../model/character.fbx", "../model/character.mesh", skinnedOptions);
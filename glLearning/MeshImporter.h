@@ -0,0 +1,80 @@
+#ifndef MESH_IMPORTER_H
+#define MESH_IMPORTER_H
+
+#include "AnimationClip.h"
+#include "AnimationCompressor.h"
+#include "MeshFile.h"
+#include "Skeleton.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct aiNode;
+struct aiScene;
+
+// MeshImporter: ߵ빤.  Assimp ȡһԴģ (obj / fbx / gltf ...),
+// Ͷ㻺Żд .mesh ļ, ʱ MeshFile ֱӳ.
+// ڵ㼶ᱻչƽ (aiProcess_PreTransformVertices), ͬһʵϲΪһ.
+// skinned ģʽ㼶: ڵ㡢Ľڵ㼰ɹǼ,  4 ؽ±Ȩ
+// (ûй󶨵ڽڵ), Ǽܺȫдͬ .anim ļ ( AnimationFile),
+// Ĭ AnimationCompressor ѹ.
+class MeshImporter {
+public:
+    struct Options {
+        bool flipUVs = true;            // ͼƬԭϽ, OpenGL ½
+        bool generateTangents = false;  //  vec4  (ͼҪ)
+        bool optimize = true;           // 㻺 / overdraw / ȡŻ
+        bool skinned = false;           // ؽ / ȨԺ .anim
+        bool compressAnimations = true; // .anim д CompressedClip, дԭʼؼ֡
+        AnimationCompressor::Settings compression;
+    };
+
+    struct Stats {
+        uint32_t vertexCount = 0;
+        uint32_t indexCount = 0;
+        uint32_t submeshCount = 0;
+        uint32_t materialCount = 0;
+        uint64_t fileSize = 0;
+        uint32_t jointCount = 0;  // skinned ģʽ
+        uint32_t clipCount = 0;
+        uint64_t animationSourceSize = 0;  // ԭʼؼֽ֡
+        uint64_t animationSize = 0;        // д .anim Ĺؼֽ֡
+    };
+
+    /**
+     * @brief  sourcePath д outputPath.
+     * @throws std::runtime_error Assimp ȡʧܡģûλдļʧʱ׳
+     */
+    static Stats importFile(const std::string& sourcePath, const std::string& outputPath);
+    static Stats importFile(const std::string& sourcePath, const std::string& outputPath, const Options& options);
+
+    // skinned ģʽ meshPath һɵ .anim ·
+    static std::string getAnimationPath(const std::string& meshPath);
+
+private:
+    MeshImporter() = delete;
+
+    // ڴе .mesh , ļеĶ֯
+    struct MeshData {
+        MeshFile::Header header;
+        std::vector<float> vertices;
+        std::vector<uint32_t> indices;
+        std::vector<MeshFile::Submesh> submeshes;
+        std::vector<MeshFile::MaterialRef> materials;
+    };
+
+    // skinned ģʽĹǼ붯
+    struct SkinData {
+        Skeleton skeleton;
+        std::unordered_map<const aiNode*, uint32_t> nodeJoints;
+        std::vector<AnimationClip> clips;
+    };
+
+    static void buildSkeleton(const aiScene& scene, SkinData& skin);
+    static void convertAnimations(const aiScene& scene, SkinData& skin);
+    static void convertScene(const aiScene& scene, const Options& options, const SkinData* skin, MeshData& data);
+    static void writeFile(const std::string& outputPath, MeshData& data);
+};
+
+#endif // MESH_IMPORTER_H
@@ -0,0 +1,415 @@
+#include "MeshOptimizer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+    //  ->  ڽӱ (CSR )
+    struct TriangleAdjacency {
+        std::vector<uint32_t> counts;
+        std::vector<uint32_t> offsets;
+        std::vector<uint32_t> data;
+
+        void build(const uint32_t* indices, size_t indexCount, size_t vertexCount) {
+            counts.assign(vertexCount, 0);
+            offsets.assign(vertexCount, 0);
+            data.resize(indexCount);
+
+            for (size_t i = 0; i < indexCount; ++i) {
+                counts[indices[i]]++;
+            }
+
+            uint32_t offset = 0;
+            for (size_t v = 0; v < vertexCount; ++v) {
+                offsets[v] = offset;
+                offset += counts[v];
+            }
+
+            //  offsets Ϊдα, ٻָ
+            for (size_t i = 0; i < indexCount; ++i) {
+                data[offsets[indices[i]]++] = static_cast<uint32_t>(i / 3);
+            }
+            for (size_t v = 0; v < vertexCount; ++v) {
+                offsets[v] -= counts[v];
+            }
+        }
+    };
+
+    // ʱ FIFO ģ:  cacheSize δڱд뼴Ϊ
+    struct FifoCache {
+        std::vector<uint32_t> timestamps;
+        uint32_t time;
+        uint32_t size;
+
+        FifoCache(size_t vertexCount, uint32_t cacheSize)
+            : timestamps(vertexCount, 0), time(cacheSize + 1), size(cacheSize) {}
+
+        // رηǷδ
+        bool access(uint32_t v) {
+            if (time - timestamps[v] > size) {
+                timestamps[v] = time++;
+                return true;
+            }
+            return false;
+        }
+
+        // ջ: ƽʱʹִĿ
+        void flush() { time += size + 1; }
+    };
+
+    void validateIndices(const uint32_t* indices, size_t indexCount, size_t vertexCount) {
+        if (indexCount % 3 != 0) {
+            throw std::runtime_error("ERROR::MESH_OPTIMIZER: Index count must be a multiple of 3");
+        }
+        for (size_t i = 0; i < indexCount; ++i) {
+            if (indices[i] >= vertexCount) {
+                throw std::runtime_error("ERROR::MESH_OPTIMIZER: Index out of range");
+            }
+        }
+    }
+
+    // Tipsify Ѱһȳ
+    int64_t getNextVertex(const std::vector<uint32_t>& candidates, const std::vector<uint32_t>& live,
+        const FifoCache& cache) {
+        int64_t best = -1;
+        int64_t bestPriority = -1;
+        for (uint32_t v : candidates) {
+            if (live[v] == 0) {
+                continue;
+            }
+            // ȳڻеĶ, ԽԽ (ԽҪ)
+            int64_t priority = 0;
+            uint32_t age = cache.time - cache.timestamps[v];
+            if (age + 2 * live[v] <= cache.size) {
+                priority = age;
+            }
+            if (priority > bestPriority) {
+                bestPriority = priority;
+                best = v;
+            }
+        }
+        return best;
+    }
+
+} // namespace
+
+// ===== ͳ =====
+MeshOptimizer::VertexCacheStats MeshOptimizer::analyzeVertexCache(const uint32_t* indices, size_t indexCount,
+    size_t vertexCount, uint32_t cacheSize) {
+    validateIndices(indices, indexCount, vertexCount);
+
+    VertexCacheStats stats;
+    stats.triangleCount = static_cast<uint32_t>(indexCount / 3);
+
+    FifoCache cache(vertexCount, cacheSize);
+    std::vector<bool> seen(vertexCount, false);
+    for (size_t i = 0; i < indexCount; ++i) {
+        uint32_t v = indices[i];
+        if (cache.access(v)) {
+            stats.transformedVertices++;
+        }
+        if (!seen[v]) {
+            seen[v] = true;
+            stats.uniqueVertices++;
+        }
+    }
+
+    if (stats.triangleCount > 0) {
+        stats.acmr = float(stats.transformedVertices) / float(stats.triangleCount);
+    }
+    if (stats.uniqueVertices > 0) {
+        stats.atvr = float(stats.transformedVertices) / float(stats.uniqueVertices);
+    }
+    return stats;
+}
+
+// ===== Tipsify 㻺Ż =====
+void MeshOptimizer::optimizeVertexCache(uint32_t* destination, const uint32_t* indices, size_t indexCount,
+    size_t vertexCount, uint32_t cacheSize, std::vector<uint32_t>* clusters) {
+    validateIndices(indices, indexCount, vertexCount);
+    if (destination == indices) {
+        throw std::runtime_error("ERROR::MESH_OPTIMIZER: In-place vertex cache optimization is not supported");
+    }
+    if (clusters) {
+        clusters->clear();
+    }
+    if (indexCount == 0) {
+        return;
+    }
+
+    TriangleAdjacency adjacency;
+    adjacency.build(indices, indexCount, vertexCount);
+
+    std::vector<uint32_t> live(adjacency.counts);
+    std::vector<bool> emitted(indexCount / 3, false);
+    std::vector<uint32_t> deadEnd;
+    std::vector<uint32_t> candidates;
+    deadEnd.reserve(indexCount);
+    candidates.reserve(64);
+
+    FifoCache cache(vertexCount, cacheSize);
+
+    size_t outputCount = 0;
+    uint32_t cursor = 0;     // ·ʱ˳ɨʣඥ
+    int64_t fanning = -1;
+
+    // ҵһõĶΪ
+    while (cursor < vertexCount && live[cursor] == 0) {
+        ++cursor;
+    }
+    fanning = cursor < vertexCount ? cursor : -1;
+    if (clusters && fanning >= 0) {
+        clusters->push_back(0);
+    }
+
+    while (fanning >= 0) {
+        uint32_t f = static_cast<uint32_t>(fanning);
+        candidates.clear();
+
+        // ȳδ
+        const uint32_t* triangles = &adjacency.data[adjacency.offsets[f]];
+        for (uint32_t j = 0; j < adjacency.counts[f]; ++j) {
+            uint32_t t = triangles[j];
+            if (emitted[t]) {
+                continue;
+            }
+            for (int k = 0; k < 3; ++k) {
+                uint32_t v = indices[t * 3 + k];
+                destination[outputCount++] = v;
+                deadEnd.push_back(v);
+                candidates.push_back(v);
+                live[v]--;
+                cache.access(v);
+            }
+            emitted[t] = true;
+        }
+
+        fanning = getNextVertex(candidates, live, cache);
+        if (fanning >= 0) {
+            continue;
+        }
+
+        // ·: ȻĶ, ˳ɨ; ˴γµӲر߽
+        while (!deadEnd.empty()) {
+            uint32_t d = deadEnd.back();
+            deadEnd.pop_back();
+            if (live[d] > 0) {
+                fanning = d;
+                break;
+            }
+        }
+        while (fanning < 0 && cursor < vertexCount) {
+            if (live[cursor] > 0) {
+                fanning = cursor;
+            }
+            ++cursor;
+        }
+        if (clusters && fanning >= 0) {
+            clusters->push_back(static_cast<uint32_t>(outputCount / 3));
+        }
+    }
+}
+
+// ===== Overdraw  =====
+void MeshOptimizer::optimizeOverdraw(uint32_t* destination, const uint32_t* indices, size_t indexCount,
+    const float* positions, size_t vertexCount, size_t vertexStride,
+    const std::vector<uint32_t>& clusters, float threshold, uint32_t cacheSize) {
+    validateIndices(indices, indexCount, vertexCount);
+    if (destination == indices) {
+        throw std::runtime_error("ERROR::MESH_OPTIMIZER: In-place overdraw optimization is not supported");
+    }
+    if (vertexStride < 3 * sizeof(float) || vertexStride % sizeof(float) != 0) {
+        throw std::runtime_error("ERROR::MESH_OPTIMIZER: Invalid vertex stride");
+    }
+
+    size_t triangleCount = indexCount / 3;
+    if (triangleCount == 0) {
+        return;
+    }
+
+    // ûӲϢʱһ
+    std::vector<uint32_t> hard = clusters.empty() ? std::vector<uint32_t>{ 0 } : clusters;
+    hard.push_back(static_cast<uint32_t>(triangleCount));
+
+    // Ӳڲ ACMR ֵз: һǰӴص ACMR Ѿز̫п
+    std::vector<uint32_t> soft;
+    FifoCache cache(vertexCount, cacheSize);
+    for (size_t c = 0; c + 1 < hard.size(); ++c) {
+        uint32_t begin = hard[c];
+        uint32_t end = hard[c + 1];
+        if (begin >= end) {
+            continue;
+        }
+
+        cache.flush();
+        uint32_t clusterMisses = 0;
+        for (uint32_t t = begin; t < end; ++t) {
+            for (int k = 0; k < 3; ++k) {
+                clusterMisses += cache.access(indices[t * 3 + k]) ? 1 : 0;
+            }
+        }
+        float limit = threshold * float(clusterMisses) / float(end - begin);
+
+        cache.flush();
+        soft.push_back(begin);
+        uint32_t misses = 0;
+        uint32_t start = begin;
+        for (uint32_t t = begin; t < end; ++t) {
+            for (int k = 0; k < 3; ++k) {
+                misses += cache.access(indices[t * 3 + k]) ? 1 : 0;
+            }
+            if (t + 1 < end && float(misses) / float(t + 1 - start) <= limit) {
+                soft.push_back(t + 1);
+                start = t + 1;
+                misses = 0;
+                cache.flush();
+            }
+        }
+    }
+    soft.push_back(static_cast<uint32_t>(triangleCount));
+
+    auto position = [&](uint32_t v) -> const float* {
+        return positions + v * (vertexStride / sizeof(float));
+    };
+
+    // Ȩ
+    double meshCentroid[3] = { 0.0, 0.0, 0.0 };
+    double meshArea = 0.0;
+
+    struct ClusterInfo {
+        double centroid[3];
+        double normal[3];
+        double area;
+    };
+    size_t clusterCount = soft.size() - 1;
+    std::vector<ClusterInfo> infos(clusterCount);
+
+    for (size_t c = 0; c < clusterCount; ++c) {
+        ClusterInfo& info = infos[c];
+        info = ClusterInfo{ { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 0.0 }, 0.0 };
+        for (uint32_t t = soft[c]; t < soft[c + 1]; ++t) {
+            const float* p0 = position(indices[t * 3 + 0]);
+            const float* p1 = position(indices[t * 3 + 1]);
+            const float* p2 = position(indices[t * 3 + 2]);
+
+            double e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+            double e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+            double n[3] = {
+                e1[1] * e2[2] - e1[2] * e2[1],
+                e1[2] * e2[0] - e1[0] * e2[2],
+                e1[0] * e2[1] - e1[1] * e2[0]
+            };
+            double area = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+
+            for (int k = 0; k < 3; ++k) {
+                double center = (double(p0[k]) + p1[k] + p2[k]) / 3.0;
+                info.centroid[k] += center * area;
+                info.normal[k] += n[k];
+                meshCentroid[k] += center * area;
+            }
+            info.area += area;
+            meshArea += area;
+        }
+    }
+
+    for (int k = 0; k < 3; ++k) {
+        meshCentroid[k] = meshArea > 0.0 ? meshCentroid[k] / meshArea : 0.0;
+    }
+
+    // : سĳ̶. Ĵظڵ, ӦȻ
+    std::vector<float> sortKey(clusterCount);
+    for (size_t c = 0; c < clusterCount; ++c) {
+        const ClusterInfo& info = infos[c];
+        double length = std::sqrt(info.normal[0] * info.normal[0] +
+            info.normal[1] * info.normal[1] + info.normal[2] * info.normal[2]);
+        double dp = 0.0;
+        if (info.area > 0.0 && length > 0.0) {
+            for (int k = 0; k < 3; ++k) {
+                dp += (info.centroid[k] / info.area - meshCentroid[k]) * (info.normal[k] / length);
+            }
+        }
+        sortKey[c] = static_cast<float>(dp);
+    }
+
+    std::vector<uint32_t> order(clusterCount);
+    for (size_t c = 0; c < clusterCount; ++c) {
+        order[c] = static_cast<uint32_t>(c);
+    }
+    // stable_sort ֤ȷ
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return sortKey[a] > sortKey[b];
+    });
+
+    size_t outputCount = 0;
+    for (uint32_t c : order) {
+        size_t first = size_t(soft[c]) * 3;
+        size_t count = size_t(soft[c + 1] - soft[c]) * 3;
+        std::memcpy(destination + outputCount, indices + first, count * sizeof(uint32_t));
+        outputCount += count;
+    }
+}
+
+// ===== ȡ =====
+size_t MeshOptimizer::optimizeVertexFetch(void* destination, uint32_t* indices, size_t indexCount,
+    const void* vertices, size_t vertexCount, size_t vertexSize) {
+    validateIndices(indices, indexCount, vertexCount);
+    if (destination == vertices) {
+        throw std::runtime_error("ERROR::MESH_OPTIMIZER: In-place vertex fetch optimization is not supported");
+    }
+
+    const uint32_t kUnused = ~0u;
+    std::vector<uint32_t> remap(vertexCount, kUnused);
+
+    auto* dst = static_cast<unsigned char*>(destination);
+    const auto* src = static_cast<const unsigned char*>(vertices);
+
+    uint32_t next = 0;
+    for (size_t i = 0; i < indexCount; ++i) {
+        uint32_t v = indices[i];
+        if (remap[v] == kUnused) {
+            remap[v] = next;
+            std::memcpy(dst + size_t(next) * vertexSize, src + size_t(v) * vertexSize, vertexSize);
+            ++next;
+        }
+        indices[i] = remap[v];
+    }
+    return next;
+}
+
+// =====  =====
+MeshOptimizer::Report MeshOptimizer::optimizeMesh(std::vector<float>& vertices, std::vector<uint32_t>& indices,
+    const VertexBufferLayout& layout, float overdrawThreshold) {
+    const auto& elements = layout.getElements();
+    size_t stride = layout.getStride();
+    if (elements.empty() || elements[0].type != GL_FLOAT || elements[0].count < 3 ||
+        stride % sizeof(float) != 0) {
+        throw std::runtime_error("ERROR::MESH_OPTIMIZER: Layout must start with a float3 position");
+    }
+
+    size_t floatsPerVertex = stride / sizeof(float);
+    size_t vertexCount = vertices.size() / floatsPerVertex;
+
+    Report report;
+    report.vertexCountBefore = static_cast<uint32_t>(vertexCount);
+    report.before = analyzeVertexCache(indices.data(), indices.size(), vertexCount);
+
+    std::vector<uint32_t> clusters;
+    std::vector<uint32_t> cacheOptimized(indices.size());
+    optimizeVertexCache(cacheOptimized.data(), indices.data(), indices.size(), vertexCount,
+        kDefaultCacheSize, &clusters);
+
+    optimizeOverdraw(indices.data(), cacheOptimized.data(), cacheOptimized.size(),
+        vertices.data(), vertexCount, stride, clusters, overdrawThreshold);
+
+    std::vector<float> fetchOptimized(vertices.size());
+    size_t newVertexCount = optimizeVertexFetch(fetchOptimized.data(), indices.data(), indices.size(),
+        vertices.data(), vertexCount, stride);
+    fetchOptimized.resize(newVertexCount * floatsPerVertex);
+    vertices.swap(fetchOptimized);
+
+    report.vertexCountAfter = static_cast<uint32_t>(newVertexCount);
+    report.after = analyzeVertexCache(indices.data(), indices.size(), newVertexCount);
+    return report;
+}
@@ -0,0 +1,85 @@
+#ifndef MESH_OPTIMIZER_H
+#define MESH_OPTIMIZER_H
+
+#include "VertexArray.h"
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// MeshOptimizer: /׶εŻ
+// ֱӴ VertexBuffer / IndexBuffer ֮ǰԭʼ,  GPU.
+// 㷨ȷԵ: ͬȻõͬ.
+class MeshOptimizer {
+public:
+    // 任(post-transform cache)ͳ
+    struct VertexCacheStats {
+        uint32_t triangleCount = 0;
+        uint32_t uniqueVertices = 0;       // õĲͬ
+        uint32_t transformedVertices = 0;  // ģ FIFO µĶɫô
+        float acmr = 0.0f;                 // ÿƽδ (Լ 0.5,  3.0)
+        float atvr = 0.0f;                 // 任 / Ψһ ( 1.0)
+    };
+
+    // optimizeMesh ǰԱȱ
+    struct Report {
+        VertexCacheStats before;
+        VertexCacheStats after;
+        uint32_t vertexCountBefore = 0;
+        uint32_t vertexCountAfter = 0;
+    };
+
+    // Ĭģ FIFO С,  GPU Чӽ
+    static constexpr uint32_t kDefaultCacheSize = 16;
+
+    /**
+     * @brief  FIFO ģ ACMR / ATVR.
+     * @param indices б.
+     * @param indexCount  ( 3 ı).
+     * @param vertexCount .
+     * @param cacheSize ģĻС.
+     */
+    static VertexCacheStats analyzeVertexCache(const uint32_t* indices, size_t indexCount,
+        size_t vertexCount, uint32_t cacheSize = kDefaultCacheSize);
+
+    /**
+     * @brief Tipsify 㻺Ż (Sander et al. 2007).
+     * @param destination , Ϊ indexCount,  indices ص.
+     * @param clusters ѡ, ÿӲ(hard boundary)ʼεı,  optimizeOverdraw ʹ.
+     */
+    static void optimizeVertexCache(uint32_t* destination, const uint32_t* indices, size_t indexCount,
+        size_t vertexCount, uint32_t cacheSize = kDefaultCacheSize,
+        std::vector<uint32_t>* clusters = nullptr);
+
+    /**
+     * @brief ֪ overdraw Ĵ. Ӧ optimizeVertexCache .
+     * @param positions λ (ÿǰ 3  float), Ϊ vertexStride ֽ.
+     * @param threshold  ACMR ڻŽı, 1.05 ʾ 5%.
+     */
+    static void optimizeOverdraw(uint32_t* destination, const uint32_t* indices, size_t indexCount,
+        const float* positions, size_t vertexCount, size_t vertexStride,
+        const std::vector<uint32_t>& clusters, float threshold = 1.05f,
+        uint32_t cacheSize = kDefaultCacheSize);
+
+    /**
+     * @brief ȡ(fetch): ״γֵ˳ж㲢ӳ.
+     * δõĶᱻ.
+     * @param destination ,  vertexCount * vertexSize ֽ,  vertices ص.
+     * @param indices ԭд.
+     * @return źĶ.
+     */
+    static size_t optimizeVertexFetch(void* destination, uint32_t* indices, size_t indexCount,
+        const void* vertices, size_t vertexCount, size_t vertexSize);
+
+    /**
+     * @brief ִлŻ, overdraw ŻͶȡŻ.
+     * Լ layout ĵһ vec3 λ.
+     * @return Żǰͳ.
+     */
+    static Report optimizeMesh(std::vector<float>& vertices, std::vector<uint32_t>& indices,
+        const VertexBufferLayout& layout, float overdrawThreshold = 1.05f);
+
+private:
+    MeshOptimizer() = delete;
+};
+
+#endif // MESH_OPTIMIZER_H
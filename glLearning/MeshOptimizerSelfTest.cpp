@@ -0,0 +1,168 @@
+#include "MeshOptimizerSelfTest.h"
+#include "Benchmark.h"
+#include "MeshOptimizer.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+    const uint32_t kGridSize = 32;           // 32 x 32 , 2048 
+    const uint32_t kUnusedVertexCount = 16;
+    const uint32_t kFloatsPerVertex = 5;     // position(3) + uv(2)
+
+    // һε, תֵСĶǰ (ı)
+    using Triangle = std::array<float, kFloatsPerVertex * 3>;
+
+    struct TestMesh {
+        std::vector<float> vertices;
+        std::vector<uint32_t> indices;
+    };
+
+    // ===== ̶Ĳ =====
+    TestMesh makeTestMesh() {
+        uint32_t state = 12345u;
+        uint32_t side = kGridSize + 1;
+        uint32_t vertexCount = side * side;
+
+        // ˳, ĩβ벻õĶ
+        std::vector<uint32_t> slots(vertexCount + kUnusedVertexCount);
+        for (uint32_t i = 0; i < slots.size(); ++i) {
+            slots[i] = i;
+        }
+        for (uint32_t i = static_cast<uint32_t>(slots.size()) - 1; i > 0; --i) {
+            uint32_t j = static_cast<uint32_t>(Benchmark::random(state) * (i + 1)) % (i + 1);
+            std::swap(slots[i], slots[j]);
+        }
+
+        TestMesh mesh;
+        mesh.vertices.assign(slots.size() * kFloatsPerVertex, 0.0f);
+        for (uint32_t i = 0; i < slots.size(); ++i) {
+            float* vertex = &mesh.vertices[slots[i] * kFloatsPerVertex];
+            if (i < vertexCount) {
+                float u = static_cast<float>(i % side) / kGridSize;
+                float v = static_cast<float>(i / side) / kGridSize;
+                vertex[0] = u * 2.0f - 1.0f;
+                vertex[1] = 0.0f;
+                vertex[2] = v * 2.0f - 1.0f;
+                vertex[3] = u;
+                vertex[4] = v;
+            } else {
+                vertex[0] = vertex[1] = vertex[2] = 100.0f + i;
+            }
+        }
+
+        // ˳
+        std::vector<std::array<uint32_t, 3>> triangles;
+        for (uint32_t y = 0; y < kGridSize; ++y) {
+            for (uint32_t x = 0; x < kGridSize; ++x) {
+                uint32_t a = slots[y * side + x];
+                uint32_t b = slots[y * side + x + 1];
+                uint32_t c = slots[(y + 1) * side + x];
+                uint32_t d = slots[(y + 1) * side + x + 1];
+                triangles.push_back({ a, c, b });
+                triangles.push_back({ b, c, d });
+            }
+        }
+        for (size_t i = triangles.size() - 1; i > 0; --i) {
+            size_t j = static_cast<size_t>(Benchmark::random(state) * (i + 1)) % (i + 1);
+            std::swap(triangles[i], triangles[j]);
+        }
+        for (const auto& triangle : triangles) {
+            mesh.indices.insert(mesh.indices.end(), triangle.begin(), triangle.end());
+        }
+        return mesh;
+    }
+
+    VertexBufferLayout makeLayout() {
+        VertexBufferLayout layout;
+        layout.push<float>(3);
+        layout.push<float>(2);
+        return layout;
+    }
+
+    // ===== αȽ =====
+    // Զݱʾμ, ֱӱȽ; Խʱ false
+    bool collectTriangles(const TestMesh& mesh, std::vector<Triangle>& triangles) {
+        size_t vertexCount = mesh.vertices.size() / kFloatsPerVertex;
+        triangles.clear();
+        for (size_t i = 0; i + 2 < mesh.indices.size(); i += 3) {
+            std::array<uint32_t, 3> corners = { mesh.indices[i], mesh.indices[i + 1], mesh.indices[i + 2] };
+            for (uint32_t index : corners) {
+                if (index >= vertexCount) {
+                    return false;
+                }
+            }
+
+            auto vertexLess = [&](uint32_t a, uint32_t b) {
+                return std::lexicographical_compare(
+                    &mesh.vertices[a * kFloatsPerVertex], &mesh.vertices[(a + 1) * kFloatsPerVertex],
+                    &mesh.vertices[b * kFloatsPerVertex], &mesh.vertices[(b + 1) * kFloatsPerVertex]);
+            };
+            size_t first = 0;
+            for (size_t k = 1; k < 3; ++k) {
+                if (vertexLess(corners[k], corners[first])) {
+                    first = k;
+                }
+            }
+
+            Triangle triangle;
+            for (size_t k = 0; k < 3; ++k) {
+                const float* vertex = &mesh.vertices[corners[(first + k) % 3] * kFloatsPerVertex];
+                std::copy(vertex, vertex + kFloatsPerVertex, triangle.begin() + k * kFloatsPerVertex);
+            }
+            triangles.push_back(triangle);
+        }
+        std::sort(triangles.begin(), triangles.end());
+        return true;
+    }
+
+    bool check(bool condition, const std::string& name, bool print) {
+        if (print) {
+            std::cout << (condition ? "  PASS  " : "  FAIL  ") << name << std::endl;
+        }
+        return condition;
+    }
+}
+
+bool runMeshOptimizerSelfTest(bool print) {
+    VertexBufferLayout layout = makeLayout();
+    TestMesh original = makeTestMesh();
+
+    TestMesh first = original;
+    MeshOptimizer::Report report = MeshOptimizer::optimizeMesh(first.vertices, first.indices, layout);
+
+    TestMesh second = original;
+    MeshOptimizer::optimizeMesh(second.vertices, second.indices, layout);
+
+    std::vector<Triangle> originalTriangles;
+    std::vector<Triangle> optimizedTriangles;
+    collectTriangles(original, originalTriangles);
+    bool indicesInRange = collectTriangles(first, optimizedTriangles);
+
+    uint32_t referencedCount = (kGridSize + 1) * (kGridSize + 1);
+
+    if (print) {
+        std::cout << "===== MeshOptimizer self-test (" << original.indices.size() / 3 << " triangles) =====" << std::endl;
+        std::cout << "  ACMR " << report.before.acmr << " -> " << report.after.acmr
+                  << ", ATVR " << report.before.atvr << " -> " << report.after.atvr
+                  << ", vertices " << report.vertexCountBefore << " -> " << report.vertexCountAfter << std::endl;
+    }
+
+    bool passed = true;
+    passed &= check(report.after.acmr < report.before.acmr, "ACMR improves", print);
+    passed &= check(report.after.atvr < report.before.atvr, "ATVR improves", print);
+    passed &= check(report.vertexCountAfter == referencedCount, "unreferenced vertices removed", print);
+    passed &= check(first.indices.size() == original.indices.size(), "triangle count unchanged", print);
+    passed &= check(indicesInRange, "indices within remapped vertex buffer", print);
+    passed &= check(optimizedTriangles == originalTriangles, "same triangles (vertex data and winding)", print);
+    passed &= check(first.vertices == second.vertices && first.indices == second.indices, "repeated runs identical", print);
+
+    if (print) {
+        std::cout << (passed ? "All checks passed" : "Some checks FAILED") << std::endl;
+    }
+    return passed;
+}
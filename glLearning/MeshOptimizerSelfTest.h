@@ -0,0 +1,12 @@
+#ifndef MESH_OPTIMIZER_SELF_TEST_H
+#define MESH_OPTIMIZER_SELF_TEST_H
+
+// MeshOptimizer Լ (ֻ CPU, Ҫ GL ): һ̶ (붥˳Ƭ,
+// δõĶ)  optimizeMesh, 
+//   - ACMR / ATVR С, δõĶ㱻ȥ
+//   - ź붥ͬһ (ݱȽ, )
+//   - ͬظеõȫͬĽ
+// ӡÿһĽ (main  --test-meshopt ), ȫͨʱ true
+bool runMeshOptimizerSelfTest(bool print = true);
+
+#endif // MESH_OPTIMIZER_SELF_TEST_H
@@ -0,0 +1,53 @@
+#include "MeshPool.h"
+#include <stdexcept>
+#include <vector>
+
+MeshPool::MeshPool(const VertexBufferLayout& layout, uint32_t maxVertices, uint32_t maxIndices,
+    uint32_t maxDraws)
+    : m_layout(layout), m_maxDraws(maxDraws), m_maxVertices(maxVertices), m_maxIndices(maxIndices) {
+    m_vao = std::make_unique<VertexArray>();
+    m_vbo = std::make_unique<VertexBuffer>(nullptr, maxVertices * layout.getStride(), GL_DYNAMIC_DRAW);
+    m_ibo = std::make_unique<IndexBuffer>(nullptr, maxIndices, GL_DYNAMIC_DRAW);
+
+    std::vector<float> drawIndices(maxDraws);
+    for (uint32_t i = 0; i < maxDraws; ++i) {
+        drawIndices[i] = static_cast<float>(i);
+    }
+    m_drawIndexBuffer = std::make_unique<VertexBuffer>(drawIndices.data(),
+        uint32_t(maxDraws * sizeof(float)));
+
+    VertexBufferLayout drawIndexLayout;
+    drawIndexLayout.pushInstanced<float>(1);
+
+    m_vao->addBuffer(*m_vbo, m_layout);
+    m_drawIndexLocation = m_vao->getAttributeCount();
+    m_vao->addBuffer(*m_drawIndexBuffer, drawIndexLayout);
+    m_vao->setIndexBuffer(*m_ibo);
+    m_vao->unbind();
+}
+
+MeshPool::MeshRange MeshPool::addMesh(const void* vertices, uint32_t vertexCount,
+    const uint32_t* indices, uint32_t indexCount) {
+    if (m_vertexCount + vertexCount > m_maxVertices || m_indexCount + indexCount > m_maxIndices) {
+        throw std::runtime_error("ERROR::MESH_POOL: Out of pool capacity");
+    }
+
+    MeshRange range;
+    range.firstIndex = m_indexCount;
+    range.indexCount = indexCount;
+    range.baseVertex = static_cast<int32_t>(m_vertexCount);
+    range.vertexCount = vertexCount;
+
+    GLuint stride = m_layout.getStride();
+    m_vbo->updateData(m_vertexCount * stride, vertices, vertexCount * stride);
+    m_ibo->updateData(m_indexCount, indices, indexCount);
+
+    m_vertexCount += vertexCount;
+    m_indexCount += indexCount;
+    return range;
+}
+
+void MeshPool::clear() {
+    m_vertexCount = 0;
+    m_indexCount = 0;
+}
@@ -0,0 +1,69 @@
+#ifndef MESH_POOL_H
+#define MESH_POOL_H
+
+#include "VertexArray.h"
+#include "VertexBuffer.h"
+#include "IndexBuffer.h"
+#include <cstdint>
+#include <memory>
+
+// MeshPool: ѶŽͬһԴ VBO / IBO , һ VAO
+// ֮ͬлֻҪı firstIndex / baseVertex, ǼӻƵǰ
+class MeshPool {
+public:
+    // ڹеλ, ֱ DrawElementsIndirectCommand
+    struct MeshRange {
+        uint32_t firstIndex = 0;
+        uint32_t indexCount = 0;
+        int32_t baseVertex = 0;
+        uint32_t vertexCount = 0;
+    };
+
+    // layout: õĶ㲼
+    // maxVertices / maxIndices: Ԥ
+    // maxDraws: ĳ, ӻ baseInstance + ʵŵ
+    MeshPool(const VertexBufferLayout& layout, uint32_t maxVertices, uint32_t maxIndices,
+        uint32_t maxDraws = 65536);
+
+    // ֹ
+    MeshPool(const MeshPool&) = delete;
+    MeshPool& operator=(const MeshPool&) = delete;
+
+    /**
+     * @brief ׷һ. ڸľֲ.
+     * @return ڹеλ. ʱ׳쳣.
+     */
+    MeshRange addMesh(const void* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount);
+
+    // շα (ݱ GPU , ᱻ addMesh )
+    void clear();
+
+    VertexArray& getVertexArray() { return *m_vao; }
+    const VertexArray& getVertexArray() const { return *m_vao; }
+    const VertexBufferLayout& getLayout() const { return m_layout; }
+
+    uint32_t getVertexCount() const { return m_vertexCount; }
+    uint32_t getIndexCount() const { return m_indexCount; }
+
+    // ʵԵλ (ڲ֮) 볤.
+    //  i ԪΪ i, ʵԶȡ baseInstance, ɫľ baseInstance,
+    // ڲ֧ ARB_shader_draw_parameters ϴ gl_BaseInstance.
+    GLuint getDrawIndexLocation() const { return m_drawIndexLocation; }
+    uint32_t getMaxDraws() const { return m_maxDraws; }
+
+private:
+    VertexBufferLayout m_layout;
+    std::unique_ptr<VertexArray> m_vao;
+    std::unique_ptr<VertexBuffer> m_vbo;
+    std::unique_ptr<IndexBuffer> m_ibo;
+    std::unique_ptr<VertexBuffer> m_drawIndexBuffer;
+    GLuint m_drawIndexLocation = 0;
+    uint32_t m_maxDraws;
+
+    uint32_t m_maxVertices;
+    uint32_t m_maxIndices;
+    uint32_t m_vertexCount = 0;
+    uint32_t m_indexCount = 0;
+};
+
+#endif // MESH_POOL_H
@@ -0,0 +1,410 @@
+#include "MeshletBuilder.h"
+#include "AssetFileSystem.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+    const uint32_t kMeshletMagic = 0x54454C4D;  // "MLET"
+    const uint32_t kMeshletVersion = 1;
+
+    struct MeshletFileHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t meshletCount;
+        uint32_t vertexCount;
+        uint32_t triangleByteCount;
+    };
+
+    const uint32_t kUnused = ~0u;
+
+    // ûںѡʱ, ֮ôδ meshlet .
+    // ͨѰ㻺, ڿռҲ; ƴù
+    const uint32_t kFillWindow = 128;
+    const size_t kFillScanLimit = 4096;
+
+    int8_t quantizeSnorm8(float value) {
+        float scaled = std::round(std::max(-1.0f, std::min(1.0f, value)) * 127.0f);
+        return static_cast<int8_t>(scaled);
+    }
+
+    template<typename T>
+    void writeArray(std::ofstream& file, const std::vector<T>& values) {
+        if (!values.empty()) {
+            file.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+        }
+    }
+
+    // ڴа˳ȡ, ʣݲʱ false
+    template<typename T>
+    bool readArray(const uint8_t*& cursor, const uint8_t* end, std::vector<T>& values, size_t count) {
+        if (static_cast<size_t>(end - cursor) / sizeof(T) < count) {
+            return false;
+        }
+        values.resize(count);
+        if (count > 0) {
+            std::memcpy(values.data(), cursor, count * sizeof(T));
+            cursor += count * sizeof(T);
+        }
+        return true;
+    }
+}
+
+std::vector<uint32_t> MeshletData::buildIndexBuffer() const {
+    std::vector<uint32_t> indices(triangles.size());
+    for (const Meshlet& meshlet : meshlets) {
+        for (uint32_t i = 0; i < meshlet.triangleCount * 3u; ++i) {
+            uint8_t local = triangles[meshlet.triangleOffset + i];
+            indices[meshlet.triangleOffset + i] = vertices[meshlet.vertexOffset + local];
+        }
+    }
+    return indices;
+}
+
+// =====  =====
+MeshletData MeshletBuilder::build(const uint32_t* indices, size_t indexCount,
+    const float* positions, size_t vertexCount, size_t vertexStride,
+    uint32_t maxVertices, uint32_t maxTriangles) {
+    if (indexCount % 3 != 0) {
+        throw std::runtime_error("ERROR::MESHLET_BUILDER: Index count must be a multiple of 3");
+    }
+    if (maxVertices < 3 || maxVertices > 255 || maxTriangles < 1 || maxTriangles > 255) {
+        throw std::runtime_error("ERROR::MESHLET_BUILDER: Invalid meshlet limits");
+    }
+    if (vertexStride < 3 * sizeof(float) || vertexStride % sizeof(float) != 0) {
+        throw std::runtime_error("ERROR::MESHLET_BUILDER: Invalid vertex stride");
+    }
+    for (size_t i = 0; i < indexCount; ++i) {
+        if (indices[i] >= vertexCount) {
+            throw std::runtime_error("ERROR::MESHLET_BUILDER: Index out of range");
+        }
+    }
+
+    size_t triangleCount = indexCount / 3;
+
+    //  ->  ڽӱ (CSR )
+    std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+    for (size_t i = 0; i < indexCount; ++i) {
+        adjacencyOffsets[indices[i] + 1]++;
+    }
+    for (size_t v = 0; v < vertexCount; ++v) {
+        adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+    }
+    std::vector<uint32_t> adjacency(indexCount);
+    {
+        std::vector<uint32_t> cursor(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+        for (size_t i = 0; i < indexCount; ++i) {
+            adjacency[cursor[indices[i]]++] = static_cast<uint32_t>(i / 3);
+        }
+    }
+
+    MeshletData data;
+    data.meshlets.reserve(triangleCount / maxTriangles + 1);
+    data.vertices.reserve(indexCount);
+    data.triangles.reserve(indexCount);
+
+    std::vector<bool> emitted(triangleCount, false);
+    std::vector<uint32_t> localIndex(vertexCount, kUnused);
+    std::vector<uint32_t> candidates;
+    size_t seedCursor = 0;
+
+    size_t floatsPerVertex = vertexStride / sizeof(float);
+    auto triangleCentroid = [&](uint32_t triangle, float* out) {
+        out[0] = out[1] = out[2] = 0.0f;
+        for (int k = 0; k < 3; ++k) {
+            const float* p = positions + size_t(indices[triangle * 3 + k]) * floatsPerVertex;
+            out[0] += p[0] / 3.0f;
+            out[1] += p[1] / 3.0f;
+            out[2] += p[2] / 3.0f;
+        }
+    };
+
+    while (true) {
+        // : ˳ҵһδ
+        while (seedCursor < triangleCount && emitted[seedCursor]) {
+            ++seedCursor;
+        }
+        if (seedCursor >= triangleCount) {
+            break;
+        }
+
+        Meshlet meshlet = {};
+        meshlet.vertexOffset = static_cast<uint32_t>(data.vertices.size());
+        meshlet.triangleOffset = static_cast<uint32_t>(data.triangles.size());
+        candidates.clear();
+        float centroidSum[3] = { 0.0f, 0.0f, 0.0f };
+
+        auto addTriangle = [&](uint32_t triangle) {
+            for (int k = 0; k < 3; ++k) {
+                uint32_t v = indices[triangle * 3 + k];
+                if (localIndex[v] == kUnused) {
+                    localIndex[v] = meshlet.vertexCount++;
+                    data.vertices.push_back(v);
+                    // ¶γΪѡ
+                    for (uint32_t j = adjacencyOffsets[v]; j < adjacencyOffsets[v + 1]; ++j) {
+                        if (!emitted[adjacency[j]]) {
+                            candidates.push_back(adjacency[j]);
+                        }
+                    }
+                }
+                data.triangles.push_back(static_cast<uint8_t>(localIndex[v]));
+            }
+            meshlet.triangleCount++;
+            emitted[triangle] = true;
+
+            float centroid[3];
+            triangleCentroid(triangle, centroid);
+            for (int k = 0; k < 3; ++k) {
+                centroidSum[k] += centroid[k];
+            }
+        };
+
+        addTriangle(static_cast<uint32_t>(seedCursor));
+
+        // ̰չ: ѡҪ¶ٵ, ͬʱȡ meshlet ,
+        //  meshlet ֽ (ΧС, ޳Ч); ҲͬʱȡС, ֤ȷ
+        while (meshlet.triangleCount < maxTriangles) {
+            uint32_t best = kUnused;
+            uint32_t bestNew = 4;
+            float bestDistance = 0.0f;
+            float center[3];
+            for (int k = 0; k < 3; ++k) {
+                center[k] = centroidSum[k] / meshlet.triangleCount;
+            }
+            size_t write = 0;
+            for (size_t c = 0; c < candidates.size(); ++c) {
+                uint32_t triangle = candidates[c];
+                if (emitted[triangle]) {
+                    continue;
+                }
+                candidates[write++] = triangle;
+
+                uint32_t newVertices = 0;
+                for (int k = 0; k < 3; ++k) {
+                    newVertices += localIndex[indices[triangle * 3 + k]] == kUnused ? 1 : 0;
+                }
+                if (meshlet.vertexCount + newVertices > maxVertices) {
+                    continue;
+                }
+                if (newVertices > bestNew) {
+                    continue;
+                }
+
+                float centroid[3];
+                triangleCentroid(triangle, centroid);
+                float dx = centroid[0] - center[0];
+                float dy = centroid[1] - center[1];
+                float dz = centroid[2] - center[2];
+                float distance = dx * dx + dy * dy + dz * dz;
+
+                if (newVertices < bestNew || distance < bestDistance ||
+                    (distance == bestDistance && triangle < best)) {
+                    bestNew = newVertices;
+                    bestDistance = distance;
+                    best = triangle;
+                }
+            }
+            candidates.resize(write);
+
+            // ڵ ( UV ӷ졢ӲߴϿ, Ͳͨ)  meshlet пռ:
+            // ֮δȡļ, ÿһϿļζᵥΪһС meshlet
+            if (best == kUnused) {
+                uint32_t examined = 0;
+                for (size_t t = seedCursor; t < triangleCount && t < seedCursor + kFillScanLimit && examined < kFillWindow; ++t) {
+                    if (emitted[t]) {
+                        continue;
+                    }
+                    ++examined;
+
+                    uint32_t triangle = static_cast<uint32_t>(t);
+                    uint32_t newVertices = 0;
+                    for (int k = 0; k < 3; ++k) {
+                        newVertices += localIndex[indices[triangle * 3 + k]] == kUnused ? 1 : 0;
+                    }
+                    if (meshlet.vertexCount + newVertices > maxVertices) {
+                        continue;
+                    }
+
+                    float centroid[3];
+                    triangleCentroid(triangle, centroid);
+                    float dx = centroid[0] - center[0];
+                    float dy = centroid[1] - center[1];
+                    float dz = centroid[2] - center[2];
+                    float distance = dx * dx + dy * dy + dz * dz;
+                    if (best == kUnused || distance < bestDistance) {
+                        bestDistance = distance;
+                        best = triangle;
+                    }
+                }
+            }
+
+            if (best == kUnused) {
+                break;
+            }
+            addTriangle(best);
+        }
+
+        // þֲ, ֻ meshlet õĶ
+        for (uint32_t i = 0; i < meshlet.vertexCount; ++i) {
+            localIndex[data.vertices[meshlet.vertexOffset + i]] = kUnused;
+        }
+        data.meshlets.push_back(meshlet);
+    }
+
+    data.bounds.reserve(data.meshlets.size());
+    for (const Meshlet& meshlet : data.meshlets) {
+        data.bounds.push_back(computeBounds(data, meshlet, positions, vertexStride));
+    }
+    return data;
+}
+
+MeshletBounds MeshletBuilder::computeBounds(const MeshletData& data, const Meshlet& meshlet,
+    const float* positions, size_t vertexStride) {
+    size_t floatsPerVertex = vertexStride / sizeof(float);
+    auto position = [&](uint32_t local) -> const float* {
+        return positions + size_t(data.vertices[meshlet.vertexOffset + local]) * floatsPerVertex;
+    };
+
+    MeshletBounds bounds = {};
+
+    // Χ: AABB  + Զ
+    float minCorner[3] = { position(0)[0], position(0)[1], position(0)[2] };
+    float maxCorner[3] = { minCorner[0], minCorner[1], minCorner[2] };
+    for (uint32_t i = 1; i < meshlet.vertexCount; ++i) {
+        const float* p = position(i);
+        for (int k = 0; k < 3; ++k) {
+            minCorner[k] = std::min(minCorner[k], p[k]);
+            maxCorner[k] = std::max(maxCorner[k], p[k]);
+        }
+    }
+    for (int k = 0; k < 3; ++k) {
+        bounds.center[k] = (minCorner[k] + maxCorner[k]) * 0.5f;
+    }
+    float radiusSq = 0.0f;
+    for (uint32_t i = 0; i < meshlet.vertexCount; ++i) {
+        const float* p = position(i);
+        float dx = p[0] - bounds.center[0];
+        float dy = p[1] - bounds.center[1];
+        float dz = p[2] - bounds.center[2];
+        radiusSq = std::max(radiusSq, dx * dx + dy * dy + dz * dz);
+    }
+    bounds.radius = std::sqrt(radiusSq);
+
+    // ׶: Ϊλ֮͵ķ, нķ߾
+    std::vector<float> normals(meshlet.triangleCount * 3, 0.0f);
+    float axis[3] = { 0.0f, 0.0f, 0.0f };
+    uint32_t validNormals = 0;
+    for (uint32_t t = 0; t < meshlet.triangleCount; ++t) {
+        const uint8_t* tri = &data.triangles[meshlet.triangleOffset + t * 3];
+        const float* p0 = position(tri[0]);
+        const float* p1 = position(tri[1]);
+        const float* p2 = position(tri[2]);
+        float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+        float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+        float n[3] = {
+            e1[1] * e2[2] - e1[2] * e2[1],
+            e1[2] * e2[0] - e1[0] * e2[2],
+            e1[0] * e2[1] - e1[1] * e2[0]
+        };
+        float length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        if (length <= 0.0f) {
+            continue;  // ˻β
+        }
+        for (int k = 0; k < 3; ++k) {
+            normals[validNormals * 3 + k] = n[k] / length;
+            axis[k] += n[k] / length;
+        }
+        ++validNormals;
+    }
+
+    float axisLength = std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+    float minDot = -1.0f;
+    if (validNormals > 0 && axisLength > 0.0f) {
+        for (int k = 0; k < 3; ++k) {
+            axis[k] /= axisLength;
+        }
+        minDot = 1.0f;
+        for (uint32_t i = 0; i < validNormals; ++i) {
+            const float* n = &normals[i * 3];
+            minDot = std::min(minDot, n[0] * axis[0] + n[1] * axis[1] + n[2] * axis[2]);
+        }
+    }
+
+    for (int k = 0; k < 3; ++k) {
+        bounds.coneAxis[k] = quantizeSnorm8(axis[k]);
+    }
+
+    // ׶ǽӽ򳬹 90 ʱ޷޳
+    if (minDot <= 0.1f) {
+        bounds.coneCutoff = 127;
+    }
+    else {
+        // cutoff = sin(). ȡ 2 λ, , ֤Ա
+        float cutoff = std::sqrt(1.0f - minDot * minDot);
+        int quantized = static_cast<int>(std::ceil(cutoff * 127.0f)) + 2;
+        bounds.coneCutoff = static_cast<int8_t>(std::min(quantized, 127));
+    }
+    return bounds;
+}
+
+// ===== ƶд =====
+void MeshletBuilder::save(const std::string& path, const MeshletData& data) {
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("ERROR::MESHLET_BUILDER: Failed to open file for writing: " + path);
+    }
+
+    MeshletFileHeader header;
+    header.magic = kMeshletMagic;
+    header.version = kMeshletVersion;
+    header.meshletCount = static_cast<uint32_t>(data.meshlets.size());
+    header.vertexCount = static_cast<uint32_t>(data.vertices.size());
+    header.triangleByteCount = static_cast<uint32_t>(data.triangles.size());
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    writeArray(file, data.meshlets);
+    writeArray(file, data.bounds);
+    writeArray(file, data.vertices);
+    writeArray(file, data.triangles);
+
+    if (!file) {
+        throw std::runtime_error("ERROR::MESHLET_BUILDER: Failed to write file: " + path);
+    }
+}
+
+MeshletData MeshletBuilder::load(const std::string& path) {
+    AssetData file;
+    try {
+        file = AssetFileSystem::getInstance().read(path);
+    }
+    catch (const std::exception&) {
+        throw std::runtime_error("ERROR::MESHLET_BUILDER: Failed to open file: " + path);
+    }
+    const uint8_t* cursor = file.data();
+    const uint8_t* end = file.data() + file.size();
+
+    MeshletFileHeader header;
+    if (file.size() < sizeof(header)) {
+        throw std::runtime_error("ERROR::MESHLET_BUILDER: Not a meshlet file: " + path);
+    }
+    std::memcpy(&header, cursor, sizeof(header));
+    cursor += sizeof(header);
+    if (header.magic != kMeshletMagic) {
+        throw std::runtime_error("ERROR::MESHLET_BUILDER: Not a meshlet file: " + path);
+    }
+    if (header.version != kMeshletVersion) {
+        throw std::runtime_error("ERROR::MESHLET_BUILDER: Unsupported meshlet file version: " + path);
+    }
+
+    MeshletData data;
+    bool complete = readArray(cursor, end, data.meshlets, header.meshletCount)
+        && readArray(cursor, end, data.bounds, header.meshletCount)
+        && readArray(cursor, end, data.vertices, header.vertexCount)
+        && readArray(cursor, end, data.triangles, header.triangleByteCount);
+    if (!complete) {
+        throw std::runtime_error("ERROR::MESHLET_BUILDER: Truncated meshlet file: " + path);
+    }
+    return data;
+}
@@ -0,0 +1,68 @@
+#ifndef MESHLET_BUILDER_H
+#define MESHLET_BUILDER_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// һ meshlet:  64  / 124 εС (12 ֽ)
+struct Meshlet {
+    uint32_t vertexOffset;    //  MeshletData::vertices еʼλ
+    uint32_t triangleOffset;  //  MeshletData::triangles еʼλ (ֽڼ, ÿ 3 ֽ)
+    uint8_t vertexCount;
+    uint8_t triangleCount;
+    uint16_t padding;
+};
+
+// meshlet ޳ (20 ֽ)
+// ׶: dot(center - camera, axis) >= cutoff * |center - camera| + radius * (1 + cutoff) ʱر
+struct MeshletBounds {
+    float center[3];
+    float radius;
+    int8_t coneAxis[3];  // ķ׶, /127 ԭ
+    int8_t coneCutoff;   //  sin(׶), /127 ԭ; 127 ʾ޳
+};
+
+// meshlet 
+struct MeshletData {
+    std::vector<Meshlet> meshlets;
+    std::vector<MeshletBounds> bounds;
+    std::vector<uint32_t> vertices;   // ֲ -> ԭʼ
+    std::vector<uint8_t> triangles;   // ֲ, ÿ 3 һ
+
+    //  meshlet ˳չΪͨ.  i  meshlet  firstIndex  meshlets[i].triangleOffset
+    std::vector<uint32_t> buildIndexBuffer() const;
+};
+
+// MeshletBuilder: ߰ѴзΪ meshlet, Χ뷨׶, дյĶļ
+class MeshletBuilder {
+public:
+    static constexpr uint32_t kMaxVertices = 64;
+    static constexpr uint32_t kMaxTriangles = 124;
+
+    /**
+     * @brief  meshlet. Ⱦ MeshOptimizer::optimizeVertexCache.
+     * ڵʱ (UV ӷ졢Ӳ߻ͨĲ) 븽, ֱ.
+     * @param positions λ (ÿǰ 3  float), Ϊ vertexStride ֽ.
+     * @param maxVertices ÿ meshlet 󶥵 ( 255).
+     * @param maxTriangles ÿ meshlet  ( 255).
+     */
+    static MeshletData build(const uint32_t* indices, size_t indexCount,
+        const float* positions, size_t vertexCount, size_t vertexStride,
+        uint32_t maxVertices = kMaxVertices, uint32_t maxTriangles = kMaxTriangles);
+
+    // Ϊļ (ͨһ, չ .meshlets). ʧʱ׳쳣
+    static void save(const std::string& path, const MeshletData& data);
+
+    // ȡļ. ʽ汾ʱ׳쳣
+    static MeshletData load(const std::string& path);
+
+private:
+    MeshletBuilder() = delete;
+
+    static MeshletBounds computeBounds(const MeshletData& data, const Meshlet& meshlet,
+        const float* positions, size_t vertexStride);
+};
+
+#endif // MESHLET_BUILDER_H
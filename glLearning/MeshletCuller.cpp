@@ -0,0 +1,208 @@
+#include "MeshletCuller.h"
+#include "Frustum.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define MESHLET_CULLER_SSE 1
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // жϵȱʱ (M^T * M  s^2 * I ֮ s^2)
+    const float kUniformScaleTolerance = 1e-3f;
+}
+
+MeshletCuller::MeshletCuller(const MeshletData& data)
+    : m_meshletCount(static_cast<uint32_t>(data.meshlets.size())) {
+    size_t padded = (m_meshletCount + 3) & ~size_t(3);
+    for (std::vector<float>* stream : { &m_centerX, &m_centerY, &m_centerZ, &m_radius,
+        &m_axisX, &m_axisY, &m_axisZ, &m_cutoff }) {
+        stream->assign(padded, 0.0f);
+    }
+    m_firstIndex.resize(m_meshletCount);
+    m_indexCount.resize(m_meshletCount);
+
+    for (uint32_t i = 0; i < m_meshletCount; ++i) {
+        const MeshletBounds& bounds = data.bounds[i];
+        m_centerX[i] = bounds.center[0];
+        m_centerY[i] = bounds.center[1];
+        m_centerZ[i] = bounds.center[2];
+        m_radius[i] = bounds.radius;
+        m_axisX[i] = bounds.coneAxis[0] / 127.0f;
+        m_axisY[i] = bounds.coneAxis[1] / 127.0f;
+        m_axisZ[i] = bounds.coneAxis[2] / 127.0f;
+        m_cutoff[i] = bounds.coneCutoff / 127.0f;
+
+        m_firstIndex[i] = data.meshlets[i].triangleOffset;
+        m_indexCount[i] = data.meshlets[i].triangleCount * 3u;
+    }
+}
+
+void MeshletCuller::emit(uint32_t meshlet, const MeshPool::MeshRange& mesh, uint32_t baseInstance,
+    std::vector<DrawElementsIndirectCommand>& out) const {
+    DrawElementsIndirectCommand command;
+    command.count = m_indexCount[meshlet];
+    command.instanceCount = 1;
+    command.firstIndex = mesh.firstIndex + m_firstIndex[meshlet];
+    command.baseVertex = mesh.baseVertex;
+    command.baseInstance = baseInstance;
+    out.push_back(command);
+}
+
+bool MeshletCuller::hasUniformScale(const glm::mat4& model) {
+    glm::vec3 columns[3] = { glm::vec3(model[0]), glm::vec3(model[1]), glm::vec3(model[2]) };
+    float scaleSq = (glm::dot(columns[0], columns[0]) + glm::dot(columns[1], columns[1])
+        + glm::dot(columns[2], columns[2])) / 3.0f;
+    if (!(scaleSq > 0.0f)) {
+        return false;
+    }
+
+    // гͬ
+    for (int a = 0; a < 3; ++a) {
+        for (int b = a; b < 3; ++b) {
+            float expected = a == b ? scaleSq : 0.0f;
+            if (std::fabs(glm::dot(columns[a], columns[b]) - expected) > kUniformScaleTolerance * scaleSq) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void MeshletCuller::cullScalar(uint32_t first, uint32_t last, const glm::vec4* planes, const glm::vec3& camera,
+    bool coneTest, uint32_t baseInstance, const MeshPool::MeshRange& mesh,
+    std::vector<DrawElementsIndirectCommand>& out, Stats& stats) const {
+    for (uint32_t i = first; i < last; ++i) {
+        glm::vec3 center(m_centerX[i], m_centerY[i], m_centerZ[i]);
+        float radius = m_radius[i];
+
+        bool inside = true;
+        for (int p = 0; p < Frustum::Count; ++p) {
+            if (glm::dot(glm::vec3(planes[p]), center) + planes[p].w < -radius) {
+                inside = false;
+                break;
+            }
+        }
+        if (!inside) {
+            ++stats.frustumCulled;
+            continue;
+        }
+
+        // cutoff Ϊ 1 ʱҲܴ, Ȼ޳
+        if (!coneTest) {
+            emit(i, mesh, baseInstance, out);
+            continue;
+        }
+        glm::vec3 toCenter = center - camera;
+        glm::vec3 axis(m_axisX[i], m_axisY[i], m_axisZ[i]);
+        float cutoff = m_cutoff[i];
+        if (glm::dot(toCenter, axis) >= cutoff * glm::length(toCenter) + radius * (1.0f + cutoff)) {
+            ++stats.backfaceCulled;
+            continue;
+        }
+
+        emit(i, mesh, baseInstance, out);
+    }
+}
+
+uint32_t MeshletCuller::cull(const glm::mat4& viewProjection, const glm::vec3& cameraPosition, const glm::mat4& model,
+    const MeshPool::MeshRange& mesh, uint32_t baseInstance,
+    std::vector<DrawElementsIndirectCommand>& out, Stats* stats) const {
+    // ׶ƽ任ֲռ
+    Frustum frustum = Frustum::fromMatrix(viewProjection * model);
+    glm::vec3 camera = glm::vec3(glm::inverse(model) * glm::vec4(cameraPosition, 1.0f));
+
+    // ǵȱ / бı䷨߷, ֲռķ׶ٿ, ֻ׶޳
+    bool coneTest = hasUniformScale(model);
+
+    Stats local;
+    local.total = m_meshletCount;
+    size_t outBegin = out.size();
+
+#ifdef MESHLET_CULLER_SSE
+    uint32_t simdCount = m_meshletCount & ~3u;
+
+    __m128 planeX[Frustum::Count], planeY[Frustum::Count], planeZ[Frustum::Count], planeW[Frustum::Count];
+    for (int p = 0; p < Frustum::Count; ++p) {
+        planeX[p] = _mm_set1_ps(frustum.planes[p].x);
+        planeY[p] = _mm_set1_ps(frustum.planes[p].y);
+        planeZ[p] = _mm_set1_ps(frustum.planes[p].z);
+        planeW[p] = _mm_set1_ps(frustum.planes[p].w);
+    }
+    const __m128 cameraX = _mm_set1_ps(camera.x);
+    const __m128 cameraY = _mm_set1_ps(camera.y);
+    const __m128 cameraZ = _mm_set1_ps(camera.z);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 coneMask = coneTest ? _mm_castsi128_ps(_mm_set1_epi32(-1)) : _mm_setzero_ps();
+
+    for (uint32_t i = 0; i < simdCount; i += 4) {
+        __m128 cx = _mm_loadu_ps(&m_centerX[i]);
+        __m128 cy = _mm_loadu_ps(&m_centerY[i]);
+        __m128 cz = _mm_loadu_ps(&m_centerZ[i]);
+        __m128 radius = _mm_loadu_ps(&m_radius[i]);
+        __m128 negRadius = _mm_sub_ps(_mm_setzero_ps(), radius);
+
+        // ׶: һƽ < -radius 
+        __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (int p = 0; p < Frustum::Count; ++p) {
+            __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(planeX[p], cx), _mm_mul_ps(planeY[p], cy)),
+                _mm_add_ps(_mm_mul_ps(planeZ[p], cz), planeW[p]));
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, negRadius));
+        }
+
+        // ׶: dot(d, axis) >= cutoff * |d| + radius * (1 + cutoff) ʱ
+        __m128 dx = _mm_sub_ps(cx, cameraX);
+        __m128 dy = _mm_sub_ps(cy, cameraY);
+        __m128 dz = _mm_sub_ps(cz, cameraZ);
+        __m128 cutoff = _mm_loadu_ps(&m_cutoff[i]);
+        __m128 projection = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, _mm_loadu_ps(&m_axisX[i])),
+            _mm_mul_ps(dy, _mm_loadu_ps(&m_axisY[i]))), _mm_mul_ps(dz, _mm_loadu_ps(&m_axisZ[i])));
+        __m128 distance = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)),
+            _mm_mul_ps(dz, dz)));
+        __m128 threshold = _mm_add_ps(_mm_mul_ps(cutoff, distance), _mm_mul_ps(radius, _mm_add_ps(one, cutoff)));
+        __m128 backface = _mm_and_ps(_mm_cmpge_ps(projection, threshold), coneMask);
+
+        int insideMask = _mm_movemask_ps(inside);
+        int visibleMask = _mm_movemask_ps(_mm_andnot_ps(backface, inside));
+        for (int lane = 0; lane < 4; ++lane) {
+            if (!(insideMask & (1 << lane))) {
+                ++local.frustumCulled;
+            }
+            else if (!(visibleMask & (1 << lane))) {
+                ++local.backfaceCulled;
+            }
+            else {
+                emit(i + lane, mesh, baseInstance, out);
+            }
+        }
+    }
+    cullScalar(simdCount, m_meshletCount, frustum.planes, camera, coneTest, baseInstance, mesh, out, local);
+#else
+    cullScalar(0, m_meshletCount, frustum.planes, camera, coneTest, baseInstance, mesh, out, local);
+#endif
+
+    local.visible = static_cast<uint32_t>(out.size() - outBegin);
+    if (stats) {
+        stats->total += local.total;
+        stats->frustumCulled += local.frustumCulled;
+        stats->backfaceCulled += local.backfaceCulled;
+        stats->visible += local.visible;
+    }
+    return local.visible;
+}
+
+// ===== ʹdemo =====
+// MeshletData meshlets = MeshletBuilder::build(indices.data(), indices.size(), vertices.data(),
+//     vertexCount, layout.getStride());
+// MeshletBuilder::save("../Model/bunny.meshlets", meshlets);
+// std::vector<uint32_t> meshletIndices = meshlets.buildIndexBuffer();
+// MeshPool::MeshRange range = pool.addMesh(vertices.data(), vertexCount,
+//     meshletIndices.data(), uint32_t(meshletIndices.size()));
+// MeshletCuller culler(meshlets);
+//
+// // ÿ֡
+// commands.clear();
+// culler.cull(projection * view, cameraPos, model, range, 0, commands);
+// renderer.submitCommands(0, { model, glm::vec4(1.0f) }, commands.data(), commands.size());
@@ -0,0 +1,61 @@
+#ifndef MESHLET_CULLER_H
+#define MESHLET_CULLER_H
+
+#include "MeshletBuilder.h"
+#include "MeshPool.h"
+#include "IndirectRenderer.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+// MeshletCuller:  CPU  meshlet ׶ + ׶޳, ӻ.
+// ޳ڹʱת SoA,  SSE һβ 4  meshlet ( x86 ƽ̨˵).
+// вԶֲռ,  meshlet 任޹, Աʵ.
+// ׶ֻڸȱֱӿ; model ǵȱŻбʱ޳, ֻ׶޳.
+// Ҫ MeshletData::buildIndexBuffer() ˳Ž MeshPool.
+class MeshletCuller {
+public:
+    struct Stats {
+        uint32_t total = 0;
+        uint32_t frustumCulled = 0;
+        uint32_t backfaceCulled = 0;
+        uint32_t visible = 0;
+    };
+
+    explicit MeshletCuller(const MeshletData& data);
+
+    /**
+     * @brief ޳һ meshlet, ѿɼ meshlet ׷ӵ out.
+     * @param mesh buildIndexBuffer() ɵϴ MeshPool õķΧ.
+     * @param baseInstance д baseInstance (IndirectRenderer::submitCommands Ḳ).
+     * @return ɼ meshlet .
+     */
+    uint32_t cull(const glm::mat4& viewProjection, const glm::vec3& cameraPosition, const glm::mat4& model,
+        const MeshPool::MeshRange& mesh, uint32_t baseInstance,
+        std::vector<DrawElementsIndirectCommand>& out, Stats* stats = nullptr) const;
+
+    uint32_t getMeshletCount() const { return m_meshletCount; }
+
+    // model  3x3 ǷΪת * ȱ (), ׶Ƿ
+    static bool hasUniformScale(const glm::mat4& model);
+
+private:
+    // ·:  [first, last) Χڵ meshlet (SIMD µβ x86 ƽ̨)
+    void cullScalar(uint32_t first, uint32_t last, const glm::vec4* planes, const glm::vec3& camera,
+        bool coneTest, uint32_t baseInstance, const MeshPool::MeshRange& mesh,
+        std::vector<DrawElementsIndirectCommand>& out, Stats& stats) const;
+
+    void emit(uint32_t meshlet, const MeshPool::MeshRange& mesh, uint32_t baseInstance,
+        std::vector<DrawElementsIndirectCommand>& out) const;
+
+    uint32_t m_meshletCount;
+
+    // SoA ޳, Ȳ뵽 4 ı
+    std::vector<float> m_centerX, m_centerY, m_centerZ, m_radius;
+    std::vector<float> m_axisX, m_axisY, m_axisZ, m_cutoff;
+
+    std::vector<uint32_t> m_firstIndex;
+    std::vector<uint32_t> m_indexCount;
+};
+
+#endif // MESHLET_CULLER_H
@@ -0,0 +1,178 @@
+#include "MeshletSelfTest.h"
+#include "MeshletBuilder.h"
+#include "MeshletCuller.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+    const uint32_t kLooseTriangleCount = 200;
+    const uint32_t kGridSize = 32;  // 32 x 32 , 2048 
+
+    struct TestMesh {
+        std::vector<float> positions;  // ÿ 3  float
+        std::vector<uint32_t> indices;
+    };
+
+    // ===== ̶Ĳ =====
+    // ÿζԼ 3 , ųһ
+    TestMesh makeLooseTriangles() {
+        TestMesh mesh;
+        for (uint32_t i = 0; i < kLooseTriangleCount; ++i) {
+            float x = static_cast<float>(i) * 2.0f;
+            float corners[9] = { x, 0.0f, 0.0f, x + 1.0f, 0.0f, 0.0f, x, 1.0f, 0.0f };
+            mesh.positions.insert(mesh.positions.end(), corners, corners + 9);
+            mesh.indices.insert(mesh.indices.end(), { i * 3, i * 3 + 1, i * 3 + 2 });
+        }
+        return mesh;
+    }
+
+    // ƽֱɫ: ÿ 4 Ķ (߲ͬ), ֮䲻
+    TestMesh makeFlatCube() {
+        TestMesh mesh;
+        for (int axis = 0; axis < 3; ++axis) {
+            for (int side = 0; side < 2; ++side) {
+                uint32_t base = static_cast<uint32_t>(mesh.positions.size() / 3);
+                for (int corner = 0; corner < 4; ++corner) {
+                    float p[3];
+                    p[axis] = side ? 1.0f : -1.0f;
+                    p[(axis + 1) % 3] = (corner & 1) ? 1.0f : -1.0f;
+                    p[(axis + 2) % 3] = (corner & 2) ? 1.0f : -1.0f;
+                    mesh.positions.insert(mesh.positions.end(), p, p + 3);
+                }
+                if (side) {
+                    mesh.indices.insert(mesh.indices.end(), { base, base + 1, base + 3, base, base + 3, base + 2 });
+                }
+                else {
+                    mesh.indices.insert(mesh.indices.end(), { base, base + 3, base + 1, base, base + 2, base + 3 });
+                }
+            }
+        }
+        return mesh;
+    }
+
+    TestMesh makeGrid() {
+        TestMesh mesh;
+        uint32_t side = kGridSize + 1;
+        for (uint32_t y = 0; y < side; ++y) {
+            for (uint32_t x = 0; x < side; ++x) {
+                mesh.positions.insert(mesh.positions.end(), { static_cast<float>(x), 0.0f, static_cast<float>(y) });
+            }
+        }
+        for (uint32_t y = 0; y < kGridSize; ++y) {
+            for (uint32_t x = 0; x < kGridSize; ++x) {
+                uint32_t a = y * side + x;
+                uint32_t b = a + 1;
+                uint32_t c = a + side;
+                uint32_t d = c + 1;
+                mesh.indices.insert(mesh.indices.end(), { a, c, b, b, c, d });
+            }
+        }
+        return mesh;
+    }
+
+    MeshletData buildMeshlets(const TestMesh& mesh) {
+        return MeshletBuilder::build(mesh.indices.data(), mesh.indices.size(),
+            mesh.positions.data(), mesh.positions.size() / 3, 3 * sizeof(float));
+    }
+
+    // ===== ṹ =====
+    // ÿתСǰ (ı) , ֱӱȽ
+    std::vector<std::array<uint32_t, 3>> sortedTriangles(const std::vector<uint32_t>& indices) {
+        std::vector<std::array<uint32_t, 3>> triangles;
+        for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+            size_t first = std::min_element(indices.begin() + i, indices.begin() + i + 3) - (indices.begin() + i);
+            triangles.push_back({ indices[i + first], indices[i + (first + 1) % 3], indices[i + (first + 2) % 3] });
+        }
+        std::sort(triangles.begin(), triangles.end());
+        return triangles;
+    }
+
+    bool withinLimits(const MeshletData& data) {
+        for (const Meshlet& meshlet : data.meshlets) {
+            if (meshlet.vertexCount > MeshletBuilder::kMaxVertices || meshlet.triangleCount > MeshletBuilder::kMaxTriangles) {
+                return false;
+            }
+            for (uint32_t i = 0; i < meshlet.triangleCount * 3u; ++i) {
+                if (data.triangles[meshlet.triangleOffset + i] >= meshlet.vertexCount) {
+                    return false;
+                }
+            }
+        }
+        return data.bounds.size() == data.meshlets.size();
+    }
+
+    bool sameTriangles(const TestMesh& mesh, const MeshletData& data) {
+        return sortedTriangles(data.buildIndexBuffer()) == sortedTriangles(mesh.indices);
+    }
+
+    // ·ϵ ( +Y), ر޳ meshlet 
+    uint32_t countBackfaceCulled(const MeshletData& data, const glm::mat4& model) {
+        glm::vec3 camera(16.0f, -20.0f, 16.0f);
+        glm::mat4 viewProjection = glm::perspective(glm::radians(90.0f), 1.0f, 0.1f, 100.0f)
+            * glm::lookAt(camera, glm::vec3(16.0f, 0.0f, 16.0f), glm::vec3(0.0f, 0.0f, 1.0f));
+        MeshletCuller culler(data);
+        std::vector<DrawElementsIndirectCommand> commands;
+        MeshletCuller::Stats stats;
+        culler.cull(viewProjection, camera, model, MeshPool::MeshRange(), 0, commands, &stats);
+        return stats.backfaceCulled;
+    }
+
+    bool check(bool condition, const std::string& name, bool print) {
+        if (print) {
+            std::cout << (condition ? "  PASS  " : "  FAIL  ") << name << std::endl;
+        }
+        return condition;
+    }
+}
+
+bool runMeshletSelfTest(bool print) {
+    TestMesh loose = makeLooseTriangles();
+    TestMesh cube = makeFlatCube();
+    TestMesh grid = makeGrid();
+    MeshletData looseMeshlets = buildMeshlets(loose);
+    MeshletData cubeMeshlets = buildMeshlets(cube);
+    MeshletData gridMeshlets = buildMeshlets(grid);
+    MeshletData gridAgain = buildMeshlets(grid);
+
+    // ʱÿҪ 3 ¶, һ meshlet  64 / 3 = 21 
+    uint32_t trianglesPerLooseMeshlet = MeshletBuilder::kMaxVertices / 3;
+    size_t looseExpected = (kLooseTriangleCount + trianglesPerLooseMeshlet - 1) / trianglesPerLooseMeshlet;
+
+    // ȱ (ת) ޳, ǵȱʱ
+    glm::mat4 uniform = glm::scale(glm::rotate(glm::mat4(1.0f), 0.3f, glm::vec3(0.0f, 1.0f, 0.0f)), glm::vec3(1.5f));
+    glm::mat4 nonUniform = glm::scale(glm::mat4(1.0f), glm::vec3(1.0f, 4.0f, 0.5f));
+    uint32_t culledIdentity = countBackfaceCulled(gridMeshlets, glm::mat4(1.0f));
+    uint32_t culledUniform = countBackfaceCulled(gridMeshlets, uniform);
+    uint32_t culledNonUniform = countBackfaceCulled(gridMeshlets, nonUniform);
+
+    if (print) {
+        std::cout << "===== Meshlet self-test =====" << std::endl;
+        std::cout << "  loose triangles " << kLooseTriangleCount << " -> " << looseMeshlets.meshlets.size()
+                  << " meshlets, flat cube -> " << cubeMeshlets.meshlets.size()
+                  << ", grid " << grid.indices.size() / 3 << " triangles -> " << gridMeshlets.meshlets.size() << std::endl;
+        std::cout << "  grid seen from behind: backface culled " << culledIdentity << " (identity), " << culledUniform
+                  << " (uniform scale), " << culledNonUniform << " (non-uniform scale)" << std::endl;
+    }
+
+    bool passed = true;
+    passed &= check(looseMeshlets.meshlets.size() == looseExpected, "unshared triangles fill meshlets to the vertex limit", print);
+    passed &= check(cubeMeshlets.meshlets.size() == 1, "flat-shaded cube is a single meshlet", print);
+    passed &= check(withinLimits(looseMeshlets) && withinLimits(cubeMeshlets) && withinLimits(gridMeshlets),
+        "meshlets within vertex / triangle limits", print);
+    passed &= check(sameTriangles(loose, looseMeshlets) && sameTriangles(cube, cubeMeshlets) && sameTriangles(grid, gridMeshlets),
+        "same triangles (indices and winding)", print);
+    passed &= check(gridMeshlets.vertices == gridAgain.vertices && gridMeshlets.triangles == gridAgain.triangles,
+        "repeated runs identical", print);
+    passed &= check(culledIdentity > 0 && culledUniform > 0, "cone test culls back-facing meshlets under uniform scale", print);
+    passed &= check(culledNonUniform == 0, "cone test skipped under non-uniform scale", print);
+
+    if (print) {
+        std::cout << (passed ? "All checks passed" : "Some checks FAILED") << std::endl;
+    }
+    return passed;
+}
@@ -0,0 +1,13 @@
+#ifndef MESHLET_SELF_TEST_H
+#define MESHLET_SELF_TEST_H
+
+// MeshletBuilder / MeshletCuller Լ (ֻ CPU, Ҫ GL ): Լ̶ build, 
+//   -  (200 ) Ͱ𿪶 (24 ) Ҳ meshlet, ÿ鼸һ
+//   - ͨÿ meshlet  / , ֲЧ
+//   - չͬһ ()
+//   - ͬظеõȫͬĽ
+//   - MeshletCuller ڵȱ׶޳, ǵȱʱ
+// ӡÿһĽ (main  --test-meshlets ), ȫͨʱ true
+bool runMeshletSelfTest(bool print = true);
+
+#endif // MESHLET_SELF_TEST_H
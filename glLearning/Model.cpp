@@ -0,0 +1,49 @@
+#include "Model.h"
+
+Model::Model(const std::string& meshPath) {
+    MeshFile mesh(meshPath);
+
+    // ӳҳϴʱű, ϴ MeshFile ӳ
+    init(mesh, std::make_unique<VertexBuffer>(mesh.getVertexData(), mesh.getVertexDataSize()),
+        std::make_unique<IndexBuffer>(mesh.getIndices(), mesh.getIndexCount()));
+}
+
+Model::Model(const MeshFile& mesh, std::unique_ptr<VertexBuffer> vbo, std::unique_ptr<IndexBuffer> ibo) {
+    init(mesh, std::move(vbo), std::move(ibo));
+}
+
+void Model::init(const MeshFile& mesh, std::unique_ptr<VertexBuffer> vbo, std::unique_ptr<IndexBuffer> ibo) {
+    m_layout = mesh.getLayout();
+    m_vbo = std::move(vbo);
+    m_ibo = std::move(ibo);
+    m_vao = std::make_unique<VertexArray>();
+    m_vao->addBuffer(*m_vbo, m_layout);
+    m_vao->setIndexBuffer(*m_ibo);
+    m_vao->unbind();
+
+    m_submeshes.assign(mesh.getSubmeshes(), mesh.getSubmeshes() + mesh.getSubmeshCount());
+    m_materials.assign(mesh.getMaterials(), mesh.getMaterials() + mesh.getMaterialCount());
+    m_boundsMin = mesh.getBoundsMin();
+    m_boundsMax = mesh.getBoundsMax();
+}
+
+RenderQueue::DrawItem Model::makeDrawItem(uint32_t submesh, const Material* material) const {
+    const MeshFile::Submesh& range = m_submeshes.at(submesh);
+    RenderQueue::DrawItem item;
+    item.material = material;
+    item.vertexArray = m_vao->getID();
+    item.indexCount = range.indexCount;
+    item.firstIndex = range.firstIndex;
+    item.baseVertex = range.baseVertex;
+    return item;
+}
+
+// ===== ʹdemo =====
+// Model backpack("../model/backpack.mesh");  // mmap + ֱϴ, ûн
+//
+// std::vector<const Material*> materials;  //  getMaterials()[i].diffuseTexture 
+// for (uint32_t i = 0; i < backpack.getSubmeshes().size(); ++i) {
+//     RenderQueue::DrawItem item = backpack.makeDrawItem(i, materials[backpack.getSubmeshes()[i].materialIndex]);
+//     item.model = &modelMatrix;
+//     renderQueue.submit(item);
+// }
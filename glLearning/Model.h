@@ -0,0 +1,58 @@
+#ifndef MODEL_H
+#define MODEL_H
+
+#include "MeshFile.h"
+#include "RenderQueue.h"
+#include "VertexArray.h"
+#include "VertexBuffer.h"
+#include "IndexBuffer.h"
+#include <glm/glm.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Model:  .mesh ļ GPU  (ֻ GL ߳ϴʹ)
+// ʱӳļ, ӳֱָӽ VBO / IBO ϴ, ֮ӳ; ֻСͲ.
+class Model {
+public:
+    /**
+     * @brief ӳ meshPath ϴ.
+     * @throws std::runtime_error ļЧʱ׳ ( MeshFile)
+     */
+    explicit Model(const std::string& meshPath);
+
+    /**
+     * @brief ʹѾдݵĻ崴 (ModelStreamer ֡ϴɺ), mesh ֻṩ֡ͰΧ.
+     */
+    Model(const MeshFile& mesh, std::unique_ptr<VertexBuffer> vbo, std::unique_ptr<IndexBuffer> ibo);
+
+    // ֹ
+    Model(const Model&) = delete;
+    Model& operator=(const Model&) = delete;
+
+    const VertexArray& getVertexArray() const { return *m_vao; }
+    const VertexBufferLayout& getLayout() const { return m_layout; }
+
+    const std::vector<MeshFile::Submesh>& getSubmeshes() const { return m_submeshes; }
+    const std::vector<MeshFile::MaterialRef>& getMaterials() const { return m_materials; }
+
+    glm::vec3 getBoundsMin() const { return m_boundsMin; }
+    glm::vec3 getBoundsMax() const { return m_boundsMax; }
+
+    // ӦĻ, ֶ (model / depth / layer ...) ɵ÷д
+    RenderQueue::DrawItem makeDrawItem(uint32_t submesh, const Material* material) const;
+
+private:
+    void init(const MeshFile& mesh, std::unique_ptr<VertexBuffer> vbo, std::unique_ptr<IndexBuffer> ibo);
+
+    VertexBufferLayout m_layout;
+    std::unique_ptr<VertexBuffer> m_vbo;
+    std::unique_ptr<IndexBuffer> m_ibo;
+    std::unique_ptr<VertexArray> m_vao;
+    std::vector<MeshFile::Submesh> m_submeshes;
+    std::vector<MeshFile::MaterialRef> m_materials;
+    glm::vec3 m_boundsMin;
+    glm::vec3 m_boundsMax;
+};
+
+#endif // MODEL_H
@@ -0,0 +1,297 @@
+#include "ModelStreamer.h"
+#include "AssetFileSystem.h"
+#include "GLStateCache.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace {
+    const size_t kPageSize = 4096;
+
+    // ҳһֽ, ȱҳ IO ߳, ϴʱҳѾڴ
+    void prefetchPages(const AssetData& data) {
+        volatile uint8_t sink = 0;
+        for (size_t offset = 0; offset < data.size(); offset += kPageSize) {
+            sink = sink + data.data()[offset];
+        }
+    }
+}
+
+// =====  =====
+ModelStreamer::ModelStreamer(JobSystem& jobs)
+    : ModelStreamer(jobs, Settings()) {
+}
+
+ModelStreamer::ModelStreamer(JobSystem& jobs, const Settings& settings)
+    : m_jobs(jobs), m_settings(settings) {
+    m_ioThread = std::thread(&ModelStreamer::ioThreadMain, this);
+}
+
+ModelStreamer::~ModelStreamer() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+        for (auto& entry : m_requests) {
+            entry.second->cancelled.store(true, std::memory_order_relaxed);
+        }
+    }
+    m_ioCondition.notify_all();
+    if (m_ioThread.joinable()) {
+        m_ioThread.join();
+    }
+    // ύĽ
+    m_jobs.wait(m_processJobs);
+}
+
+// ===== ߳ =====
+ModelStreamer::Handle ModelStreamer::load(const std::string& path, float priority) {
+    auto request = std::make_shared<Request>();
+    request->path = path;
+    request->priority.store(priority, std::memory_order_relaxed);
+
+    Handle handle;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        handle = m_nextHandle++;
+        if (m_nextHandle == kInvalidHandle) {
+            m_nextHandle = 1;
+        }
+        request->handle = handle;
+        m_requests[handle] = request;
+        m_ioQueue.push_back(std::move(request));
+    }
+    m_ioCondition.notify_one();
+    return handle;
+}
+
+void ModelStreamer::setPriority(Handle handle, float priority) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_requests.find(handle);
+    if (it != m_requests.end()) {
+        it->second->priority.store(priority, std::memory_order_relaxed);
+    }
+}
+
+void ModelStreamer::release(Handle handle) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_requests.find(handle);
+    if (it == m_requests.end()) {
+        return;
+    }
+    RequestPtr request = std::move(it->second);
+    m_requests.erase(it);
+
+    // ׶ο cancelled , GPU Դֻ GL ߳ͷ
+    request->cancelled.store(true, std::memory_order_relaxed);
+    m_ioQueue.erase(std::remove(m_ioQueue.begin(), m_ioQueue.end(), request), m_ioQueue.end());
+    m_released.push_back(std::move(request));
+}
+
+ModelStreamer::State ModelStreamer::getState(Handle handle) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_requests.find(handle);
+    return it != m_requests.end() ? it->second->state.load(std::memory_order_acquire) : State::Failed;
+}
+
+const Model* ModelStreamer::getModel(Handle handle) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_requests.find(handle);
+    if (it == m_requests.end() || it->second->state.load(std::memory_order_acquire) != State::Ready) {
+        return nullptr;
+    }
+    return it->second->model.get();
+}
+
+// ===== IO ߳ =====
+void ModelStreamer::ioThreadMain() {
+    for (;;) {
+        RequestPtr request;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_ioCondition.wait(lock, [this]() { return m_stopping || !m_ioQueue.empty(); });
+            if (m_stopping) {
+                return;
+            }
+            // ȼʱܱ仯, ÿȡʱٱȽ
+            auto best = std::min_element(m_ioQueue.begin(), m_ioQueue.end(), [](const RequestPtr& a, const RequestPtr& b) {
+                return a->priority.load(std::memory_order_relaxed) < b->priority.load(std::memory_order_relaxed);
+            });
+            request = std::move(*best);
+            m_ioQueue.erase(best);
+        }
+
+        if (request->cancelled.load(std::memory_order_relaxed)) {
+            continue;
+        }
+        request->state.store(State::Reading, std::memory_order_release);
+        try {
+            AssetData data = AssetFileSystem::getInstance().read(request->path);
+            if (data.isMapped()) {
+                prefetchPages(data);
+            }
+            request->data = std::move(data);
+        }
+        catch (const std::exception& e) {
+            fail(request, e.what());
+            continue;
+        }
+
+        request->state.store(State::Processing, std::memory_order_release);
+        m_jobs.schedule([this, request]() { process(request); }, &m_processJobs);
+    }
+}
+
+// ===== ߳ =====
+void ModelStreamer::process(const RequestPtr& request) {
+    if (request->cancelled.load(std::memory_order_relaxed)) {
+        request->data = AssetData();
+        return;
+    }
+    try {
+        request->mesh = std::make_unique<MeshFile>(request->path, std::move(request->data));
+    }
+    catch (const std::exception& e) {
+        fail(request, e.what());
+        return;
+    }
+
+    request->state.store(State::Uploading, std::memory_order_release);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_uploadQueue.push_back(request);
+}
+
+void ModelStreamer::fail(const RequestPtr& request, const std::string& error) {
+    request->state.store(State::Failed, std::memory_order_release);
+    std::cerr << "ERROR::MODEL_STREAMER: Failed to load '" << request->path << "': " << error << std::endl;
+}
+
+// ===== GL ߳ =====
+void ModelStreamer::update() {
+    m_frameStats = FrameStats();
+
+    std::vector<RequestPtr> released;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_uploading.insert(m_uploading.end(), m_uploadQueue.begin(), m_uploadQueue.end());
+        m_uploadQueue.clear();
+        released.swap(m_released);
+    }
+    // ȡﶪ, ģ GL ߳
+    m_uploading.erase(std::remove_if(m_uploading.begin(), m_uploading.end(), [](const RequestPtr& request) {
+        return request->cancelled.load(std::memory_order_relaxed);
+    }), m_uploading.end());
+    released.clear();
+
+    std::stable_sort(m_uploading.begin(), m_uploading.end(), [](const RequestPtr& a, const RequestPtr& b) {
+        return a->priority.load(std::memory_order_relaxed) < b->priority.load(std::memory_order_relaxed);
+    });
+
+    // Ȱѱ֡зֿдݴ滺, ӳͳһƵĿ껺
+    struct Copy {
+        Request* request;
+        GLuint buffer;
+        size_t stagingOffset;
+        size_t offset;
+        size_t size;
+    };
+    std::vector<Copy> copies;
+    uint8_t* staging = nullptr;
+    size_t stagingUsed = 0;
+    GLStateCache& state = GLStateCache::getInstance();
+
+    for (const RequestPtr& request : m_uploading) {
+        if (stagingUsed >= m_settings.uploadBudget) {
+            break;
+        }
+        const MeshFile& mesh = *request->mesh;
+        size_t vertexBytes = mesh.getVertexDataSize();
+        size_t totalBytes = vertexBytes + size_t(mesh.getIndexCount()) * sizeof(uint32_t);
+        if (!request->vbo) {
+            request->vbo = std::make_unique<VertexBuffer>(nullptr, mesh.getVertexDataSize());
+            request->ibo = std::make_unique<IndexBuffer>(nullptr, mesh.getIndexCount());
+        }
+
+        while (request->uploadedBytes < totalBytes && stagingUsed < m_settings.uploadBudget) {
+            bool vertices = request->uploadedBytes < vertexBytes;
+            size_t offset = vertices ? request->uploadedBytes : request->uploadedBytes - vertexBytes;
+            size_t regionSize = vertices ? vertexBytes : totalBytes - vertexBytes;
+            size_t size = std::min(regionSize - offset, m_settings.uploadBudget - stagingUsed);
+            const uint8_t* source = vertices
+                ? static_cast<const uint8_t*>(mesh.getVertexData()) + offset
+                : reinterpret_cast<const uint8_t*>(mesh.getIndices()) + offset;
+
+            if (!staging) {
+                if (!m_staging) {
+                    m_staging = std::make_unique<GpuBuffer>(GL_COPY_READ_BUFFER, nullptr, m_settings.uploadBudget, GL_STREAM_DRAW);
+                }
+                // INVALIDATE һ´洢, õһ֡ĸ
+                state.bindBuffer(GL_COPY_READ_BUFFER, m_staging->getID());
+                staging = static_cast<uint8_t*>(glMapBufferRange(GL_COPY_READ_BUFFER, 0, m_settings.uploadBudget,
+                    GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT));
+                if (!staging) {
+                    std::cerr << "ERROR::MODEL_STREAMER: Failed to map staging buffer" << std::endl;
+                    return;
+                }
+            }
+            std::memcpy(staging + stagingUsed, source, size);
+            copies.push_back({ request.get(), vertices ? request->vbo->getID() : request->ibo->getID(), stagingUsed, offset, size });
+            stagingUsed += size;
+            request->uploadedBytes += size;
+        }
+    }
+
+    if (staging) {
+        state.bindBuffer(GL_COPY_READ_BUFFER, m_staging->getID());
+        if (glUnmapBuffer(GL_COPY_READ_BUFFER) == GL_TRUE) {
+            for (const Copy& copy : copies) {
+                state.bindBuffer(GL_COPY_WRITE_BUFFER, copy.buffer);
+                glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+                    static_cast<GLintptr>(copy.stagingOffset), static_cast<GLintptr>(copy.offset), static_cast<GLsizeiptr>(copy.size));
+            }
+            m_frameStats.uploadedBytes = stagingUsed;
+        }
+        else {
+            // ӳڼ洢ݶʧ (ʾģʽл), һ֡شЩֿ
+            std::cerr << "WARNING::MODEL_STREAMER: Staging buffer contents lost, retrying" << std::endl;
+            for (const Copy& copy : copies) {
+                copy.request->uploadedBytes -= copy.size;
+            }
+        }
+    }
+
+    // ģ
+    for (auto it = m_uploading.begin(); it != m_uploading.end();) {
+        Request& request = **it;
+        const MeshFile& mesh = *request.mesh;
+        size_t totalBytes = mesh.getVertexDataSize() + size_t(mesh.getIndexCount()) * sizeof(uint32_t);
+        if (!request.vbo || request.uploadedBytes < totalBytes) {
+            ++it;
+            continue;
+        }
+        request.model = std::make_unique<Model>(mesh, std::move(request.vbo), std::move(request.ibo));
+        request.mesh.reset();  // ӳ
+        request.state.store(State::Ready, std::memory_order_release);
+        ++m_frameStats.completed;
+        it = m_uploading.erase(it);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& entry : m_requests) {
+        State requestState = entry.second->state.load(std::memory_order_relaxed);
+        if (requestState != State::Ready && requestState != State::Failed) {
+            ++m_frameStats.pending;
+        }
+    }
+}
+
+// ===== ʹdemo =====
+// ModelStreamer streamer(jobs);  // GL ߳ϴ
+// ModelStreamer::Handle rock = streamer.load("../model/rock.mesh", glm::distance(cameraPos, rockPos));
+//
+// // ÿ֡:
+// streamer.setPriority(rock, glm::distance(cameraPos, rockPos));
+// streamer.update();  // ϴ uploadBudget ֽ
+// if (const Model* model = streamer.getModel(rock))
+//     renderQueue.submit(model->makeDrawItem(0, rockMaterial));
+//
+// streamer.release(rock);  // 뿪: ڼȡ, Ѽһ֡ͷ
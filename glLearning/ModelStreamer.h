@@ -0,0 +1,122 @@
+#ifndef MODEL_STREAMER_H
+#define MODEL_STREAMER_H
+
+#include "GpuBuffer.h"
+#include "JobSystem.h"
+#include "MeshFile.h"
+#include "Model.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// ModelStreamer: 첽 .mesh, ع̲Ⱦ߳.
+//   1. IO ߳     ȼȡ, ͨ AssetFileSystem ӳļԤҳ (ȱҳ IO ߳)
+//   2. ߳     JobSystem ϽУ MeshFile
+//   3. GL ߳     update() аȼݴ滺ֿϴ, ÿ֡ uploadBudget ֽ, 󴴽 Model
+// ȼֵԽСԽȼ (ͨľ), ʱ޸; κν׶ζ release() ȡ.
+// load / setPriority / release / getState ̵߳, update / getModel ֻ GL ߳.
+class ModelStreamer {
+public:
+    using Handle = uint32_t;
+    static constexpr Handle kInvalidHandle = 0;
+
+    enum class State {
+        Queued,      // ȴ IO ߳
+        Reading,
+        Processing,  // ߳̽
+        Uploading,   // ȴڷ֡ϴ
+        Ready,
+        Failed,
+    };
+
+    struct Settings {
+        size_t uploadBudget = 4 * 1024 * 1024;  // ÿ֡ϴֽ, Ҳݴ滺ĴС
+    };
+
+    struct FrameStats {
+        size_t uploadedBytes = 0;
+        uint32_t completed = 0;  // ֡ɵģ
+        uint32_t pending = 0;    // ûɵ (н׶)
+    };
+
+    explicit ModelStreamer(JobSystem& jobs);
+    ModelStreamer(JobSystem& jobs, const Settings& settings);
+
+    // ֹͣ IO ̲߳ȴ߳ϵ, ͷģ (GL ߳)
+    ~ModelStreamer();
+
+    // ֹ
+    ModelStreamer(const ModelStreamer&) = delete;
+    ModelStreamer& operator=(const ModelStreamer&) = delete;
+
+    // . ͬһ·ظõͬľ, Զ
+    Handle load(const std::string& path, float priority);
+
+    void setPriority(Handle handle, float priority);
+
+    // ȡж. ģ͵ GPU Դһ update() ͷ
+    void release(Handle handle);
+
+    // Ч ( release) ʱ Failed
+    State getState(Handle handle) const;
+
+    // Ready ֮ǰ nullptr. ָ release ֮һ update() ֮ǰһֱЧ
+    const Model* getModel(Handle handle) const;
+
+    // ÿ֡ڻ֮ǰһ (GL ߳)
+    void update();
+
+    const FrameStats& getFrameStats() const { return m_frameStats; }
+
+private:
+    struct Request {
+        Handle handle = kInvalidHandle;
+        std::string path;
+        std::atomic<float> priority{ 0.0f };
+        std::atomic<State> state{ State::Queued };
+        std::atomic<bool> cancelled{ false };
+
+        AssetData data;                  // IO ߳ -> ߳
+        std::unique_ptr<MeshFile> mesh;  // ߳ -> GL ߳
+
+        // ֻ GL ߳Ϸ
+        std::unique_ptr<VertexBuffer> vbo;
+        std::unique_ptr<IndexBuffer> ibo;
+        size_t uploadedBytes = 0;
+        std::unique_ptr<Model> model;
+    };
+    using RequestPtr = std::shared_ptr<Request>;
+
+    void ioThreadMain();
+    void process(const RequestPtr& request);
+    void fail(const RequestPtr& request, const std::string& error);
+
+    JobSystem& m_jobs;
+    Settings m_settings;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_ioCondition;
+    std::unordered_map<Handle, RequestPtr> m_requests;
+    std::vector<RequestPtr> m_ioQueue;
+    std::vector<RequestPtr> m_uploadQueue;   // ߳ɽ, update() ʱȡ
+    std::vector<RequestPtr> m_released;      //  GL ߳ͷŵ
+    Handle m_nextHandle = 1;
+    bool m_stopping = false;
+
+    std::thread m_ioThread;
+    JobCounter m_processJobs;
+
+    // GL ߳
+    std::vector<RequestPtr> m_uploading;
+    std::unique_ptr<GpuBuffer> m_staging;
+    FrameStats m_frameStats;
+};
+
+#endif // MODEL_STREAMER_H
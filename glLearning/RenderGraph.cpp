@@ -0,0 +1,458 @@
+#include "RenderGraph.h"
+#include "GLStateCache.h"
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <sstream>
+#include <stdexcept>
+
+// ===== PassBuilder =====
+RenderGraph::Handle RenderGraph::PassBuilder::create(const std::string& name, const TextureDesc& desc) {
+    if (desc.width <= 0 || desc.height <= 0) {
+        throw std::runtime_error("ERROR::RENDER_GRAPH: Invalid size for transient target '" + name + "'");
+    }
+    Framebuffer::getBytesPerPixel(desc.internalFormat);  // ֵ֧ĸʽʱͱ
+
+    Resource resource;
+    resource.name = name;
+    resource.desc = desc;
+    m_graph.m_resources.push_back(resource);
+    return m_graph.addNode(static_cast<uint32_t>(m_graph.m_resources.size() - 1), 0, -1);
+}
+
+RenderGraph::Handle RenderGraph::PassBuilder::read(Handle handle) {
+    m_graph.getNode(handle);
+    m_graph.m_passes[m_pass].reads.push_back(handle);
+    m_graph.m_nodes[handle].readers.push_back(m_pass);
+    return handle;
+}
+
+RenderGraph::Handle RenderGraph::PassBuilder::writeColor(Handle handle, uint32_t index) {
+    const Resource& resource = m_graph.m_resources[m_graph.getNode(handle).resource];
+    if (index >= Framebuffer::kMaxColorAttachments) {
+        throw std::runtime_error("ERROR::RENDER_GRAPH: Color attachment index out of range");
+    }
+    if (!resource.backbuffer && Framebuffer::isDepthFormat(resource.desc.internalFormat)) {
+        throw std::runtime_error("ERROR::RENDER_GRAPH: '" + resource.name + "' is a depth target, use writeDepth");
+    }
+    return write(handle, GL_COLOR_ATTACHMENT0 + index);
+}
+
+RenderGraph::Handle RenderGraph::PassBuilder::writeDepth(Handle handle) {
+    const Resource& resource = m_graph.m_resources[m_graph.getNode(handle).resource];
+    if (resource.backbuffer || !Framebuffer::isDepthFormat(resource.desc.internalFormat)) {
+        throw std::runtime_error("ERROR::RENDER_GRAPH: '" + resource.name + "' is not a depth target");
+    }
+    return write(handle, Framebuffer::getAttachmentPoint(resource.desc.internalFormat));
+}
+
+void RenderGraph::PassBuilder::setSideEffect() {
+    m_graph.m_passes[m_pass].sideEffect = true;
+}
+
+RenderGraph::Handle RenderGraph::PassBuilder::write(Handle handle, GLenum attachment) {
+    const Node& node = m_graph.getNode(handle);
+    if (node.nextWriter >= 0) {
+        throw std::runtime_error("ERROR::RENDER_GRAPH: '" + m_graph.m_resources[node.resource].name
+            + "' version already written, write the latest handle instead");
+    }
+    uint32_t resource = node.resource;
+    uint32_t version = node.version;
+    m_graph.m_nodes[handle].nextWriter = static_cast<int>(m_pass);
+
+    // addNode ʹ node ʧЧ, ֻ֮±
+    Handle written = m_graph.addNode(resource, version + 1, static_cast<int>(m_pass));
+    Pass& pass = m_graph.m_passes[m_pass];
+    pass.writes.push_back(handle);
+    pass.attachments.push_back({ attachment, written });
+    return written;
+}
+
+// ===== PassResources =====
+Texture& RenderGraph::PassResources::getTexture(Handle handle) const {
+    const Resource& resource = m_graph.m_resources[m_graph.getNode(handle).resource];
+    if (resource.imported && !resource.backbuffer) {
+        return *resource.external;
+    }
+    RenderTarget* target = m_graph.getPhysicalTarget(resource);
+    if (!target || !target->getTexture()) {
+        throw std::runtime_error("ERROR::RENDER_GRAPH: '" + resource.name + "' has no texture");
+    }
+    return *target->getTexture();
+}
+
+RenderTarget& RenderGraph::PassResources::getTarget(Handle handle) const {
+    const Resource& resource = m_graph.m_resources[m_graph.getNode(handle).resource];
+    RenderTarget* target = m_graph.getPhysicalTarget(resource);
+    if (!target) {
+        throw std::runtime_error("ERROR::RENDER_GRAPH: '" + resource.name + "' is not a pooled target");
+    }
+    return *target;
+}
+
+const RenderGraph::TextureDesc& RenderGraph::PassResources::getDesc(Handle handle) const {
+    return m_graph.m_resources[m_graph.getNode(handle).resource].desc;
+}
+
+// =====  =====
+RenderGraph::~RenderGraph() {
+    releaseTargets();
+}
+
+RenderGraph::Handle RenderGraph::importTexture(const std::string& name, Texture& texture, const TextureDesc& desc) {
+    Resource resource;
+    resource.name = name;
+    resource.desc = desc;
+    resource.external = &texture;
+    resource.imported = true;
+    m_resources.push_back(resource);
+    return addNode(static_cast<uint32_t>(m_resources.size() - 1), 0, -1);
+}
+
+RenderGraph::Handle RenderGraph::importBackbuffer(const std::string& name, int width, int height) {
+    Resource resource;
+    resource.name = name;
+    resource.desc.width = width;
+    resource.desc.height = height;
+    resource.imported = true;
+    resource.backbuffer = true;
+    m_resources.push_back(resource);
+    return addNode(static_cast<uint32_t>(m_resources.size() - 1), 0, -1);
+}
+
+void RenderGraph::addPass(const std::string& name, const SetupFunction& setup, const ExecuteFunction& execute) {
+    if (m_compiled) {
+        throw std::runtime_error("ERROR::RENDER_GRAPH: Graph already compiled, call reset() first");
+    }
+    Pass pass;
+    pass.name = name;
+    pass.execute = execute;
+    m_passes.push_back(pass);
+
+    PassBuilder builder(*this, static_cast<uint32_t>(m_passes.size() - 1));
+    if (setup) {
+        setup(builder);
+    }
+}
+
+// =====  =====
+void RenderGraph::compile() {
+    releaseTargets();
+    m_stats = Stats();
+    m_stats.passes = static_cast<uint32_t>(m_passes.size());
+
+    // 1. ޳: дԴиõ pass , 
+    std::vector<uint32_t> stack;
+    for (uint32_t i = 0; i < m_passes.size(); ++i) {
+        Pass& pass = m_passes[i];
+        pass.culled = true;
+        bool root = pass.sideEffect;
+        for (const Attachment& attachment : pass.attachments) {
+            root = root || m_resources[m_nodes[attachment.handle].resource].imported;
+        }
+        if (root) {
+            pass.culled = false;
+            stack.push_back(i);
+        }
+    }
+    while (!stack.empty()) {
+        const Pass& pass = m_passes[stack.back()];
+        stack.pop_back();
+        auto visit = [&](Handle handle) {
+            int producer = m_nodes[handle].producer;
+            if (producer >= 0 && m_passes[producer].culled) {
+                m_passes[producer].culled = false;
+                stack.push_back(static_cast<uint32_t>(producer));
+            }
+        };
+        for (Handle handle : pass.reads) {
+            visit(handle);
+        }
+        for (Handle handle : pass.writes) {
+            visit(handle);
+        }
+    }
+
+    // 2. . : 汾 -> /һд;  -> һд (ܸ)
+    std::vector<std::vector<uint32_t>> successors(m_passes.size());
+    std::vector<uint32_t> inDegree(m_passes.size(), 0);
+    auto addEdge = [&](int from, uint32_t to) {
+        if (from < 0 || static_cast<uint32_t>(from) == to || m_passes[from].culled) {
+            return;
+        }
+        successors[from].push_back(to);
+        ++inDegree[to];
+    };
+    for (uint32_t i = 0; i < m_passes.size(); ++i) {
+        const Pass& pass = m_passes[i];
+        if (pass.culled) {
+            continue;
+        }
+        for (Handle handle : pass.reads) {
+            addEdge(m_nodes[handle].producer, i);
+        }
+        for (Handle handle : pass.writes) {
+            addEdge(m_nodes[handle].producer, i);
+            for (uint32_t reader : m_nodes[handle].readers) {
+                addEdge(static_cast<int>(reader), i);
+            }
+        }
+    }
+
+    m_order.clear();
+    std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<uint32_t>> ready;
+    uint32_t aliveCount = 0;
+    for (uint32_t i = 0; i < m_passes.size(); ++i) {
+        if (!m_passes[i].culled) {
+            ++aliveCount;
+            if (inDegree[i] == 0) {
+                ready.push(i);
+            }
+        }
+        else {
+            ++m_stats.culledPasses;
+        }
+    }
+    while (!ready.empty()) {
+        uint32_t index = ready.top();
+        ready.pop();
+        m_order.push_back(index);
+        for (uint32_t next : successors[index]) {
+            if (--inDegree[next] == 0) {
+                ready.push(next);
+            }
+        }
+    }
+    if (m_order.size() != aliveCount) {
+        throw std::runtime_error("ERROR::RENDER_GRAPH: Pass dependencies contain a cycle");
+    }
+
+    // 3.  (ִ˳еĩλ) 븽
+    for (Resource& resource : m_resources) {
+        resource.firstUse = resource.lastUse = -1;
+        resource.physical = -1;
+    }
+    for (uint32_t position = 0; position < m_order.size(); ++position) {
+        const Pass& pass = m_passes[m_order[position]];
+        auto touch = [&](Handle handle) {
+            Resource& resource = m_resources[m_nodes[handle].resource];
+            if (resource.firstUse < 0) {
+                resource.firstUse = static_cast<int>(position);
+            }
+            resource.lastUse = static_cast<int>(position);
+        };
+        for (Handle handle : pass.reads) {
+            touch(handle);
+        }
+        for (const Attachment& attachment : pass.attachments) {
+            touch(attachment.handle);
+            if (m_resources[m_nodes[attachment.handle].resource].backbuffer && pass.attachments.size() > 1) {
+                throw std::runtime_error("ERROR::RENDER_GRAPH: Pass '" + pass.name
+                    + "' mixes the backbuffer with other attachments");
+            }
+        }
+    }
+
+    // 4. : ״ʹ, ͬѾĲλ
+    std::vector<uint32_t> transients;
+    for (uint32_t i = 0; i < m_resources.size(); ++i) {
+        if (!m_resources[i].imported && m_resources[i].firstUse >= 0) {
+            transients.push_back(i);
+        }
+    }
+    std::stable_sort(transients.begin(), transients.end(), [this](uint32_t a, uint32_t b) {
+        return m_resources[a].firstUse < m_resources[b].firstUse;
+    });
+
+    struct Slot {
+        TextureDesc desc;
+        int lastUse;
+    };
+    std::vector<Slot> slots;
+    for (uint32_t index : transients) {
+        Resource& resource = m_resources[index];
+        size_t bytes = RenderTargetPool::computeBytes(resource.desc);
+        m_stats.transientBytes += bytes;
+        ++m_stats.transientTextures;
+
+        for (size_t s = 0; s < slots.size(); ++s) {
+            if (slots[s].desc == resource.desc && slots[s].lastUse < resource.firstUse) {
+                resource.physical = static_cast<int>(s);
+                slots[s].lastUse = resource.lastUse;
+                break;
+            }
+        }
+        if (resource.physical < 0) {
+            resource.physical = static_cast<int>(slots.size());
+            slots.push_back({ resource.desc, resource.lastUse });
+        }
+    }
+    m_stats.physicalTextures = static_cast<uint32_t>(slots.size());
+
+    // 5. λӳнĿ (һ֡黹ľͲ½)
+    // ؿƲ, ʵԴԽĿΪ׼
+    for (const Slot& slot : slots) {
+        m_slotTargets.push_back(&m_pool.acquire(slot.desc));
+        m_stats.physicalBytes += m_slotTargets.back()->getBytes();
+    }
+
+    m_compiled = true;
+}
+
+// ===== ִ =====
+void RenderGraph::execute() {
+    if (!m_compiled) {
+        compile();
+    }
+
+    GLStateCache& state = GLStateCache::getInstance();
+    PassResources resources(*this);
+    for (uint32_t index : m_order) {
+        const Pass& pass = m_passes[index];
+        if (!pass.attachments.empty()) {
+            const Resource& target = m_resources[m_nodes[pass.attachments.front().handle].resource];
+            if (target.backbuffer) {
+                state.bindFramebuffer(GL_FRAMEBUFFER, 0);
+            }
+            else {
+                getFramebuffer(pass).bind();
+            }
+            state.setViewport(0, 0, target.desc.width, target.desc.height);
+        }
+        if (pass.execute) {
+            pass.execute(resources);
+        }
+    }
+    state.bindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    // Ŀѹ黹, ٴִҪ±
+    releaseTargets();
+    m_compiled = false;
+}
+
+void RenderGraph::reset() {
+    releaseTargets();
+    m_resources.clear();
+    m_nodes.clear();
+    m_passes.clear();
+    m_order.clear();
+    m_compiled = false;
+}
+
+std::string RenderGraph::describe() const {
+    std::ostringstream out;
+    out << "RenderGraph: " << m_order.size() << " passes, " << m_stats.culledPasses << " culled\n";
+    for (size_t position = 0; position < m_order.size(); ++position) {
+        out << "  " << position << ": " << m_passes[m_order[position]].name << "\n";
+    }
+    for (const Pass& pass : m_passes) {
+        if (pass.culled) {
+            out << "  culled: " << pass.name << "\n";
+        }
+    }
+    for (const Resource& resource : m_resources) {
+        out << "  " << resource.name << " ";
+        if (resource.backbuffer) {
+            out << "backbuffer";
+        }
+        else if (resource.imported) {
+            out << "imported";
+        }
+        else if (resource.physical < 0) {
+            out << "unused";
+        }
+        else {
+            out << "-> target " << resource.physical << " [" << resource.firstUse << ", " << resource.lastUse << "]";
+        }
+        out << " " << resource.desc.width << "x" << resource.desc.height;
+        if (resource.desc.samples > 1) {
+            out << " x" << resource.desc.samples;
+        }
+        out << "\n";
+    }
+    out << "  transient " << m_stats.transientBytes << " bytes, physical " << m_stats.physicalBytes << " bytes\n";
+    return out.str();
+}
+
+// ===== ˽и =====
+RenderGraph::Handle RenderGraph::addNode(uint32_t resource, uint32_t version, int producer) {
+    Node node;
+    node.resource = resource;
+    node.version = version;
+    node.producer = producer;
+    m_nodes.push_back(node);
+    return static_cast<Handle>(m_nodes.size() - 1);
+}
+
+const RenderGraph::Node& RenderGraph::getNode(Handle handle) const {
+    if (handle >= m_nodes.size()) {
+        throw std::runtime_error("ERROR::RENDER_GRAPH: Invalid resource handle");
+    }
+    return m_nodes[handle];
+}
+
+RenderTarget* RenderGraph::getPhysicalTarget(const Resource& resource) const {
+    if (resource.imported || resource.physical < 0 || resource.physical >= static_cast<int>(m_slotTargets.size())) {
+        return nullptr;
+    }
+    return m_slotTargets[resource.physical];
+}
+
+Framebuffer& RenderGraph::getFramebuffer(const Pass& pass) {
+    std::vector<RenderTargetPool::Attachment> attachments;
+    for (const Attachment& attachment : pass.attachments) {
+        const Resource& resource = m_resources[m_nodes[attachment.handle].resource];
+        if (resource.imported) {
+            attachments.push_back(RenderTargetPool::attach(attachment.point, *resource.external));
+        }
+        else {
+            attachments.push_back(RenderTargetPool::attach(attachment.point, *getPhysicalTarget(resource)));
+        }
+    }
+    return m_pool.getFramebuffer(attachments);
+}
+
+void RenderGraph::releaseTargets() {
+    for (RenderTarget* target : m_slotTargets) {
+        m_pool.release(*target);
+    }
+    m_slotTargets.clear();
+}
+
+// ===== ʹdemo =====
+// RenderTargetPool pool;
+// RenderGraph graph(pool);  // ڱ, Ŀ FBO ɳؿ֡
+//
+// // ÿ֡ (Ⱦ߳)
+// pool.beginFrame();
+// graph.reset();
+// RenderGraph::Handle backbuffer = graph.importBackbuffer("backbuffer", width, height);
+// RenderGraph::Handle shadowMap, albedo, normal, depth, lit;
+//
+// graph.addPass("shadow", [&](RenderGraph::PassBuilder& builder) {
+//     shadowMap = builder.writeDepth(builder.create("shadowMap", { 2048, 2048, GL_DEPTH_COMPONENT32F }));
+// }, [&](const RenderGraph::PassResources&) { glClear(GL_DEPTH_BUFFER_BIT); /* ͶӰ */ });
+//
+// graph.addPass("gbuffer", [&](RenderGraph::PassBuilder& builder) {
+//     albedo = builder.writeColor(builder.create("albedo", { width, height, GL_RGBA8 }), 0);
+//     normal = builder.writeColor(builder.create("normal", { width, height, GL_RGBA16F }), 1);
+//     depth = builder.writeDepth(builder.create("depth", { width, height, GL_DEPTH24_STENCIL8 }));
+// }, [&](const RenderGraph::PassResources&) { /* Ƴ */ });
+//
+// graph.addPass("lighting", [&](RenderGraph::PassBuilder& builder) {
+//     builder.read(albedo); builder.read(normal); builder.read(depth); builder.read(shadowMap);
+//     lit = builder.writeColor(builder.create("lit", { width, height, GL_RGBA16F }));
+// }, [&](const RenderGraph::PassResources& resources) {
+//     resources.getTexture(albedo).bind(0);
+//     resources.getTexture(normal).bind(1);
+//     /* ȫ */
+// });
+//
+// graph.addPass("tonemap", [&](RenderGraph::PassBuilder& builder) {
+//     builder.read(lit);
+//     builder.writeColor(backbuffer);
+// }, [&](const RenderGraph::PassResources& resources) { resources.getTexture(lit).bind(0); /* ȫ */ });
+//
+// graph.compile();  // û tonemap õ pass ᱻ޳
+// graph.execute();
+// // lit  albedo ߴͬʽͬ, Ṳ; ͬڲصĺĿṲһ
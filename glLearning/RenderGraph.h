@@ -0,0 +1,176 @@
+#ifndef RENDER_GRAPH_H
+#define RENDER_GRAPH_H
+
+#include "Framebuffer.h"
+#include "RenderTargetPool.h"
+#include "Texture.h"
+#include <glad/glad.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// RenderGraph: ʽ֡ͼ
+// ÿ֡ addPass  pass дЩȾĿ, compile() :
+//   1. ޳ûõ pass (ֻӰ쵼Դ/󻺳˸õ pass);
+//   2. д (ͬ˳);
+//   3. ʱĿ, ڲصͬĿ깲ͬһ.
+// execute() ˳Ϊÿ pass  () FBO ӿںִк.
+// Դ汾: ÿд°汾, ĸ汾ĸ pass, ˳޹.
+// Ŀ FBO  RenderTargetPool , execute() ʱ黹, ֡ɳظ.
+// ע: GL ûԴ,  "" ǸͬһĿ, ֻڳߴ硢ʽȫͬʱ.
+class RenderGraph {
+public:
+    using Handle = uint32_t;
+    static constexpr Handle kInvalidHandle = 0xFFFFFFFFu;
+
+    // ȾĿ, samples > 1 ʱΪزȾ
+    using TextureDesc = RenderTargetDesc;
+
+    struct Stats {
+        uint32_t passes = 0;             //  pass
+        uint32_t culledPasses = 0;
+        uint32_t transientTextures = 0;  // ֡õʱĿ
+        uint32_t physicalTextures = 0;   // ֮ʵռõ
+        size_t transientBytes = 0;       // ʱҪԴ
+        size_t physicalBytes = 0;        // ʵռõԴ
+    };
+
+    // pass ׶ʹ
+    class PassBuilder {
+    public:
+        // һʱȾĿ (δ, Ҫɱ pass д)
+        Handle create(const std::string& name, const TextureDesc& desc);
+
+        // Ϊȡ
+        Handle read(Handle handle);
+
+        /**
+         * @brief Ϊɫд, д°汾.
+         * @param index ɫص GL_COLOR_ATTACHMENT0 + index
+         */
+        Handle writeColor(Handle handle, uint32_t index = 0);
+
+        // Ϊ (ģ) д, д°汾
+        Handle writeDepth(Handle handle);
+
+        // Ϊи (д SSBO ض), Զᱻ޳
+        void setSideEffect();
+
+    private:
+        friend class RenderGraph;
+        PassBuilder(RenderGraph& graph, uint32_t pass) : m_graph(graph), m_pass(pass) {}
+        Handle write(Handle handle, GLenum attachment);
+
+        RenderGraph& m_graph;
+        uint32_t m_pass;
+    };
+
+    // pass ִн׶ʹ
+    class PassResources {
+    public:
+        // ԴӦ. 󻺳زĿû, ׳쳣
+        Texture& getTexture(Handle handle) const;
+
+        // ʱԴӦĳĿ (زĿҪ blit ). Դ׳쳣
+        RenderTarget& getTarget(Handle handle) const;
+        const TextureDesc& getDesc(Handle handle) const;
+
+    private:
+        friend class RenderGraph;
+        explicit PassResources(const RenderGraph& graph) : m_graph(graph) {}
+        const RenderGraph& m_graph;
+    };
+
+    using SetupFunction = std::function<void(PassBuilder& builder)>;
+    using ExecuteFunction = std::function<void(const PassResources& resources)>;
+
+    explicit RenderGraph(RenderTargetPool& pool) : m_pool(pool) {}
+    ~RenderGraph();
+
+    // ֹ
+    RenderGraph(const RenderGraph&) = delete;
+    RenderGraph& operator=(const RenderGraph&) = delete;
+
+    // ⲿе (֡ʷ塢Ӱͼ). д pass ᱻ޳
+    Handle importTexture(const std::string& name, Texture& texture, const TextureDesc& desc);
+
+    // Ĭ֡. д pass ᱻ޳, Ҹ pass 
+    Handle importBackbuffer(const std::string& name, int width, int height);
+
+    // һ pass. setup ִ
+    void addPass(const std::string& name, const SetupFunction& setup, const ExecuteFunction& execute);
+
+    /**
+     * @brief ޳򲢷.
+     * @throws std::runtime_error ɻ򸽼Ϸʱ׳
+     */
+    void compile();
+
+    // ˳ִδ޳ pass (δʱȱ). ʱ󶨻Ĭ֡岢Ŀ껹
+    void execute();
+
+    // ձ֡ pass Դ
+    void reset();
+
+    const Stats& getStats() const { return m_stats; }
+
+    // : ִ˳򡢱޳ passʱĿĶӦϵ
+    std::string describe() const;
+
+private:
+    struct Resource {
+        std::string name;
+        TextureDesc desc;
+        Texture* external = nullptr;  // 
+        bool imported = false;
+        bool backbuffer = false;
+        int firstUse = -1;            // ִ˳еλ
+        int lastUse = -1;
+        int physical = -1;            // ʱĿ: ֡ʹõĿλ
+    };
+
+    // Դһ汾
+    struct Node {
+        uint32_t resource = 0;
+        uint32_t version = 0;
+        int producer = -1;            // дð汾 pass, -1 ʾʼ
+        int nextWriter = -1;          // ڸð汾дһ汾 pass
+        std::vector<uint32_t> readers;
+    };
+
+    struct Attachment {
+        GLenum point;
+        Handle handle;
+    };
+
+    struct Pass {
+        std::string name;
+        ExecuteFunction execute;
+        std::vector<Handle> reads;
+        std::vector<Handle> writes;   // дǰİ汾
+        std::vector<Attachment> attachments;
+        bool sideEffect = false;
+        bool culled = false;
+    };
+
+    Handle addNode(uint32_t resource, uint32_t version, int producer);
+    const Node& getNode(Handle handle) const;
+    RenderTarget* getPhysicalTarget(const Resource& resource) const;
+    Framebuffer& getFramebuffer(const Pass& pass);
+    void releaseTargets();
+
+    RenderTargetPool& m_pool;
+
+    std::vector<Resource> m_resources;
+    std::vector<Node> m_nodes;
+    std::vector<Pass> m_passes;
+    std::vector<uint32_t> m_order;        // ִ˳
+    std::vector<RenderTarget*> m_slotTargets;  // Ŀλ -> Ŀ
+    bool m_compiled = false;
+
+    Stats m_stats;
+};
+
+#endif // RENDER_GRAPH_H
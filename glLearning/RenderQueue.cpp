@@ -0,0 +1,214 @@
+#include "RenderQueue.h"
+#include "CommandBuffer.h"
+#include "GLStateCache.h"
+#include "Material.h"
+#include <cstring>
+
+namespace {
+    const int kLayerBits = 4;
+    const int kShaderBits = 12;
+    const int kMaterialBits = 14;
+    const int kVertexArrayBits = 12;
+    const int kDepthBits = 21;
+
+    // λģʽֵ, ȡָβĸ 21 λΪȼ
+    uint64_t depthBits(float depth) {
+        if (!(depth > 0.0f)) {
+            return 0;
+        }
+        uint32_t bits;
+        std::memcpy(&bits, &depth, sizeof(bits));
+        return (bits >> (31 - kDepthBits)) & ((1u << kDepthBits) - 1);
+    }
+}
+
+RenderQueue::RenderQueue()
+    : m_localBuffer(std::make_unique<CommandBuffer>()) {
+    m_commands.reserve(1024);
+}
+
+RenderQueue::~RenderQueue() = default;
+
+void RenderQueue::beginFrame() {
+    m_localBuffer->reset();
+    m_commands.clear();
+    m_stats = Stats();
+}
+
+// =====  =====
+uint64_t RenderQueue::makeMaterialHash(const TextureSet& textures) {
+    // FNV-1a, λϸ ID
+    uint64_t hash = 1469598103934665603ull;
+    for (uint32_t i = 0; i < kMaxTextures; ++i) {
+        uint64_t id = textures.textures[i] ? textures.textures[i]->getID() : 0;
+        hash = (hash ^ id) * 1099511628211ull;
+    }
+    return hash;
+}
+
+uint64_t RenderQueue::makeKey(const DrawItem& item, uint64_t materialHash) {
+    Shader* program = item.material ? item.material->getShader() : item.shader;
+    uint64_t shader = program->getProgram() & ((1u << kShaderBits) - 1);
+    uint64_t material = (materialHash ^ (materialHash >> 14) ^ (materialHash >> 28) ^ (materialHash >> 42)) &
+        ((1u << kMaterialBits) - 1);
+    uint64_t vertexArray = item.vertexArray & ((1u << kVertexArrayBits) - 1);
+
+    uint64_t key = uint64_t(item.layer & ((1u << kLayerBits) - 1)) << 60;
+    uint64_t state = (shader << (kMaterialBits + kVertexArrayBits)) | (material << kVertexArrayBits) | vertexArray;
+    uint64_t depth = depthBits(item.depth);
+
+    if (item.translucent) {
+        uint64_t farFirst = ((1u << kDepthBits) - 1) - depth;
+        key |= uint64_t(1) << 59;
+        key |= farFirst << (kShaderBits + kMaterialBits + kVertexArrayBits);
+        key |= state;
+    }
+    else {
+        key |= state << kDepthBits;
+        key |= depth;
+    }
+    return key;
+}
+
+// ===== ύ =====
+void RenderQueue::submit(const DrawItem& item) {
+    m_localBuffer->draw(item);
+}
+
+void RenderQueue::submit(const CommandBuffer& buffer) {
+    const std::vector<RenderCommand>& commands = buffer.getCommands();
+    m_commands.insert(m_commands.end(), commands.begin(), commands.end());
+}
+
+// =====  =====
+// LSD , ÿ 16 λ 4 ; мĳһȡֵͬʱ (ֻ֡һ layer)
+void RenderQueue::radixSort() {
+    size_t count = m_commands.size();
+    m_order.resize(count);
+    m_scratch.resize(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        m_order[i] = i;
+    }
+
+    std::vector<uint32_t>& histogram = m_histogram;
+    histogram.resize(1u << 16);
+    for (int pass = 0; pass < 4; ++pass) {
+        int shift = pass * 16;
+        std::fill(histogram.begin(), histogram.end(), 0);
+        for (const RenderCommand& command : m_commands) {
+            histogram[(command.key >> shift) & 0xFFFF]++;
+        }
+        if (histogram[(m_commands[0].key >> shift) & 0xFFFF] == count) {
+            continue;
+        }
+
+        uint32_t sum = 0;
+        for (uint32_t& bucket : histogram) {
+            uint32_t value = bucket;
+            bucket = sum;
+            sum += value;
+        }
+        for (uint32_t index : m_order) {
+            m_scratch[histogram[(m_commands[index].key >> shift) & 0xFFFF]++] = index;
+        }
+        m_order.swap(m_scratch);
+    }
+}
+
+RenderQueue::StateChanges RenderQueue::countStateChanges(const std::vector<RenderCommand>& commands,
+    const uint32_t* order) {
+    StateChanges changes;
+    const RenderCommand* previous = nullptr;
+    for (size_t i = 0; i < commands.size(); ++i) {
+        const RenderCommand& command = commands[order ? order[i] : i];
+        if (!previous || previous->shader != command.shader) {
+            ++changes.programs;
+        }
+        if (!previous || !sameMaterial(*previous, command)) {
+            ++changes.materials;
+        }
+        if (!previous || previous->vertexArray != command.vertexArray) {
+            ++changes.vertexArrays;
+        }
+        previous = &command;
+    }
+    return changes;
+}
+
+bool RenderQueue::sameMaterial(const RenderCommand& a, const RenderCommand& b) {
+    // פĲʰָȽϼ
+    if (a.material || b.material) {
+        return a.material == b.material;
+    }
+    if (a.textures == b.textures) {
+        return true;
+    }
+    if (a.materialHash != b.materialHash) {
+        return false;
+    }
+    for (uint32_t i = 0; i < kMaxTextures; ++i) {
+        if (a.textures->textures[i] != b.textures->textures[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ===== ִ =====
+void RenderQueue::execute(const RenderCommand& command, const RenderCommand* previous) {
+    GLStateCache& state = GLStateCache::getInstance();
+
+    bool translucent = (command.key >> 59) & 1;
+    if (!previous || translucent != (((previous->key >> 59) & 1) != 0)) {
+        state.setBlend(translucent);
+        state.setDepthWrite(!translucent);
+        if (translucent) {
+            state.setBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        }
+    }
+
+    command.shader->use();
+    if (!previous || !sameMaterial(*previous, command)) {
+        if (command.material) {
+            command.material->bind();
+        }
+        else {
+            for (uint32_t unit = 0; unit < kMaxTextures; ++unit) {
+                if (command.textures->textures[unit]) {
+                    command.textures->textures[unit]->bind(unit);
+                }
+            }
+        }
+    }
+    if (command.transform) {
+        command.shader->setMat4("model", *command.transform);
+    }
+
+    state.bindVertexArray(command.vertexArray);
+    glDrawElementsBaseVertex(GL_TRIANGLES, command.indexCount, GL_UNSIGNED_INT,
+        (const void*)(uintptr_t(command.firstIndex) * sizeof(uint32_t)), command.baseVertex);
+}
+
+void RenderQueue::flush() {
+    submit(*m_localBuffer);
+    if (m_commands.empty()) {
+        return;
+    }
+
+    m_stats.commands = static_cast<uint32_t>(m_commands.size());
+    m_stats.unsorted = countStateChanges(m_commands, nullptr);
+
+    radixSort();
+    m_stats.sorted = countStateChanges(m_commands, m_order.data());
+
+    const RenderCommand* previous = nullptr;
+    for (uint32_t index : m_order) {
+        execute(m_commands[index], previous);
+        previous = &m_commands[index];
+    }
+
+    // ָĬ״̬, Ӱ֮Ļ
+    GLStateCache& state = GLStateCache::getInstance();
+    state.setBlend(false);
+    state.setDepthWrite(true);
+}
@@ -0,0 +1,116 @@
+#ifndef RENDER_QUEUE_H
+#define RENDER_QUEUE_H
+
+#include "Shader.h"
+#include "Texture.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class CommandBuffer;
+class Material;
+
+// RenderQueue: Ⱦǰ. ÿύѹһ POD  64 λ,
+// ÿ֡û˳ִ, Զͬ /  / VAO Ļŵһ.
+// ڹ߳¼ƵԵ CommandBuffer, Ⱦ̺߳ϲ ( CommandBuffer / CommandRecorder).
+//
+//  (λ -> λ):
+//   ͸: layer(4) | 0 | shader(12) | material(14) | vao(12) | depth(21)   ״̬, ͬ״̬ɽԶ
+//   ͸: layer(4) | 1 | ת depth(21) | shader(12) | material(14) | vao(12)  Զ
+// shader / vao ȡ GL ֵĵλ, material ȡפʵı, ûвʱȡϹϣ۵ֵ. Ҫκι,
+// ˿߳Ͻ; żĳͻֻӰЧ, ִʱȽϵʵ״̬.
+class RenderQueue {
+public:
+    static constexpr uint32_t kMaxTextures = 4;
+
+    // һλƵ (÷д)
+    struct DrawItem {
+        Shader* shader = nullptr;
+        GLuint vertexArray = 0;
+        const Texture* textures[kMaxTextures] = {};  //  i 󶨵Ԫ i
+        const Material* material = nullptr;          // ǿʱɫȡԲ,  shader / textures
+        uint32_t indexCount = 0;
+        uint32_t firstIndex = 0;
+        int32_t baseVertex = 0;
+        const glm::mat4* model = nullptr;  // ǿʱд uniform "model"
+        float depth = 0.0f;                // ľ, 
+        uint8_t layer = 0;                 // 0 ~ 15, СȻ
+        bool translucent = false;          // ͸: , رд, Զ
+    };
+
+    // ״̬лͳ
+    struct StateChanges {
+        uint32_t programs = 0;
+        uint32_t materials = 0;
+        uint32_t vertexArrays = 0;
+    };
+
+    struct Stats {
+        uint32_t commands = 0;
+        StateChanges unsorted;  // ύ˳ִʱҪл
+        StateChanges sorted;    // ʵʵл
+    };
+
+    // ûвʱֱָ: 󶨵Ԫ
+    struct TextureSet {
+        const Texture* textures[kMaxTextures];
+    };
+
+    // յ POD  (64 ֽ). Ϻͱ任ָ¼ CommandBuffer Է,
+    //  MaterialLibrary . textures  material ֻһǿ
+    struct RenderCommand {
+        uint64_t key;
+        uint64_t materialHash;
+        Shader* shader;
+        const TextureSet* textures;
+        const Material* material;
+        const glm::mat4* transform;  // Ϊʱ uniform "model"
+        GLuint vertexArray;
+        uint32_t indexCount;
+        uint32_t firstIndex;
+        int32_t baseVertex;
+    };
+
+    // ̰߳ȫ,  CommandBuffer ڹ߳ϵ
+    static uint64_t makeMaterialHash(const TextureSet& textures);
+    static uint64_t makeKey(const DrawItem& item, uint64_t materialHash);
+
+    RenderQueue();
+    ~RenderQueue();
+
+    // ֹ
+    RenderQueue(const RenderQueue&) = delete;
+    RenderQueue& operator=(const RenderQueue&) = delete;
+
+    // ʼµһ֡, 
+    void beginFrame();
+
+    // Ⱦֱ߳ύ
+    void submit(const DrawItem& item);
+
+    // ϲһ¼ɵ.  flush() ܱ֮ reset
+    void submit(const CommandBuffer& buffer);
+
+    // ϲִб֡ (ÿ֡һ), ָĬϵĻ / д״̬
+    void flush();
+
+    const Stats& getStats() const { return m_stats; }
+
+private:
+    static StateChanges countStateChanges(const std::vector<RenderCommand>& commands, const uint32_t* order);
+    static bool sameMaterial(const RenderCommand& a, const RenderCommand& b);
+
+    void radixSort();
+    void execute(const RenderCommand& command, const RenderCommand* previous);
+
+    std::unique_ptr<CommandBuffer> m_localBuffer;  // submit(const DrawItem&) ¼Ƶ
+    std::vector<RenderCommand> m_commands;         // ֡ϲȫ
+    std::vector<uint32_t> m_order;
+    std::vector<uint32_t> m_scratch;
+    std::vector<uint32_t> m_histogram;
+
+    Stats m_stats;
+};
+
+#endif // RENDER_QUEUE_H
@@ -0,0 +1,262 @@
+#include "RenderTargetPool.h"
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+
+// ===== RenderTarget =====
+RenderTarget::RenderTarget(const RenderTargetDesc& desc)
+    : m_desc(desc), m_bytes(RenderTargetPool::computeBytes(desc)) {
+    if (desc.samples <= 1) {
+        m_texture = Framebuffer::createTargetTexture(desc.width, desc.height, desc.internalFormat);
+        return;
+    }
+
+    if (GLAD_GL_VERSION_4_5) {
+        glCreateRenderbuffers(1, &m_renderbuffer);
+        glNamedRenderbufferStorageMultisample(m_renderbuffer, desc.samples, desc.internalFormat, desc.width, desc.height);
+    }
+    else {
+        // Ⱦİ󶨲״̬, ָΪ 0
+        glGenRenderbuffers(1, &m_renderbuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, m_renderbuffer);
+        glRenderbufferStorageMultisample(GL_RENDERBUFFER, desc.samples, desc.internalFormat, desc.width, desc.height);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    }
+}
+
+RenderTarget::~RenderTarget() {
+    if (m_renderbuffer != 0) {
+        glDeleteRenderbuffers(1, &m_renderbuffer);
+    }
+}
+
+// ===== 黹 =====
+RenderTargetPool::~RenderTargetPool() {
+    clear();
+}
+
+RenderTarget& RenderTargetPool::acquire(const RenderTargetDesc& desc) {
+    if (desc.width <= 0 || desc.height <= 0) {
+        throw std::runtime_error("ERROR::RENDER_TARGET_POOL: Invalid render target size");
+    }
+
+    RenderTargetDesc actual = desc;
+    if (actual.samples > 1) {
+        if (m_maxSamples == 0) {
+            glGetIntegerv(GL_MAX_SAMPLES, &m_maxSamples);
+            m_maxSamples = std::max(m_maxSamples, 1);
+        }
+        actual.samples = std::min(actual.samples, static_cast<int>(m_maxSamples));
+    }
+    if (actual.samples < 1) {
+        actual.samples = 1;
+    }
+
+    for (auto& target : m_targets) {
+        if (!target->m_inUse && !target->m_stale && target->m_desc == actual) {
+            target->m_inUse = true;
+            target->m_unusedFrames = 0;
+            updateStats();
+            return *target;
+        }
+    }
+
+    // ֵ֧ĸʽ׳, رֲ
+    std::unique_ptr<RenderTarget> target(new RenderTarget(actual));
+    target->m_inUse = true;
+    m_targets.push_back(std::move(target));
+    ++m_stats.allocations;
+    ++m_stats.totalAllocations;
+    updateStats();
+    return *m_targets.back();
+}
+
+void RenderTargetPool::release(RenderTarget& target) {
+    for (size_t i = 0; i < m_targets.size(); ++i) {
+        if (m_targets[i].get() != &target) {
+            continue;
+        }
+        if (!target.m_inUse) {
+            std::cerr << "ERROR::RENDER_TARGET_POOL: Render target released twice" << std::endl;
+            return;
+        }
+        target.m_inUse = false;
+        if (target.m_stale) {
+            destroyTarget(i);
+        }
+        updateStats();
+        return;
+    }
+    std::cerr << "ERROR::RENDER_TARGET_POOL: Render target does not belong to this pool" << std::endl;
+}
+
+// ===== ֡ =====
+Framebuffer& RenderTargetPool::getFramebuffer(const std::vector<Attachment>& attachments) {
+    std::vector<GLuint> key;
+    key.reserve(attachments.size() * 3);
+    for (const Attachment& attachment : attachments) {
+        key.push_back(attachment.point);
+        key.push_back(attachment.texture);
+        key.push_back(attachment.renderbuffer);
+    }
+
+    auto it = m_framebuffers.find(key);
+    if (it == m_framebuffers.end()) {
+        auto framebuffer = std::make_unique<Framebuffer>();
+        for (const Attachment& attachment : attachments) {
+            if (attachment.renderbuffer != 0) {
+                framebuffer->attachRenderbuffer(attachment.point, attachment.renderbuffer);
+            }
+            else {
+                framebuffer->attachTexture(attachment.point, attachment.texture);
+            }
+        }
+        framebuffer->finalize();  // ʱ׳, 뻺
+
+        CachedFramebuffer cached;
+        cached.framebuffer = std::move(framebuffer);
+        it = m_framebuffers.emplace(key, std::move(cached)).first;
+        m_stats.framebuffers = static_cast<uint32_t>(m_framebuffers.size());
+    }
+    it->second.unusedFrames = 0;
+    return *it->second.framebuffer;
+}
+
+RenderTargetPool::Attachment RenderTargetPool::attach(GLenum point, const RenderTarget& target) {
+    Attachment attachment;
+    attachment.point = point;
+    attachment.texture = target.getTexture() ? target.getTexture()->getID() : 0;
+    attachment.renderbuffer = target.getRenderbuffer();
+    return attachment;
+}
+
+RenderTargetPool::Attachment RenderTargetPool::attach(GLenum point, const Texture& texture) {
+    Attachment attachment;
+    attachment.point = point;
+    attachment.texture = texture.getID();
+    return attachment;
+}
+
+void RenderTargetPool::releaseFramebuffersUsing(GLuint texture) {
+    for (auto it = m_framebuffers.begin(); it != m_framebuffers.end();) {
+        bool uses = false;
+        for (size_t i = 1; i < it->first.size(); i += 3) {
+            uses = uses || it->first[i] == texture;
+        }
+        it = uses ? m_framebuffers.erase(it) : std::next(it);
+    }
+    m_stats.framebuffers = static_cast<uint32_t>(m_framebuffers.size());
+}
+
+// =====  =====
+void RenderTargetPool::setScreenSize(int width, int height) {
+    if (width == m_screenWidth && height == m_screenHeight) {
+        return;
+    }
+    int oldWidth = m_screenWidth;
+    int oldHeight = m_screenHeight;
+    m_screenWidth = width;
+    m_screenHeight = height;
+
+    // ϶ڱԵʱÿ֡ߴ綼ڱ, ɳߴĿ겻ٱõ,  kRetireFrames
+    for (size_t i = 0; i < m_targets.size();) {
+        RenderTarget& target = *m_targets[i];
+        if (target.m_desc.width != oldWidth || target.m_desc.height != oldHeight) {
+            ++i;
+            continue;
+        }
+        if (target.m_inUse) {
+            target.m_stale = true;
+            ++i;
+            continue;
+        }
+        destroyTarget(i);
+    }
+    updateStats();
+}
+
+void RenderTargetPool::beginFrame() {
+    m_stats.allocations = 0;
+
+    for (size_t i = 0; i < m_targets.size();) {
+        RenderTarget& target = *m_targets[i];
+        if (!target.m_inUse && ++target.m_unusedFrames > kRetireFrames) {
+            destroyTarget(i);
+            continue;
+        }
+        ++i;
+    }
+    for (auto it = m_framebuffers.begin(); it != m_framebuffers.end();) {
+        it = ++it->second.unusedFrames > kRetireFrames ? m_framebuffers.erase(it) : std::next(it);
+    }
+    m_stats.framebuffers = static_cast<uint32_t>(m_framebuffers.size());
+    updateStats();
+}
+
+void RenderTargetPool::clear() {
+    // ɾ֡, ɾõĸ
+    m_framebuffers.clear();
+    m_targets.clear();
+    m_stats.framebuffers = 0;
+    updateStats();
+}
+
+size_t RenderTargetPool::computeBytes(const RenderTargetDesc& desc) {
+    return static_cast<size_t>(desc.width) * desc.height * Framebuffer::getBytesPerPixel(desc.internalFormat)
+        * static_cast<size_t>(std::max(desc.samples, 1));
+}
+
+// ===== ˽и =====
+void RenderTargetPool::destroyTarget(size_t index) {
+    releaseFramebuffersUsing(*m_targets[index]);
+    m_targets.erase(m_targets.begin() + index);
+}
+
+void RenderTargetPool::releaseFramebuffersUsing(const RenderTarget& target) {
+    Attachment attachment = attach(GL_NONE, target);
+    for (auto it = m_framebuffers.begin(); it != m_framebuffers.end();) {
+        bool uses = false;
+        for (size_t i = 0; i + 2 < it->first.size(); i += 3) {
+            uses = uses || (attachment.texture != 0 && it->first[i + 1] == attachment.texture)
+                || (attachment.renderbuffer != 0 && it->first[i + 2] == attachment.renderbuffer);
+        }
+        it = uses ? m_framebuffers.erase(it) : std::next(it);
+    }
+    m_stats.framebuffers = static_cast<uint32_t>(m_framebuffers.size());
+}
+
+void RenderTargetPool::updateStats() {
+    m_stats.targets = static_cast<uint32_t>(m_targets.size());
+    m_stats.targetsInUse = 0;
+    m_stats.bytes = 0;
+    m_stats.bytesInUse = 0;
+    for (const auto& target : m_targets) {
+        m_stats.bytes += target->m_bytes;
+        if (target->m_inUse) {
+            ++m_stats.targetsInUse;
+            m_stats.bytesInUse += target->m_bytes;
+        }
+    }
+    m_stats.peakBytes = std::max(m_stats.peakBytes, m_stats.bytes);
+}
+
+// ===== ʹdemo =====
+// RenderTargetPool pool;  // Ⱦ̳߳
+//
+// // ÿ֡
+// pool.setScreenSize(width, height);  //  framebuffer_size_callback ¼ĴС
+// pool.beginFrame();
+//
+// RenderTarget& scene = pool.acquire({ width, height, GL_RGBA16F, 4 });
+// RenderTarget& depth = pool.acquire({ width, height, GL_DEPTH24_STENCIL8, 4 });
+// pool.getFramebuffer({ RenderTargetPool::attach(GL_COLOR_ATTACHMENT0, scene),
+//                       RenderTargetPool::attach(GL_DEPTH_STENCIL_ATTACHMENT, depth) }).bind();
+// ...Ƴ...
+// RenderTarget& resolved = pool.acquire({ width, height, GL_RGBA16F });
+// ...glBlitFramebuffer  resolved, ֮Ϊ...
+// pool.release(depth);  // 黹,  pass Ը
+// pool.release(scene);
+// pool.release(resolved);
+//
+// std::cout << pool.getStats().bytes / (1024 * 1024) << " MB pooled" << std::endl;
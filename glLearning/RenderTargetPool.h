@@ -0,0 +1,150 @@
+#ifndef RENDER_TARGET_POOL_H
+#define RENDER_TARGET_POOL_H
+
+#include "Framebuffer.h"
+#include "Texture.h"
+#include <glad/glad.h>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+// ȾĿ. ذ (ߴ, ʽ, ) ƥ
+struct RenderTargetDesc {
+    int width = 0;
+    int height = 0;
+    GLenum internalFormat = GL_RGBA8;
+    int samples = 1;  // > 1 ʱΪزȾ, ֱӲ, Ҫ blit 
+
+    bool operator==(const RenderTargetDesc& other) const {
+        return width == other.width && height == other.height
+            && internalFormat == other.internalFormat && samples == other.samples;
+    }
+};
+
+// еһȾĿ: Ϊ, زΪȾ. ֻ RenderTargetPool 
+class RenderTarget {
+public:
+    ~RenderTarget();
+
+    // ֹ (ذַ)
+    RenderTarget(const RenderTarget&) = delete;
+    RenderTarget& operator=(const RenderTarget&) = delete;
+
+    const RenderTargetDesc& getDesc() const { return m_desc; }
+
+    // Ŀ, زʱΪ nullptr
+    Texture* getTexture() const { return m_texture.get(); }
+
+    // زĿȾ, ʱΪ 0
+    GLuint getRenderbuffer() const { return m_renderbuffer; }
+
+    bool isMultisampled() const { return m_renderbuffer != 0; }
+
+    size_t getBytes() const { return m_bytes; }
+
+private:
+    friend class RenderTargetPool;
+    explicit RenderTarget(const RenderTargetDesc& desc);
+
+    RenderTargetDesc m_desc;
+    std::unique_ptr<Texture> m_texture;
+    GLuint m_renderbuffer = 0;
+    size_t m_bytes = 0;
+    uint32_t m_unusedFrames = 0;
+    bool m_inUse = false;
+    bool m_stale = false;  // ɴڳߴĿ, 黹ʱֱͷ
+};
+
+// RenderTargetPool: ȾĿ֡ (Ⱦ̶߳ռ)
+// acquire/release ֡ڡ pass Ŀ; 黹Ŀ걣֡,  kRetireFrames ֡
+// ûͷ. ֡尴ص (ص, /Ⱦ) , Ŀͷʱһɾ.
+// : framebuffer_size_callback ֻ¼С, Ⱦ̷ִ߳С仯 setScreenSize,
+// ɳߴĿĿͷ, еڹ黹ʱͷ, ֻгߴ仯һ֡·.
+class RenderTargetPool {
+public:
+    // ֡һ, texture  renderbuffer ѡһ
+    struct Attachment {
+        GLenum point = GL_COLOR_ATTACHMENT0;
+        GLuint texture = 0;
+        GLuint renderbuffer = 0;
+    };
+
+    struct Stats {
+        uint32_t targets = 0;           // ȫĿ
+        uint32_t targetsInUse = 0;
+        uint32_t framebuffers = 0;
+        size_t bytes = 0;               // ռõԴ ()
+        size_t bytesInUse = 0;
+        size_t peakBytes = 0;
+        uint32_t allocations = 0;       // ֡½Ŀ, ȶ״̬ӦΪ 0
+        uint64_t totalAllocations = 0;
+    };
+
+    static constexpr uint32_t kRetireFrames = 3;
+
+    RenderTargetPool() = default;
+    ~RenderTargetPool();
+
+    // ֹ
+    RenderTargetPool(const RenderTargetPool&) = delete;
+    RenderTargetPool& operator=(const RenderTargetPool&) = delete;
+
+    /**
+     * @brief һƥĿĿ, û½. δ.
+     *        ᱻ GL_MAX_SAMPLES ,  getDesc() Ϊ׼.
+     * @throws std::runtime_error ߴʽϷʱ׳
+     */
+    RenderTarget& acquire(const RenderTargetDesc& desc);
+
+    // 黹Ŀ, ֮ɱ֡ pass Ժ֡
+    void release(RenderTarget& target);
+
+    /**
+     * @brief ȡ (򴴽) ˸֡.
+     * @throws std::runtime_error ֡岻ʱ׳
+     */
+    Framebuffer& getFramebuffer(const std::vector<Attachment>& attachments);
+
+    static Attachment attach(GLenum point, const RenderTarget& target);
+    static Attachment attach(GLenum point, const Texture& texture);
+
+    // ɾⲿ֡. ⲿǰ, ֱúоɵ֡
+    void releaseFramebuffersUsing(GLuint texture);
+
+    //  (֡) ߴ仯ʱ, ͷžɳߴĿ
+    void setScreenSize(int width, int height);
+    int getScreenWidth() const { return m_screenWidth; }
+    int getScreenHeight() const { return m_screenHeight; }
+
+    // ÿ֡ʼʱ: ͳ㲢ͷųڿеĿ֡
+    void beginFrame();
+
+    // ͷȫĿ֡ (Ⱦ߳˳ǰ). еĿҲʧЧ
+    void clear();
+
+    const Stats& getStats() const { return m_stats; }
+
+    // ĿռõԴ:  *  * ÿֽ * 
+    static size_t computeBytes(const RenderTargetDesc& desc);
+
+private:
+    struct CachedFramebuffer {
+        std::unique_ptr<Framebuffer> framebuffer;
+        uint32_t unusedFrames = 0;
+    };
+
+    void destroyTarget(size_t index);
+    void releaseFramebuffersUsing(const RenderTarget& target);
+    void updateStats();
+
+    std::vector<std::unique_ptr<RenderTarget>> m_targets;
+    std::map<std::vector<GLuint>, CachedFramebuffer> m_framebuffers;  // : (ص, , Ⱦ) 
+    int m_screenWidth = 0;
+    int m_screenHeight = 0;
+    GLint m_maxSamples = 0;  // ״Ҫʱѯ
+    Stats m_stats;
+};
+
+#endif // RENDER_TARGET_POOL_H
@@ -0,0 +1,148 @@
+#include "RenderThread.h"
+#include <GLFW/glfw3.h>
+#include <iostream>
+#include <stdexcept>
+
+RenderThread::RenderThread(GLFWwindow* window)
+    : m_window(window) {
+    if (!window) {
+        throw std::runtime_error("ERROR::RENDER_THREAD: Window is null");
+    }
+}
+
+RenderThread::~RenderThread() {
+    try {
+        stop();
+    }
+    catch (const std::exception& e) {
+        std::cerr << "ERROR::RENDER_THREAD: " << e.what() << std::endl;
+    }
+}
+
+// ===== ֹͣ (߳) =====
+void RenderThread::start(const Callbacks& callbacks) {
+    if (m_thread.joinable()) {
+        throw std::runtime_error("ERROR::RENDER_THREAD: Render thread already started");
+    }
+
+    m_callbacks = callbacks;
+    m_stopRequested.store(false);
+    m_failed.store(false);
+    m_initDone = false;
+    m_error = nullptr;
+
+    // ͬһʱֻһ߳ǵǰ
+    glfwMakeContextCurrent(nullptr);
+    m_running.store(true, std::memory_order_release);
+    m_thread = std::thread(&RenderThread::threadMain, this);
+
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_initialized.wait(lock, [this] { return m_initDone; });
+        error = m_error;
+    }
+    if (error) {
+        m_thread.join();
+        m_error = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+void RenderThread::stop() {
+    if (!m_thread.joinable()) {
+        return;
+    }
+
+    m_stopRequested.store(true, std::memory_order_release);
+    m_thread.join();
+
+    std::exception_ptr error = m_error;
+    m_error = nullptr;
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+// ===== Ⱦ߳ =====
+void RenderThread::threadMain() {
+    glfwMakeContextCurrent(m_window);
+
+    bool initialized = false;
+    try {
+        if (m_callbacks.initialize) {
+            m_callbacks.initialize();
+        }
+        initialized = true;
+    }
+    catch (...) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_error = std::current_exception();
+        m_failed.store(true, std::memory_order_release);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_initDone = true;
+    }
+    m_initialized.notify_one();
+
+    if (initialized) {
+        try {
+            while (!m_stopRequested.load(std::memory_order_acquire)) {
+                if (m_callbacks.renderFrame) {
+                    m_callbacks.renderFrame();
+                }
+                glfwSwapBuffers(m_window);
+                if (m_callbacks.frameSwapped) {
+                    m_callbacks.frameSwapped();
+                }
+                m_frameCount.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_error = std::current_exception();
+            m_failed.store(true, std::memory_order_release);
+        }
+
+        // Ƿͷ GL Դ, ʱǵǰ
+        try {
+            if (m_callbacks.shutdown) {
+                m_callbacks.shutdown();
+            }
+        }
+        catch (const std::exception& e) {
+            std::cerr << "ERROR::RENDER_THREAD: Shutdown failed: " << e.what() << std::endl;
+        }
+    }
+
+    glfwMakeContextCurrent(nullptr);
+    m_running.store(false, std::memory_order_release);
+}
+
+// ===== ʹdemo =====
+// // ̴߳ڲ GLAD, ȻĽȾ߳
+// TripleBuffer<FrameSnapshot> snapshots;
+// RenderThread renderThread(window);
+//
+// RenderThread::Callbacks callbacks;
+// callbacks.initialize = [&] { /* ɫ//VAO */ };
+// callbacks.renderFrame = [&] {
+//     snapshots.acquire();
+//     const FrameSnapshot& snapshot = snapshots.getReadBuffer();
+//     /* ֻݿջ */
+// };
+// callbacks.shutdown = [&] { /* ͷ GL Դ */ };
+// renderThread.start(callbacks);
+//
+// FixedTimestep timestep(1.0 / 60.0);
+// timestep.reset(glfwGetTime());
+// while (!glfwWindowShouldClose(window) && !renderThread.hasFailed()) {
+//     glfwWaitEventsTimeout(timestep.getNextStepTime() - glfwGetTime());
+//     uint32_t steps = timestep.advance(glfwGetTime());
+//     for (uint32_t i = 0; i < steps; ++i) { /* simulate(timestep.getStep()) */ }
+//     /* д snapshots.getWriteBuffer() */
+//     snapshots.publish();
+// }
+// renderThread.stop();
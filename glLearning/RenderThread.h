@@ -0,0 +1,69 @@
+#ifndef RENDER_THREAD_H
+#define RENDER_THREAD_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+struct GLFWwindow;
+
+// RenderThread: ռ GL ĵȾ߳.
+// ֻ߳ GLFW ¼ģ; Ⱦ߳ͨ glfwMakeContextCurrent ӹ,
+// ѭִ renderFrame + glfwSwapBuffers. ֱͬڽʱ߳.
+// ֮߳ͨ TripleBuffer , Ⱦصֻܶ, ߳״̬.
+class RenderThread {
+public:
+    struct Callbacks {
+        std::function<void()> initialize;   // ľִһ:  GL Դ
+        std::function<void()> renderFrame;  // ÿִ֡, ֮Ⱦ߳̽
+        std::function<void()> frameSwapped; // ÿִ֮֡ (դͳƳ)
+        std::function<void()> shutdown;     // ˳ǰִһ: ͷ GL Դ
+    };
+
+    explicit RenderThread(GLFWwindow* window);
+    ~RenderThread();
+
+    // ֹ
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+
+    /**
+     * @brief Ⱦ̲߳ȴ initialize .
+     * ǰ߳ϲеǰ (ͷ). initialize ׳쳣׳.
+     */
+    void start(const Callbacks& callbacks);
+
+    // ˳ȴȾ߳̽. Ⱦ߳׳쳣׳
+    void stop();
+
+    bool isRunning() const { return m_running.load(std::memory_order_acquire); }
+
+    // Ⱦ߳쳣˳
+    bool hasFailed() const { return m_failed.load(std::memory_order_acquire); }
+
+    // ѽ֡
+    uint64_t getFrameCount() const { return m_frameCount.load(std::memory_order_relaxed); }
+
+private:
+    void threadMain();
+
+    GLFWwindow* m_window;
+    Callbacks m_callbacks;
+    std::thread m_thread;
+
+    std::atomic<bool> m_running{ false };
+    std::atomic<bool> m_stopRequested{ false };
+    std::atomic<bool> m_failed{ false };
+    std::atomic<uint64_t> m_frameCount{ 0 };
+
+    std::mutex m_mutex;
+    std::condition_variable m_initialized;
+    bool m_initDone = false;
+    std::exception_ptr m_error;  //  m_mutex 
+};
+
+#endif // RENDER_THREAD_H
@@ -0,0 +1,123 @@
+#include "SamplerCache.h"
+#include "GLStateCache.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+
+namespace {
+    bool isMipmapFilter(GLenum filter) {
+        return filter == GL_NEAREST_MIPMAP_NEAREST || filter == GL_LINEAR_MIPMAP_NEAREST
+            || filter == GL_NEAREST_MIPMAP_LINEAR || filter == GL_LINEAR_MIPMAP_LINEAR;
+    }
+}
+
+SamplerCache& SamplerCache::getInstance() {
+    static SamplerCache instance;
+    return instance;
+}
+
+// ===== ȡ =====
+GLuint SamplerCache::getSampler(const Texture::Parameters& params) {
+    Key key = makeKey(params);
+    auto it = m_samplers.find(key);
+    if (it != m_samplers.end()) {
+        return it->second;
+    }
+
+    GLuint sampler = 0;
+    if (GLAD_GL_VERSION_4_5) {
+        glCreateSamplers(1, &sampler);
+    }
+    else {
+        glGenSamplers(1, &sampler);  // Ҫ󶨼
+    }
+    applyParameters(sampler, key);
+    m_samplers.emplace(key, sampler);
+    return sampler;
+}
+
+void SamplerCache::setQuality(const Quality& quality) {
+    m_quality = quality;
+    for (const auto& entry : m_samplers) {
+        applyParameters(entry.second, entry.first);
+    }
+}
+
+void SamplerCache::cleanup() {
+    GLStateCache& state = GLStateCache::getInstance();
+    for (const auto& entry : m_samplers) {
+        state.deleteSampler(entry.second);
+    }
+    m_samplers.clear();
+}
+
+// ===== ˽и =====
+size_t SamplerCache::KeyHash::operator()(const Key& key) const {
+    uint32_t anisotropyBits;
+    std::memcpy(&anisotropyBits, &key.anisotropy, sizeof(anisotropyBits));
+
+    size_t hash = 0;
+    for (uint32_t value : { static_cast<uint32_t>(key.wrapS), static_cast<uint32_t>(key.wrapT),
+        static_cast<uint32_t>(key.wrapR), static_cast<uint32_t>(key.minFilter),
+        static_cast<uint32_t>(key.magFilter), anisotropyBits }) {
+        hash ^= std::hash<uint32_t>()(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
+
+SamplerCache::Key SamplerCache::makeKey(const Texture::Parameters& params) {
+    Key key;
+    key.wrapS = params.wrapS;
+    key.wrapT = params.wrapT;
+    key.wrapR = params.wrapR;
+    key.minFilter = params.minFilter;
+    key.magFilter = params.magFilter;
+    key.anisotropy = std::max(params.anisotropy, 0.0f);  //  0 ʾҪ
+    return key;
+}
+
+void SamplerCache::applyParameters(GLuint sampler, const Key& key) {
+    GLenum minFilter = key.minFilter;
+    if (!m_quality.trilinear && minFilter == GL_LINEAR_MIPMAP_LINEAR) {
+        minFilter = GL_LINEAR_MIPMAP_NEAREST;
+    }
+
+    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_S, key.wrapS);
+    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_T, key.wrapT);
+    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_R, key.wrapR);
+    glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, minFilter);
+    glSamplerParameteri(sampler, GL_TEXTURE_MAG_FILTER, key.magFilter);
+    glSamplerParameterf(sampler, GL_TEXTURE_LOD_BIAS, m_quality.lodBias);
+
+    if (m_maxAnisotropy < 0.0f) {
+        m_maxAnisotropy = 0.0f;
+        if (GLAD_GL_EXT_texture_filter_anisotropic) {
+            glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &m_maxAnisotropy);
+        }
+    }
+    if (m_maxAnisotropy > 0.0f) {
+        // û mipmap ʱû,  1
+        float anisotropy = isMipmapFilter(key.minFilter) ? std::max(key.anisotropy, m_quality.anisotropy) : 1.0f;
+        anisotropy = std::min(std::max(anisotropy, 1.0f), m_maxAnisotropy);
+        glSamplerParameterf(sampler, GL_TEXTURE_MAX_ANISOTROPY_EXT, anisotropy);
+    }
+}
+
+// ===== ʹdemo =====
+// // Ķ, bind ʱԶ󶨹Ĳ
+// Texture::Parameters params;
+// params.anisotropy = 8.0f;
+// Texture diffuse("../texture/wall.jpg", params);
+// diffuse.bind(0);  // glBindTexture + glBindSampler(0, ...)
+//
+// // : ֻ޸Ļеļ
+// SamplerCache::Quality quality;
+// quality.anisotropy = 16.0f;
+// quality.trilinear = true;
+// SamplerCache::getInstance().setQuality(quality);
+//
+// std::cout << SamplerCache::getInstance().getSamplerCount() << " samplers" << std::endl;
+//
+// // Ⱦ߳˳ǰ, ͷ֮
+// SamplerCache::getInstance().cleanup();
@@ -0,0 +1,75 @@
+#ifndef SAMPLER_CACHE_H
+#define SAMPLER_CACHE_H
+
+#include "Texture.h"
+#include <glad/glad.h>
+#include <cstddef>
+#include <unordered_map>
+
+// SamplerCache: 󻺴 (, ֻ GL ߳ʹ)
+//  Texture::Parameters еĲֶ (ơˡ) ȥ, ǧ.
+// Texture::bind ԼĲ󶨵ͬһԪ, ״̬Ĳ.
+//  (ȫָԡԡLOD ƫ) ֻ޸⼸, ޸.
+class SamplerCache {
+public:
+    // ȫֻ, в
+    struct Quality {
+        float anisotropy = 0.0f;  // ȫָԵȼ, ԼҪȡϴֵ. ֻ mipmap Ч
+        bool trilinear = true;    // false ʱ mipmap ֮䲻ֵ (LINEAR_MIPMAP_LINEAR -> LINEAR_MIPMAP_NEAREST)
+        float lodBias = 0.0f;
+    };
+
+    // ȡʵ
+    static SamplerCache& getInstance();
+
+    // ֹ͸ֵ
+    SamplerCache(const SamplerCache&) = delete;
+    void operator=(const SamplerCache&) = delete;
+
+    /**
+     * @brief ȡ (򴴽) ƥĲ. ֻ wrap/minFilter/magFilter/anisotropy.
+     * @return , ɻ, cleanup() ֮ǰһֱЧ
+     */
+    GLuint getSampler(const Texture::Parameters& params);
+
+    // ޸Ļ, ѴĲ (ֲ)
+    void setQuality(const Quality& quality);
+    const Quality& getQuality() const { return m_quality; }
+
+    size_t getSamplerCount() const { return m_samplers.size(); }
+
+    // ɾв (Ⱦ߳˳ǰ). ٰ֮
+    void cleanup();
+
+private:
+    SamplerCache() = default;
+    ~SamplerCache() = default;
+
+    // صĲ
+    struct Key {
+        GLenum wrapS;
+        GLenum wrapT;
+        GLenum wrapR;
+        GLenum minFilter;
+        GLenum magFilter;
+        float anisotropy;
+
+        bool operator==(const Key& other) const {
+            return wrapS == other.wrapS && wrapT == other.wrapT && wrapR == other.wrapR
+                && minFilter == other.minFilter && magFilter == other.magFilter && anisotropy == other.anisotropy;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    static Key makeKey(const Texture::Parameters& params);
+    void applyParameters(GLuint sampler, const Key& key);
+
+    std::unordered_map<Key, GLuint, KeyHash> m_samplers;
+    Quality m_quality;
+    float m_maxAnisotropy = -1.0f;  // Ӳ, ״Ҫʱѯ, 0 ʾ֧
+};
+
+#endif // SAMPLER_CACHE_H
@@ -0,0 +1,48 @@
+#ifndef SCENE_COMPONENTS_H
+#define SCENE_COMPONENTS_H
+
+#include "SceneGraph.h"
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+
+class Animator;
+class Material;
+
+// Ⱦ޳Ͷʹõʵ ( EntityManager / EntitySystems). ƽɿ POD
+
+// 任
+struct Transform {
+    glm::mat4 world = glm::mat4(1.0f);
+};
+
+// ɳͼڵ Transform (EntitySystems::copySceneTransforms)
+struct SceneNode {
+    SceneGraph::NodeId node = SceneGraph::kInvalidNode;
+};
+
+// һ, ֶ RenderQueue::DrawItem Ӧ
+struct MeshRef {
+    const Material* material = nullptr;
+    GLuint vertexArray = 0;
+    uint32_t indexCount = 0;
+    uint32_t firstIndex = 0;
+    int32_t baseVertex = 0;
+    uint8_t layer = 0;
+    bool translucent = false;
+};
+
+// Χ: local , world  EntitySystems::updateBounds  Transform 
+struct Bounds {
+    glm::vec3 localMin = glm::vec3(0.0f);
+    glm::vec3 localMax = glm::vec3(0.0f);
+    glm::vec3 worldMin = glm::vec3(0.0f);
+    glm::vec3 worldMax = glm::vec3(0.0f);
+};
+
+// ɫ, Animator ɵ÷
+struct AnimatorRef {
+    Animator* animator = nullptr;
+};
+
+#endif // SCENE_COMPONENTS_H
@@ -0,0 +1,362 @@
+#include "SceneGraph.h"
+#include "Simd.h"
+#include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    // ÿĽڵ,  Simd::kWidth ı, β
+    const uint32_t kParallelGrain = 4096;
+
+    const float kIdentity[LocalPose::ChannelCount] = {
+        0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f,
+        1.0f, 1.0f, 1.0f,
+    };
+
+    const uint32_t kUnknownDepth = 0xFFFFFFFFu;
+}
+
+SceneGraph::SceneGraph() {
+    for (uint32_t c = 0; c < LocalPose::ChannelCount; ++c) {
+        m_channels[c].assign(LocalPose::kPadding, kIdentity[c]);
+    }
+}
+
+// ===== ڵ =====
+uint32_t SceneGraph::getIndex(NodeId node) const {
+    if (node >= m_indices.size() || m_indices[node] == kInvalidIndex || (m_flags[m_indices[node]] & Removed)) {
+        throw std::runtime_error("ERROR::SCENE_GRAPH: Invalid node " + std::to_string(node));
+    }
+    return m_indices[node];
+}
+
+bool SceneGraph::isValid(NodeId node) const {
+    return node < m_indices.size() && m_indices[node] != kInvalidIndex && !(m_flags[m_indices[node]] & Removed);
+}
+
+SceneGraph::NodeId SceneGraph::createNode(NodeId parent) {
+    return createNode(parent, glm::vec3(0.0f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(1.0f));
+}
+
+SceneGraph::NodeId SceneGraph::createNode(NodeId parent, const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale) {
+    int32_t parentIndex = parent == kInvalidNode ? -1 : static_cast<int32_t>(getIndex(parent));
+    uint32_t depth = parentIndex < 0 ? 0 : m_depths[parentIndex] + 1;
+    uint32_t index = getNodeCount();
+
+    NodeId id;
+    if (!m_freeIds.empty()) {
+        id = m_freeIds.back();
+        m_freeIds.pop_back();
+        m_indices[id] = index;
+    }
+    else {
+        id = static_cast<NodeId>(m_indices.size());
+        m_indices.push_back(index);
+    }
+
+    // ׷ĩβ: ȲСһڵʱ˳ȻЧ (һ)
+    if (!m_orderDirty) {
+        if (index > 0 && depth < m_depths.back()) {
+            m_orderDirty = true;
+        }
+        else if (depth == m_levelStarts.size()) {
+            m_levelStarts.push_back(index);
+        }
+    }
+
+    m_parents.push_back(parentIndex);
+    m_depths.push_back(depth);
+    m_flags.push_back(0);
+    m_nodeIds.push_back(id);
+    m_worldMatrices.emplace_back(1.0f);
+    for (uint32_t c = 0; c < LocalPose::ChannelCount; ++c) {
+        m_channels[c].push_back(kIdentity[c]);  // ĩβĲ
+    }
+    setChannels(index, position, rotation, scale);
+    markDirty(index);
+    return id;
+}
+
+void SceneGraph::destroyNode(NodeId node) {
+    uint32_t index = getIndex(node);
+    m_flags[index] |= Removed;
+    m_orderDirty = true;
+}
+
+void SceneGraph::setParent(NodeId node, NodeId parent) {
+    uint32_t index = getIndex(node);
+    int32_t parentIndex = parent == kInvalidNode ? -1 : static_cast<int32_t>(getIndex(parent));
+    for (int32_t ancestor = parentIndex; ancestor >= 0; ancestor = m_parents[ancestor]) {
+        if (ancestor == static_cast<int32_t>(index)) {
+            throw std::runtime_error("ERROR::SCENE_GRAPH: Cannot parent node " + std::to_string(node) + " to its own subtree");
+        }
+    }
+
+    m_parents[index] = parentIndex;
+    markDirty(index);
+    // ȲʱȻЧ (ͬڵ㻥), ȶҪ
+    uint32_t depth = parentIndex < 0 ? 0 : m_depths[parentIndex] + 1;
+    if (depth != m_depths[index]) {
+        m_orderDirty = true;
+    }
+}
+
+SceneGraph::NodeId SceneGraph::getParent(NodeId node) const {
+    int32_t parentIndex = m_parents[getIndex(node)];
+    return parentIndex < 0 ? kInvalidNode : m_nodeIds[parentIndex];
+}
+
+// ===== ֲ任 =====
+void SceneGraph::setChannels(uint32_t index, const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale) {
+    m_channels[LocalPose::TranslationX][index] = position.x;
+    m_channels[LocalPose::TranslationY][index] = position.y;
+    m_channels[LocalPose::TranslationZ][index] = position.z;
+    m_channels[LocalPose::RotationX][index] = rotation.x;
+    m_channels[LocalPose::RotationY][index] = rotation.y;
+    m_channels[LocalPose::RotationZ][index] = rotation.z;
+    m_channels[LocalPose::RotationW][index] = rotation.w;
+    m_channels[LocalPose::ScaleX][index] = scale.x;
+    m_channels[LocalPose::ScaleY][index] = scale.y;
+    m_channels[LocalPose::ScaleZ][index] = scale.z;
+}
+
+void SceneGraph::setLocalTransform(NodeId node, const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale) {
+    uint32_t index = getIndex(node);
+    setChannels(index, position, rotation, scale);
+    markDirty(index);
+}
+
+void SceneGraph::setLocalPosition(NodeId node, const glm::vec3& position) {
+    uint32_t index = getIndex(node);
+    m_channels[LocalPose::TranslationX][index] = position.x;
+    m_channels[LocalPose::TranslationY][index] = position.y;
+    m_channels[LocalPose::TranslationZ][index] = position.z;
+    markDirty(index);
+}
+
+void SceneGraph::setLocalRotation(NodeId node, const glm::quat& rotation) {
+    uint32_t index = getIndex(node);
+    m_channels[LocalPose::RotationX][index] = rotation.x;
+    m_channels[LocalPose::RotationY][index] = rotation.y;
+    m_channels[LocalPose::RotationZ][index] = rotation.z;
+    m_channels[LocalPose::RotationW][index] = rotation.w;
+    markDirty(index);
+}
+
+void SceneGraph::setLocalScale(NodeId node, const glm::vec3& scale) {
+    uint32_t index = getIndex(node);
+    m_channels[LocalPose::ScaleX][index] = scale.x;
+    m_channels[LocalPose::ScaleY][index] = scale.y;
+    m_channels[LocalPose::ScaleZ][index] = scale.z;
+    markDirty(index);
+}
+
+glm::vec3 SceneGraph::getLocalPosition(NodeId node) const {
+    uint32_t index = getIndex(node);
+    return glm::vec3(m_channels[LocalPose::TranslationX][index], m_channels[LocalPose::TranslationY][index],
+        m_channels[LocalPose::TranslationZ][index]);
+}
+
+glm::quat SceneGraph::getLocalRotation(NodeId node) const {
+    uint32_t index = getIndex(node);
+    return glm::quat(m_channels[LocalPose::RotationW][index], m_channels[LocalPose::RotationX][index],
+        m_channels[LocalPose::RotationY][index], m_channels[LocalPose::RotationZ][index]);
+}
+
+glm::vec3 SceneGraph::getLocalScale(NodeId node) const {
+    uint32_t index = getIndex(node);
+    return glm::vec3(m_channels[LocalPose::ScaleX][index], m_channels[LocalPose::ScaleY][index], m_channels[LocalPose::ScaleZ][index]);
+}
+
+const glm::mat4& SceneGraph::getWorldMatrix(NodeId node) const {
+    return m_worldMatrices[getIndex(node)];
+}
+
+// =====  =====
+void SceneGraph::rebuild() {
+    const uint32_t count = getNodeCount();
+
+    // ȺǷɾ (Լһȱɾ): ظڵҵ֪Ľڵ, 
+    std::vector<uint32_t> depths(count, kUnknownDepth);
+    std::vector<uint8_t> removed(count, 0);
+    std::vector<uint32_t> chain;
+    for (uint32_t i = 0; i < count; ++i) {
+        int32_t node = static_cast<int32_t>(i);
+        while (node >= 0 && depths[node] == kUnknownDepth) {
+            chain.push_back(static_cast<uint32_t>(node));
+            node = m_parents[node];
+        }
+        uint32_t depth = node < 0 ? 0 : depths[node] + 1;
+        uint8_t parentRemoved = node < 0 ? 0 : removed[node];
+        while (!chain.empty()) {
+            uint32_t current = chain.back();
+            chain.pop_back();
+            depths[current] = depth++;
+            parentRemoved = parentRemoved || (m_flags[current] & Removed);
+            removed[current] = parentRemoved;
+        }
+    }
+
+    // ȼ, ͬ㱣ԭ˳
+    std::vector<uint32_t> levelSizes;
+    for (uint32_t i = 0; i < count; ++i) {
+        if (removed[i]) {
+            continue;
+        }
+        if (depths[i] >= levelSizes.size()) {
+            levelSizes.resize(depths[i] + 1, 0);
+        }
+        ++levelSizes[depths[i]];
+    }
+    m_levelStarts.assign(levelSizes.size(), 0);
+    uint32_t liveCount = 0;
+    for (size_t level = 0; level < levelSizes.size(); ++level) {
+        m_levelStarts[level] = liveCount;
+        liveCount += levelSizes[level];
+    }
+    std::vector<uint32_t> next = m_levelStarts;
+    std::vector<uint32_t> newIndices(count, kInvalidIndex);
+    for (uint32_t i = 0; i < count; ++i) {
+        if (!removed[i]) {
+            newIndices[i] = next[depths[i]]++;
+        }
+    }
+
+    std::vector<int32_t> parents(liveCount);
+    std::vector<uint8_t> flags(liveCount);
+    std::vector<NodeId> nodeIds(liveCount);
+    std::vector<glm::mat4> worldMatrices(liveCount);
+    std::vector<float> channels[LocalPose::ChannelCount];
+    for (uint32_t c = 0; c < LocalPose::ChannelCount; ++c) {
+        channels[c].assign(liveCount + LocalPose::kPadding, kIdentity[c]);
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t target = newIndices[i];
+        if (target == kInvalidIndex) {
+            m_indices[m_nodeIds[i]] = kInvalidIndex;
+            m_freeIds.push_back(m_nodeIds[i]);
+            continue;
+        }
+        parents[target] = m_parents[i] < 0 ? -1 : static_cast<int32_t>(newIndices[m_parents[i]]);
+        flags[target] = m_flags[i];
+        nodeIds[target] = m_nodeIds[i];
+        worldMatrices[target] = m_worldMatrices[i];
+        for (uint32_t c = 0; c < LocalPose::ChannelCount; ++c) {
+            channels[c][target] = m_channels[c][i];
+        }
+        m_indices[m_nodeIds[i]] = target;
+    }
+
+    m_depths.resize(liveCount);
+    for (size_t level = 0; level < levelSizes.size(); ++level) {
+        std::fill_n(m_depths.begin() + m_levelStarts[level], levelSizes[level], static_cast<uint32_t>(level));
+    }
+    m_parents.swap(parents);
+    m_flags.swap(flags);
+    m_nodeIds.swap(nodeIds);
+    m_worldMatrices.swap(worldMatrices);
+    for (uint32_t c = 0; c < LocalPose::ChannelCount; ++c) {
+        m_channels[c].swap(channels[c]);
+    }
+    m_orderDirty = false;
+}
+
+// =====  =====
+SceneGraph::UpdateStats SceneGraph::update() {
+    return updateHierarchy(nullptr);
+}
+
+SceneGraph::UpdateStats SceneGraph::update(JobSystem& jobs) {
+    return updateHierarchy(&jobs);
+}
+
+SceneGraph::UpdateStats SceneGraph::updateHierarchy(JobSystem* jobs) {
+    UpdateStats stats;
+    stats.nodeCount = getNodeCount();
+    stats.levelCount = static_cast<uint32_t>(m_levelStarts.size());
+    if (!m_changed && !m_orderDirty) {
+        return stats;
+    }
+    m_changed = false;
+
+    if (m_orderDirty) {
+        rebuild();
+        stats.rebuilt = true;
+        stats.nodeCount = getNodeCount();
+        stats.levelCount = static_cast<uint32_t>(m_levelStarts.size());
+    }
+
+    // һȫɺŴһ, ӽڵĸڵǺ;ǱεĽ
+    for (size_t level = 0; level < m_levelStarts.size(); ++level) {
+        uint32_t begin = m_levelStarts[level];
+        uint32_t end = level + 1 < m_levelStarts.size() ? m_levelStarts[level + 1] : getNodeCount();
+        if (jobs && end - begin > kParallelGrain) {
+            std::atomic<uint32_t> updated{ 0 };
+            jobs->parallelFor(end - begin, kParallelGrain, [&](size_t first, size_t last) {
+                updated += updateRange(begin + static_cast<uint32_t>(first), begin + static_cast<uint32_t>(last));
+            });
+            stats.updatedCount += updated;
+        }
+        else {
+            stats.updatedCount += updateRange(begin, end);
+        }
+    }
+    return stats;
+}
+
+uint32_t SceneGraph::updateRange(uint32_t begin, uint32_t end) {
+    const float* channels[LocalPose::ChannelCount];
+    for (uint32_t c = 0; c < LocalPose::ChannelCount; ++c) {
+        channels[c] = m_channels[c].data();
+    }
+
+    uint32_t updated = 0;
+    bool dirty[Simd::kWidth];
+    glm::mat4 local[Simd::kWidth];
+    for (uint32_t i = begin; i < end; i += Simd::kWidth) {
+        uint32_t count = std::min<uint32_t>(Simd::kWidth, end - i);
+        bool anyDirty = false;
+        for (uint32_t lane = 0; lane < count; ++lane) {
+            uint32_t index = i + lane;
+            int32_t parent = m_parents[index];
+            dirty[lane] = (m_flags[index] & LocalDirty) || (parent >= 0 && (m_flags[parent] & WorldDirty));
+            m_flags[index] = dirty[lane] ? WorldDirty : 0;
+            anyDirty = anyDirty || dirty[lane];
+        }
+        if (!anyDirty) {
+            continue;
+        }
+
+        LocalPose::composeMatrices(channels, i, count, local);
+        for (uint32_t lane = 0; lane < count; ++lane) {
+            if (!dirty[lane]) {
+                continue;
+            }
+            uint32_t index = i + lane;
+            int32_t parent = m_parents[index];
+            if (parent < 0) {
+                m_worldMatrices[index] = local[lane];
+            }
+            else {
+                Simd::multiplyMatrix(glm::value_ptr(m_worldMatrices[parent]), glm::value_ptr(local[lane]),
+                    glm::value_ptr(m_worldMatrices[index]));
+            }
+            ++updated;
+        }
+    }
+    return updated;
+}
+
+// ===== ʹdemo =====
+// SceneGraph scene;
+// SceneGraph::NodeId car = scene.createNode();
+// SceneGraph::NodeId wheel = scene.createNode(car, glm::vec3(1.0f, -0.5f, 1.5f), glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(1.0f));
+//
+// // ÿ֡: ֻĶĽڵ㼰ᱻ
+// scene.setLocalPosition(car, carPosition);
+// scene.setLocalRotation(wheel, glm::angleAxis(wheelAngle, glm::vec3(1.0f, 0.0f, 0.0f)));
+// scene.update(jobs);
+// item.model = &scene.getWorldMatrix(wheel);
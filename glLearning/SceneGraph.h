@@ -0,0 +1,107 @@
+#ifndef SCENE_GRAPH_H
+#define SCENE_GRAPH_H
+
+#include "JobSystem.h"
+#include "LocalPose.h"
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <cstdint>
+#include <vector>
+
+// SceneGraph: 任㼶. ֲ TRS  LocalPose::Channel Ĳ SoA , 󵥶һ,
+// ڵ㰴: ڵӽڵ֮ǰ, ͬһȵĽڵ, Ϊһ.
+//
+// : ޸ľֲ任ֻǸýڵ, update ʱ㴫 "ѱ" ,
+// ֻ㱻޸ĵĽڵ㼰. ֲ Simd::kWidth ڵһ, Ӿ Simd::multiplyMatrix.
+// ͬһĽڵ㻥, update(JobSystem&) ѽϴĲֿ鲢.
+//
+// ṹ仯 (ɾıȵ setParent˳Ĵ) ֻ, һ update ʼʱһ,
+//  / ɾᷴƶ. ˳򴴽ڵʱҪ.
+// NodeId ڽڵڼ䱣ֲ, ɾᱻ.
+class SceneGraph {
+public:
+    using NodeId = uint32_t;
+    static constexpr NodeId kInvalidNode = 0xFFFFFFFFu;
+
+    struct UpdateStats {
+        uint32_t nodeCount = 0;
+        uint32_t updatedCount = 0;  // Ľڵ
+        uint32_t levelCount = 0;
+        bool rebuilt = false;       // Ƿ˴洢
+    };
+
+    SceneGraph();
+
+    NodeId createNode(NodeId parent = kInvalidNode);
+    NodeId createNode(NodeId parent, const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale);
+
+    // ɾڵ㼰. ڵ㱾ʧЧ, һ update ʱһɾ, ֮ǰҪٷ
+    void destroyNode(NodeId node);
+
+    /**
+     * @brief ı丸ڵ (kInvalidNode ʾΪڵ), ־ֲ任.
+     * @throws std::runtime_error parent  node Լĺʱ׳
+     */
+    void setParent(NodeId node, NodeId parent);
+
+    bool isValid(NodeId node) const;
+    NodeId getParent(NodeId node) const;
+
+    // ȴһ update ɾ
+    uint32_t getNodeCount() const { return static_cast<uint32_t>(m_parents.size()); }
+
+    void setLocalTransform(NodeId node, const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale);
+    void setLocalPosition(NodeId node, const glm::vec3& position);
+    void setLocalRotation(NodeId node, const glm::quat& rotation);
+    void setLocalScale(NodeId node, const glm::vec3& scale);
+    glm::vec3 getLocalPosition(NodeId node) const;
+    glm::quat getLocalRotation(NodeId node) const;
+    glm::vec3 getLocalScale(NodeId node) const;
+
+    // һ update . һ update ֮ǰЧ
+    const glm::mat4& getWorldMatrix(NodeId node) const;
+
+    // ̸߳йڵ
+    UpdateStats update();
+
+    // ͬ, ڵ϶Ĳ jobs ϲ. ܵȴ jobs ߳ϵ
+    UpdateStats update(JobSystem& jobs);
+
+private:
+    static constexpr uint32_t kInvalidIndex = 0xFFFFFFFFu;
+
+    enum Flag : uint8_t {
+        LocalDirty = 1,
+        WorldDirty = 2,  //  update , ӽڵݴж
+        Removed = 4,
+    };
+
+    uint32_t getIndex(NodeId node) const;
+    void setChannels(uint32_t index, const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale);
+    void markDirty(uint32_t index) { m_flags[index] |= LocalDirty; m_changed = true; }
+
+    UpdateStats updateHierarchy(JobSystem* jobs);
+
+    // ɾƳ, ȶ, ؽ NodeId ӳ
+    void rebuild();
+
+    //  [begin, end) ڵĽڵ (ͬһ), Ľڵ
+    uint32_t updateRange(uint32_t begin, uint32_t end);
+
+    // 洢˳еĽڵ
+    std::vector<int32_t> m_parents;     // ڵĴ洢±, ڵΪ -1
+    std::vector<uint32_t> m_depths;
+    std::vector<uint8_t> m_flags;
+    std::vector<NodeId> m_nodeIds;
+    std::vector<float> m_channels[LocalPose::ChannelCount];  // ĩβ kPadding λ任, ȡ
+    std::vector<glm::mat4> m_worldMatrices;
+
+    std::vector<uint32_t> m_levelStarts;  // ÿһڵ±
+    bool m_orderDirty = false;
+    bool m_changed = false;  // ϴ update нڵ㱻޸,  update ֱӷ
+
+    std::vector<uint32_t> m_indices;  // NodeId -> 洢±
+    std::vector<NodeId> m_freeIds;
+};
+
+#endif // SCENE_GRAPH_H
@@ -0,0 +1,150 @@
+#include "SceneGraphBenchmark.h"
+#include "Benchmark.h"
+#include "JobSystem.h"
+#include "SceneGraph.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    const uint32_t kChildren = 4;
+    const int kFrames = 10;
+
+    // : ÿڵһ, ֲ任һ
+    struct ScalarNode {
+        glm::vec3 position;
+        glm::quat rotation;
+        glm::vec3 scale;
+        int32_t parent;
+        glm::mat4 world;
+    };
+
+    void updateScalar(std::vector<ScalarNode>& nodes) {
+        for (ScalarNode& node : nodes) {
+            glm::mat4 local = glm::translate(glm::mat4(1.0f), node.position) * glm::mat4_cast(node.rotation)
+                * glm::scale(glm::mat4(1.0f), node.scale);
+            node.world = node.parent < 0 ? local : nodes[node.parent].world * local;
+        }
+    }
+
+    // 2, 4, 8, ... ߳, һΪӲ߳ ( 2)
+    std::vector<uint32_t> makeThreadCounts() {
+        uint32_t hardware = std::max(std::thread::hardware_concurrency(), 2u);
+        std::vector<uint32_t> counts;
+        for (uint32_t count = 2; count < hardware; count *= 2) {
+            counts.push_back(count);
+        }
+        counts.push_back(hardware);
+        return counts;
+    }
+}
+
+SceneGraphBenchmarkResult runSceneGraphBenchmark(uint32_t nodeCount, bool print) {
+    SceneGraphBenchmarkResult result;
+    result.nodeCount = nodeCount;
+
+    // ȴ, ڵǰ, Ҫ. Žӽ 1, ڵ󲻻
+    uint32_t seed = 1;
+    SceneGraph scene;
+    std::vector<ScalarNode> scalarNodes(nodeCount);
+    std::vector<SceneGraph::NodeId> ids(nodeCount);
+    for (uint32_t i = 0; i < nodeCount; ++i) {
+        ScalarNode& node = scalarNodes[i];
+        node.position = (Benchmark::randomVector(seed) - glm::vec3(0.5f)) * 4.0f;
+        glm::vec3 axis = glm::normalize(Benchmark::randomVector(seed) - glm::vec3(0.5f));
+        node.rotation = glm::angleAxis(Benchmark::random(seed) * 6.2831853f, axis);
+        node.scale = glm::vec3(0.9f + Benchmark::random(seed) * 0.2f);
+        node.parent = i == 0 ? -1 : static_cast<int32_t>((i - 1) / kChildren);
+        node.world = glm::mat4(1.0f);
+        ids[i] = scene.createNode(node.parent < 0 ? SceneGraph::kInvalidNode : ids[node.parent], node.position, node.rotation, node.scale);
+    }
+    result.levelCount = scene.update().levelCount;
+
+    // ===== ȷ =====
+    updateScalar(scalarNodes);
+    for (uint32_t i = 0; i < nodeCount; ++i) {
+        const glm::mat4& world = scene.getWorldMatrix(ids[i]);
+        for (int c = 0; c < 4; ++c) {
+            for (int r = 0; r < 4; ++r) {
+                result.maxError = std::max(result.maxError, std::fabs(world[c][r] - scalarNodes[i].world[c][r]));
+            }
+        }
+    }
+
+    // ===== ȫ: glm vs SceneGraph =====
+    Benchmark::TimePoint start = Benchmark::now();
+    for (int frame = 0; frame < kFrames; ++frame) {
+        updateScalar(scalarNodes);
+    }
+    result.scalarMs = Benchmark::millisecondsSince(start) / kFrames;
+
+    const glm::vec3 rootPosition = scene.getLocalPosition(ids[0]);
+    start = Benchmark::now();
+    for (int frame = 0; frame < kFrames; ++frame) {
+        scene.setLocalPosition(ids[0], rootPosition);  // ڵ仯, Ҫ
+        scene.update();
+    }
+    result.fullSingleThreadMs = Benchmark::millisecondsSince(start) / kFrames;
+
+    result.nanosecondsPerNode = result.fullSingleThreadMs * 1e6 / nodeCount;
+
+    // ===== ÿ߳һ JobSystem: ȫ (ÿ֡޸ 1% ڵ)ո =====
+    const uint32_t changedCount = std::max(nodeCount / 100, 1u);
+    for (uint32_t threadCount : makeThreadCounts()) {
+        JobSystem::Settings settings;
+        settings.workerCount = threadCount - 1;
+        JobSystem jobs(settings);
+
+        SceneGraphBenchmarkResult::Run run;
+        run.threadCount = threadCount;
+        scene.setLocalPosition(ids[0], rootPosition);
+        scene.update(jobs);  // Ԥ, ù̶߳
+        start = Benchmark::now();
+        for (int frame = 0; frame < kFrames; ++frame) {
+            scene.setLocalPosition(ids[0], rootPosition);
+            scene.update(jobs);
+        }
+        run.fullMs = Benchmark::millisecondsSince(start) / kFrames;
+        run.speedup = result.fullSingleThreadMs / std::max(run.fullMs, 1e-6);
+
+        double incrementalMs = 0.0;
+        uint32_t incrementalUpdated = 0;
+        for (int frame = 0; frame < kFrames; ++frame) {
+            for (uint32_t i = 0; i < changedCount; ++i) {
+                uint32_t node = std::min(static_cast<uint32_t>(Benchmark::random(seed) * nodeCount), nodeCount - 1);
+                scene.setLocalPosition(ids[node], scalarNodes[node].position + glm::vec3(0.0f, 0.01f, 0.0f));
+            }
+            start = Benchmark::now();
+            incrementalUpdated += scene.update(jobs).updatedCount;
+            incrementalMs += Benchmark::millisecondsSince(start);
+        }
+        run.incrementalMs = incrementalMs / kFrames;
+        run.incrementalUpdated = incrementalUpdated / kFrames;
+
+        start = Benchmark::now();
+        for (int frame = 0; frame < kFrames; ++frame) {
+            scene.update(jobs);
+        }
+        run.idleMs = Benchmark::millisecondsSince(start) / kFrames;
+        result.runs.push_back(run);
+    }
+
+    if (print) {
+        std::cout << "===== Scene graph benchmark (" << nodeCount << " nodes, " << result.levelCount << " levels, "
+            << std::thread::hardware_concurrency() << " hardware threads) =====" << std::endl;
+        std::cout << "full glm:          " << result.scalarMs << " ms/frame" << std::endl;
+        std::cout << "full 1 thread:     " << result.fullSingleThreadMs << " ms/frame ("
+            << result.scalarMs / std::max(result.fullSingleThreadMs, 1e-6) << "x), " << result.nanosecondsPerNode
+            << " ns/node, max error " << result.maxError << std::endl;
+        for (const SceneGraphBenchmarkResult::Run& run : result.runs) {
+            std::cout << run.threadCount << " threads:" << std::string(run.threadCount < 10 ? 9 : 8, ' ')
+                << "full " << run.fullMs << " ms/frame (" << run.speedup << "x), 1% changed " << run.incrementalMs
+                << " ms (" << run.incrementalUpdated << " nodes updated), no change " << run.idleMs << " ms" << std::endl;
+        }
+    }
+    return result;
+}
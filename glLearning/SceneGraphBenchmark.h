@@ -0,0 +1,36 @@
+#ifndef SCENE_GRAPH_BENCHMARK_H
+#define SCENE_GRAPH_BENCHMARK_H
+
+#include <cstdint>
+#include <vector>
+
+// ͼ׼: ֲ任Ĳ, Ա
+//   ڵ glm  (AoS, ݹ˳)  SceneGraph ߳ȫ,
+//   ٶ 2, 4, ... ߳ (ֱӲ߳) һ JobSystem, Ⲣȫ¡
+//   ÿ֡޸ 1% ڵ, Լû޸ʱĿո
+struct SceneGraphBenchmarkResult {
+    struct Run {
+        uint32_t threadCount = 0;          // ߳ + ߳
+        double fullMs = 0.0;               // ޸ĸڵ, SceneGraph::update(jobs)
+        double speedup = 0.0;              // fullSingleThreadMs / fullMs
+        double incrementalMs = 0.0;        // ޸ 1% ڵ, и
+        uint32_t incrementalUpdated = 0;   // Ľڵ ()
+        double idleMs = 0.0;               // û޸ʱĸ
+    };
+
+    uint32_t nodeCount = 0;
+    uint32_t levelCount = 0;
+    double scalarMs = 0.0;             // glm, ÿڵ translate * mat4_cast * scale ٳ˸
+    double fullSingleThreadMs = 0.0;   // ޸ĸڵ, SceneGraph::update()
+    double nanosecondsPerNode = 0.0;   // ߳ȫÿڵĺʱ, ڵ߳
+    std::vector<Run> runs;
+    float maxError = 0.0f;             //  glm 
+};
+
+/**
+ * @brief л׼ӡ (main  --bench-scene ).
+ * ڲΪÿ߳Լ JobSystem, ʱӦ JobSystem Ĺ߳
+ */
+SceneGraphBenchmarkResult runSceneGraphBenchmark(uint32_t nodeCount = 1000000, bool print = true);
+
+#endif // SCENE_GRAPH_BENCHMARK_H
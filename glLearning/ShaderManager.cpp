@@ -53,6 +53,52 @@ ShaderPtr ShaderManager::load(const std::string& name, const std::string& vertex
     return nullptr;
 }
 
+// ɫ
+ShaderPtr ShaderManager::loadVariant(const std::string& name, const std::string& vertexPath, const std::string& fragmentPath,
+    const std::vector<std::string>& defines) {
+    std::string key = name;
+    for (const std::string& define : defines) {
+        key += "|" + define;
+    }
+    if (m_shaderCache.count(key)) {
+        return m_shaderCache[key];
+    }
+
+    std::cout << "SHADER_MANAGER: Loading shader variant '" << key << "' from files..." << std::endl;
+    try {
+        auto shader = std::make_shared<Shader>(vertexPath, fragmentPath, "", defines);
+        if (shader->isValid()) {
+            m_shaderCache[key] = shader;
+            return shader;
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "SHADER_MANAGER: Failed to load shader '" << key << "'.\n" << e.what() << std::endl;
+    }
+
+    return nullptr;
+}
+
+// ؼɫ
+ShaderPtr ShaderManager::loadCompute(const std::string& name, const std::string& computePath) {
+    if (m_shaderCache.count(name)) {
+        return m_shaderCache[name];
+    }
+
+    std::cout << "SHADER_MANAGER: Loading compute shader '" << name << "' from file..." << std::endl;
+    try {
+        auto shader = std::make_shared<Shader>(computePath);
+        if (shader->isValid()) {
+            m_shaderCache[name] = shader;
+            return shader;
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "SHADER_MANAGER: Failed to load shader '" << name << "'.\n" << e.what() << std::endl;
+    }
+
+    return nullptr;
+}
 
 // ͨȡɫ
 ShaderPtr ShaderManager::get(const std::string& name) const {
@@ -5,6 +5,7 @@
 #include <string>
 #include <unordered_map>
 #include <memory>
+#include <vector>
 
 // ShaderManagerһ࣬ء洢ṩShaderķ
 class ShaderManager {
@@ -35,6 +36,25 @@ public:
      */
     ShaderPtr load(const std::string& name, const std::string& vertexPath, const std::string& fragmentPath, const std::string& geometryPath);
 
+    /**
+     * @brief (ȡѼص)һɫ.
+     * @param name . Ϊ "|1|2...", ͬһԴļĲͬϸԻ.
+     * @param vertexPath ɫļ·.
+     * @param fragmentPath Ƭɫļ·.
+     * @param defines 뵽 #version ֮ĺ궨,  { "USE_NORMAL_MAP" }.
+     * @return һָShaderĹָ. ʧ򷵻nullptr.
+     */
+    ShaderPtr loadVariant(const std::string& name, const std::string& vertexPath, const std::string& fragmentPath,
+        const std::vector<std::string>& defines);
+
+    /**
+     * @brief (ȡѼص)һɫ.
+     * @param name ڹΨһʶɫı.
+     * @param computePath ɫļ·.
+     * @return һָShaderĹָ. ʧ򷵻nullptr.
+     */
+    ShaderPtr loadCompute(const std::string& name, const std::string& computePath);
+
     /**
      * @brief ͨȡһѾصɫ.
      * @param name ɫı.
@@ -0,0 +1,113 @@
+#ifndef SIMD_H
+#define SIMD_H
+
+// Simd: SoA õС SIMD װ, ѡ.
+//   /arch:AVX  ( __AVX__)  8 · __m256
+//   x86 / x64                        4 · __m128 (SSE2  x64 Ļ)
+//   ƽ̨                          1 ·
+// ϲ㰴 kWidth дһݴ, ֿȶܱ. дҪ, 鳤ɵ÷뵽 kWidth ı.
+// Ƚ (greaterEqual) õֻ maskAnd ,  maskBits ȡ,  i λӦ i ͨ.
+#if defined(__AVX__)
+#include <immintrin.h>
+#define SIMD_AVX 1
+#elif defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define SIMD_SSE 1
+#else
+#include <cmath>
+#endif
+
+class Simd {
+public:
+#if defined(SIMD_AVX)
+    using Float = __m256;
+    static constexpr int kWidth = 8;
+
+    static Float load(const float* p) { return _mm256_loadu_ps(p); }
+    static void store(float* p, Float v) { _mm256_storeu_ps(p, v); }
+    static Float set1(float value) { return _mm256_set1_ps(value); }
+    static Float add(Float a, Float b) { return _mm256_add_ps(a, b); }
+    static Float sub(Float a, Float b) { return _mm256_sub_ps(a, b); }
+    static Float mul(Float a, Float b) { return _mm256_mul_ps(a, b); }
+    static Float div(Float a, Float b) { return _mm256_div_ps(a, b); }
+    static Float sqrt(Float a) { return _mm256_sqrt_ps(a); }
+    // sign Ϊ (λΪ 1) ͨȡ value
+    static Float flipSign(Float value, Float sign) { return _mm256_xor_ps(value, _mm256_and_ps(sign, _mm256_set1_ps(-0.0f))); }
+    static Float greaterEqual(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+    static Float maskAnd(Float a, Float b) { return _mm256_and_ps(a, b); }
+    static int maskBits(Float mask) { return _mm256_movemask_ps(mask); }
+#elif defined(SIMD_SSE)
+    using Float = __m128;
+    static constexpr int kWidth = 4;
+
+    static Float load(const float* p) { return _mm_loadu_ps(p); }
+    static void store(float* p, Float v) { _mm_storeu_ps(p, v); }
+    static Float set1(float value) { return _mm_set1_ps(value); }
+    static Float add(Float a, Float b) { return _mm_add_ps(a, b); }
+    static Float sub(Float a, Float b) { return _mm_sub_ps(a, b); }
+    static Float mul(Float a, Float b) { return _mm_mul_ps(a, b); }
+    static Float div(Float a, Float b) { return _mm_div_ps(a, b); }
+    static Float sqrt(Float a) { return _mm_sqrt_ps(a); }
+    static Float flipSign(Float value, Float sign) { return _mm_xor_ps(value, _mm_and_ps(sign, _mm_set1_ps(-0.0f))); }
+    static Float greaterEqual(Float a, Float b) { return _mm_cmpge_ps(a, b); }
+    static Float maskAnd(Float a, Float b) { return _mm_and_ps(a, b); }
+    static int maskBits(Float mask) { return _mm_movemask_ps(mask); }
+#else
+    using Float = float;
+    static constexpr int kWidth = 1;
+
+    static Float load(const float* p) { return *p; }
+    static void store(float* p, Float v) { *p = v; }
+    static Float set1(float value) { return value; }
+    static Float add(Float a, Float b) { return a + b; }
+    static Float sub(Float a, Float b) { return a - b; }
+    static Float mul(Float a, Float b) { return a * b; }
+    static Float div(Float a, Float b) { return a / b; }
+    static Float sqrt(Float a) { return std::sqrt(a); }
+    static Float flipSign(Float value, Float sign) { return std::signbit(sign) ? -value : value; }
+    static Float greaterEqual(Float a, Float b) { return a >= b ? 1.0f : 0.0f; }
+    static Float maskAnd(Float a, Float b) { return a * b; }
+    static int maskBits(Float mask) { return mask != 0.0f ? 1 : 0; }
+#endif
+
+    // a * b + c
+    static Float madd(Float a, Float b, Float c) { return add(mul(a, b), c); }
+
+    /**
+     * @brief 4x4  out = a * b ( glm Ĳһ). out  a  b ͬ.
+     * Ȼ 4 ·, AVX ͬʹ SSE.
+     */
+    static void multiplyMatrix(const float* a, const float* b, float* out) {
+#if defined(SIMD_AVX) || defined(SIMD_SSE)
+        __m128 a0 = _mm_loadu_ps(a);
+        __m128 a1 = _mm_loadu_ps(a + 4);
+        __m128 a2 = _mm_loadu_ps(a + 8);
+        __m128 a3 = _mm_loadu_ps(a + 12);
+        __m128 columns[4];
+        for (int c = 0; c < 4; ++c) {
+            const float* column = b + c * 4;
+            columns[c] = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(a0, _mm_set1_ps(column[0])), _mm_mul_ps(a1, _mm_set1_ps(column[1]))),
+                _mm_add_ps(_mm_mul_ps(a2, _mm_set1_ps(column[2])), _mm_mul_ps(a3, _mm_set1_ps(column[3]))));
+        }
+        for (int c = 0; c < 4; ++c) {
+            _mm_storeu_ps(out + c * 4, columns[c]);
+        }
+#else
+        float result[16];
+        for (int c = 0; c < 4; ++c) {
+            for (int r = 0; r < 4; ++r) {
+                result[c * 4 + r] = a[r] * b[c * 4] + a[4 + r] * b[c * 4 + 1] + a[8 + r] * b[c * 4 + 2] + a[12 + r] * b[c * 4 + 3];
+            }
+        }
+        for (int i = 0; i < 16; ++i) {
+            out[i] = result[i];
+        }
+#endif
+    }
+
+private:
+    Simd() = delete;
+};
+
+#endif // SIMD_H
@@ -0,0 +1,63 @@
+#include "Skeleton.h"
+#include "Simd.h"
+#include <glm/gtc/type_ptr.hpp>
+#include <stdexcept>
+#include <utility>
+
+uint32_t Skeleton::addJoint(const std::string& name, int32_t parent, const glm::vec3& translation, const glm::quat& rotation,
+    const glm::vec3& scale, const glm::mat4& inverseBind) {
+    uint32_t joint = getJointCount();
+    if (joint >= kMaxJoints) {
+        throw std::runtime_error("ERROR::SKELETON: Too many joints (max " + std::to_string(kMaxJoints) + ")");
+    }
+    if (parent != kNoParent && (parent < 0 || static_cast<uint32_t>(parent) >= joint)) {
+        throw std::runtime_error("ERROR::SKELETON: Joint '" + name + "' added before its parent");
+    }
+    m_names.push_back(name);
+    m_parents.push_back(parent);
+    m_inverseBind.push_back(inverseBind);
+
+    // ֻڼʱ, ֱؽ
+    LocalPose bindPose(joint + 1);
+    for (uint32_t i = 0; i < joint; ++i) {
+        bindPose.setJoint(i, m_bindPose.getTranslation(i), m_bindPose.getRotation(i), m_bindPose.getScale(i));
+    }
+    bindPose.setJoint(joint, translation, rotation, scale);
+    m_bindPose = std::move(bindPose);
+    return joint;
+}
+
+int32_t Skeleton::findJoint(const std::string& name) const {
+    for (size_t i = 0; i < m_names.size(); ++i) {
+        if (m_names[i] == name) {
+            return static_cast<int32_t>(i);
+        }
+    }
+    return -1;
+}
+
+void Skeleton::computeSkinningMatrices(const LocalPose& pose, glm::mat4* modelMatrices, glm::mat4* palette) const {
+    if (pose.getJointCount() != getJointCount()) {
+        throw std::runtime_error("ERROR::SKELETON: Pose does not match skeleton");
+    }
+    pose.computeLocalMatrices(modelMatrices);
+
+    // ؽǰ, ˳ɨʱؽѾģͿռ
+    const uint32_t jointCount = getJointCount();
+    for (uint32_t i = 0; i < jointCount; ++i) {
+        int32_t parent = m_parents[i];
+        if (parent != kNoParent) {
+            Simd::multiplyMatrix(glm::value_ptr(modelMatrices[parent]), glm::value_ptr(modelMatrices[i]),
+                glm::value_ptr(modelMatrices[i]));
+        }
+        Simd::multiplyMatrix(glm::value_ptr(modelMatrices[i]), glm::value_ptr(m_inverseBind[i]), glm::value_ptr(palette[i]));
+    }
+}
+
+// ===== ʹdemo =====
+// Skeleton skeleton;
+// uint32_t hips = skeleton.addJoint("hips", Skeleton::kNoParent, hipsT, hipsR, glm::vec3(1.0f), hipsInverseBind);
+// uint32_t spine = skeleton.addJoint("spine", hips, spineT, spineR, glm::vec3(1.0f), spineInverseBind);
+//
+// std::vector<glm::mat4> model(skeleton.getJointCount()), palette(skeleton.getJointCount());
+// skeleton.computeSkinningMatrices(skeleton.getBindPose(), model.data(), palette.data());  // ȫǵλ
@@ -0,0 +1,51 @@
+#ifndef SKELETON_H
+#define SKELETON_H
+
+#include "LocalPose.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Skeleton: ؽڲ㼶ƺ󶨾, нɫʵһ.
+// ؽڰؽǰ˳, ֲģͿռֻ˳ɨһ.
+class Skeleton {
+public:
+    static constexpr uint32_t kMaxJoints = 256;  // Ƥɫеɫ
+    static constexpr int32_t kNoParent = -1;
+
+    /**
+     * @brief һؽ, ±.
+     * @param parent ؽ± ()  kNoParent
+     * @param inverseBind ģͿռ䵽ؽڿռ󶨾, ƤĹؽڴλ
+     * @throws std::runtime_error  kMaxJoints 򸸹ؽЧʱ׳
+     */
+    uint32_t addJoint(const std::string& name, int32_t parent, const glm::vec3& translation, const glm::quat& rotation,
+        const glm::vec3& scale, const glm::mat4& inverseBind);
+
+    uint32_t getJointCount() const { return static_cast<uint32_t>(m_parents.size()); }
+    int32_t getParent(uint32_t joint) const { return m_parents[joint]; }
+    const std::string& getJointName(uint32_t joint) const { return m_names[joint]; }
+    const glm::mat4& getInverseBindMatrix(uint32_t joint) const { return m_inverseBind[joint]; }
+
+    // Ҳ -1
+    int32_t findJoint(const std::string& name) const;
+
+    // ûжĹؽڱְ
+    const LocalPose& getBindPose() const { return m_bindPose; }
+
+    /**
+     * @brief Ƥɫ palette[i] = model[i] * inverseBind[i].
+     * @param modelMatrices ÿؽڵģͿռ,  getJointCount() 
+     * @param palette  getJointCount() , ֱϴ SkinningBuffer
+     */
+    void computeSkinningMatrices(const LocalPose& pose, glm::mat4* modelMatrices, glm::mat4* palette) const;
+
+private:
+    std::vector<std::string> m_names;
+    std::vector<int32_t> m_parents;
+    std::vector<glm::mat4> m_inverseBind;
+    LocalPose m_bindPose;
+};
+
+#endif // SKELETON_H
@@ -0,0 +1,104 @@
+#include "SkinningBuffer.h"
+#include <stdexcept>
+
+SkinningBuffer::SkinningBuffer()
+    : m_storage(GLAD_GL_VERSION_4_3 != 0) {
+    if (!m_storage) {
+        // ÿε GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT (ͨ 256 ֽ)
+        GLint alignment = 256;
+        glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+        m_alignment = static_cast<uint32_t>((alignment + sizeof(glm::mat4) - 1) / sizeof(glm::mat4));
+        if (m_alignment == 0) {
+            m_alignment = 1;
+        }
+    }
+}
+
+std::vector<std::string> SkinningBuffer::getShaderDefines() const {
+    if (m_storage) {
+        return { "USE_STORAGE_BUFFER" };
+    }
+    return {};
+}
+
+void SkinningBuffer::prepareShader(const Shader& shader) const {
+    GLuint program = shader.getProgram();
+    if (m_storage) {
+        GLuint index = glGetProgramResourceIndex(program, GL_SHADER_STORAGE_BLOCK, kBlockName);
+        if (index != GL_INVALID_INDEX) {
+            glShaderStorageBlockBinding(program, index, kBinding);
+        }
+    }
+    else {
+        GLuint index = glGetUniformBlockIndex(program, kBlockName);
+        if (index != GL_INVALID_INDEX) {
+            glUniformBlockBinding(program, index, kBinding);
+        }
+    }
+}
+
+void SkinningBuffer::beginFrame() {
+    m_matrices.clear();
+}
+
+uint32_t SkinningBuffer::addPalette(const glm::mat4* matrices, uint32_t count) {
+    if (!m_storage) {
+        if (count > kUniformPaletteSize) {
+            throw std::runtime_error("ERROR::SKINNING_BUFFER: Palette of " + std::to_string(count)
+                + " joints exceeds the uniform buffer limit");
+        }
+        size_t aligned = (m_matrices.size() + m_alignment - 1) / m_alignment * m_alignment;
+        m_matrices.resize(aligned);
+    }
+    uint32_t offset = static_cast<uint32_t>(m_matrices.size());
+    m_matrices.insert(m_matrices.end(), matrices, matrices + count);
+    return offset;
+}
+
+void SkinningBuffer::upload() {
+    if (m_matrices.empty()) {
+        return;
+    }
+    size_t bytes = m_matrices.size() * sizeof(glm::mat4);
+    // UBO ·ǰ kUniformPaletteSize , ĩβ֤ΧԽ
+    size_t capacity = m_storage ? bytes : bytes + kUniformPaletteSize * sizeof(glm::mat4);
+
+    GLenum target = m_storage ? GL_SHADER_STORAGE_BUFFER : GL_UNIFORM_BUFFER;
+    if (!m_buffer) {
+        m_buffer = std::make_unique<GpuBuffer>(target, nullptr, capacity, GL_STREAM_DRAW);
+    }
+    // ·ͬСĴ洢 (ɴ洢), õһ֡Ļƶ
+    size_t size = m_buffer->getSize();
+    m_buffer->setData(nullptr, capacity > size ? capacity + capacity / 2 : size);
+    m_buffer->updateData(0, m_matrices.data(), bytes);
+}
+
+uint32_t SkinningBuffer::bind(uint32_t paletteOffset) const {
+    if (!m_buffer) {
+        return 0;
+    }
+    if (m_storage) {
+        m_buffer->bindBase(kBinding);
+        return paletteOffset;
+    }
+    m_buffer->bindRange(kBinding, size_t(paletteOffset) * sizeof(glm::mat4), kUniformPaletteSize * sizeof(glm::mat4));
+    return 0;
+}
+
+// ===== ʹdemo =====
+// SkinningBuffer skinning;
+// Shader skinnedShader("../Shader/skinned.vs", "../Shader/skinned.fs", "", skinning.getShaderDefines());
+// skinning.prepareShader(skinnedShader);
+//
+// // ÿ֡: ɫ֮
+// skinning.beginFrame();
+// for (Character& character : characters)
+//     character.paletteOffset = skinning.addPalette(character.animator->getSkinningMatrices(), jointCount);
+// skinning.upload();
+//
+// skinnedShader.use();
+// for (Character& character : characters) {
+//     skinnedShader.setUInt("paletteOffset", skinning.bind(character.paletteOffset));
+//     skinnedShader.setMat4("model", character.transform);
+//     ... character.model Ķ, ...
+// }
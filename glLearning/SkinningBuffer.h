@@ -0,0 +1,63 @@
+#ifndef SKINNING_BUFFER_H
+#define SKINNING_BUFFER_H
+
+#include "GpuBuffer.h"
+#include "Shader.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// SkinningBuffer: ÿ֡нɫƤɫռһ, һϴ.
+//   GL 4.3+  SSBO, һ, ÿλֻɫ (uniform paletteOffset)
+//   GL 3.3   UBO, ÿλ glBindBufferRange 󶨸ýɫһ, ɫ kUniformPaletteSize 
+// ɫ (Shader/skinned.vs, Shader/skin.comp) еĿΪ SkinningPalette,  prepareShader 󶨵 kBinding.
+class SkinningBuffer {
+public:
+    static constexpr GLuint kBinding = 1;
+    static constexpr const char* kBlockName = "SkinningPalette";
+    static constexpr uint32_t kUniformPaletteSize = 256;  // 256  mat4 = 16KB, GL_MAX_UNIFORM_BLOCK_SIZE ͱ֤
+
+    SkinningBuffer();
+
+    // ֹ
+    SkinningBuffer(const SkinningBuffer&) = delete;
+    SkinningBuffer& operator=(const SkinningBuffer&) = delete;
+
+    bool usesStorageBuffer() const { return m_storage; }
+
+    // Ƥɫʱ׷ӵĺ (SSBO ·Ϊ USE_STORAGE_BUFFER)
+    std::vector<std::string> getShaderDefines() const;
+
+    // ɫе SkinningPalette 󶨵 kBinding. ÿɫӺһ
+    void prepareShader(const Shader& shader) const;
+
+    // ձ֡ĵɫ
+    void beginFrame();
+
+    /**
+     * @brief ׷һɫ,  (Ծ), ʱ bind.
+     * @throws std::runtime_error UBO · count  kUniformPaletteSize ʱ׳
+     */
+    uint32_t addPalette(const glm::mat4* matrices, uint32_t count);
+
+    // ϴ֡ȫɫ (GL ߳, ֮ǰ)
+    void upload();
+
+    /**
+     * @brief  addPalette صĵɫ, ɫ paletteOffset Ӧõֵ.
+     * SSBO ·ֻڵһ, UBO ·ÿΰһβ 0.
+     */
+    uint32_t bind(uint32_t paletteOffset) const;
+
+    uint32_t getMatrixCount() const { return static_cast<uint32_t>(m_matrices.size()); }
+
+private:
+    bool m_storage;
+    uint32_t m_alignment = 1;  // UBO ·µɫĶ (Ծ)
+    std::vector<glm::mat4> m_matrices;
+    std::unique_ptr<GpuBuffer> m_buffer;
+};
+
+#endif // SKINNING_BUFFER_H
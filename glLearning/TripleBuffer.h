@@ -0,0 +1,66 @@
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+
+#include <atomic>
+#include <cstdint>
+
+// TripleBuffer:  / ߵ彻.
+// дԼĻдһ, publish() м仺彻;
+//  acquire() ʱм仺廻. ˫ȴԷ,
+// õһη, мûľֱӱ.
+template<typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() = default;
+
+    // ֹ
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    // ===== д (߳) =====
+
+    /**
+     * @brief ǰдĻ. ɴη֮ǰľ, ǰдһ.
+     */
+    T& getWriteBuffer() { return m_slots[m_writeIndex].value; }
+
+    // д, һлд
+    void publish() {
+        uint8_t previous = m_shared.exchange(static_cast<uint8_t>(m_writeIndex | kNewBit),
+            std::memory_order_acq_rel);
+        m_writeIndex = previous & kIndexMask;
+    }
+
+    // =====  (߳) =====
+
+    /**
+     * @brief ȡ·.
+     * @return ʱ true; 屣һε.
+     */
+    bool acquire() {
+        if ((m_shared.load(std::memory_order_relaxed) & kNewBit) == 0) {
+            return false;
+        }
+        uint8_t previous = m_shared.exchange(m_readIndex, std::memory_order_acq_rel);
+        m_readIndex = previous & kIndexMask;
+        return true;
+    }
+
+    const T& getReadBuffer() const { return m_slots[m_readIndex].value; }
+
+private:
+    static constexpr uint8_t kIndexMask = 0x3;
+    static constexpr uint8_t kNewBit = 0x4;
+
+    // ÿռ, д˫α
+    struct alignas(64) Slot {
+        T value{};
+    };
+
+    Slot m_slots[3];
+    alignas(64) std::atomic<uint8_t> m_shared{ 1 };  // м仺± | Ƿδ
+    alignas(64) uint8_t m_writeIndex = 0;            // ֻд
+    alignas(64) uint8_t m_readIndex = 2;             // ֻɶ
+};
+
+#endif // TRIPLE_BUFFER_H
@@ -1,4 +1,5 @@
 #include "VertexArray.h"
+#include "GLStateCache.h"
 
 VertexArray::VertexArray() {
     glGenVertexArrays(1, &m_rendererID);
@@ -6,22 +7,25 @@ VertexArray::VertexArray() {
 
 VertexArray::~VertexArray() {
     if (m_rendererID != 0) {
-        glDeleteVertexArrays(1, &m_rendererID);
+        GLStateCache::getInstance().deleteVertexArray(m_rendererID);
     }
 }
 
 VertexArray::VertexArray(VertexArray&& other) noexcept
-    : m_rendererID(other.m_rendererID) {
+    : m_rendererID(other.m_rendererID), m_attributeCount(other.m_attributeCount) {
     other.m_rendererID = 0;
+    other.m_attributeCount = 0;
 }
 
 VertexArray& VertexArray::operator=(VertexArray&& other) noexcept {
     if (this != &other) {
         if (m_rendererID != 0) {
-            glDeleteVertexArrays(1, &m_rendererID);
+            GLStateCache::getInstance().deleteVertexArray(m_rendererID);
         }
         m_rendererID = other.m_rendererID;
+        m_attributeCount = other.m_attributeCount;
         other.m_rendererID = 0;
+        other.m_attributeCount = 0;
     }
     return *this;
 }
@@ -33,19 +37,51 @@ void VertexArray::addBuffer(const VertexBuffer& vb, const VertexBufferLayout& la
     uintptr_t offset = 0;
     for (GLuint i = 0; i < elements.size(); ++i) {
         const auto& element = elements[i];
-        glEnableVertexAttribArray(i);
-        glVertexAttribPointer(i, element.count, element.type, element.normalized,
+        GLuint location = m_attributeCount + i;
+        glEnableVertexAttribArray(location);
+        glVertexAttribPointer(location, element.count, element.type, element.normalized,
             layout.getStride(), (const void*)offset);
+        if (element.divisor != 0) {
+            glVertexAttribDivisor(location, element.divisor);
+        }
         offset += element.count * VertexAttribute::getSizeOfType(element.type);
     }
+    m_attributeCount += static_cast<GLuint>(elements.size());
+}
+
+void VertexArray::setIndexBuffer(const IndexBuffer& ib) {
+    bind();
+    ib.bind();
+}
+
+void VertexArray::drawInstanced(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex,
+    int32_t baseVertex, uint32_t baseInstance, GLenum mode) const {
+    bind();
+    const void* indexOffset = (const void*)(uintptr_t(firstIndex) * sizeof(uint32_t));
+
+    if (baseInstance != 0) {
+        // baseInstance  GL 4.2 (ARB_base_instance), 3.3 кָΪ
+        if (!GLAD_GL_VERSION_4_2) {
+            throw std::runtime_error("ERROR::VERTEX_ARRAY: baseInstance requires OpenGL 4.2");
+        }
+        glDrawElementsInstancedBaseVertexBaseInstance(mode, indexCount, GL_UNSIGNED_INT,
+            indexOffset, instanceCount, baseVertex, baseInstance);
+    }
+    else if (baseVertex != 0) {
+        glDrawElementsInstancedBaseVertex(mode, indexCount, GL_UNSIGNED_INT,
+            indexOffset, instanceCount, baseVertex);
+    }
+    else {
+        glDrawElementsInstanced(mode, indexCount, GL_UNSIGNED_INT, indexOffset, instanceCount);
+    }
 }
 
 void VertexArray::bind() const {
-    glBindVertexArray(m_rendererID);
+    GLStateCache::getInstance().bindVertexArray(m_rendererID);
 }
 
 void VertexArray::unbind() const {
-    glBindVertexArray(0);
+    GLStateCache::getInstance().bindVertexArray(0);
 }
 
 
@@ -105,4 +141,30 @@ void main() {
 
     // vao, vbo, ibo, shader  main ʱԶ٣ͷGPUԴ
 }
-*/
\ No newline at end of file
+*/
+
+/*ʵdemo ( Shader/instanced.vs)
+
+    // 𶥵: ͬλ + ɫ
+    VertexBufferLayout vertexLayout;
+    vertexLayout.push<float>(3);           // location 0: λ
+    vertexLayout.push<float>(3);           // location 1: ɫ
+
+    // ʵ: ÿʵһ mat4, ռ location 2..5
+    std::vector<glm::mat4> transforms(100000);
+    auto instanceVbo = std::make_unique<VertexBuffer>(transforms.data(),
+        uint32_t(transforms.size() * sizeof(glm::mat4)), GL_STREAM_DRAW);
+    VertexBufferLayout instanceLayout;
+    instanceLayout.pushInstanceMatrix();
+
+    vao->addBuffer(*vbo, vertexLayout);
+    vao->addBuffer(*instanceVbo, instanceLayout);
+    vao->setIndexBuffer(*ibo);
+
+    while (!glfwWindowShouldClose(window)) {
+        // ÿֻ֡ϴһʵ, һλƵûȫʵ
+        instanceVbo->setData(transforms.data(), uint32_t(transforms.size() * sizeof(glm::mat4)));
+        shader->use();
+        vao->drawInstanced(ibo->getCount(), uint32_t(transforms.size()));
+    }
+*/
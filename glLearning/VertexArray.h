@@ -2,6 +2,7 @@
 #define VERTEX_ARRAY_H
 
 #include "VertexBuffer.h"
+#include "IndexBuffer.h"
 #include <vector>
 #include <glad/glad.h>
 #include <stdexcept>
@@ -11,6 +12,7 @@ struct VertexAttribute {
     GLuint type;
     GLuint count;
     GLboolean normalized;
+    GLuint divisor;  // 0: 𶥵; N: ÿ N ʵǰһ (glVertexAttribDivisor)
 
     static GLuint getSizeOfType(GLuint type) {
         switch (type) {
@@ -34,23 +36,47 @@ public:
         throw std::runtime_error("Unsupported type for VertexBufferLayout!");
     }
 
+    // ʵ, divisor ʾÿٸʵǰһ
+    template<typename T>
+    void pushInstanced(GLuint count, GLuint divisor = 1) {
+        throw std::runtime_error("Unsupported type for VertexBufferLayout!");
+    }
+
+    // ʵ mat4 (ʵ任), ռ 4  vec4 Բ
+    void pushInstanceMatrix(GLuint divisor = 1) {
+        for (int column = 0; column < 4; ++column) {
+            pushAttribute(GL_FLOAT, 4, GL_FALSE, divisor);
+        }
+    }
+
     const std::vector<VertexAttribute>& getElements() const { return m_elements; }
     GLuint getStride() const { return m_stride; }
 
 private:
     std::vector<VertexAttribute> m_elements;
     GLuint m_stride;
+
+    void pushAttribute(GLuint type, GLuint count, GLboolean normalized, GLuint divisor) {
+        m_elements.push_back({ type, count, normalized, divisor });
+        m_stride += count * VertexAttribute::getSizeOfType(type);
+    }
 };
 
 // ģػ
 template<> inline void VertexBufferLayout::push<float>(GLuint count) {
-    m_elements.push_back({ GL_FLOAT, count, GL_FALSE });
-    m_stride += count * VertexAttribute::getSizeOfType(GL_FLOAT);
+    pushAttribute(GL_FLOAT, count, GL_FALSE, 0);
 }
 
 template<> inline void VertexBufferLayout::push<unsigned int>(GLuint count) {
-    m_elements.push_back({ GL_UNSIGNED_INT, count, GL_FALSE });
-    m_stride += count * VertexAttribute::getSizeOfType(GL_UNSIGNED_INT);
+    pushAttribute(GL_UNSIGNED_INT, count, GL_FALSE, 0);
+}
+
+template<> inline void VertexBufferLayout::pushInstanced<float>(GLuint count, GLuint divisor) {
+    pushAttribute(GL_FLOAT, count, GL_FALSE, divisor);
+}
+
+template<> inline void VertexBufferLayout::pushInstanced<unsigned int>(GLuint count, GLuint divisor) {
+    pushAttribute(GL_UNSIGNED_INT, count, GL_FALSE, divisor);
 }
 
 // װ (VAO) 
@@ -66,13 +92,34 @@ public:
     VertexArray& operator=(VertexArray&& other) noexcept;
 
     //  VBO 䲼ӵ VAO
+    // εʱλε, 𶥵㻺, ʵ
     void addBuffer(const VertexBuffer& vb, const VertexBufferLayout& layout);
 
+    // , ð󶨻ᱻ¼ VAO 
+    void setIndexBuffer(const IndexBuffer& ib);
+
     void bind() const;
     void unbind() const;
 
+    GLuint getID() const { return m_rendererID; }
+
+    // һõλ
+    GLuint getAttributeCount() const { return m_attributeCount; }
+
+    /**
+     * @brief ʵ (glDrawElementsInstancedBaseVertexBaseInstance).
+     * @param indexCount ÿʵ.
+     * @param instanceCount ʵ.
+     * @param firstIndex еʼ.
+     * @param baseVertex ӵÿϵƫ.
+     * @param baseInstance ʵԵʼʵ,  0 ʱҪ GL 4.2.
+     */
+    void drawInstanced(uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex = 0,
+        int32_t baseVertex = 0, uint32_t baseInstance = 0, GLenum mode = GL_TRIANGLES) const;
+
 private:
     GLuint m_rendererID = 0;
+    GLuint m_attributeCount = 0;
 };
 
 #endif // VERTEX_ARRAY_H
\ No newline at end of file
@@ -1,37 +1,59 @@
 #include "VertexBuffer.h"
+#include "GLStateCache.h"
+#include <stdexcept>
 
-VertexBuffer::VertexBuffer(const void* data, uint32_t size) {
+VertexBuffer::VertexBuffer(const void* data, uint32_t size, GLenum usage)
+    : m_size(size), m_usage(usage) {
     glGenBuffers(1, &m_rendererID);
-    glBindBuffer(GL_ARRAY_BUFFER, m_rendererID);
-    glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
+    GLStateCache::getInstance().bindBuffer(GL_ARRAY_BUFFER, m_rendererID);
+    glBufferData(GL_ARRAY_BUFFER, size, data, usage);
 }
 
 VertexBuffer::~VertexBuffer() {
     if (m_rendererID != 0) {
-        glDeleteBuffers(1, &m_rendererID);
+        GLStateCache::getInstance().deleteBuffer(m_rendererID);
     }
 }
 
 VertexBuffer::VertexBuffer(VertexBuffer&& other) noexcept
-    : m_rendererID(other.m_rendererID) {
+    : m_rendererID(other.m_rendererID), m_size(other.m_size), m_usage(other.m_usage) {
     other.m_rendererID = 0;
+    other.m_size = 0;
 }
 
 VertexBuffer& VertexBuffer::operator=(VertexBuffer&& other) noexcept {
     if (this != &other) {
         if (m_rendererID != 0) {
-            glDeleteBuffers(1, &m_rendererID);
+            GLStateCache::getInstance().deleteBuffer(m_rendererID);
         }
         m_rendererID = other.m_rendererID;
+        m_size = other.m_size;
+        m_usage = other.m_usage;
         other.m_rendererID = 0;
+        other.m_size = 0;
     }
     return *this;
 }
 
 void VertexBuffer::bind() const {
-    glBindBuffer(GL_ARRAY_BUFFER, m_rendererID);
+    GLStateCache::getInstance().bindBuffer(GL_ARRAY_BUFFER, m_rendererID);
 }
 
 void VertexBuffer::unbind() const {
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    GLStateCache::getInstance().bindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void VertexBuffer::setData(const void* data, uint32_t size) {
+    GLStateCache::getInstance().bindBuffer(GL_ARRAY_BUFFER, m_rendererID);
+    // glBufferData ·洢 (orphaning), صȴ GPU 
+    glBufferData(GL_ARRAY_BUFFER, size, data, m_usage);
+    m_size = size;
+}
+
+void VertexBuffer::updateData(uint32_t offset, const void* data, uint32_t size) {
+    if (offset + size > m_size) {
+        throw std::runtime_error("ERROR::VERTEX_BUFFER: updateData out of range");
+    }
+    GLStateCache::getInstance().bindBuffer(GL_ARRAY_BUFFER, m_rendererID);
+    glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
 }
\ No newline at end of file
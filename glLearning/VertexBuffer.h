@@ -9,7 +9,8 @@ public:
     // 캯: VBO
     // data: ָ򶥵ݵָ
     // size: ݵֽڴС
-    VertexBuffer(const void* data, uint32_t size);
+    // usage: GL_STATIC_DRAW / GL_DYNAMIC_DRAW / GL_STREAM_DRAW (ʵÿ֡ʱ GL_STREAM_DRAW)
+    VertexBuffer(const void* data, uint32_t size, GLenum usage = GL_STATIC_DRAW);
     ~VertexBuffer();
 
     // ֹ, ƶ
@@ -21,8 +22,19 @@ public:
     void bind() const;
     void unbind() const;
 
+    // ·䲢ϴȫ (ȶɴ洢, ȴ GPU ڶȡľ)
+    void setData(const void* data, uint32_t size);
+
+    // ², offset + size ܳǰС
+    void updateData(uint32_t offset, const void* data, uint32_t size);
+
+    GLuint getID() const { return m_rendererID; }
+    uint32_t getSize() const { return m_size; }
+
 private:
     GLuint m_rendererID = 0;
+    uint32_t m_size = 0;
+    GLenum m_usage = GL_STATIC_DRAW;
 };
 
 #endif // VERTEX_BUFFER_H#pragma once
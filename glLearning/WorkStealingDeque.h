@@ -0,0 +1,101 @@
+#ifndef WORK_STEALING_DEQUE_H
+#define WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+
+// WorkStealingDeque:  Chase-Lev ˫˶ ( Le et al. 2013  C11 ڴ汾)
+// ӵ߳ڵײ push / pop (ȳ, Ѻ), ̴߳Ӷ steal (Ƚȳ).
+// T ǿԷŽ std::atomic , ָͨ.
+template<typename T>
+class WorkStealingDeque {
+public:
+    // capacity  2 
+    explicit WorkStealingDeque(size_t capacity = 4096)
+        : m_capacity(static_cast<int64_t>(capacity)), m_mask(static_cast<int64_t>(capacity) - 1),
+        m_buffer(new std::atomic<T>[capacity]) {
+        if (capacity == 0 || (capacity & (capacity - 1)) != 0) {
+            throw std::runtime_error("ERROR::WORK_STEALING_DEQUE: Capacity must be a power of two");
+        }
+    }
+
+    // ֹ
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // ӵߵ. ʱ false
+    bool push(T item) {
+        int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        int64_t top = m_top.load(std::memory_order_acquire);
+        if (bottom - top >= m_capacity) {
+            return false;
+        }
+        // λ release д: ȡ acquire ָʱ, Ҳһɼ
+        m_buffer[bottom & m_mask].store(item, std::memory_order_release);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // ӵߵ
+    bool pop(T& out) {
+        int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = m_top.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            // Ϊ
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        out = m_buffer[bottom & m_mask].load(std::memory_order_relaxed);
+        if (top == bottom) {
+            // ֻʣһԪ, ȡ߾
+            bool won = m_top.compare_exchange_strong(top, top + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed);
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    // ̵߳. Ϊջʧʱ false
+    bool steal(T& out) {
+        int64_t top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t bottom = m_bottom.load(std::memory_order_acquire);
+        if (top >= bottom) {
+            return false;
+        }
+
+        T item = m_buffer[top & m_mask].load(std::memory_order_acquire);
+        if (!m_top.compare_exchange_strong(top, top + 1,
+            std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return false;
+        }
+        out = item;
+        return true;
+    }
+
+    // ƴС, ͳ
+    size_t size() const {
+        int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        int64_t top = m_top.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+    }
+
+private:
+    // top  bottom ִͬ, α
+    alignas(64) std::atomic<int64_t> m_top{ 0 };
+    alignas(64) std::atomic<int64_t> m_bottom{ 0 };
+    alignas(64) int64_t m_capacity;
+    int64_t m_mask;
+    std::unique_ptr<std::atomic<T>[]> m_buffer;
+};
+
+#endif // WORK_STEALING_DEQUE_H
@@ -4,25 +4,335 @@
 #include "shader.h"
 #include "ShaderManager.h"
 #include "Texture.h"
+#include "GLStateCache.h"
+#include "RenderQueue.h"
+#include "JobSystem.h"
+#include "JobSystemBenchmark.h"
+#include "AnimationBenchmark.h"
+#include "SceneGraph.h"
+#include "EntitySystems.h"
+#include "SceneGraphBenchmark.h"
+#include "CullingBenchmark.h"
+#include "BvhBenchmark.h"
+#include "EntityBenchmark.h"
+#include "CommandRecorderBenchmark.h"
+#include "MeshOptimizerSelfTest.h"
+#include "MeshletSelfTest.h"
+#include "GpuCullerSelfTest.h"
+#include "RenderThread.h"
+#include "TripleBuffer.h"
+#include "FixedTimestep.h"
+#include "FramePacer.h"
+#include "RenderGraph.h"
+#include "RenderTargetPool.h"
+#include "SamplerCache.h"
+#include "Material.h"
+#include "MeshImporter.h"
+#include "AssetFileSystem.h"
+#include "AssetCooker.h"
+#include "ModelStreamer.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
 #include <filesystem>
+#include <memory>
+#include <mutex>
+#include <sstream>
 
+// ģ״̬: ֻ߳ϰ̶ƽ
+struct SimulationState
+{
+    float mixValue = 0.2f;//Ļϱ, ·
+};
+
+// ״̬: ÿδ¼
+struct InputState
+{
+    bool increaseMix = false;
+    bool decreaseMix = false;
+};
+
+// ߳̽Ⱦ̵߳һ֡. Ⱦֻ߳, ̵߳κ״̬
+struct FrameSnapshot
+{
+    SimulationState previous;//һ״̬, ڲֵ
+    SimulationState current;
+    double stepTime = 0.0;//current Ӧʱ
+    double stepSeconds = 0.0;
+    double inputTime = -1.0;//current Ĳʱ, ͳ뵽ֵӳ
+    int framebufferWidth = 800;
+    int framebufferHeight = 600;
+    std::unique_ptr<CommandRecorder> recorder;//߳޳¼ƵĿɼʵ, ÿһ, Ⱦֻ߳ϲ
+};
+
+// --model ʽģ. Ⱦ̳߳ʼʱȡ, ֮߳ÿ֡ľ¼ȼ
+struct StreamedModel
+{
+    std::string path;
+    glm::vec3 position = glm::vec3(0.0f);//еλ, ı·
+    ModelStreamer::Handle handle = ModelStreamer::kInvalidHandle;
+    bool reported = false;//ѽ̴߳ʵ, ֻȾ̶߳д
+};
+
+// Ⱦ̷߳ģ;󽻸̵߳ (Model ֻ GL ̷߳), ߳̾ݴ˴ʵ
+struct ReadyModel
+{
+    size_t index = 0;// streamedModels е±
+    GLuint vertexArray = 0;
+    std::vector<MeshFile::Submesh> submeshes;
+    glm::vec3 boundsMin = glm::vec3(0.0f);
+    glm::vec3 boundsMax = glm::vec3(0.0f);
+};
+
+// ص̵߳ glfwPollEvents ִ, ֻ¼С, ӿȾ߳
+static int g_framebufferWidth = 800;
+static int g_framebufferHeight = 600;
 
 void framebuffer_size_callback(GLFWwindow* window, int width, int height)
 {
-    glViewport(0, 0, width, height);
+    g_framebufferWidth = width;
+    g_framebufferHeight = height;
 }
 
-void processInput(GLFWwindow* window)
+void processInput(GLFWwindow* window, InputState& input)
 {
     if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)//Esc˳
         glfwSetWindowShouldClose(window, true);
+
+    input.increaseMix = glfwGetKey(window, GLFW_KEY_UP) == GLFW_PRESS;
+    input.decreaseMix = glfwGetKey(window, GLFW_KEY_DOWN) == GLFW_PRESS;
+}
+
+void simulate(SimulationState& state, const InputState& input, float dt)
+{
+    if (input.increaseMix)
+        state.mixValue = std::min(state.mixValue + dt, 1.0f);
+    if (input.decreaseMix)
+        state.mixValue = std::max(state.mixValue - dt, 0.0f);
+}
+
+//  flag λ, ûʱ 0
+int findFlag(int argc, char** argv, const char* flag)
+{
+    for (int i = 1; i < argc; ++i)
+        if (std::strcmp(argv[i], flag) == 0)
+            return i;
+    return 0;
+}
+
+// λ index ֮, ûлʱ defaultValue
+uint32_t countArgument(int argc, char** argv, int index, uint32_t defaultValue)
+{
+    if (index + 1 < argc && std::atoi(argv[index + 1]) > 0)
+        return static_cast<uint32_t>(std::atoi(argv[index + 1]));
+    return defaultValue;
 }
 
-int main()
+int main(int argc, char** argv)
 {
+    // --bench-jobs: ֻϵͳ΢׼, 
+    if (findFlag(argc, argv, "--bench-jobs")) {
+        JobSystem benchmarkJobs;
+        runJobSystemBenchmark(benchmarkJobs);
+        return 0;
+    }
+
+    // --bench-anim [ɫ]: ֻж׼ (Ĭ 1000 ɫ), 
+    if (int i = findFlag(argc, argv, "--bench-anim")) {
+        JobSystem benchmarkJobs;
+        runAnimationBenchmark(benchmarkJobs, countArgument(argc, argv, i, 1000));
+        return 0;
+    }
+
+    // --bench-anim-compress [.anim]: ֻжѹ׼, . ļ --raw-animations ,
+    // ʱúϳɵƬ
+    if (int i = findFlag(argc, argv, "--bench-anim-compress")) {
+        try {
+            runAnimationCompressionBenchmark(i + 1 < argc ? argv[i + 1] : "");
+        }
+        catch (const std::exception& e) {
+            std::cerr << e.what() << std::endl;
+            return -1;
+        }
+        return 0;
+    }
+
+    // --bench-scene [ڵ]: ֻгͼ׼ (Ĭ 100 ڵ,  2 ̵߳Ӳ߳һ), 
+    if (int i = findFlag(argc, argv, "--bench-scene")) {
+        runSceneGraphBenchmark(countArgument(argc, argv, i, 1000000));
+        return 0;
+    }
+
+    // --bench-cull []: ֻ CPU ޳׼ (Ĭ 10 ), 
+    if (int i = findFlag(argc, argv, "--bench-cull")) {
+        JobSystem benchmarkJobs;
+        runCullingBenchmark(benchmarkJobs, countArgument(argc, argv, i, 100000));
+        return 0;
+    }
+
+    // --bench-bvh []: ֻ BVH ׼ (Ĭ 10 ), 
+    if (int i = findFlag(argc, argv, "--bench-bvh")) {
+        JobSystem benchmarkJobs;
+        runBvhBenchmark(benchmarkJobs, countArgument(argc, argv, i, 100000));
+        return 0;
+    }
+
+    // --bench-ecs [ʵ]: ֻʵ洢׼ (Ĭ 10 ʵ), 
+    if (int i = findFlag(argc, argv, "--bench-ecs")) {
+        JobSystem benchmarkJobs;
+        runEntityBenchmark(benchmarkJobs, countArgument(argc, argv, i, 100000));
+        return 0;
+    }
+
+    // --test-meshopt: ֻ MeshOptimizer Լ, . мʧʱط 0
+    if (findFlag(argc, argv, "--test-meshopt")) {
+        return runMeshOptimizerSelfTest() ? 0 : -1;
+    }
+
+    // --test-meshlets: ֻ MeshletBuilder Լ, . мʧʱط 0
+    if (findFlag(argc, argv, "--test-meshlets")) {
+        return runMeshletSelfTest() ? 0 : -1;
+    }
+
+    // --import <ģ> <.mesh> [--tangents] [--no-optimize] [--skinned] [--raw-animations]: תģ, .
+    // --skinned Ͷ, ͬʱͬ .anim (Ĭѹ, --raw-animations ԭʼؼ֡)
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--import") == 0 && i + 2 < argc) {
+            MeshImporter::Options importOptions;
+            for (int j = 1; j < argc; ++j) {
+                if (std::strcmp(argv[j], "--tangents") == 0)
+                    importOptions.generateTangents = true;
+                else if (std::strcmp(argv[j], "--no-optimize") == 0)
+                    importOptions.optimize = false;
+                else if (std::strcmp(argv[j], "--skinned") == 0)
+                    importOptions.skinned = true;
+                else if (std::strcmp(argv[j], "--raw-animations") == 0)
+                    importOptions.compressAnimations = false;
+            }
+            try {
+                MeshImporter::Stats stats = MeshImporter::importFile(argv[i + 1], argv[i + 2], importOptions);
+                std::cout << "Imported " << argv[i + 1] << " -> " << argv[i + 2] << ": " << stats.submeshCount
+                    << " submeshes, " << stats.materialCount << " materials, " << stats.vertexCount << " vertices, "
+                    << stats.indexCount / 3 << " triangles, " << stats.fileSize << " bytes" << std::endl;
+                if (importOptions.skinned)
+                    std::cout << "Animations -> " << MeshImporter::getAnimationPath(argv[i + 2]) << ": " << stats.jointCount
+                        << " joints, " << stats.clipCount << " clips, keys " << stats.animationSourceSize << " -> "
+                        << stats.animationSize << " bytes" << std::endl;
+            }
+            catch (const std::exception& e) {
+                std::cerr << e.what() << std::endl;
+                return -1;
+            }
+            return 0;
+        }
+    }
+
+    // --cook [--force]: 決 ../Shader ../texture (ԼڵĻ ../model)  ../cooked, .
+    // ֮ --pack ../assets.pak ../cooked/Shader ../cooked/texture 
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--cook") == 0) {
+            AssetCooker::Settings cookSettings;
+            for (int j = 1; j < argc; ++j) {
+                if (std::strcmp(argv[j], "--force") == 0)
+                    cookSettings.forceRebuild = true;
+            }
+            try {
+                JobSystem cookJobs;
+                AssetCooker cooker(cookJobs, cookSettings);
+                for (const char* directory : { "../Shader", "../texture", "../model" }) {
+                    if (std::filesystem::is_directory(directory))
+                        cooker.addDirectory(directory);
+                }
+                AssetCooker::Stats stats = cooker.cook();
+                std::cout << "Cooked " << stats.cooked << " of " << stats.assets << " assets (" << stats.upToDate
+                    << " up to date, " << stats.failed << " failed) in " << stats.milliseconds << " ms" << std::endl;
+                return stats.failed == 0 ? 0 : -1;
+            }
+            catch (const std::exception& e) {
+                std::cerr << e.what() << std::endl;
+                return -1;
+            }
+        }
+    }
+
+    // --pack <.pak> <Ŀ¼>...: Ŀ¼Դ (·Ŀ¼ͷ,  Shader/learn.vs), 
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--pack") == 0 && i + 2 < argc) {
+            try {
+                AssetPackWriter writer;
+                for (int j = i + 2; j < argc && std::strncmp(argv[j], "--", 2) != 0; ++j)
+                    writer.addDirectory(argv[j], std::filesystem::path(argv[j]).filename().string());
+                AssetPackWriter::Stats stats = writer.write(argv[i + 1]);
+                std::cout << "Packed " << stats.files << " files (" << stats.blobs << " unique, "
+                    << stats.compressedBlobs << " compressed) into " << argv[i + 1] << ": " << stats.rawBytes
+                    << " -> " << stats.fileSize << " bytes, " << stats.dedupedBytes << " bytes deduplicated" << std::endl;
+            }
+            catch (const std::exception& e) {
+                std::cerr << e.what() << std::endl;
+                return -1;
+            }
+            return 0;
+        }
+    }
+
+    // ԴʱȴӰжȡ, ɢļ
+    if (std::filesystem::exists("../assets.pak"))
+    {
+        try {
+            AssetFileSystem::getInstance().mount("../assets.pak");
+        }
+        catch (const std::exception& e) {
+            std::cerr << e.what() << std::endl;
+        }
+    }
+
+    // ֡: --frames-in-flight N, --swap-interval N, --low-latency
+    FramePacer::Settings pacerSettings;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--frames-in-flight") == 0 && i + 1 < argc)
+            pacerSettings.framesInFlight = static_cast<uint32_t>(std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "--swap-interval") == 0 && i + 1 < argc)
+            pacerSettings.swapInterval = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--low-latency") == 0)
+            pacerSettings.lowLatency = true;
+    }
+    FramePacer pacer(pacerSettings);
+
+    // --msaa N:  N زĿٽ󻺳, 1 ʾֱӻ󻺳
+    // --anisotropy N: ȫָԵȼ, ֻ޸ĹĲ
+    int msaaSamples = 4;
+    SamplerCache::Quality samplerQuality;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--msaa") == 0 && i + 1 < argc)
+            msaaSamples = std::max(std::atoi(argv[++i]), 1);
+        else if (std::strcmp(argv[i], "--anisotropy") == 0 && i + 1 < argc)
+            samplerQuality.anisotropy = static_cast<float>(std::atof(argv[++i]));
+    }
+
+    // --model <ļ.mesh>: 첽 (ظ), ȸ
+    // ͼͶӰǵλ, ൱ڽƽ; ģÿ 4 , Զ
+    const glm::vec3 cameraPosition(0.0f, 0.0f, -1.0f);
+    std::vector<StreamedModel> streamedModels;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--model") == 0 && i + 1 < argc) {
+            StreamedModel streamed;
+            streamed.path = argv[++i];
+            size_t slot = streamedModels.size();
+            streamed.position = glm::vec3(-0.75f + 0.5f * (slot % 4), -0.75f, 0.25f * (slot / 4));
+            streamedModels.push_back(streamed);
+        }
+    }
+
+    // --test-gpucull: GpuCuller ļɫҪ GL 4.3, ֻΪԼ촴һش
+    bool gpuCullTest = findFlag(argc, argv, "--test-gpucull") != 0;
+
     glfwInit();
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, gpuCullTest ? 4 : 3);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    if (gpuCullTest) {
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    }
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
     //glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);  // for ios
 
@@ -35,96 +345,400 @@ int main()
     }
     glfwMakeContextCurrent(window);
 
+    // GL ָȫֵ, ̼߳һμ
     if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
     {
         std::cout << "Failed to initialize GLAD" << std::endl;
         return -1;
     }
 
-    glViewport(0, 0, 800, 600);
-    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);//ݴڴС̬ӿڴС
+    // --bench-recorder []: ֻ CommandRecorder չԻ׼ (Ĭ 10 ). Ҫʵɫ,
+    // ڴ֮ϵͳ֮ǰ
+    if (int i = findFlag(argc, argv, "--bench-recorder")) {
+        try {
+            Shader benchmarkShader("../Shader/learn.vs", "../Shader/learn.fs");
+            runCommandRecorderBenchmark(benchmarkShader, countArgument(argc, argv, i, 100000));
+        }
+        catch (const std::exception& e) {
+            std::cerr << e.what() << std::endl;
+        }
+        glfwTerminate();
+        return 0;
+    }
 
-    float vertices[] = {
-      0.5f,  0.5f, 0.0f,   1.0f, 0.0f, 0.0f,   1.0f, 1.0f,   // 
-     0.5f, -0.5f, 0.0f,   0.0f, 1.0f, 0.0f,   1.0f, 0.0f,   // 
-    -0.5f, -0.5f, 0.0f,   0.0f, 0.0f, 1.0f,   0.0f, 0.0f,   // 
-    -0.5f,  0.5f, 0.0f,   1.0f, 1.0f, 0.0f,   0.0f, 1.0f    // 
+    // --test-gpucull: Ա GpuCuller (cull.comp + Hi-Z)  CPU ϵ Frustum ޳, мʧʱط 0
+    if (gpuCullTest) {
+        bool passed = runGpuCullerSelfTest((GLADloadproc)glfwGetProcAddress);
+        glfwTerminate();
+        return passed ? 0 : -1;
+    }
+
+    // Ⱦ̶̹߳ 0 ź, ̱߳ܿ
+    JobSystem::Settings jobSettings;
+    jobSettings.renderThreadCore = 0;
+    JobSystem jobs(jobSettings);
+
+    // ӳģʽҪˢ, ֻ̲߳ѯ
+    if (const GLFWvidmode* mode = glfwGetVideoMode(glfwGetPrimaryMonitor()))
+    {
+        pacerSettings.refreshRate = mode->refreshRate;
+        pacer.setSettings(pacerSettings);
+    }
+
+    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);//¼ڴС, Ⱦ̵߳ӿ
+
+    TripleBuffer<FrameSnapshot> snapshots;
+    FixedTimestep timestep(1.0 / 60.0);
+    SimulationState simulation;
+    SimulationState previousSimulation;
+    InputState input;
+    double inputTime = -1.0;
+    double stepInputTime = -1.0;
+    int publishedWidth = 0, publishedHeight = 0;
+
+    // ͼʵֻ߳޸ĺ͸. ʵԳͼ, ޳¼Ҳ߳ (߳) ,
+    // Ⱦֻ߳ѿ¼õϲȾ
+    SceneGraph scene;
+    SceneGraph::NodeId quadNode = scene.createNode();
+    scene.update(jobs);
+    EntityManager entities;
+    const Frustum viewFrustum = Frustum::fromMatrix(glm::mat4(1.0f));//ͼͶӰǵλ
+
+    // дǾ, ÿηдһ
+    auto publishSnapshot = [&]() {
+        FrameSnapshot& snapshot = snapshots.getWriteBuffer();
+        snapshot.previous = previousSimulation;
+        snapshot.current = simulation;
+        snapshot.stepTime = timestep.getCurrentStepTime();
+        snapshot.stepSeconds = timestep.getStep();
+        snapshot.inputTime = stepInputTime;
+        snapshot.framebufferWidth = g_framebufferWidth;
+        snapshot.framebufferHeight = g_framebufferHeight;
+
+        // ʵͰΧи泡ͼ, ɼʵ¼ƽԼ recorder
+        EntitySystems::copySceneTransforms(entities, scene, jobs);
+        EntitySystems::updateBounds(entities, jobs);
+        if (!snapshot.recorder)
+            snapshot.recorder = std::make_unique<CommandRecorder>(jobs);
+        EntitySystems::recordVisible(entities, viewFrustum, cameraPosition, *snapshot.recorder);
+        snapshots.publish();
+        publishedWidth = g_framebufferWidth;
+        publishedHeight = g_framebufferHeight;
     };
 
-    unsigned int indices[] = {
-        // ע0ʼ! 
-        // (0,1,2,3)Ƕvertices±꣬
-        // ±ϳɾ
+    // Ⱦ߳ǰȷһݳʼ
+    timestep.reset(glfwGetTime());
+    publishSnapshot();
+
+    // ģ IO ̺߳͹߳϶ȡ, ÿֻ֡ϴһС, ῨסȾ.
+    // ߳ÿ֡Ҫȼ, ̳߳: Ⱦֹ߳ͣ (ʧ) ֮, ߳û
+    std::unique_ptr<ModelStreamer> modelStreamer = std::make_unique<ModelStreamer>(jobs);
+    for (StreamedModel& streamed : streamedModels)
+        streamed.handle = modelStreamer->load(streamed.path, glm::distance(cameraPosition, streamed.position));
+
+    // =====  GL ԴֻȾ߳ϴʹú =====
+    unsigned int VAO = 0, VBO = 0, EBO = 0;
+    ShaderPtr Shader;
+    std::unique_ptr<Texture> texture1, texture2;
+    Material* quadMaterial = nullptr;
+    const Material* modelMaterial = nullptr;
+    std::unique_ptr<RenderQueue> renderQueue;
+    std::unique_ptr<RenderTargetPool> targetPool;
+    std::unique_ptr<RenderGraph> renderGraph;
+    int viewportWidth = 0, viewportHeight = 0;
+    std::atomic<size_t> pooledBytes{ 0 };//ȾĿռõԴ, ߳ʾڱ
+    std::mutex readyModelsMutex;
+    std::vector<ReadyModel> readyModels;//Ⱦ߳ -> ߳
+
+    RenderThread::Callbacks renderCallbacks;
+    renderCallbacks.initialize = [&]() {
+        jobs.pinRenderThread();
+
+        // ֮İ󶨺״̬޸Ķ GLStateCache, 
+        GLStateCache& state = GLStateCache::getInstance();
+        SamplerCache::getInstance().setQuality(samplerQuality);
+
+        float vertices[] = {
+          0.5f,  0.5f, 0.0f,   1.0f, 0.0f, 0.0f,   1.0f, 1.0f,   // 
+         0.5f, -0.5f, 0.0f,   0.0f, 1.0f, 0.0f,   1.0f, 0.0f,   // 
+        -0.5f, -0.5f, 0.0f,   0.0f, 0.0f, 1.0f,   0.0f, 0.0f,   // 
+        -0.5f,  0.5f, 0.0f,   1.0f, 1.0f, 0.0f,   0.0f, 1.0f    // 
+        };
+
+        unsigned int indices[] = {
+            // ע0ʼ!
+            // (0,1,2,3)Ƕvertices±꣬
+            // ±ϳɾ
 
-        0, 1, 3, // first triangle
-        1, 2, 3  // second triangle
+            0, 1, 3, // first triangle
+            1, 2, 3  // second triangle
+        };
+
+        glGenVertexArrays(1, &VAO);
+        state.bindVertexArray(VAO);
+        //VBO
+        glGenBuffers(1, &VBO);//
+        state.bindBuffer(GL_ARRAY_BUFFER, VBO);//
+        glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);//
+
+        glGenBuffers(1, &EBO);
+        state.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);//λ
+        glEnableVertexAttribArray(0);
+        // color attribute
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));//ɫ
+        glEnableVertexAttribArray(1);
+        // texture coord attribute
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));//
+        glEnableVertexAttribArray(2);
+
+
+        state.bindVertexArray(0);//unbind VAO
+
+        Shader = ShaderManager::getInstance().load("test_Shader", "../Shader/learn.vs", "../Shader/learn.fs");
+
+        // ͼƬڹ߳ϲн, GL ֻ߳ϴ
+        Texture::Image images[2];
+        JobCounter decoded;
+        jobs.schedule([&] { images[0] = Texture::decode("../texture/container.jpg"); }, &decoded);
+        jobs.schedule([&] { images[1] = Texture::decode("../texture/wall.jpg"); }, &decoded);
+        jobs.wait(decoded);
+        texture1 = std::make_unique<Texture>(images[0]);
+        texture2 = std::make_unique<Texture>(images[1]);
+
+       // glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);//߿ģʽ
+
+        // Ԫʱɷ, ʰְ, tint  mixValue д MaterialParams .
+        // mixValue ÿ֡仯, öռ
+        quadMaterial = MaterialLibrary::getInstance().createDynamic(MaterialDesc(Shader)
+            .setTexture("texture1", texture2.get())
+            .setTexture("texture2", texture1.get())
+            .setVec4("tint", glm::vec4(1.0f))
+            .setFloat("mixValue", SimulationState().mixValue));
+
+        // ʽģʱһ, 㲼 (λ /  / )  learn.vs 
+        modelMaterial = MaterialLibrary::getInstance().intern(MaterialDesc(Shader)
+            .setTexture("texture1", texture1.get())
+            .setTexture("texture2", texture1.get())
+            .setVec4("tint", glm::vec4(1.0f))
+            .setFloat("mixValue", 0.0f));
+
+        renderQueue = std::make_unique<RenderQueue>();
+        targetPool = std::make_unique<RenderTargetPool>();
+        renderGraph = std::make_unique<RenderGraph>(*targetPool);
     };
 
-    unsigned int VAO;
-    glGenVertexArrays(1, &VAO);
-    glBindVertexArray(VAO);
-    //VBO
-    unsigned int VBO;
-    glGenBuffers(1, &VBO);//
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);//
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);//
-
-    unsigned int EBO;
-    glGenBuffers(1, &EBO);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
-
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);//λ
-    glEnableVertexAttribArray(0);
-    // color attribute
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));//ɫ
-    glEnableVertexAttribArray(1);
-    // texture coord attribute
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));//
-    glEnableVertexAttribArray(2);
-
-
-    glBindVertexArray(0);//unbind VAO
-
-    auto Shader = ShaderManager::getInstance().load("test_Shader", "../Shader/learn.vs", "../Shader/learn.fs");
-    Texture* texture1 = new Texture("../texture/container.jpg");
-    Texture* texture2 = new Texture("../texture/wall.jpg");
-    //shader->addTexture(texture1->getTexture(), "texture1");
-   // shader->addTexture(texture2->getTexture(), "texture2");
-    
-   // glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);//߿ģʽ
-
-    //int vertexColorLocation = glGetUniformLocation(shader->getProgram(), "timeColor");
-    //glUniform4f(vertexColorLocation, 0.0f, 0.5f, 0.0f, 1.0f);
-
-    glUniform1i(glGetUniformLocation(Shader->getProgram(), "texture1"), 0);
-    glUniform1i(glGetUniformLocation(Shader->getProgram(), "texture2"), 1);
-
-    while (!glfwWindowShouldClose(window))
+    renderCallbacks.renderFrame = [&]() {
+        // ;֡ (ӳģʽ»˯), ȡ¿, ʹ֡Ͼµ
+        pacer.beginFrame();
+        snapshots.acquire();//ȡ¿, û¿ʱһ
+        const FrameSnapshot& snapshot = snapshots.getReadBuffer();
+
+        GLStateCache& state = GLStateCache::getInstance();
+        if (snapshot.framebufferWidth != viewportWidth || snapshot.framebufferHeight != viewportHeight)
+        {
+            viewportWidth = snapshot.framebufferWidth;
+            viewportHeight = snapshot.framebufferHeight;
+            targetPool->setScreenSize(viewportWidth, viewportHeight);//ֻڴС仯һ֡·ȾĿ
+        }
+        targetPool->beginFrame();
+        modelStreamer->update();
+
+        // վģͽ̴߳ʵ, ֮ıһ߳޳¼
+        for (StreamedModel& streamed : streamedModels)
+        {
+            const Model* model = streamed.reported ? nullptr : modelStreamer->getModel(streamed.handle);
+            if (!model)
+                continue;
+            ReadyModel ready;
+            ready.index = static_cast<size_t>(&streamed - streamedModels.data());
+            ready.vertexArray = model->getVertexArray().getID();
+            ready.submeshes = model->getSubmeshes();
+            ready.boundsMin = model->getBoundsMin();
+            ready.boundsMax = model->getBoundsMax();
+            std::lock_guard<std::mutex> lock(readyModelsMutex);
+            readyModels.push_back(std::move(ready));
+            streamed.reported = true;
+        }
+
+        // ǰֵ֮, Ⱦ֡ģⲽ޹
+        float alpha = 1.0f;
+        if (snapshot.stepSeconds > 0.0)
+            alpha = static_cast<float>((glfwGetTime() - snapshot.stepTime) / snapshot.stepSeconds);
+        alpha = std::min(std::max(alpha, 0.0f), 1.0f);
+        float mixValue = snapshot.previous.mixValue + (snapshot.current.mixValue - snapshot.previous.mixValue) * alpha;
+        quadMaterial->setFloat("mixValue", mixValue);//ڰ󶨲ʱϴ
+
+        // ӿȾͼĿС
+        auto drawScene = [&](const RenderGraph::PassResources&) {
+            glClearColor(0.5f, 0.5f, 0.5f, 1.0f);//ɫ
+            glClear(GL_COLOR_BUFFER_BIT);//ɫ塢Ȼ塢ģ建
+
+            // ߳¼õĿɼʵϲȾ, ͳһִ
+            renderQueue->beginFrame();
+            if (snapshot.recorder)
+                snapshot.recorder->submitTo(*renderQueue);
+            renderQueue->flush();
+        };
+
+        renderGraph->reset();
+        RenderGraph::Handle backbuffer = renderGraph->importBackbuffer("backbuffer", viewportWidth, viewportHeight);
+        if (msaaSamples > 1 && viewportWidth > 0 && viewportHeight > 0)
+        {
+            RenderGraph::Handle sceneColor;
+            renderGraph->addPass("scene", [&](RenderGraph::PassBuilder& builder) {
+                sceneColor = builder.writeColor(builder.create("sceneColor", { viewportWidth, viewportHeight, GL_RGBA8, msaaSamples }));
+            }, drawScene);
+
+            // زĿ겻ֱӲ,  blit 󻺳
+            renderGraph->addPass("resolve", [&](RenderGraph::PassBuilder& builder) {
+                builder.read(sceneColor);
+                builder.writeColor(backbuffer);
+            }, [&](const RenderGraph::PassResources& resources) {
+                Framebuffer& source = targetPool->getFramebuffer({
+                    RenderTargetPool::attach(GL_COLOR_ATTACHMENT0, resources.getTarget(sceneColor)) });
+                state.bindFramebuffer(GL_READ_FRAMEBUFFER, source.getID());
+                glBlitFramebuffer(0, 0, viewportWidth, viewportHeight, 0, 0, viewportWidth, viewportHeight,
+                    GL_COLOR_BUFFER_BIT, GL_NEAREST);
+            });
+        }
+        else
+        {
+            renderGraph->addPass("scene", [&](RenderGraph::PassBuilder& builder) {
+                builder.writeColor(backbuffer);
+            }, drawScene);
+        }
+        renderGraph->execute();
+        pooledBytes = targetPool->getStats().bytes;
+
+        pacer.endFrame(snapshot.inputTime);
+    };
+
+    renderCallbacks.frameSwapped = [&]() {
+        pacer.afterSwap();
+    };
+
+    renderCallbacks.shutdown = [&]() {
+        pacer.releaseFences();
+        renderGraph.reset();
+        targetPool.reset();
+        renderQueue.reset();
+        MaterialLibrary::getInstance().cleanup();
+        texture1.reset();
+        texture2.reset();
+        SamplerCache::getInstance().cleanup();
+        Shader.reset();
+        ShaderManager::getInstance().cleanup();
+
+        GLStateCache& state = GLStateCache::getInstance();
+        state.deleteVertexArray(VAO);
+        state.deleteBuffer(VBO);
+        state.deleteBuffer(EBO);
+    };
+
+    // ĽȾ߳,  (ֱͬ) ģ
+    RenderThread renderThread(window);
+    try
     {
-        processInput(window);
-        glClearColor(0.5f, 0.5f, 0.5f, 1.0f);//ɫ
-        glClear(GL_COLOR_BUFFER_BIT);//ɫ塢Ȼ塢ģ建
+        renderThread.start(renderCallbacks);
+    }
+    catch (const std::exception& e)
+    {
+        std::cout << e.what() << std::endl;
+        glfwMakeContextCurrent(window);
+        modelStreamer.reset();
+        glfwTerminate();
+        return -1;
+    }
+
+    // ʼȾ߳, ıε VAO Ͳʿʵ
+    entities.createEntity(Transform(), SceneNode{ quadNode }, MeshRef{ quadMaterial, VAO, 6 },
+        Bounds{ glm::vec3(-0.5f, -0.5f, 0.0f), glm::vec3(0.5f, 0.5f, 0.0f) });
+    publishSnapshot();
+
+    // ߳: ¼롢̶ģ
+    double titleTime = glfwGetTime();
+    while (!glfwWindowShouldClose(window) && !renderThread.hasFailed())
+    {
+        // ˯һģⲽ¼Ϊֹ
+        double timeout = timestep.getNextStepTime() - glfwGetTime();
+        if (timeout > 0.0)
+            glfwWaitEventsTimeout(timeout);
+        else
+            glfwPollEvents();//ȡioϢ()
+        processInput(window, input);
+        inputTime = glfwGetTime();
+
+        uint32_t steps = timestep.advance(glfwGetTime());
+        for (uint32_t i = 0; i < steps; ++i)
+        {
+            previousSimulation = simulation;
+            simulate(simulation, input, static_cast<float>(timestep.getStep()));
+            stepInputTime = inputTime;
+        }
+
+        // ģͰΧŵ 0.4 С, ķԤλ, ÿһʵ
+        std::vector<ReadyModel> arrivedModels;
+        {
+            std::lock_guard<std::mutex> lock(readyModelsMutex);
+            arrivedModels.swap(readyModels);
+        }
+        for (const ReadyModel& ready : arrivedModels)
+        {
+            glm::vec3 extent = ready.boundsMax - ready.boundsMin;
+            float scale = 0.4f / std::max(std::max(extent.x, extent.y), std::max(extent.z, 1e-6f));
+            glm::vec3 center = (ready.boundsMin + ready.boundsMax) * 0.5f;
+            SceneGraph::NodeId node = scene.createNode(SceneGraph::kInvalidNode,
+                streamedModels[ready.index].position - center * scale, glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(scale));
+            for (const MeshFile::Submesh& submesh : ready.submeshes)
+            {
+                MeshRef mesh{ modelMaterial, ready.vertexArray, submesh.indexCount, submesh.firstIndex, submesh.baseVertex };
+                Bounds bounds;
+                bounds.localMin = glm::vec3(submesh.boundsMin[0], submesh.boundsMin[1], submesh.boundsMin[2]);
+                bounds.localMax = glm::vec3(submesh.boundsMax[0], submesh.boundsMax[1], submesh.boundsMax[2]);
+                entities.createEntity(Transform(), SceneNode{ node }, mesh, bounds);
+            }
+        }
+
+        if (steps > 0 || !arrivedModels.empty())
+            scene.update(jobs);//ֻ㱾֡ĶĽڵ
 
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, texture2->getID());
+        // ȼ浽ľ仯 (߳), ȼ
+        for (const StreamedModel& streamed : streamedModels)
+            modelStreamer->setPriority(streamed.handle, glm::distance(cameraPosition, streamed.position));
 
-        glActiveTexture(GL_TEXTURE1);
-        glBindTexture(GL_TEXTURE_2D, texture1->getID());
+        if (steps > 0 || !arrivedModels.empty() || g_framebufferWidth != publishedWidth || g_framebufferHeight != publishedHeight)
+            publishSnapshot();
 
-        Shader->use();
-        
-        glBindVertexArray(VAO);//draw triangles
-       // glDrawArrays(GL_TRIANGLES, 0, 3);//ֱʹVBO
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);//ֱʹEBO
+        // ÿڱʾ֡ʱ뵽ֵӳ (ں̵ֻ߳)
+        if (glfwGetTime() - titleTime >= 1.0)
+        {
+            titleTime = glfwGetTime();
+            FramePacer::Stats stats = pacer.getStats();
+            std::ostringstream title;
+            title.precision(1);
+            title << std::fixed << "GL_Engine | " << stats.frameTimeMs << " ms | input->present "
+                << stats.inputToPresentMs << " ms (max " << stats.inputToPresentMaxMs << ") | in flight "
+                << stats.framesInFlight << " | targets " << pooledBytes / (1024 * 1024) << " MB";
+            glfwSetWindowTitle(window, title.str().c_str());
+        }
+    }
 
-        glfwSwapBuffers(window);//
-        glfwPollEvents();//ȡioϢ()
+    try
+    {
+        renderThread.stop();
+    }
+    catch (const std::exception& e)
+    {
+        std::cout << e.what() << std::endl;
     }
-    glDeleteVertexArrays(1, &VAO);
-    glDeleteBuffers(1, &VBO);
-    glDeleteBuffers(1, &EBO);
+
+    // Ⱦ߳˳ͷ, ߳ ModelStreamer (ֹͣ IO ߳, ͷģ͵ GL Դ)
+    glfwMakeContextCurrent(window);
+    modelStreamer.reset();
     glfwTerminate();
 
     return 0;
-}
\ No newline at end of file
+}
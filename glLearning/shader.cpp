@@ -1,9 +1,82 @@
 #include "Shader.h"
-#include <fstream>
-#include <sstream>
+#include "GLStateCache.h"
+#include "AssetFileSystem.h"
+#include <algorithm>
+#include <filesystem>
 #include <iostream>
+#include <sstream>
 #include <glm/gtc/type_ptr.hpp>
 
+namespace {
+    bool isSamplerType(GLenum type) {
+        static const GLenum kSamplerTypes[] = {
+            GL_SAMPLER_1D, GL_SAMPLER_2D, GL_SAMPLER_3D, GL_SAMPLER_CUBE,
+            GL_SAMPLER_1D_SHADOW, GL_SAMPLER_2D_SHADOW, GL_SAMPLER_CUBE_SHADOW,
+            GL_SAMPLER_1D_ARRAY, GL_SAMPLER_2D_ARRAY, GL_SAMPLER_1D_ARRAY_SHADOW, GL_SAMPLER_2D_ARRAY_SHADOW,
+            GL_SAMPLER_2D_MULTISAMPLE, GL_SAMPLER_2D_MULTISAMPLE_ARRAY, GL_SAMPLER_BUFFER,
+            GL_SAMPLER_2D_RECT, GL_SAMPLER_2D_RECT_SHADOW, GL_SAMPLER_CUBE_MAP_ARRAY, GL_SAMPLER_CUBE_MAP_ARRAY_SHADOW,
+            GL_INT_SAMPLER_1D, GL_INT_SAMPLER_2D, GL_INT_SAMPLER_3D, GL_INT_SAMPLER_CUBE,
+            GL_INT_SAMPLER_1D_ARRAY, GL_INT_SAMPLER_2D_ARRAY, GL_INT_SAMPLER_2D_MULTISAMPLE,
+            GL_INT_SAMPLER_2D_MULTISAMPLE_ARRAY, GL_INT_SAMPLER_BUFFER, GL_INT_SAMPLER_2D_RECT, GL_INT_SAMPLER_CUBE_MAP_ARRAY,
+            GL_UNSIGNED_INT_SAMPLER_1D, GL_UNSIGNED_INT_SAMPLER_2D, GL_UNSIGNED_INT_SAMPLER_3D, GL_UNSIGNED_INT_SAMPLER_CUBE,
+            GL_UNSIGNED_INT_SAMPLER_1D_ARRAY, GL_UNSIGNED_INT_SAMPLER_2D_ARRAY, GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE,
+            GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE_ARRAY, GL_UNSIGNED_INT_SAMPLER_BUFFER, GL_UNSIGNED_INT_SAMPLER_2D_RECT,
+            GL_UNSIGNED_INT_SAMPLER_CUBE_MAP_ARRAY,
+        };
+        return std::find(std::begin(kSamplerTypes), std::end(kSamplerTypes), type) != std::end(kSamplerTypes);
+    }
+
+    //  uniform  "[0]" β
+    std::string stripArraySuffix(std::string name) {
+        if (name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0) {
+            name.resize(name.size() - 3);
+        }
+        return name;
+    }
+
+    // չ path е #include, included ¼Ѿչļ
+    void expandIncludes(const std::string& path, std::string& output,
+        std::vector<std::string>& included, std::vector<std::string>* dependencies) {
+        std::string source;
+        // ȲصԴ, ٶɢļ
+        try {
+            source = AssetFileSystem::getInstance().readText(path);
+        }
+        catch (const std::exception& e) {
+            std::string error = "ERROR::SHADER::FILE_NOT_SUCCESSFULLY_READ: " + path + "\n" + e.what();
+            throw std::runtime_error(error);
+        }
+
+        std::istringstream stream(source);
+        std::string line;
+        while (std::getline(stream, line)) {
+            size_t start = line.find_first_not_of(" \t");
+            if (start == std::string::npos || line.compare(start, 8, "#include") != 0) {
+                output += line;
+                output += '\n';
+                continue;
+            }
+
+            size_t open = line.find('"', start + 8);
+            size_t close = open == std::string::npos ? open : line.find('"', open + 1);
+            if (close == std::string::npos) {
+                throw std::runtime_error("ERROR::SHADER::INVALID_INCLUDE: " + path + ": " + line);
+            }
+            std::filesystem::path includePath = std::filesystem::path(path).parent_path() / line.substr(open + 1, close - open - 1);
+            std::string includeFile = includePath.lexically_normal().generic_string();
+
+            if (std::find(included.begin(), included.end(), includeFile) != included.end()) {
+                continue;
+            }
+            included.push_back(includeFile);
+            if (dependencies) {
+                dependencies->push_back(includeFile);
+            }
+            expandIncludes(includeFile, output, included, dependencies);
+        }
+    }
+}
+
 // ===== 캯 =====
 Shader::Shader(const std::string& vertexPath, const std::string& fragmentPath) {
     initFromFiles(vertexPath, fragmentPath);
@@ -14,10 +87,20 @@ Shader::Shader(const std::string& vertexPath, const std::string& fragmentPath,
     initFromFiles(vertexPath, fragmentPath, geometryPath);
 }
 
+Shader::Shader(const std::string& vertexPath, const std::string& fragmentPath,
+    const std::string& geometryPath, const std::vector<std::string>& defines)
+    : m_defines(defines) {
+    initFromFiles(vertexPath, fragmentPath, geometryPath);
+}
+
+Shader::Shader(const std::string& computePath) {
+    initCompute(computePath);
+}
+
 // =====  =====
 Shader::~Shader() {
     if (m_programID != 0) {
-        glDeleteProgram(m_programID);
+        GLStateCache::getInstance().deleteProgram(m_programID);
     }
 }
 
@@ -27,6 +110,11 @@ Shader::Shader(Shader&& other) noexcept
     m_vertexPath(std::move(other.m_vertexPath)),
     m_fragmentPath(std::move(other.m_fragmentPath)),
     m_geometryPath(std::move(other.m_geometryPath)),
+    m_computePath(std::move(other.m_computePath)),
+    m_defines(std::move(other.m_defines)),
+    m_samplers(std::move(other.m_samplers)),
+    m_uniformBlocks(std::move(other.m_uniformBlocks)),
+    m_linkVersion(other.m_linkVersion),
     m_uniformLocationCache(std::move(other.m_uniformLocationCache)) {
     other.m_programID = 0; // ֹͷ
 }
@@ -35,7 +123,7 @@ Shader& Shader::operator=(Shader&& other) noexcept {
     if (this != &other) {
         // ͷŵǰԴ
         if (m_programID != 0) {
-            glDeleteProgram(m_programID);
+            GLStateCache::getInstance().deleteProgram(m_programID);
         }
 
         // ƶԴ
@@ -43,6 +131,11 @@ Shader& Shader::operator=(Shader&& other) noexcept {
         m_vertexPath = std::move(other.m_vertexPath);
         m_fragmentPath = std::move(other.m_fragmentPath);
         m_geometryPath = std::move(other.m_geometryPath);
+        m_computePath = std::move(other.m_computePath);
+        m_defines = std::move(other.m_defines);
+        m_samplers = std::move(other.m_samplers);
+        m_uniformBlocks = std::move(other.m_uniformBlocks);
+        m_linkVersion = other.m_linkVersion;
         m_uniformLocationCache = std::move(other.m_uniformLocationCache);
 
         other.m_programID = 0;
@@ -53,13 +146,23 @@ Shader& Shader::operator=(Shader&& other) noexcept {
 // ===== ʹɫ =====
 void Shader::use() const {
     if (m_programID != 0) {
-        glUseProgram(m_programID);
+        GLStateCache::getInstance().useProgram(m_programID);
     }
     else {
         std::cerr << "ERROR::SHADER: Attempting to use invalid shader program!" << std::endl;
     }
 }
 
+// ===== ȼɫ =====
+void Shader::dispatch(GLuint groupsX, GLuint groupsY, GLuint groupsZ) const {
+    if (!isCompute()) {
+        std::cerr << "ERROR::SHADER: dispatch() called on a non-compute shader program!" << std::endl;
+        return;
+    }
+    use();
+    glDispatchCompute(groupsX, groupsY, groupsZ);
+}
+
 // ===== Uniformú =====
 void Shader::setBool(const std::string& name, bool value) {
     glUniform1i(getUniformLocation(name), static_cast<int>(value));
@@ -69,6 +172,10 @@ void Shader::setInt(const std::string& name, int value) {
     glUniform1i(getUniformLocation(name), value);
 }
 
+void Shader::setUInt(const std::string& name, unsigned int value) {
+    glUniform1ui(getUniformLocation(name), value);
+}
+
 void Shader::setFloat(const std::string& name, float value) {
     glUniform1f(getUniformLocation(name), value);
 }
@@ -85,6 +192,10 @@ void Shader::setVec4(const std::string& name, const glm::vec4& value) {
     glUniform4fv(getUniformLocation(name), 1, glm::value_ptr(value));
 }
 
+void Shader::setIVec2(const std::string& name, const glm::ivec2& value) {
+    glUniform2i(getUniformLocation(name), value.x, value.y);
+}
+
 void Shader::setMat3(const std::string& name, const glm::mat3& mat) {
     glUniformMatrix3fv(getUniformLocation(name), 1, GL_FALSE, glm::value_ptr(mat));
 }
@@ -97,6 +208,29 @@ void Shader::setIntArray(const std::string& name, const int* values, size_t coun
     glUniform1iv(getUniformLocation(name), static_cast<GLsizei>(count), values);
 }
 
+void Shader::setVec4Array(const std::string& name, const glm::vec4* values, size_t count) {
+    glUniform4fv(getUniformLocation(name), static_cast<GLsizei>(count), glm::value_ptr(values[0]));
+}
+
+// ===== ѯ =====
+GLint Shader::getSamplerUnit(const std::string& name) const {
+    for (const SamplerBinding& sampler : m_samplers) {
+        if (sampler.name == name) {
+            return sampler.unit;
+        }
+    }
+    return -1;
+}
+
+const Shader::UniformBlock* Shader::findUniformBlock(const std::string& name) const {
+    for (const UniformBlock& block : m_uniformBlocks) {
+        if (block.name == name) {
+            return &block;
+        }
+    }
+    return nullptr;
+}
+
 // ===== ع =====
 bool Shader::reload() {
     std::cout << "Reloading shader..." << std::endl;
@@ -110,11 +244,16 @@ bool Shader::reload() {
 
     try {
         // ¼
-        initFromFiles(m_vertexPath, m_fragmentPath, m_geometryPath);
+        if (isCompute()) {
+            initCompute(m_computePath);
+        }
+        else {
+            initFromFiles(m_vertexPath, m_fragmentPath, m_geometryPath);
+        }
 
         // ɾɳ
         if (oldProgram != 0) {
-            glDeleteProgram(oldProgram);
+            GLStateCache::getInstance().deleteProgram(oldProgram);
         }
 
         std::cout << "Shader reloaded successfully!" << std::endl;
@@ -142,12 +281,12 @@ void Shader::initFromFiles(const std::string& vertexPath,
     m_geometryPath = geometryPath;
 
     // ȡļ
-    std::string vertexCode = readFile(vertexPath);
-    std::string fragmentCode = readFile(fragmentPath);
+    std::string vertexCode = injectDefines(readFile(vertexPath));
+    std::string fragmentCode = injectDefines(readFile(fragmentPath));
     std::string geometryCode;
 
     if (!geometryPath.empty()) {
-        geometryCode = readFile(geometryPath);
+        geometryCode = injectDefines(readFile(geometryPath));
     }
 
     // ɫ
@@ -168,23 +307,177 @@ void Shader::initFromFiles(const std::string& vertexPath,
     if (geometryShader != 0) {
         glDeleteShader(geometryShader);
     }
+
+    reflect();
 }
 
-std::string Shader::readFile(const std::string& filepath) {
-    std::ifstream file;
-    file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+void Shader::initCompute(const std::string& computePath) {
+    m_computePath = computePath;
 
-    try {
-        file.open(filepath);
-        std::stringstream stream;
-        stream << file.rdbuf();
-        file.close();
-        return stream.str();
-    }
-    catch (const std::ifstream::failure& e) {
-        std::string error = "ERROR::SHADER::FILE_NOT_SUCCESSFULLY_READ: " + filepath + "\n" + e.what();
-        throw std::runtime_error(error);
+    if (!GLAD_GL_VERSION_4_3) {
+        throw std::runtime_error("ERROR::SHADER: Compute shaders require OpenGL 4.3");
+    }
+
+    std::string computeCode = injectDefines(readFile(computePath));
+    GLuint computeShader = compileShader(computeCode, GL_COMPUTE_SHADER, "COMPUTE");
+    m_programID = linkComputeProgram(computeShader);
+    glDeleteShader(computeShader);
+
+    reflect();
+}
+
+std::string Shader::injectDefines(const std::string& source) const {
+    if (m_defines.empty()) {
+        return source;
+    }
+    std::string defines;
+    for (const std::string& define : m_defines) {
+        defines += "#define " + define + "\n";
+    }
+
+    // #version ǵһ, һ
+    size_t version = source.find("#version");
+    if (version == std::string::npos) {
+        return defines + source;
+    }
+    size_t lineEnd = source.find('\n', version);
+    if (lineEnd == std::string::npos) {
+        return source + "\n" + defines;
     }
+    return source.substr(0, lineEnd + 1) + defines + source.substr(lineEnd + 1);
+}
+
+void Shader::reflect() {
+    m_samplers.clear();
+    m_uniformBlocks.clear();
+
+    GLint uniformCount = 0;
+    GLint maxNameLength = 0;
+    glGetProgramiv(m_programID, GL_ACTIVE_UNIFORMS, &uniformCount);
+    glGetProgramiv(m_programID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+    std::vector<GLchar> name(std::max(maxNameLength, 1) + 1);
+
+    // uniform 
+    GLint blockCount = 0;
+    GLint maxBlockNameLength = 0;
+    glGetProgramiv(m_programID, GL_ACTIVE_UNIFORM_BLOCKS, &blockCount);
+    glGetProgramiv(m_programID, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &maxBlockNameLength);
+    std::vector<GLchar> blockName(std::max(maxBlockNameLength, 1) + 1);
+    for (GLint i = 0; i < blockCount; ++i) {
+        UniformBlock block;
+        block.index = static_cast<GLuint>(i);
+        glGetActiveUniformBlockName(m_programID, block.index, static_cast<GLsizei>(blockName.size()), nullptr, blockName.data());
+        block.name = blockName.data();
+        glGetActiveUniformBlockiv(m_programID, block.index, GL_UNIFORM_BLOCK_DATA_SIZE, &block.size);
+        if (block.name == kMaterialBlockName) {
+            glUniformBlockBinding(m_programID, block.index, kMaterialBlockBinding);
+        }
+        GLint binding = 0;
+        glGetActiveUniformBlockiv(m_programID, block.index, GL_UNIFORM_BLOCK_BINDING, &binding);
+        block.binding = static_cast<GLuint>(binding);
+        m_uniformBlocks.push_back(block);
+    }
+
+    // ԱĲһβѯ
+    std::vector<GLuint> indices(uniformCount);
+    std::vector<GLint> blockIndices(uniformCount), offsets(uniformCount), arrayStrides(uniformCount), matrixStrides(uniformCount);
+    for (GLint i = 0; i < uniformCount; ++i) {
+        indices[i] = static_cast<GLuint>(i);
+    }
+    if (uniformCount > 0) {
+        glGetActiveUniformsiv(m_programID, uniformCount, indices.data(), GL_UNIFORM_BLOCK_INDEX, blockIndices.data());
+        glGetActiveUniformsiv(m_programID, uniformCount, indices.data(), GL_UNIFORM_OFFSET, offsets.data());
+        glGetActiveUniformsiv(m_programID, uniformCount, indices.data(), GL_UNIFORM_ARRAY_STRIDE, arrayStrides.data());
+        glGetActiveUniformsiv(m_programID, uniformCount, indices.data(), GL_UNIFORM_MATRIX_STRIDE, matrixStrides.data());
+    }
+
+    for (GLint i = 0; i < uniformCount; ++i) {
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(m_programID, indices[i], static_cast<GLsizei>(name.size()), nullptr, &size, &type, name.data());
+
+        if (blockIndices[i] >= 0 && blockIndices[i] < blockCount) {
+            BlockMember member;
+            member.name = stripArraySuffix(name.data());
+            size_t dot = member.name.find('.');
+            if (dot != std::string::npos && member.name.compare(0, dot, m_uniformBlocks[blockIndices[i]].name) == 0) {
+                member.name = member.name.substr(dot + 1);
+            }
+            member.type = type;
+            member.count = size;
+            member.offset = offsets[i];
+            member.arrayStride = arrayStrides[i];
+            member.matrixStride = matrixStrides[i];
+            m_uniformBlocks[blockIndices[i]].members.push_back(member);
+        }
+        else if (isSamplerType(type)) {
+            SamplerBinding sampler;
+            sampler.name = stripArraySuffix(name.data());
+            sampler.location = glGetUniformLocation(m_programID, name.data());
+            sampler.type = type;
+            sampler.count = size;
+            sampler.unit = -1;
+            m_samplers.push_back(sampler);
+        }
+    }
+
+    // Ԫ: layout(binding = N) ָ˷ 0 Ԫı, ఴ location ˳η
+    std::sort(m_samplers.begin(), m_samplers.end(), [](const SamplerBinding& a, const SamplerBinding& b) {
+        return a.location < b.location;
+    });
+    std::vector<bool> usedUnits;
+    auto markUsed = [&usedUnits](GLint first, GLint count) {
+        if (usedUnits.size() < static_cast<size_t>(first + count)) {
+            usedUnits.resize(first + count, false);
+        }
+        std::fill(usedUnits.begin() + first, usedUnits.begin() + first + count, true);
+    };
+    for (SamplerBinding& sampler : m_samplers) {
+        GLint current = 0;
+        glGetUniformiv(m_programID, sampler.location, &current);
+        if (current > 0) {
+            sampler.unit = current;
+            markUsed(current, sampler.count);
+        }
+    }
+    GLint nextUnit = 0;
+    GLStateCache::getInstance().useProgram(m_programID);
+    for (SamplerBinding& sampler : m_samplers) {
+        if (sampler.unit < 0) {
+            auto isFree = [&](GLint first) {
+                for (GLint k = first; k < first + sampler.count; ++k) {
+                    if (static_cast<size_t>(k) < usedUnits.size() && usedUnits[k]) {
+                        return false;
+                    }
+                }
+                return true;
+            };
+            while (!isFree(nextUnit)) {
+                ++nextUnit;
+            }
+            sampler.unit = nextUnit;
+            markUsed(nextUnit, sampler.count);
+            nextUnit += sampler.count;
+        }
+        std::vector<GLint> units(sampler.count);
+        for (GLint k = 0; k < sampler.count; ++k) {
+            units[k] = sampler.unit + k;
+        }
+        glUniform1iv(sampler.location, sampler.count, units.data());
+    }
+
+    ++m_linkVersion;
+}
+
+std::string Shader::readFile(const std::string& filepath) {
+    return preprocess(filepath);
+}
+
+std::string Shader::preprocess(const std::string& path, std::vector<std::string>* dependencies) {
+    std::string output;
+    std::vector<std::string> included{ std::filesystem::path(path).lexically_normal().generic_string() };
+    expandIncludes(path, output, included, dependencies);
+    return output;
 }
 
 GLuint Shader::compileShader(const std::string& source, GLenum type, const std::string& typeName) {
@@ -208,6 +501,14 @@ GLuint Shader::linkProgram(GLuint vertexShader, GLuint fragmentShader, GLuint ge
     return program;
 }
 
+GLuint Shader::linkComputeProgram(GLuint computeShader) {
+    GLuint program = glCreateProgram();
+    glAttachShader(program, computeShader);
+    glLinkProgram(program);
+    checkLinkErrors(program);
+    return program;
+}
+
 void Shader::checkCompileErrors(GLuint shader, const std::string& type) {
     GLint success;
     GLchar infoLog[1024];
@@ -3,17 +3,62 @@
 
 #include <glad/glad.h>
 #include <glm/glm.hpp>
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 #include <memory>
+#include <vector>
 
 class Shader {
 public:
+    // ===== Ϣ (ÿӺ) =====
+    //  uniform. ʱ location ˳Ԫд uniform, ֮Ҫ glUniform1i
+    struct SamplerBinding {
+        std::string name;   // ȥ "[0]"
+        GLint location;
+        GLenum type;
+        GLint count;        // 鳤, ռ unit ~ unit + count - 1
+        GLint unit;
+    };
+
+    // uniform еĳԱ (std140 ƫ)
+    struct BlockMember {
+        std::string name;   // ȥʵǰ׺ "[0]"
+        GLenum type;
+        GLint count;
+        GLint offset;
+        GLint arrayStride;
+        GLint matrixStride;
+    };
+
+    struct UniformBlock {
+        std::string name;
+        GLuint index;
+        GLuint binding;
+        GLint size;
+        std::vector<BlockMember> members;
+    };
+
+    // ʲ󶨵. ʱΪ MaterialParams  uniform ̶󶨵
+    static constexpr const char* kMaterialBlockName = "MaterialParams";
+    static constexpr GLuint kMaterialBlockBinding = 0;
+
     // 캯 - ֿ֧ѡļɫ
     Shader(const std::string& vertexPath, const std::string& fragmentPath);
     Shader(const std::string& vertexPath, const std::string& fragmentPath,
         const std::string& geometryPath);
 
+    /**
+     * @brief ɫ: ÿ׶ε #version ֮ "#define xxx".
+     * @param geometryPath Ϊձʾûмɫ.
+     * @param defines  { "USE_NORMAL_MAP", "MAX_LIGHTS 8" }.
+     */
+    Shader(const std::string& vertexPath, const std::string& fragmentPath,
+        const std::string& geometryPath, const std::vector<std::string>& defines);
+
+    // 캯 - ɫ (Ҫ GL 4.3)
+    explicit Shader(const std::string& computePath);
+
     // 
     ~Shader();
 
@@ -32,19 +77,51 @@ public:
     // ɫǷЧ
     bool isValid() const { return m_programID != 0; }
 
+    // ǷΪɫ
+    bool isCompute() const { return !m_computePath.empty(); }
+
+    // ȼɫ ( use)
+    void dispatch(GLuint groupsX, GLuint groupsY = 1, GLuint groupsZ = 1) const;
+
     // Uniformú - Ż
     void setBool(const std::string& name, bool value);
     void setInt(const std::string& name, int value);
+    void setUInt(const std::string& name, unsigned int value);
     void setFloat(const std::string& name, float value);
     void setVec2(const std::string& name, const glm::vec2& value);
     void setVec3(const std::string& name, const glm::vec3& value);
     void setVec4(const std::string& name, const glm::vec4& value);
+    void setIVec2(const std::string& name, const glm::ivec2& value);
     void setMat3(const std::string& name, const glm::mat3& mat);
     void setMat4(const std::string& name, const glm::mat4& mat);
 
     // öint (Ԫ)
     void setIntArray(const std::string& name, const int* values, size_t count);
 
+    //  vec4  (׶ƽ)
+    void setVec4Array(const std::string& name, const glm::vec4* values, size_t count);
+
+    // Ϣ
+    const std::vector<SamplerBinding>& getSamplers() const { return m_samplers; }
+    const std::vector<UniformBlock>& getUniformBlocks() const { return m_uniformBlocks; }
+
+    // ӦԪ,  (򱻱Ż) ʱ -1
+    GLint getSamplerUnit(const std::string& name) const;
+    const UniformBlock* findUniformBlock(const std::string& name) const;
+
+    // ÿγɹ () һ, ĶݴжǷҪ½
+    uint32_t getLinkVersion() const { return m_linkVersion; }
+
+    const std::vector<std::string>& getDefines() const { return m_defines; }
+
+    /**
+     * @brief ȡɫԴ벢չ #include "xxx.glsl" (ڵǰļĿ¼, Ƕ).
+     * ͬһļֻչһ, ѭѭ.  GL, ߺ決Ҳռ.
+     * @param dependencies ǿʱ׷бļ· (չ˳)
+     * @throws std::runtime_error ļ򱻰ļȡʧʱ׳
+     */
+    static std::string preprocess(const std::string& path, std::vector<std::string>* dependencies = nullptr);
+
     // ع (ʱǳ)
     bool reload();
 
@@ -58,6 +135,13 @@ private:
     std::string m_vertexPath;
     std::string m_fragmentPath;
     std::string m_geometryPath;
+    std::string m_computePath;
+    std::vector<std::string> m_defines;
+
+    // Ϣ
+    std::vector<SamplerBinding> m_samplers;
+    std::vector<UniformBlock> m_uniformBlocks;
+    uint32_t m_linkVersion = 0;
 
     // Uniform location,ظѯ
     mutable std::unordered_map<std::string, GLint> m_uniformLocationCache;
@@ -65,6 +149,7 @@ private:
     // ڲ
     GLuint compileShader(const std::string& source, GLenum type, const std::string& typeName);
     GLuint linkProgram(GLuint vertexShader, GLuint fragmentShader, GLuint geometryShader = 0);
+    GLuint linkComputeProgram(GLuint computeShader);
     std::string readFile(const std::string& filepath);
     void checkCompileErrors(GLuint shader, const std::string& type);
     void checkLinkErrors(GLuint program);
@@ -76,6 +161,9 @@ private:
     void initFromFiles(const std::string& vertexPath,
         const std::string& fragmentPath,
         const std::string& geometryPath = "");
+    void initCompute(const std::string& computePath);
+    std::string injectDefines(const std::string& source) const;
+    void reflect();
 };
 
 // ָͱ
@@ -1,4 +1,9 @@
 #include "Texture.h"
+#include "GLStateCache.h"
+#include "SamplerCache.h"
+#include "AssetFileSystem.h"
+#include <cstring>
+#include <fstream>
 #include <iostream>
 
 // ע: STB_IMAGE_IMPLEMENTATION Ӧֻһ .cpp ļж
@@ -16,20 +21,27 @@ Texture::Texture(const std::string& path, const Parameters& params, Type type)
     loadFromFile(path, params);
 }
 
+Texture::Texture(const Image& image) {
+    upload(image, Parameters());
+}
+
+Texture::Texture(const Image& image, const Parameters& params)
+    : m_params(params) {
+    upload(image, params);
+}
+
 Texture::Texture(int width, int height, GLenum internalFormat, GLenum format,
     GLenum dataType, const void* data)
     : m_width(width), m_height(height) {
 
     glGenTextures(1, &m_textureID);
-    glBindTexture(GL_TEXTURE_2D, m_textureID);
+    GLStateCache::getInstance().bindTextureOnActiveUnit(GL_TEXTURE_2D, m_textureID);
 
     glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0,
         format, dataType, data);
 
     // Ĭϲ
-    setupTextureParameters(Parameters());
-
-    glBindTexture(GL_TEXTURE_2D, 0);
+    setupTextureParameters(m_params);
 }
 
 Texture::Texture(const std::string faces[6])
@@ -40,13 +52,14 @@ Texture::Texture(const std::string faces[6])
 // =====  =====
 Texture::~Texture() {
     if (m_textureID != 0) {
-        glDeleteTextures(1, &m_textureID);
+        GLStateCache::getInstance().deleteTexture(m_textureID);
     }
 }
 
 // ===== ƶ͸ֵ =====
 Texture::Texture(Texture&& other) noexcept
     : m_textureID(other.m_textureID),
+    m_sampler(other.m_sampler),
     m_type(other.m_type),
     m_path(std::move(other.m_path)),
     m_params(other.m_params),
@@ -60,11 +73,12 @@ Texture& Texture::operator=(Texture&& other) noexcept {
     if (this != &other) {
         // ͷŵǰԴ
         if (m_textureID != 0) {
-            glDeleteTextures(1, &m_textureID);
+            GLStateCache::getInstance().deleteTexture(m_textureID);
         }
 
         // ƶԴ
         m_textureID = other.m_textureID;
+        m_sampler = other.m_sampler;
         m_type = other.m_type;
         m_path = std::move(other.m_path);
         m_params = other.m_params;
@@ -79,21 +93,26 @@ Texture& Texture::operator=(Texture&& other) noexcept {
 
 // ===== 󶨺ͽ =====
 void Texture::bind(unsigned int unit) const {
-    glActiveTexture(GL_TEXTURE0 + unit);
-    glBindTexture(getTextureTarget(), m_textureID);
+    GLStateCache& state = GLStateCache::getInstance();
+    state.bindTexture(unit, getTextureTarget(), m_textureID);
+    state.bindSampler(unit, m_sampler);
 }
 
 void Texture::unbind() const {
-    glBindTexture(getTextureTarget(), 0);
+    GLStateCache::getInstance().bindTextureOnActiveUnit(getTextureTarget(), 0);
 }
 
 // =====  =====
 void Texture::updateData(int xOffset, int yOffset, int width, int height,
     GLenum format, GLenum dataType, const void* data) {
-    glBindTexture(GL_TEXTURE_2D, m_textureID);
+    // GL 4.5 ֱӰ޸ (DSA), κԪİ
+    if (GLAD_GL_VERSION_4_5) {
+        glTextureSubImage2D(m_textureID, 0, xOffset, yOffset, width, height, format, dataType, data);
+        return;
+    }
+    GLStateCache::getInstance().bindTextureOnActiveUnit(GL_TEXTURE_2D, m_textureID);
     glTexSubImage2D(GL_TEXTURE_2D, 0, xOffset, yOffset, width, height,
         format, dataType, data);
-    glBindTexture(GL_TEXTURE_2D, 0);
 }
 
 // ===== ¼ =====
@@ -107,7 +126,7 @@ bool Texture::reload() {
 
     // ɾ
     if (m_textureID != 0) {
-        glDeleteTextures(1, &m_textureID);
+        GLStateCache::getInstance().deleteTexture(m_textureID);
         m_textureID = 0;
     }
 
@@ -131,40 +150,143 @@ bool Texture::reload() {
 
 // =====  Mipmaps =====
 void Texture::generateMipmaps() {
-    glBindTexture(getTextureTarget(), m_textureID);
+    if (GLAD_GL_VERSION_4_5) {
+        glGenerateTextureMipmap(m_textureID);
+        return;
+    }
+    GLStateCache::getInstance().bindTextureOnActiveUnit(getTextureTarget(), m_textureID);
     glGenerateMipmap(getTextureTarget());
-    glBindTexture(getTextureTarget(), 0);
 }
 
 // =====  =====
 void Texture::setParameter(GLenum param, GLint value) {
-    glBindTexture(getTextureTarget(), m_textureID);
-    glTexParameteri(getTextureTarget(), param, value);
-    glBindTexture(getTextureTarget(), 0);
+    if (GLAD_GL_VERSION_4_5) {
+        glTextureParameteri(m_textureID, param, value);
+    }
+    else {
+        GLStateCache::getInstance().bindTextureOnActiveUnit(getTextureTarget(), m_textureID);
+        glTexParameteri(getTextureTarget(), param, value);
+    }
+
+    // ʱ, صĲҪͬȥ
+    GLenum* field = nullptr;
+    switch (param) {
+    case GL_TEXTURE_WRAP_S: field = &m_params.wrapS; break;
+    case GL_TEXTURE_WRAP_T: field = &m_params.wrapT; break;
+    case GL_TEXTURE_WRAP_R: field = &m_params.wrapR; break;
+    case GL_TEXTURE_MIN_FILTER: field = &m_params.minFilter; break;
+    case GL_TEXTURE_MAG_FILTER: field = &m_params.magFilter; break;
+    default: break;
+    }
+    if (field) {
+        *field = static_cast<GLenum>(value);
+        updateSampler();
+    }
 }
 
 void Texture::setParameter(GLenum param, GLfloat value) {
-    glBindTexture(getTextureTarget(), m_textureID);
-    glTexParameterf(getTextureTarget(), param, value);
-    glBindTexture(getTextureTarget(), 0);
+    if (GLAD_GL_VERSION_4_5) {
+        glTextureParameterf(m_textureID, param, value);
+    }
+    else {
+        GLStateCache::getInstance().bindTextureOnActiveUnit(getTextureTarget(), m_textureID);
+        glTexParameterf(getTextureTarget(), param, value);
+    }
+
+    if (param == GL_TEXTURE_MAX_ANISOTROPY_EXT) {
+        m_params.anisotropy = value;
+        updateSampler();
+    }
 }
 
 // ===== ˽и =====
-void Texture::loadFromFile(const std::string& path, const Parameters& params) {
-    //  stb_image ת
-    stbi_set_flip_vertically_on_load(params.flipVertically);
-
-    // ͼƬ
-    unsigned char* data = stbi_load(path.c_str(), &m_width, &m_height, &m_channels, 0);
+Texture::Image Texture::decode(const std::string& path, bool flipVertically) {
+    // ת־ֻڵǰ߳, ߳̿ͬʱ
+    stbi_set_flip_vertically_on_load_thread(flipVertically);
+
+    // δѹͼƬֱӴӳڴ
+    AssetData file = AssetFileSystem::getInstance().read(path);
+    Image image;
+
+    CookedHeader header;
+    if (file.size() >= sizeof(header) && std::memcmp(file.data(), &kCookedMagic, sizeof(kCookedMagic)) == 0) {
+        std::memcpy(&header, file.data(), sizeof(header));
+        size_t rowSize = static_cast<size_t>(header.width) * header.channels;
+        if (header.version != kCookedVersion || header.width <= 0 || header.height <= 0
+            || header.channels < 1 || header.channels > 4
+            || file.size() - sizeof(header) < rowSize * header.height) {
+            throw std::runtime_error("ERROR::TEXTURE: Invalid cooked texture: " + path);
+        }
+        image.width = header.width;
+        image.height = header.height;
+        image.channels = header.channels;
+
+        //  AssetData Ȩ, ָָļͷ֮
+        auto holder = std::make_shared<AssetData>(std::move(file));
+        const uint8_t* pixels = holder->data() + sizeof(header);
+        if ((header.flipped != 0) == flipVertically) {
+            image.pixels = std::shared_ptr<unsigned char>(holder, const_cast<unsigned char*>(pixels));
+        }
+        else {
+            std::shared_ptr<unsigned char> flippedPixels(new unsigned char[rowSize * image.height],
+                std::default_delete<unsigned char[]>());
+            for (int y = 0; y < image.height; ++y) {
+                std::memcpy(flippedPixels.get() + rowSize * y, pixels + rowSize * (image.height - 1 - y), rowSize);
+            }
+            image.pixels = std::move(flippedPixels);
+        }
+        return image;
+    }
 
+    unsigned char* data = stbi_load_from_memory(file.data(), static_cast<int>(file.size()),
+        &image.width, &image.height, &image.channels, 0);
     if (!data) {
         std::string error = "ERROR::TEXTURE: Failed to load texture: " + path;
         throw std::runtime_error(error);
     }
+    image.pixels.reset(data, [](unsigned char* pixels) { stbi_image_free(pixels); });
+    return image;
+}
+
+void Texture::writeCooked(const std::string& path, const Image& image, bool flipped) {
+    if (!image.pixels) {
+        throw std::runtime_error("ERROR::TEXTURE: Cannot write an empty image");
+    }
+    CookedHeader header = {};
+    header.magic = kCookedMagic;
+    header.version = kCookedVersion;
+    header.width = image.width;
+    header.height = image.height;
+    header.channels = image.channels;
+    header.flipped = flipped ? 1 : 0;
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(image.pixels.get()),
+        static_cast<std::streamsize>(image.width) * image.height * image.channels);
+    if (!file) {
+        throw std::runtime_error("ERROR::TEXTURE: Failed to write cooked texture: " + path);
+    }
+}
+
+void Texture::loadFromFile(const std::string& path, const Parameters& params) {
+    upload(decode(path, params.flipVertically), params);
+
+    std::cout << "SUCCESS::TEXTURE: Loaded texture '" << path << "' ("
+        << m_width << "x" << m_height << ", " << m_channels << " channels)" << std::endl;
+}
+
+void Texture::upload(const Image& image, const Parameters& params) {
+    if (!image.pixels) {
+        throw std::runtime_error("ERROR::TEXTURE: Cannot upload an empty image");
+    }
+    m_width = image.width;
+    m_height = image.height;
+    m_channels = image.channels;
 
     // 
     glGenTextures(1, &m_textureID);
-    glBindTexture(GL_TEXTURE_2D, m_textureID);
+    GLStateCache::getInstance().bindTextureOnActiveUnit(GL_TEXTURE_2D, m_textureID);
 
     // ͨȷʽ
     GLenum internalFormat = getInternalFormat(m_channels, params.sRGB);
@@ -172,7 +294,7 @@ void Texture::loadFromFile(const std::string& path, const Parameters& params) {
 
     // ϴ
     glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, m_width, m_height, 0,
-        format, GL_UNSIGNED_BYTE, data);
+        format, GL_UNSIGNED_BYTE, image.pixels.get());
 
     //  Mipmaps
     if (params.generateMipmaps) {
@@ -181,25 +303,19 @@ void Texture::loadFromFile(const std::string& path, const Parameters& params) {
 
     // 
     setupTextureParameters(params);
-
-    glBindTexture(GL_TEXTURE_2D, 0);
-
-    // ͷͼƬڴ
-    stbi_image_free(data);
-
-    std::cout << "SUCCESS::TEXTURE: Loaded texture '" << path << "' ("
-        << m_width << "x" << m_height << ", " << m_channels << " channels)" << std::endl;
 }
 
 void Texture::loadCubemap(const std::string faces[6]) {
     glGenTextures(1, &m_textureID);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, m_textureID);
+    GLStateCache::getInstance().bindTextureOnActiveUnit(GL_TEXTURE_CUBE_MAP, m_textureID);
 
-    stbi_set_flip_vertically_on_load(false);  // ͼͨת
+    stbi_set_flip_vertically_on_load_thread(false);  // ͼͨת
 
     for (unsigned int i = 0; i < 6; i++) {
         int width, height, channels;
-        unsigned char* data = stbi_load(faces[i].c_str(), &width, &height, &channels, 0);
+        AssetData file = AssetFileSystem::getInstance().read(faces[i]);
+        unsigned char* data = stbi_load_from_memory(file.data(), static_cast<int>(file.size()),
+            &width, &height, &channels, 0);
 
         if (data) {
             GLenum format = getFormat(channels);
@@ -229,7 +345,9 @@ void Texture::loadCubemap(const std::string faces[6]) {
     glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
 
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    m_params.wrapS = m_params.wrapT = m_params.wrapR = GL_CLAMP_TO_EDGE;
+    m_params.minFilter = m_params.magFilter = GL_LINEAR;
+    updateSampler();
 
     std::cout << "SUCCESS::TEXTURE: Loaded cubemap texture" << std::endl;
 }
@@ -255,6 +373,13 @@ void Texture::setupTextureParameters(const Parameters& params) {
         float anisotropy = std::min(params.anisotropy, maxAnisotropy);
         glTexParameterf(target, GL_TEXTURE_MAX_ANISOTROPY_EXT, anisotropy);
     }
+
+    // ĲֻǺ, ʱԹĲΪ׼
+    updateSampler();
+}
+
+void Texture::updateSampler() {
+    m_sampler = SamplerCache::getInstance().getSampler(m_params);
 }
 
 GLenum Texture::getInternalFormat(int channels, bool sRGB) const {
@@ -2,6 +2,7 @@
 #define TEXTURE_H
 
 #include <glad/glad.h>
+#include <cstdint>
 #include <string>
 #include <memory>
 
@@ -28,10 +29,50 @@ public:
         float anisotropy = 0.0f;  // 0 ʾʹ
     };
 
+    // ͼƬ (CPU ڴ), ̲߳, ٽ GL ߳ϴ
+    struct Image {
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+        std::shared_ptr<unsigned char> pixels;  // stbi_image_free ͷ, ú決ļӳ
+    };
+
+    // 決ļ: CookedHeader + е 8 λ ( flipped ).
+    // AssetCooker ʱԴļ, ʱ·ø, decode ļͷʶ
+    static constexpr uint32_t kCookedMagic = 0x58455447;  // "GTEX"
+    static constexpr uint32_t kCookedVersion = 1;
+
+    struct CookedHeader {
+        uint32_t magic;
+        uint32_t version;
+        int32_t width;
+        int32_t height;
+        int32_t channels;
+        uint32_t flipped;
+        uint32_t reserved[2];
+    };
+
+    /**
+     * @brief ͼƬļ,  GL, ϵͳĹ߳ϲִ.
+     * 決ٽ, ֱӳڴ (תһʱſ).
+     * @throws std::runtime_error ʧʱ׳
+     */
+    static Image decode(const std::string& path, bool flipVertically = true);
+
+    /**
+     * @brief ѽͼƬдɺ決ʽ.
+     * @throws std::runtime_error дļʧʱ׳
+     */
+    static void writeCooked(const std::string& path, const Image& image, bool flipped);
+
     // 캯 - ļ
     Texture(const std::string& path, Type type = Type::Texture2D);
     Texture(const std::string& path, const Parameters& params, Type type = Type::Texture2D);
 
+    // 캯 - ѽͼƬϴ (GL ߳)
+    explicit Texture(const Image& image);
+    Texture(const Image& image, const Parameters& params);
+
     // 캯 - ڴݴ
     Texture(int width, int height, GLenum internalFormat, GLenum format,
         GLenum dataType, const void* data = nullptr);
@@ -48,7 +89,7 @@ public:
     Texture(Texture&& other) noexcept;
     Texture& operator=(Texture&& other) noexcept;
 
-    // ָԪ
+    // ָԪ, ͬʱ󶨹Ĳ
     void bind(unsigned int unit = 0) const;
 
     // 
@@ -60,6 +101,9 @@ public:
     // ǷЧ
     bool isValid() const { return m_textureID != 0; }
 
+    //  (SamplerCache )
+    GLuint getSampler() const { return m_sampler; }
+
     // ȡϢ
     int getWidth() const { return m_width; }
     int getHeight() const { return m_height; }
@@ -76,12 +120,13 @@ public:
     //  Mipmap
     void generateMipmaps();
 
-    // 
+    // . ơԻͬ
     void setParameter(GLenum param, GLint value);
     void setParameter(GLenum param, GLfloat value);
 
 private:
     GLuint m_textureID = 0;
+    GLuint m_sampler = 0;  //  SamplerCache 
     Type m_type = Type::Texture2D;
     std::string m_path;  // ·
     Parameters m_params;
@@ -93,8 +138,10 @@ private:
 
     // ڲ
     void loadFromFile(const std::string& path, const Parameters& params);
+    void upload(const Image& image, const Parameters& params);
     void loadCubemap(const std::string faces[6]);
     void setupTextureParameters(const Parameters& params);
+    void updateSampler();
     GLenum getInternalFormat(int channels, bool sRGB) const;
     GLenum getFormat(int channels) const;
     GLenum getTextureTarget() const;